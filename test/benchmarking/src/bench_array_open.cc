@@ -0,0 +1,119 @@
+/**
+ * @file   bench_array_open.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Benchmark opening a sparse array for reads with many fragments, which is
+ * dominated by listing the array directories and loading the fragment
+ * footers. The number of fragments is read from the
+ * `TILEDB_BENCH_FRAGMENT_NUM` environment variable (default 1000), so the
+ * benchmark can be run for arrays of 10 to 10,000 fragments.
+ */
+
+#include <tiledb/tiledb>
+
+#include <cstdlib>
+#include <string>
+
+#include "benchmark.h"
+
+using namespace tiledb;
+
+class Benchmark : public BenchmarkBase {
+ public:
+  Benchmark() {
+    const char* fragment_num = std::getenv("TILEDB_BENCH_FRAGMENT_NUM");
+    if (fragment_num != nullptr)
+      fragment_num_ = std::stoull(fragment_num);
+  }
+
+ protected:
+  virtual void setup() {
+    ArraySchema schema(ctx_, TILEDB_SPARSE);
+    Domain domain(ctx_);
+    domain.add_dimension(
+        Dimension::create<int64_t>(ctx_, "d1", {{0, 1000000000}}, 1000));
+    domain.add_dimension(
+        Dimension::create<int64_t>(ctx_, "d2", {{0, 1000000000}}, 1000));
+    schema.set_domain(domain);
+    schema.add_attribute(Attribute::create<int32_t>(ctx_, "a"));
+    schema.add_attribute(Attribute::create<double>(ctx_, "b"));
+    Array::create(array_uri_, schema);
+
+    // Write one small fragment at a time
+    std::vector<int64_t> d1(cells_per_fragment), d2(cells_per_fragment);
+    std::vector<int32_t> a(cells_per_fragment);
+    std::vector<double> b(cells_per_fragment);
+    Array array(ctx_, array_uri_, TILEDB_WRITE);
+    for (uint64_t f = 0; f < fragment_num_; f++) {
+      for (uint64_t i = 0; i < cells_per_fragment; i++) {
+        d1[i] = f * cells_per_fragment + i;
+        d2[i] = i;
+        a[i] = static_cast<int32_t>(i);
+        b[i] = static_cast<double>(f);
+      }
+      Query query(ctx_, array);
+      query.set_layout(TILEDB_GLOBAL_ORDER)
+          .set_data_buffer("d1", d1)
+          .set_data_buffer("d2", d2)
+          .set_data_buffer("a", a)
+          .set_data_buffer("b", b);
+      query.submit();
+      query.finalize();
+    }
+    array.close();
+  }
+
+  virtual void teardown() {
+    VFS vfs(ctx_);
+    if (vfs.is_dir(array_uri_))
+      vfs.remove_dir(array_uri_);
+  }
+
+  virtual void pre_run() {
+  }
+
+  virtual void run() {
+    for (unsigned i = 0; i < open_num; i++) {
+      Array array(ctx_, array_uri_, TILEDB_READ);
+      array.close();
+    }
+  }
+
+ private:
+  const std::string array_uri_ = "bench_array";
+  const uint64_t cells_per_fragment = 10;
+  const unsigned open_num = 10;
+  uint64_t fragment_num_ = 1000;
+
+  Context ctx_;
+};
+
+int main(int argc, char** argv) {
+  Benchmark bench;
+  return bench.main(argc, argv);
+}
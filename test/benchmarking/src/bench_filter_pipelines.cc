@@ -0,0 +1,174 @@
+/**
+ * @file   bench_filter_pipelines.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Benchmark writing and reading a dense attribute through each of several
+ * filter pipelines over the existing filters, one array per pipeline. The
+ * run prints the write and read time of each pipeline to stderr, to
+ * compare the forward and reverse cost of the pipelines across builds.
+ */
+
+#include <tiledb/tiledb>
+
+#include <array>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark.h"
+
+using namespace tiledb;
+
+class Benchmark : public BenchmarkBase {
+ protected:
+  virtual void setup() {
+    for (const auto& pipeline : pipelines_)
+      create_array(pipeline.first, pipeline.second);
+  }
+
+  virtual void teardown() {
+    VFS vfs(ctx_);
+    for (const auto& pipeline : pipelines_) {
+      if (vfs.is_dir(pipeline.first))
+        vfs.remove_dir(pipeline.first);
+    }
+  }
+
+  virtual void pre_run() {
+    // Start every run from empty arrays.
+    teardown();
+    setup();
+
+    // Squares increase, and so do their deltas within each delta window,
+    // which makes the data valid for one or two positive delta filters.
+    data_.resize(array_rows);
+    for (uint64_t i = 0; i < data_.size(); i++)
+      data_[i] = (int64_t)(i * i);
+    read_data_.resize(array_rows);
+  }
+
+  virtual void run() {
+    for (const auto& pipeline : pipelines_) {
+      const std::string& array_uri = pipeline.first;
+      std::array<uint64_t, 2> subarray = {1ul, array_rows};
+
+      auto t0 = std::chrono::steady_clock::now();
+      {
+        Array array(ctx_, array_uri, TILEDB_WRITE);
+        Query query(ctx_, array, TILEDB_WRITE);
+        query.set_subarray({subarray})
+            .set_layout(TILEDB_ROW_MAJOR)
+            .set_data_buffer("a", data_);
+        query.submit();
+        array.close();
+      }
+
+      auto t1 = std::chrono::steady_clock::now();
+      {
+        Array array(ctx_, array_uri, TILEDB_READ);
+        Query query(ctx_, array);
+        query.set_subarray({subarray})
+            .set_layout(TILEDB_ROW_MAJOR)
+            .set_data_buffer("a", read_data_);
+        query.submit();
+        array.close();
+      }
+      auto t2 = std::chrono::steady_clock::now();
+
+      std::cerr << "{ \"pipeline\": \"" << array_uri << "\", \"write_ms\": "
+                << ms(t0, t1) << ", \"read_ms\": " << ms(t1, t2) << " }"
+                << std::endl;
+    }
+  }
+
+ private:
+  const uint64_t array_rows = 50000000;
+  const uint64_t tile_rows = 1000000;
+
+  /** The array URI and filters of each benchmarked pipeline. */
+  const std::vector<std::pair<std::string, std::vector<tiledb_filter_type_t>>>
+      pipelines_ = {
+          {"bench_array_none", {}},
+          {"bench_array_zstd", {TILEDB_FILTER_ZSTD}},
+          {"bench_array_byteshuffle_zstd",
+           {TILEDB_FILTER_BYTESHUFFLE, TILEDB_FILTER_ZSTD}},
+          {"bench_array_bitshuffle_lz4",
+           {TILEDB_FILTER_BITSHUFFLE, TILEDB_FILTER_LZ4}},
+          {"bench_array_delta_bwr",
+           {TILEDB_FILTER_POSITIVE_DELTA, TILEDB_FILTER_BIT_WIDTH_REDUCTION}},
+          {"bench_array_delta_bwr_zstd",
+           {TILEDB_FILTER_POSITIVE_DELTA,
+            TILEDB_FILTER_BIT_WIDTH_REDUCTION,
+            TILEDB_FILTER_ZSTD}},
+          {"bench_array_delta_byteshuffle_zstd",
+           {TILEDB_FILTER_POSITIVE_DELTA,
+            TILEDB_FILTER_BYTESHUFFLE,
+            TILEDB_FILTER_ZSTD}},
+          {"bench_array_delta_delta_lz4",
+           {TILEDB_FILTER_POSITIVE_DELTA,
+            TILEDB_FILTER_POSITIVE_DELTA,
+            TILEDB_FILTER_LZ4}},
+          {"bench_array_byteshuffle_md5_lz4",
+           {TILEDB_FILTER_BYTESHUFFLE,
+            TILEDB_FILTER_CHECKSUM_MD5,
+            TILEDB_FILTER_LZ4}},
+  };
+
+  Context ctx_;
+  std::vector<int64_t> data_;
+  std::vector<int64_t> read_data_;
+
+  void create_array(
+      const std::string& array_uri,
+      const std::vector<tiledb_filter_type_t>& filter_types) {
+    ArraySchema schema(ctx_, TILEDB_DENSE);
+    Domain domain(ctx_);
+    domain.add_dimension(
+        Dimension::create<uint64_t>(ctx_, "d1", {{1, array_rows}}, tile_rows));
+    schema.set_domain(domain);
+    FilterList filters(ctx_);
+    for (auto filter_type : filter_types)
+      filters.add_filter({ctx_, filter_type});
+    schema.add_attribute(Attribute::create<int64_t>(ctx_, "a", filters));
+    Array::create(array_uri, schema);
+  }
+
+  static uint64_t ms(
+      std::chrono::steady_clock::time_point t0,
+      std::chrono::steady_clock::time_point t1) {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0)
+        .count();
+  }
+};
+
+int main(int argc, char** argv) {
+  Benchmark bench;
+  return bench.main(argc, argv);
+}
@@ -36,6 +36,18 @@
 
 using namespace tiledb;
 
+/**
+ * Returns the context config. The `bench_large_io_uring` variant of this
+ * benchmark reads local files with io_uring.
+ */
+static Config bench_config() {
+  Config config;
+#ifdef BENCH_IO_URING
+  config["vfs.file.io_uring"] = "true";
+#endif
+  return config;
+}
+
 class Benchmark : public BenchmarkBase {
  protected:
   virtual void setup() {
@@ -183,7 +195,7 @@ class Benchmark : public BenchmarkBase {
   const unsigned sparse_max_row = 12000, sparse_max_col = 12000;
   const unsigned tile_rows = 2000, tile_cols = 2000;
 
-  Context ctx_;
+  Context ctx_{bench_config()};
 
   std::vector<int> data_a_;
   std::vector<int> data_b_;
@@ -0,0 +1,129 @@
+/**
+ * @file   bench_sparse_multi_attribute_filtering.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Benchmarks a multi-clause query condition over an int32 and a float64
+ * attribute of a sparse array, exercising the vectorized evaluation of
+ * fixed-size attribute tiles in the sparse readers.
+ */
+
+#include <tiledb/tiledb>
+
+#include "benchmark.h"
+
+using namespace tiledb;
+
+class Benchmark : public BenchmarkBase {
+ protected:
+  virtual void setup() {
+    ArraySchema schema(ctx_, TILEDB_SPARSE);
+    Domain domain(ctx_);
+    domain.add_dimension(
+        Dimension::create<uint64_t>(ctx_, "d1", {{1, array_rows}}, tile_rows));
+    schema.set_domain(domain);
+    schema.set_capacity(capacity);
+    FilterList filters(ctx_);
+    schema.add_attribute(Attribute::create<int32_t>(ctx_, "a", filters));
+    schema.add_attribute(Attribute::create<double>(ctx_, "b", filters));
+    Array::create(array_uri_, schema);
+
+    coords_.resize(array_rows);
+    data_a_.resize(array_rows);
+    data_b_.resize(array_rows);
+    for (uint64_t i = 0; i < array_rows; i++) {
+      coords_[i] = i + 1;
+      data_a_[i] = i;
+      data_b_[i] = static_cast<double>(array_rows - i);
+    }
+
+    Array array(ctx_, array_uri_, TILEDB_WRITE);
+    Query query(ctx_, array, TILEDB_WRITE);
+    query.set_layout(TILEDB_GLOBAL_ORDER)
+        .set_data_buffer("d1", coords_)
+        .set_data_buffer("a", data_a_)
+        .set_data_buffer("b", data_b_);
+    query.submit();
+    query.finalize();
+    array.close();
+  }
+
+  virtual void teardown() {
+    VFS vfs(ctx_);
+    if (vfs.is_dir(array_uri_))
+      vfs.remove_dir(array_uri_);
+  }
+
+  virtual void pre_run() {
+    coords_.resize(array_rows);
+    data_a_.resize(array_rows);
+    data_b_.resize(array_rows);
+  }
+
+  virtual void run() {
+    Array array(ctx_, array_uri_, TILEDB_READ);
+    Query query(ctx_, array);
+
+    // (a < rows / 2 AND b > rows / 4) OR a >= rows - 1000
+    const int32_t a_half = array_rows / 2;
+    const double b_quarter = array_rows / 4.0;
+    const int32_t a_tail = array_rows - 1000;
+    QueryCondition qc1 = QueryCondition::create(ctx_, "a", a_half, TILEDB_LT);
+    QueryCondition qc2 =
+        QueryCondition::create(ctx_, "b", b_quarter, TILEDB_GT);
+    QueryCondition qc3 = QueryCondition::create(ctx_, "a", a_tail, TILEDB_GE);
+    QueryCondition condition =
+        qc1.combine(qc2, TILEDB_AND).combine(qc3, TILEDB_OR);
+
+    query.set_layout(TILEDB_UNORDERED)
+        .set_condition(condition)
+        .set_data_buffer("d1", coords_)
+        .set_data_buffer("a", data_a_)
+        .set_data_buffer("b", data_b_);
+    do {
+      query.submit();
+    } while (query.query_status() == Query::Status::INCOMPLETE);
+    array.close();
+  }
+
+ private:
+  const std::string array_uri_ = "bench_array";
+
+  const uint64_t array_rows = 100000000;
+  const uint64_t tile_rows = 100000;
+  const uint64_t capacity = 100000;
+
+  Context ctx_;
+  std::vector<uint64_t> coords_;
+  std::vector<int32_t> data_a_;
+  std::vector<double> data_b_;
+};
+
+int main(int argc, char** argv) {
+  Benchmark bench;
+  return bench.main(argc, argv);
+}
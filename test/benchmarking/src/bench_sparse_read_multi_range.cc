@@ -0,0 +1,128 @@
+/**
+ * @file   bench_sparse_read_multi_range.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Benchmark sparse 2D reads with many ranges per dimension over a fragment
+ * with a small data tile capacity, which stresses the computation of the
+ * tile overlap on the fragment R-tree.
+ */
+
+#include <tiledb/tiledb>
+
+#include "benchmark.h"
+
+using namespace tiledb;
+
+class Benchmark : public BenchmarkBase {
+ protected:
+  virtual void setup() {
+    ArraySchema schema(ctx_, TILEDB_SPARSE);
+    Domain domain(ctx_);
+    domain.add_dimension(
+        Dimension::create<uint32_t>(ctx_, "d1", {{1, max_row}}, tile_rows));
+    domain.add_dimension(
+        Dimension::create<uint32_t>(ctx_, "d2", {{1, max_col}}, tile_cols));
+    schema.set_domain(domain);
+    schema.set_capacity(capacity);
+    schema.add_attribute(Attribute::create<int32_t>(ctx_, "a"));
+    Array::create(array_uri_, schema);
+
+    // Make the data "sparse" by skipping a few cells between each
+    // nonempty cell.
+    const unsigned skip = 2;
+    std::vector<uint32_t> d1, d2;
+    for (uint32_t i = 1; i < max_row; i += skip) {
+      for (uint32_t j = 1; j < max_col; j += skip) {
+        d1.push_back(i);
+        d2.push_back(j);
+      }
+    }
+
+    data_.resize(d1.size());
+    for (uint64_t i = 0; i < data_.size(); i++)
+      data_[i] = i;
+
+    Array array(ctx_, array_uri_, TILEDB_WRITE);
+    Query query(ctx_, array);
+    query.set_layout(TILEDB_UNORDERED)
+        .set_data_buffer("a", data_)
+        .set_data_buffer("d1", d1)
+        .set_data_buffer("d2", d2);
+    query.submit();
+    array.close();
+  }
+
+  virtual void teardown() {
+    VFS vfs(ctx_);
+    if (vfs.is_dir(array_uri_))
+      vfs.remove_dir(array_uri_);
+  }
+
+  virtual void pre_run() {
+    d1_.resize(data_.size());
+    d2_.resize(data_.size());
+  }
+
+  virtual void run() {
+    Array array(ctx_, array_uri_, TILEDB_READ);
+
+    // Add `range_num` short ranges spread over each dimension
+    Subarray subarray(ctx_, array);
+    for (uint32_t r = 0; r < range_num; r++) {
+      uint32_t row = 1 + r * (max_row / range_num);
+      uint32_t col = 1 + r * (max_col / range_num);
+      subarray.add_range<uint32_t>(0, row, row + range_len);
+      subarray.add_range<uint32_t>(1, col, col + range_len);
+    }
+
+    Query query(ctx_, array);
+    query.set_subarray(subarray)
+        .set_layout(TILEDB_UNORDERED)
+        .set_data_buffer("a", data_)
+        .set_data_buffer("d1", d1_)
+        .set_data_buffer("d2", d2_);
+    query.submit();
+    array.close();
+  }
+
+ private:
+  const std::string array_uri_ = "bench_array";
+  const uint32_t tile_rows = 100, tile_cols = 100;
+  const uint32_t capacity = 100;
+  const uint32_t max_row = 2000, max_col = 2000;
+  const uint32_t range_num = 100, range_len = 4;
+
+  Context ctx_;
+  std::vector<int> data_;
+  std::vector<uint32_t> d1_, d2_;
+};
+
+int main(int argc, char** argv) {
+  Benchmark bench;
+  return bench.main(argc, argv);
+}
@@ -0,0 +1,125 @@
+/**
+ * @file   bench_sparse_read_point_ranges.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Benchmark sparse 1D reads of many point ranges (e.g., ID lookups) in
+ * row-major layout, which stresses the computation of the tile overlap when
+ * the ranges far outnumber the fragment tiles. The number of ranges is read
+ * from the `TILEDB_BENCH_RANGE_NUM` environment variable (default 1000), so
+ * the benchmark can be run for 1k to 100k range queries.
+ */
+
+#include <tiledb/tiledb>
+
+#include <cstdlib>
+#include <string>
+
+#include "benchmark.h"
+
+using namespace tiledb;
+
+class Benchmark : public BenchmarkBase {
+ public:
+  Benchmark() {
+    const char* range_num = std::getenv("TILEDB_BENCH_RANGE_NUM");
+    if (range_num != nullptr)
+      range_num_ = std::stoull(range_num);
+  }
+
+ protected:
+  virtual void setup() {
+    ArraySchema schema(ctx_, TILEDB_SPARSE);
+    Domain domain(ctx_);
+    domain.add_dimension(Dimension::create<uint64_t>(
+        ctx_, "d1", {{0, cell_num * stride}}, cell_num * stride / 100));
+    schema.set_domain(domain);
+    schema.set_capacity(capacity);
+    schema.add_attribute(Attribute::create<int32_t>(ctx_, "a"));
+    Array::create(array_uri_, schema);
+
+    std::vector<uint64_t> d1(cell_num);
+    std::vector<int32_t> a(cell_num);
+    for (uint64_t i = 0; i < cell_num; i++) {
+      d1[i] = i * stride;
+      a[i] = (int32_t)i;
+    }
+
+    Array array(ctx_, array_uri_, TILEDB_WRITE);
+    Query query(ctx_, array);
+    query.set_layout(TILEDB_UNORDERED)
+        .set_data_buffer("a", a)
+        .set_data_buffer("d1", d1);
+    query.submit();
+    array.close();
+  }
+
+  virtual void teardown() {
+    VFS vfs(ctx_);
+    if (vfs.is_dir(array_uri_))
+      vfs.remove_dir(array_uri_);
+  }
+
+  virtual void pre_run() {
+    data_.resize(range_num_);
+    d1_.resize(range_num_);
+  }
+
+  virtual void run() {
+    Array array(ctx_, array_uri_, TILEDB_READ);
+
+    // Look up `range_num_` existing cells in a scattered order
+    Subarray subarray(ctx_, array);
+    for (uint64_t r = 0; r < range_num_; r++) {
+      uint64_t id = ((r * 7919) % cell_num) * stride;
+      subarray.add_range<uint64_t>(0, id, id);
+    }
+
+    Query query(ctx_, array);
+    query.set_subarray(subarray)
+        .set_layout(TILEDB_ROW_MAJOR)
+        .set_data_buffer("a", data_)
+        .set_data_buffer("d1", d1_);
+    query.submit();
+    array.close();
+  }
+
+ private:
+  const std::string array_uri_ = "bench_array";
+  const uint64_t cell_num = 1000000, stride = 10;
+  const uint64_t capacity = 10000;
+
+  uint64_t range_num_ = 1000;
+  Context ctx_;
+  std::vector<int32_t> data_;
+  std::vector<uint64_t> d1_;
+};
+
+int main(int argc, char** argv) {
+  Benchmark bench;
+  return bench.main(argc, argv);
+}
@@ -0,0 +1,105 @@
+/**
+ * @file   bench_sparse_write_unordered.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Benchmark sparse 2D unordered write performance with random int64 and
+ * float64 coordinates, which is dominated by sorting the coordinates.
+ */
+
+#include <tiledb/tiledb>
+
+#include <random>
+
+#include "benchmark.h"
+
+using namespace tiledb;
+
+class Benchmark : public BenchmarkBase {
+ protected:
+  virtual void setup() {
+    ArraySchema schema(ctx_, TILEDB_SPARSE);
+    Domain domain(ctx_);
+    domain.add_dimension(Dimension::create<int64_t>(
+        ctx_, "d1", {{-max_coord, max_coord}}, tile_extent));
+    domain.add_dimension(
+        Dimension::create<double>(ctx_, "d2", {{-1.0, 1.0}}, 0.125));
+    schema.set_domain(domain);
+    schema.set_capacity(capacity);
+    schema.set_allows_dups(true);
+    schema.add_attribute(Attribute::create<int32_t>(ctx_, "a"));
+    Array::create(array_uri_, schema);
+  }
+
+  virtual void teardown() {
+    VFS vfs(ctx_);
+    if (vfs.is_dir(array_uri_))
+      vfs.remove_dir(array_uri_);
+  }
+
+  virtual void pre_run() {
+    std::mt19937_64 gen(0);
+    std::uniform_int_distribution<int64_t> d1_dist(-max_coord, max_coord);
+    std::uniform_real_distribution<double> d2_dist(-1.0, 1.0);
+    d1_.resize(cell_num);
+    d2_.resize(cell_num);
+    data_.resize(cell_num);
+    for (uint64_t i = 0; i < cell_num; i++) {
+      d1_[i] = d1_dist(gen);
+      d2_[i] = d2_dist(gen);
+      data_[i] = i;
+    }
+  }
+
+  virtual void run() {
+    Array array(ctx_, array_uri_, TILEDB_WRITE);
+    Query query(ctx_, array);
+    query.set_layout(TILEDB_UNORDERED)
+        .set_data_buffer("a", data_)
+        .set_data_buffer("d1", d1_)
+        .set_data_buffer("d2", d2_);
+    query.submit();
+    array.close();
+  }
+
+ private:
+  const std::string array_uri_ = "bench_array";
+  const int64_t max_coord = 1000000000;
+  const int64_t tile_extent = 1000000;
+  const unsigned capacity = 100000;
+  const uint64_t cell_num = 20000000;
+
+  Context ctx_;
+  std::vector<int> data_;
+  std::vector<int64_t> d1_;
+  std::vector<double> d2_;
+};
+
+int main(int argc, char** argv) {
+  Benchmark bench;
+  return bench.main(argc, argv);
+}
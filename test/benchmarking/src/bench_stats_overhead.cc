@@ -0,0 +1,124 @@
+/**
+ * @file   bench_stats_overhead.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Benchmark the overhead of the internal statistics on a sparse read of
+ * many small tiles, which updates per-tile stats from the compute and I/O
+ * threads. Run it against builds with `TILEDB_STATS` on and off to
+ * quantify the overhead; the run also dumps the stats when they are on.
+ */
+
+#include <tiledb/tiledb>
+
+#include <string>
+
+#include "benchmark.h"
+
+using namespace tiledb;
+
+class Benchmark : public BenchmarkBase {
+ protected:
+  virtual void setup() {
+    ArraySchema schema(ctx_, TILEDB_SPARSE);
+    Domain domain(ctx_);
+    domain.add_dimension(
+        Dimension::create<uint64_t>(ctx_, "d1", {{0, cell_num - 1}}, 10000));
+    schema.set_domain(domain);
+    schema.set_capacity(capacity);
+    schema.set_allows_dups(true);
+    schema.add_attribute(Attribute::create<int32_t>(ctx_, "a"));
+    schema.add_attribute(Attribute::create<double>(ctx_, "b"));
+    Array::create(array_uri_, schema);
+
+    std::vector<uint64_t> d1(cell_num);
+    std::vector<int32_t> a(cell_num);
+    std::vector<double> b(cell_num);
+    for (uint64_t i = 0; i < cell_num; i++) {
+      d1[i] = i;
+      a[i] = (int32_t)i;
+      b[i] = (double)i;
+    }
+
+    Array array(ctx_, array_uri_, TILEDB_WRITE);
+    Query query(ctx_, array);
+    query.set_layout(TILEDB_UNORDERED)
+        .set_data_buffer("a", a)
+        .set_data_buffer("b", b)
+        .set_data_buffer("d1", d1);
+    query.submit();
+    array.close();
+  }
+
+  virtual void teardown() {
+    VFS vfs(ctx_);
+    if (vfs.is_dir(array_uri_))
+      vfs.remove_dir(array_uri_);
+  }
+
+  virtual void pre_run() {
+    d1_.resize(cell_num);
+    a_.resize(cell_num);
+    b_.resize(cell_num);
+  }
+
+  virtual void run() {
+    Stats::enable();
+    Stats::reset();
+
+    Array array(ctx_, array_uri_, TILEDB_READ);
+    for (unsigned i = 0; i < read_num; i++) {
+      Query query(ctx_, array);
+      query.set_layout(TILEDB_UNORDERED)
+          .set_data_buffer("a", a_)
+          .set_data_buffer("b", b_)
+          .set_data_buffer("d1", d1_);
+      query.submit();
+    }
+    array.close();
+
+    std::string stats;
+    Stats::dump(&stats);
+    Stats::disable();
+  }
+
+ private:
+  const std::string array_uri_ = "bench_array";
+  const uint64_t cell_num = 2000000;
+  const uint64_t capacity = 100;
+  const unsigned read_num = 5;
+
+  Context ctx_;
+  std::vector<uint64_t> d1_;
+  std::vector<int32_t> a_;
+  std::vector<double> b_;
+};
+
+int main(int argc, char** argv) {
+  Benchmark bench;
+  return bench.main(argc, argv);
+}
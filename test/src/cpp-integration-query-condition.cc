@@ -1769,4 +1769,115 @@ TEST_CASE(
   if (vfs.is_dir(array_name)) {
     vfs.remove_dir(array_name);
   }
-}
\ No newline at end of file
+}
+
+TEST_CASE(
+    "Testing read query with QC, pruning tiles with the tile metadata",
+    "[query][query-condition][tile-metadata]") {
+  Context ctx;
+  VFS vfs(ctx);
+
+  if (vfs.is_dir(array_name)) {
+    vfs.remove_dir(array_name);
+  }
+
+  tiledb_array_type_t array_type = TILEDB_SPARSE;
+  tiledb_layout_t layout = TILEDB_GLOBAL_ORDER;
+  bool set_dups = false;
+  SECTION("Dense") {
+    array_type = TILEDB_DENSE;
+    layout = TILEDB_ROW_MAJOR;
+  }
+  SECTION("Sparse, global order") {
+    layout = TILEDB_GLOBAL_ORDER;
+  }
+  SECTION("Sparse with duplicates, global order") {
+    set_dups = true;
+    layout = TILEDB_GLOBAL_ORDER;
+  }
+  SECTION("Sparse with duplicates, unordered") {
+    set_dups = true;
+    layout = TILEDB_UNORDERED;
+  }
+
+  // Create an array with four tiles of ten cells, where each cell value is
+  // its coordinate.
+  Domain domain(ctx);
+  domain.add_dimension(Dimension::create<int>(ctx, "d", {{1, 40}}, 10));
+  ArraySchema schema(ctx, array_type);
+  schema.set_domain(domain);
+  if (array_type == TILEDB_SPARSE) {
+    schema.set_capacity(10);
+    schema.set_allows_dups(set_dups);
+  }
+  schema.add_attribute(Attribute::create<int>(ctx, "a"));
+  Array::create(array_name, schema);
+
+  std::vector<int> d_data(40);
+  std::vector<int> a_data(40);
+  for (int i = 0; i < 40; ++i) {
+    d_data[i] = i + 1;
+    a_data[i] = i + 1;
+  }
+
+  Array array_w(ctx, array_name, TILEDB_WRITE);
+  Query query_w(ctx, array_w);
+  if (array_type == TILEDB_SPARSE) {
+    query_w.set_layout(TILEDB_UNORDERED).set_data_buffer("d", d_data);
+  } else {
+    query_w.set_layout(TILEDB_ROW_MAJOR);
+  }
+  query_w.set_data_buffer("a", a_data);
+  query_w.submit();
+  query_w.finalize();
+  array_w.close();
+
+  // The first two tiles cannot match the condition, the last one fully
+  // matches it.
+  Array array(ctx, array_name, TILEDB_READ);
+  Query query(ctx, array);
+  QueryCondition qc(ctx);
+  int val = 25;
+  qc.init("a", &val, sizeof(int), TILEDB_GT);
+
+  std::vector<int> a_read(40);
+  query.set_layout(layout).set_data_buffer("a", a_read).set_condition(qc);
+  if (array_type == TILEDB_DENSE) {
+    query.add_range("d", 1, 40);
+  }
+  query.submit();
+  CHECK(query.query_status() == Query::Status::COMPLETE);
+
+  // Dense reads return the fill value for the filtered cells.
+  auto table = query.result_buffer_elements();
+  a_read.resize(table["a"].second);
+  std::vector<int> c_a_read;
+  for (int i = 1; i <= 40; ++i) {
+    if (i > 25) {
+      c_a_read.push_back(i);
+    } else if (array_type == TILEDB_DENSE) {
+      c_a_read.push_back(std::numeric_limits<int>::min());
+    }
+  }
+  if (layout == TILEDB_UNORDERED) {
+    std::sort(a_read.begin(), a_read.end());
+  }
+  CHECK(a_read == c_a_read);
+
+  // Check the pruned tiles.
+  auto stats = query.stats();
+  CHECK(
+      stats.find(
+          "\"Context.StorageManager.Query.Reader.qc_tile_pruned_num\": 2") !=
+      std::string::npos);
+  CHECK(
+      stats.find(
+          "\"Context.StorageManager.Query.Reader.qc_tile_full_match_num\": "
+          "1") != std::string::npos);
+
+  array.close();
+
+  if (vfs.is_dir(array_name)) {
+    vfs.remove_dir(array_name);
+  }
+}
@@ -924,4 +924,90 @@ TEST_CASE_METHOD(
       &subarray, 37, 57, 32, 63, {2, 0, 0}, {3, 3, 3});
 
   close_array(ctx_, array_);
-}
\ No newline at end of file
+}
+
+TEST_CASE_METHOD(
+    SubarrayFx,
+    "Subarray: Test tile overlap with more ranges than tiles, sparse 2D",
+    "[Subarray][sparse][2d][tile_overlap]") {
+  uint64_t domain[] = {1, 100};
+  uint64_t tile_extent = 10;
+  create_array(
+      ctx_,
+      array_name_,
+      TILEDB_SPARSE,
+      {"d1", "d2"},
+      {TILEDB_UINT64, TILEDB_UINT64},
+      {domain, domain},
+      {&tile_extent, &tile_extent},
+      {"a"},
+      {TILEDB_INT32},
+      {1},
+      {tiledb::test::Compressor(TILEDB_FILTER_NONE, -1)},
+      TILEDB_ROW_MAJOR,
+      TILEDB_ROW_MAJOR,
+      2);
+
+  // Write 40 cells on the diagonal, in 20 tiles
+  std::vector<uint64_t> d1, d2;
+  std::vector<int32_t> a;
+  for (uint64_t i = 1; i <= 40; ++i) {
+    d1.push_back(i);
+    d2.push_back(i);
+    a.push_back((int32_t)i);
+  }
+  tiledb::test::QueryBuffers buffers;
+  buffers["d1"] = tiledb::test::QueryBuffer(
+      {&d1[0], d1.size() * sizeof(uint64_t), nullptr, 0});
+  buffers["d2"] = tiledb::test::QueryBuffer(
+      {&d2[0], d2.size() * sizeof(uint64_t), nullptr, 0});
+  buffers["a"] = tiledb::test::QueryBuffer(
+      {&a[0], a.size() * sizeof(int32_t), nullptr, 0});
+  write_array(ctx_, array_name_, TILEDB_UNORDERED, buffers);
+
+  open_array(ctx_, array_, TILEDB_READ);
+
+  // Unsorted point ranges on `d1` and two ranges on `d2`, which makes for
+  // more ranges than tiles
+  SubarrayRanges<uint64_t> ranges(2);
+  for (uint64_t i = 45; i >= 1; --i)
+    ranges[0].insert(ranges[0].end(), {i, i});
+  ranges[1] = {25, 38, 1, 20};
+  Layout subarray_layout = GENERATE(Layout::ROW_MAJOR, Layout::COL_MAJOR);
+  Subarray subarray;
+  create_subarray(array_->array_, ranges, subarray_layout, &subarray);
+  auto range_num = subarray.range_num();
+  CHECK(range_num == 90);
+
+  ThreadPool tp(4);
+  Config config;
+  CHECK(subarray.precompute_tile_overlap(0, range_num - 1, &config, &tp, true)
+            .ok());
+
+  // The tile overlap matches querying the R-tree with each range
+  auto meta = array_->array_->fragment_metadata();
+  REQUIRE(meta.size() == 1);
+  CHECK(meta[0]->tile_num() == 20);
+  std::vector<bool> is_default(2, false);
+  for (uint64_t r = 0; r < range_num; ++r) {
+    TileOverlap expected;
+    CHECK(meta[0]
+              ->get_tile_overlap(subarray.ndrange(r), is_default, &expected)
+              .ok());
+    auto overlap = subarray.tile_overlap(0, r);
+    CHECK(overlap->tiles_ == expected.tiles_);
+
+    std::vector<uint64_t> full, expected_full;
+    for (const auto& [start, end] : overlap->tile_ranges_) {
+      for (auto t = start; t <= end; ++t)
+        full.push_back(t);
+    }
+    for (const auto& [start, end] : expected.tile_ranges_) {
+      for (auto t = start; t <= end; ++t)
+        expected_full.push_back(t);
+    }
+    CHECK(full == expected_full);
+  }
+
+  close_array(ctx_, array_);
+}
@@ -31,7 +31,9 @@
  */
 
 #include "tiledb/sm/enums/datatype.h"
+#include "tiledb/sm/stats/stats.h"
 #include "tiledb/sm/tile/tile.h"
+#include "tiledb/sm/tile/tile_buffer_pool.h"
 
 #include <catch.hpp>
 #include <iostream>
@@ -222,4 +224,82 @@ TEST_CASE("Tile: Test move-assignment", "[Tile][move_assignment]") {
 
   free(buffer);
   free(read_buffer);
-}
\ No newline at end of file
+}
+
+TEST_CASE("Tile: Test buffer pool", "[Tile][buffer_pool]") {
+  stats::Stats stats("test");
+  TileBufferPool pool(&stats, 1024 * 1024);
+
+  // A released buffer serves later requests of the same size class.
+  auto [data, capacity] = pool.acquire(10000);
+  REQUIRE(data != nullptr);
+  CHECK(capacity >= 10000);
+  pool.release(data, capacity);
+  CHECK(pool.size() == capacity);
+  auto [data2, capacity2] = pool.acquire(capacity);
+  CHECK(data2 == data);
+  CHECK(capacity2 == capacity);
+  CHECK(pool.size() == 0);
+
+  // Buffers past the pool capacity are freed.
+  auto [data3, capacity3] = pool.acquire(1024 * 1024);
+  REQUIRE(data3 != nullptr);
+  pool.release(data2, capacity2);
+  pool.release(data3, capacity3);
+  CHECK(pool.size() == capacity2);
+
+  // Small buffers are not pooled.
+  auto [data4, capacity4] = pool.acquire(16);
+  REQUIRE(data4 != nullptr);
+  pool.release(data4, capacity4);
+  CHECK(pool.size() == capacity2);
+
+  // Tiles return their pooled buffer when cleared.
+  const uint64_t tile_size = 10000;
+  {
+    Tile tile;
+    CHECK(tile.alloc_data(tile_size, &pool).ok());
+    CHECK(tile.data() == data);
+    CHECK(tile.size() == tile_size);
+    CHECK(pool.size() == 0);
+    memset(tile.data(), 1, tile_size);
+    tile.clear_data();
+    CHECK(pool.size() == capacity2);
+    CHECK(tile.alloc_data(tile_size, &pool).ok());
+    CHECK(pool.size() == 0);
+  }
+  CHECK(pool.size() == capacity2);
+}
+
+TEST_CASE(
+    "Tile: Test growing a pooled filtered buffer",
+    "[Tile][buffer_pool][filtered_buffer]") {
+  stats::Stats stats("test");
+  TileBufferPool pool(&stats, 1024 * 1024);
+
+  FilteredBuffer buffer(0);
+  CHECK(buffer.expand(5000, &pool).ok());
+  CHECK(buffer.size() == 5000);
+  CHECK(!buffer.is_view());
+  for (uint64_t i = 0; i < 5000; i++)
+    buffer.data()[i] = static_cast<char>(i);
+
+  // Growing past the capacity of the pooled buffer moves the data to a
+  // larger pooled buffer, and releases the smaller one to the pool.
+  CHECK(buffer.expand(50000, &pool).ok());
+  CHECK(buffer.size() == 50000);
+  CHECK(pool.size() != 0);
+  for (uint64_t i = 0; i < 5000; i++)
+    CHECK(buffer.data()[i] == static_cast<char>(i));
+
+  // Without a pool, a pooled buffer keeps growing from its own pool.
+  CHECK(buffer.expand(100000, nullptr).ok());
+  CHECK(buffer.size() == 100000);
+  for (uint64_t i = 0; i < 5000; i++)
+    CHECK(buffer.data()[i] == static_cast<char>(i));
+
+  const uint64_t pool_size = pool.size();
+  buffer.clear();
+  CHECK(buffer.size() == 0);
+  CHECK(pool.size() > pool_size);
+}
@@ -245,6 +245,8 @@ void check_save_to_file() {
   ss << "sm.consolidation.amplification 1.0\n";
   ss << "sm.consolidation.buffer_size 50000000\n";
   ss << "sm.consolidation.mode fragments\n";
+  ss << "sm.consolidation.parallel_groups 1\n";
+  ss << "sm.consolidation.pipeline_depth 1\n";
   ss << "sm.consolidation.purge_deleted_cells false\n";
   ss << "sm.consolidation.step_max_frags 4294967295\n";
   ss << "sm.consolidation.step_min_frags 4294967295\n";
@@ -255,11 +257,14 @@ void check_save_to_file() {
   ss << "sm.dedup_coords false\n";
   ss << "sm.enable_signal_handlers true\n";
   ss << "sm.encryption_type NO_ENCRYPTION\n";
+  ss << "sm.fragment_metadata_cache_size 0\n";
   ss << "sm.group.timestamp_end 18446744073709551615\n";
   ss << "sm.group.timestamp_start 0\n";
   ss << "sm.io_concurrency_level " << std::thread::hardware_concurrency()
      << "\n";
   ss << "sm.max_tile_overlap_size 314572800\n";
+  ss << "sm.mem.admission_timeout_ms 1000\n";
+  ss << "sm.mem.context_budget 0\n";
   ss << "sm.mem.malloc_trim true\n";
   ss << "sm.mem.reader.sparse_global_order.ratio_array_data 0.1\n";
   ss << "sm.mem.reader.sparse_global_order.ratio_coords 0.5\n";
@@ -270,16 +275,24 @@ void check_save_to_file() {
   ss << "sm.mem.reader.sparse_unordered_with_dups.ratio_query_condition "
         "0.25\n";
   ss << "sm.mem.reader.sparse_unordered_with_dups.ratio_tile_ranges 0.1\n";
+  ss << "sm.mem.tile_buffer_pool_size 0\n";
   ss << "sm.mem.total_budget 10737418240\n";
   ss << "sm.memory_budget 5368709120\n";
   ss << "sm.memory_budget_var 10737418240\n";
+  ss << "sm.numa_aware false\n";
   ss << "sm.query.dense.reader refactored\n";
+  ss << "sm.query.sparse_global_order.merge_partition_min_cells 65536\n";
   ss << "sm.query.sparse_global_order.reader refactored\n";
   ss << "sm.query.sparse_unordered_with_dups.reader refactored\n";
+  ss << "sm.query.trace_max_span_num 0\n";
   ss << "sm.read_range_oob warn\n";
   ss << "sm.skip_checksum_validation false\n";
   ss << "sm.skip_est_size_partitioning false\n";
+  ss << "sm.tile_cache_policy lru\n";
+  ss << "sm.tile_cache_shard_num 0\n";
   ss << "sm.tile_cache_size 10000000\n";
+  ss << "sm.tile_cache_unfiltered_min_ratio 1.0\n";
+  ss << "sm.tile_cache_unfiltered_size 0\n";
   ss << "sm.vacuum.mode fragments\n";
   ss << "sm.var_offsets.bitsize 64\n";
   ss << "sm.var_offsets.extra_element false\n";
@@ -289,8 +302,11 @@ void check_save_to_file() {
      << "\n";
   ss << "vfs.azure.use_block_list_upload true\n";
   ss << "vfs.azure.use_https true\n";
+  ss << "vfs.file.io_uring false\n";
+  ss << "vfs.file.io_uring_queue_depth 256\n";
   ss << "vfs.file.max_parallel_ops " << std::thread::hardware_concurrency()
      << "\n";
+  ss << "vfs.file.mmap false\n";
   ss << "vfs.file.posix_directory_permissions 755\n";
   ss << "vfs.file.posix_file_permissions 644\n";
   ss << "vfs.gcs.max_parallel_ops " << std::thread::hardware_concurrency()
@@ -303,6 +319,8 @@ void check_save_to_file() {
   ss << "vfs.min_batch_size 20971520\n";
   ss << "vfs.min_parallel_size 10485760\n";
   ss << "vfs.read_ahead_cache_size 10485760\n";
+  ss << "vfs.read_ahead_local false\n";
+  ss << "vfs.read_ahead_max_size 1048576\n";
   ss << "vfs.read_ahead_size 102400\n";
   ss << "vfs.s3.bucket_canned_acl NOT_SET\n";
   ss << "vfs.s3.connect_max_tries 5\n";
@@ -585,14 +603,25 @@ TEST_CASE("C API: Test config iter", "[capi][config]") {
   all_param_values["sm.check_coord_oob"] = "true";
   all_param_values["sm.check_global_order"] = "true";
   all_param_values["sm.tile_cache_size"] = "100";
+  all_param_values["sm.tile_cache_shard_num"] = "0";
+  all_param_values["sm.tile_cache_policy"] = "lru";
+  all_param_values["sm.tile_cache_unfiltered_size"] = "0";
+  all_param_values["sm.tile_cache_unfiltered_min_ratio"] = "1.0";
+  all_param_values["sm.fragment_metadata_cache_size"] = "0";
   all_param_values["sm.skip_est_size_partitioning"] = "false";
   all_param_values["sm.memory_budget"] = "5368709120";
   all_param_values["sm.memory_budget_var"] = "10737418240";
   all_param_values["sm.query.dense.reader"] = "refactored";
   all_param_values["sm.query.sparse_global_order.reader"] = "refactored";
+  all_param_values["sm.query.sparse_global_order.merge_partition_min_cells"] =
+      "65536";
   all_param_values["sm.query.sparse_unordered_with_dups.reader"] = "refactored";
+  all_param_values["sm.query.trace_max_span_num"] = "0";
   all_param_values["sm.mem.malloc_trim"] = "true";
   all_param_values["sm.mem.total_budget"] = "10737418240";
+  all_param_values["sm.mem.context_budget"] = "0";
+  all_param_values["sm.mem.admission_timeout_ms"] = "1000";
+  all_param_values["sm.mem.tile_buffer_pool_size"] = "0";
   all_param_values["sm.mem.reader.sparse_global_order.ratio_coords"] = "0.5";
   all_param_values["sm.mem.reader.sparse_global_order.ratio_query_condition"] =
       "0.25";
@@ -616,6 +645,9 @@ TEST_CASE("C API: Test config iter", "[capi][config]") {
       std::to_string(std::thread::hardware_concurrency());
   all_param_values["sm.io_concurrency_level"] =
       std::to_string(std::thread::hardware_concurrency());
+  all_param_values["sm.compute_cpu_set"] = "";
+  all_param_values["sm.io_cpu_set"] = "";
+  all_param_values["sm.numa_aware"] = "false";
   all_param_values["sm.skip_checksum_validation"] = "false";
   all_param_values["sm.consolidation.amplification"] = "1.0";
   all_param_values["sm.consolidation.steps"] = "4294967295";
@@ -626,6 +658,8 @@ TEST_CASE("C API: Test config iter", "[capi][config]") {
   all_param_values["sm.consolidation.step_min_frags"] = "4294967295";
   all_param_values["sm.consolidation.step_max_frags"] = "4294967295";
   all_param_values["sm.consolidation.buffer_size"] = "50000000";
+  all_param_values["sm.consolidation.pipeline_depth"] = "1";
+  all_param_values["sm.consolidation.parallel_groups"] = "1";
   all_param_values["sm.consolidation.step_size_ratio"] = "0.0";
   all_param_values["sm.consolidation.mode"] = "fragments";
   all_param_values["sm.read_range_oob"] = "warn";
@@ -641,6 +675,8 @@ TEST_CASE("C API: Test config iter", "[capi][config]") {
   all_param_values["vfs.min_parallel_size"] = "10485760";
   all_param_values["vfs.read_ahead_size"] = "102400";
   all_param_values["vfs.read_ahead_cache_size"] = "10485760";
+  all_param_values["vfs.read_ahead_max_size"] = "1048576";
+  all_param_values["vfs.read_ahead_local"] = "false";
   all_param_values["vfs.gcs.project_id"] = "";
   all_param_values["vfs.gcs.max_parallel_ops"] =
       std::to_string(std::thread::hardware_concurrency());
@@ -660,6 +696,9 @@ TEST_CASE("C API: Test config iter", "[capi][config]") {
   all_param_values["vfs.file.posix_directory_permissions"] = "755";
   all_param_values["vfs.file.max_parallel_ops"] =
       std::to_string(std::thread::hardware_concurrency());
+  all_param_values["vfs.file.io_uring"] = "false";
+  all_param_values["vfs.file.io_uring_queue_depth"] = "256";
+  all_param_values["vfs.file.mmap"] = "false";
   all_param_values["vfs.s3.scheme"] = "https";
   all_param_values["vfs.s3.region"] = "us-east-1";
   all_param_values["vfs.s3.aws_access_key_id"] = "";
@@ -705,6 +744,8 @@ TEST_CASE("C API: Test config iter", "[capi][config]") {
   vfs_param_values["min_parallel_size"] = "10485760";
   vfs_param_values["read_ahead_size"] = "102400";
   vfs_param_values["read_ahead_cache_size"] = "10485760";
+  vfs_param_values["read_ahead_max_size"] = "1048576";
+  vfs_param_values["read_ahead_local"] = "false";
   vfs_param_values["gcs.project_id"] = "";
   vfs_param_values["gcs.max_parallel_ops"] =
       std::to_string(std::thread::hardware_concurrency());
@@ -724,6 +765,9 @@ TEST_CASE("C API: Test config iter", "[capi][config]") {
   vfs_param_values["file.posix_directory_permissions"] = "755";
   vfs_param_values["file.max_parallel_ops"] =
       std::to_string(std::thread::hardware_concurrency());
+  vfs_param_values["file.io_uring"] = "false";
+  vfs_param_values["file.io_uring_queue_depth"] = "256";
+  vfs_param_values["file.mmap"] = "false";
   vfs_param_values["s3.scheme"] = "https";
   vfs_param_values["s3.region"] = "us-east-1";
   vfs_param_values["s3.aws_access_key_id"] = "";
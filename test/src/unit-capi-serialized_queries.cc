@@ -37,6 +37,8 @@
 #include "tiledb/sm/c_api/tiledb_serialization.h"
 #include "tiledb/sm/c_api/tiledb_struct_def.h"
 #include "tiledb/sm/cpp_api/tiledb"
+#include "tiledb/sm/enums/aggregate_op.h"
+#include "tiledb/sm/enums/serialization_type.h"
 #include "tiledb/sm/query/legacy/reader.h"
 #include "tiledb/sm/query/writers/writer_base.h"
 #include "tiledb/sm/serialization/query.h"
@@ -905,6 +907,74 @@ TEST_CASE_METHOD(
   }
 }
 
+TEST_CASE_METHOD(
+    SerializationFx,
+    "Query serialization, sparse aggregate",
+    "[query][sparse][serialization][aggregate]") {
+  create_array(TILEDB_SPARSE);
+  write_sparse_array();
+
+  auto serialize_type = GENERATE(
+      sm::SerializationType::CAPNP, sm::SerializationType::JSON);
+
+  Array array(ctx, array_uri, TILEDB_READ);
+  Query query(ctx, array);
+  std::vector<int32_t> subarray = {1, 5, 1, 10};
+  query.set_subarray(subarray);
+
+  // Serialize the request (client side).
+  sm::Buffer request;
+  REQUIRE(sm::serialization::query_aggregate_request_serialize(
+              query.ptr()->query_,
+              "a1",
+              sm::AggregateOp::AGGREGATE_SUM,
+              serialize_type,
+              &request)
+              .ok());
+
+  // Deserialize the request and compute the aggregate (server side).
+  Array array2(ctx, array_uri, TILEDB_READ);
+  Query query2(ctx, array2);
+  std::string name;
+  sm::AggregateOp op = sm::AggregateOp::AGGREGATE_COUNT;
+  REQUIRE(sm::serialization::query_aggregate_request_deserialize(
+              request,
+              serialize_type,
+              query2.ptr()->query_,
+              &name,
+              &op,
+              ctx.ptr()->ctx_->storage_manager()->compute_tp())
+              .ok());
+  CHECK(name == "a1");
+  CHECK(op == sm::AggregateOp::AGGREGATE_SUM);
+
+  uint64_t sum = 0;
+  uint64_t sum_size = sizeof(sum);
+  REQUIRE(query2.ptr()
+              ->query_->get_aggregate(name.c_str(), op, &sum, &sum_size)
+              .ok());
+  sm::Buffer response;
+  REQUIRE(sm::serialization::query_aggregate_value_serialize(
+              &sum, sum_size, serialize_type, &response)
+              .ok());
+
+  // Deserialize the value (client side), the subarray was applied.
+  uint64_t value = 0;
+  uint64_t value_size = sizeof(value);
+  REQUIRE(sm::serialization::query_aggregate_value_deserialize(
+              response, serialize_type, &value, &value_size)
+              .ok());
+  CHECK(value_size == sizeof(uint64_t));
+  CHECK(value == 10);
+
+  // The value buffer must fit the value.
+  uint32_t small_value = 0;
+  uint64_t small_value_size = sizeof(small_value);
+  CHECK(!sm::serialization::query_aggregate_value_deserialize(
+             response, serialize_type, &small_value, &small_value_size)
+             .ok());
+}
+
 TEST_CASE_METHOD(
     SerializationFx,
     "Query serialization, split coords, sparse",
@@ -1646,6 +1646,15 @@ TEST_CASE(
   CHECK(
       stats.find("\"Context.StorageManager.VFS.file_size_num\": 1") !=
       std::string::npos);
+
+  // Expect the footer of the fragment not to be consolidated.
+  CHECK(
+      stats.find("\"Context.StorageManager.fragment_footer_num\": 1") !=
+      std::string::npos);
+  CHECK(
+      stats.find(
+          "\"Context.StorageManager.fragment_consolidated_footer_num\": 0") !=
+      std::string::npos);
 }
 
 TEST_CASE(
@@ -1704,3 +1713,350 @@ TEST_CASE(
       stats.find("\"Context.StorageManager.VFS.file_size_num\": 1") !=
       std::string::npos);
 }
+
+TEST_CASE(
+    "C++ API: Array read with unfiltered tile cache",
+    "[cppapi][sparse][unfiltered-tile-cache]") {
+  const std::string array_name = "cpp_unit_array";
+  Config cfg;
+  cfg["sm.tile_cache_unfiltered_size"] = "10000000";
+  cfg["sm.tile_cache_unfiltered_min_ratio"] = "0";
+  Context ctx(cfg);
+  VFS vfs(ctx);
+
+  if (vfs.is_dir(array_name))
+    vfs.remove_dir(array_name);
+
+  // Create
+  FilterList filters(ctx);
+  filters.add_filter({ctx, TILEDB_FILTER_ZSTD});
+  Domain domain(ctx);
+  domain.add_dimension(Dimension::create<int>(ctx, "rows", {{0, 3}}, 4))
+      .add_dimension(Dimension::create<int>(ctx, "cols", {{0, 3}}, 4));
+  ArraySchema schema(ctx, TILEDB_SPARSE);
+  schema.set_domain(domain).set_order({{TILEDB_ROW_MAJOR, TILEDB_ROW_MAJOR}});
+  schema.set_coords_filter_list(filters);
+  auto a = Attribute::create<int>(ctx, "a");
+  a.set_filter_list(filters);
+  schema.add_attribute(a);
+  Array::create(array_name, schema);
+
+  // Write
+  std::vector<int> data_w = {1, 2, 3, 4};
+  std::vector<int> rows_w = {0, 1, 2, 3};
+  std::vector<int> cols_w = {0, 1, 2, 3};
+  Array array_w(ctx, array_name, TILEDB_WRITE);
+  Query query_w(ctx, array_w);
+  query_w.set_layout(TILEDB_GLOBAL_ORDER)
+      .set_data_buffer("rows", rows_w)
+      .set_data_buffer("cols", cols_w)
+      .set_data_buffer("a", data_w);
+  query_w.submit();
+  query_w.finalize();
+  array_w.close();
+
+  // Read twice, the second read is served by the unfiltered tile cache.
+  Array array(ctx, array_name, TILEDB_READ);
+  for (int i = 0; i < 2; i++) {
+    Stats::reset();
+    Stats::enable();
+    std::vector<int> data_r(4);
+    std::vector<int> rows_r(4);
+    std::vector<int> cols_r(4);
+    Query query_r(ctx, array);
+    query_r.set_layout(TILEDB_GLOBAL_ORDER)
+        .set_data_buffer("rows", rows_r)
+        .set_data_buffer("cols", cols_r)
+        .set_data_buffer("a", data_r);
+    REQUIRE(query_r.submit() == Query::Status::COMPLETE);
+    Stats::disable();
+    CHECK(data_r == data_w);
+    CHECK(rows_r == rows_w);
+    CHECK(cols_r == cols_w);
+
+    std::string stats;
+    Stats::dump(&stats);
+    if (i == 0) {
+      CHECK(
+          stats.find("unfiltered_tile_cache_hit_num\": 0") !=
+          std::string::npos);
+    } else {
+      CHECK(
+          stats.find("unfiltered_tile_cache_hit_num\": 3") !=
+          std::string::npos);
+      CHECK(
+          stats.find("unfiltered_tile_cache_miss_num\": 0") !=
+          std::string::npos);
+    }
+  }
+  array.close();
+
+  if (vfs.is_dir(array_name))
+    vfs.remove_dir(array_name);
+}
+
+TEST_CASE(
+    "C++ API: Array reopen with fragment metadata cache",
+    "[cppapi][sparse][fragment-metadata-cache]") {
+  const std::string array_name = "cpp_unit_array";
+  Config cfg;
+  cfg["sm.fragment_metadata_cache_size"] = "10000000";
+  Context ctx(cfg);
+  VFS vfs(ctx);
+
+  if (vfs.is_dir(array_name))
+    vfs.remove_dir(array_name);
+
+  // Create
+  Domain domain(ctx);
+  domain.add_dimension(Dimension::create<int>(ctx, "rows", {{0, 3}}, 4))
+      .add_dimension(Dimension::create<int>(ctx, "cols", {{0, 3}}, 4));
+  ArraySchema schema(ctx, TILEDB_SPARSE);
+  schema.set_domain(domain).set_order({{TILEDB_ROW_MAJOR, TILEDB_ROW_MAJOR}});
+  schema.add_attribute(Attribute::create<int>(ctx, "a"));
+  Array::create(array_name, schema);
+
+  // Write two fragments
+  for (int f = 0; f < 2; f++) {
+    std::vector<int> data_w = {1 + 2 * f, 2 + 2 * f};
+    std::vector<int> rows_w = {2 * f, 2 * f + 1};
+    std::vector<int> cols_w = {2 * f, 2 * f + 1};
+    Array array_w(ctx, array_name, TILEDB_WRITE);
+    Query query_w(ctx, array_w);
+    query_w.set_layout(TILEDB_GLOBAL_ORDER)
+        .set_data_buffer("rows", rows_w)
+        .set_data_buffer("cols", cols_w)
+        .set_data_buffer("a", data_w);
+    query_w.submit();
+    query_w.finalize();
+    array_w.close();
+  }
+
+  // Opens the array, reads it and returns the stats of the open and read.
+  auto read = [&]() {
+    Stats::reset();
+    Stats::enable();
+    std::vector<int> data_r(4);
+    std::vector<int> rows_r(4);
+    std::vector<int> cols_r(4);
+    Array array(ctx, array_name, TILEDB_READ);
+    Query query_r(ctx, array);
+    query_r.set_layout(TILEDB_GLOBAL_ORDER)
+        .set_data_buffer("rows", rows_r)
+        .set_data_buffer("cols", cols_r)
+        .set_data_buffer("a", data_r);
+    REQUIRE(query_r.submit() == Query::Status::COMPLETE);
+    array.close();
+    Stats::disable();
+    CHECK(data_r == std::vector<int>{1, 2, 3, 4});
+    CHECK(rows_r == std::vector<int>{0, 1, 2, 3});
+    CHECK(cols_r == std::vector<int>{0, 1, 2, 3});
+
+    std::string stats;
+    Stats::dump(&stats);
+    return stats;
+  };
+
+  // The first open reads the fragment metadata from storage.
+  auto stats = read();
+  CHECK(
+      stats.find("FragmentMetadataCache.footer_miss_num\": 2") !=
+      std::string::npos);
+
+  // The second open is served by the cache.
+  stats = read();
+  CHECK(
+      stats.find("FragmentMetadataCache.footer_hit_num\": 2") !=
+      std::string::npos);
+  CHECK(
+      stats.find("FragmentMetadataCache.footer_miss_num") ==
+      std::string::npos);
+  CHECK(stats.find("FragmentMetadataCache.hit_num") != std::string::npos);
+  CHECK(stats.find("FragmentMetadataCache.miss_num") == std::string::npos);
+
+  // Vacuuming the consolidated fragments drops their cached metadata.
+  Array::consolidate(ctx, array_name);
+  Stats::reset();
+  Stats::enable();
+  Array::vacuum(ctx, array_name);
+  Stats::disable();
+  Stats::dump(&stats);
+  CHECK(
+      stats.find("FragmentMetadataCache.invalidated_num") !=
+      std::string::npos);
+
+  // Only the footer of the consolidated fragment is looked up.
+  stats = read();
+  CHECK(
+      (stats.find("FragmentMetadataCache.footer_hit_num\": 1") !=
+           std::string::npos ||
+       stats.find("FragmentMetadataCache.footer_miss_num\": 1") !=
+           std::string::npos));
+  CHECK(
+      stats.find("FragmentMetadataCache.footer_hit_num\": 2") ==
+      std::string::npos);
+
+  if (vfs.is_dir(array_name))
+    vfs.remove_dir(array_name);
+}
+
+TEST_CASE(
+    "C++ API: Array reopen loads only the new fragments",
+    "[cppapi][sparse][reopen]") {
+  const std::string array_name = "cpp_unit_array";
+  Context ctx;
+  VFS vfs(ctx);
+
+  if (vfs.is_dir(array_name))
+    vfs.remove_dir(array_name);
+
+  // Create
+  Domain domain(ctx);
+  domain.add_dimension(Dimension::create<int>(ctx, "rows", {{0, 3}}, 4))
+      .add_dimension(Dimension::create<int>(ctx, "cols", {{0, 3}}, 4));
+  ArraySchema schema(ctx, TILEDB_SPARSE);
+  schema.set_domain(domain).set_order({{TILEDB_ROW_MAJOR, TILEDB_ROW_MAJOR}});
+  schema.add_attribute(Attribute::create<int>(ctx, "a"));
+  Array::create(array_name, schema);
+
+  // Writes one fragment with two cells on the diagonal.
+  auto write = [&](int f) {
+    std::vector<int> data_w = {1 + 2 * f, 2 + 2 * f};
+    std::vector<int> rows_w = {2 * f, 2 * f + 1};
+    std::vector<int> cols_w = {2 * f, 2 * f + 1};
+    Array array_w(ctx, array_name, TILEDB_WRITE);
+    Query query_w(ctx, array_w);
+    query_w.set_layout(TILEDB_GLOBAL_ORDER)
+        .set_data_buffer("rows", rows_w)
+        .set_data_buffer("cols", cols_w)
+        .set_data_buffer("a", data_w);
+    query_w.submit();
+    query_w.finalize();
+    array_w.close();
+  };
+
+  // Reads the array and returns the attribute values.
+  auto read = [&](Array& array) {
+    std::vector<int> data_r(4);
+    std::vector<int> rows_r(4);
+    std::vector<int> cols_r(4);
+    Query query_r(ctx, array);
+    query_r.set_layout(TILEDB_GLOBAL_ORDER)
+        .set_data_buffer("rows", rows_r)
+        .set_data_buffer("cols", cols_r)
+        .set_data_buffer("a", data_r);
+    REQUIRE(query_r.submit() == Query::Status::COMPLETE);
+    data_r.resize(query_r.result_buffer_elements()["a"].second);
+    return data_r;
+  };
+
+  write(0);
+  Array array(ctx, array_name, TILEDB_READ);
+  CHECK(read(array) == std::vector<int>{1, 2});
+
+  // Reopening after a new write only loads the new fragment.
+  write(1);
+  Stats::reset();
+  Stats::enable();
+  array.reopen();
+  Stats::disable();
+  std::string stats;
+  Stats::dump(&stats);
+  CHECK(
+      stats.find("\"Context.StorageManager.fragment_footer_num\": 1") !=
+      std::string::npos);
+  CHECK(
+      stats.find("\"Context.StorageManager.fragment_reused_num\": 1") !=
+      std::string::npos);
+  CHECK(read(array) == std::vector<int>{1, 2, 3, 4});
+
+  // Consolidating and vacuuming drops the vacuumed fragments on reopen.
+  Array::consolidate(ctx, array_name);
+  Array::vacuum(ctx, array_name);
+  array.reopen();
+  CHECK(read(array) == std::vector<int>{1, 2, 3, 4});
+  array.close();
+
+  if (vfs.is_dir(array_name))
+    vfs.remove_dir(array_name);
+}
+
+TEST_CASE(
+    "C++ API: Array read from memory-mapped files",
+    "[cppapi][sparse][mmap]") {
+  const std::string array_name = "cpp_unit_array";
+  Config cfg;
+  cfg["vfs.file.mmap"] = "true";
+  Context ctx(cfg);
+  VFS vfs(ctx);
+
+  if (vfs.is_dir(array_name))
+    vfs.remove_dir(array_name);
+
+  // Create, with a checksum filter on `b` only.
+  FilterList filters(ctx);
+  filters.add_filter({ctx, TILEDB_FILTER_CHECKSUM_MD5});
+  Domain domain(ctx);
+  domain.add_dimension(Dimension::create<int>(ctx, "rows", {{0, 3}}, 4))
+      .add_dimension(Dimension::create<int>(ctx, "cols", {{0, 3}}, 4));
+  ArraySchema schema(ctx, TILEDB_SPARSE);
+  schema.set_domain(domain).set_order({{TILEDB_ROW_MAJOR, TILEDB_ROW_MAJOR}});
+  schema.add_attribute(Attribute::create<int>(ctx, "a"));
+  auto b = Attribute::create<int>(ctx, "b");
+  b.set_filter_list(filters);
+  schema.add_attribute(b);
+  Array::create(array_name, schema);
+
+  // Write
+  std::vector<int> a_w = {1, 2, 3, 4};
+  std::vector<int> b_w = {5, 6, 7, 8};
+  std::vector<int> rows_w = {0, 1, 2, 3};
+  std::vector<int> cols_w = {0, 1, 2, 3};
+  Array array_w(ctx, array_name, TILEDB_WRITE);
+  Query query_w(ctx, array_w);
+  query_w.set_layout(TILEDB_GLOBAL_ORDER)
+      .set_data_buffer("rows", rows_w)
+      .set_data_buffer("cols", cols_w)
+      .set_data_buffer("a", a_w)
+      .set_data_buffer("b", b_w);
+  query_w.submit();
+  query_w.finalize();
+  array_w.close();
+
+  // Read, then read again after reopening the array. The single-chunk tiles
+  // without filters are referenced in place, `b` is still unfiltered to
+  // validate its checksum.
+  Array array(ctx, array_name, TILEDB_READ);
+  for (int i = 0; i < 2; i++) {
+    if (i == 1)
+      array.reopen();
+
+    Stats::reset();
+    Stats::enable();
+    std::vector<int> a_r(4);
+    std::vector<int> b_r(4);
+    std::vector<int> rows_r(4);
+    std::vector<int> cols_r(4);
+    Query query_r(ctx, array);
+    query_r.set_layout(TILEDB_GLOBAL_ORDER)
+        .set_data_buffer("rows", rows_r)
+        .set_data_buffer("cols", cols_r)
+        .set_data_buffer("a", a_r)
+        .set_data_buffer("b", b_r);
+    REQUIRE(query_r.submit() == Query::Status::COMPLETE);
+    Stats::disable();
+    CHECK(a_r == a_w);
+    CHECK(b_r == b_w);
+    CHECK(rows_r == rows_w);
+    CHECK(cols_r == cols_w);
+
+    std::string stats;
+    Stats::dump(&stats);
+    CHECK(stats.find("mmap_tile_num\": 4") != std::string::npos);
+    CHECK(stats.find("mmap_zero_copy_tile_num\": 3") != std::string::npos);
+  }
+  array.close();
+
+  if (vfs.is_dir(array_name))
+    vfs.remove_dir(array_name);
+}
@@ -277,4 +277,85 @@ TEST_CASE(
   REQUIRE(a1_r[1] == 1);
   if (vfs.is_dir(array_name))
     vfs.remove_dir(array_name);
-}
\ No newline at end of file
+}
+
+TEST_CASE(
+    "C++ API: Test pipelined consolidation of parallel fragment groups",
+    "[cppapi][consolidation][pipeline]") {
+  const std::string array_name = "cppapi_consolidation_pipeline";
+  remove_array(array_name);
+
+  // Create a sparse array
+  Context ctx;
+  Domain domain(ctx);
+  domain.add_dimension(Dimension::create<int>(ctx, "d", {{1, 100}}, 10));
+  ArraySchema schema(ctx, TILEDB_SPARSE);
+  schema.set_domain(domain);
+  schema.add_attribute(Attribute::create<int>(ctx, "a"));
+  Array::create(array_name, schema);
+
+  // Write two fragments at each end of the domain
+  std::vector<std::vector<int>> coords = {{1, 2, 3, 4, 5},
+                                          {6, 7, 8, 9, 10},
+                                          {91, 92, 93, 94, 95},
+                                          {96, 97, 98, 99, 100}};
+  for (const auto& c : coords) {
+    std::vector<int> d(c);
+    std::vector<int> a(c);
+    Array array(ctx, array_name, TILEDB_WRITE);
+    Query query(ctx, array, TILEDB_WRITE);
+    query.set_layout(TILEDB_UNORDERED)
+        .set_data_buffer("d", d)
+        .set_data_buffer("a", a);
+    query.submit();
+    array.close();
+  }
+  CHECK(tiledb::test::num_fragments(array_name) == 4);
+
+  // Consolidate each pair of fragments in a group of its own, through small
+  // buffers so that the copy takes several batches.
+  Config config;
+  config["sm.consolidation.buffer_size"] = "8";
+  config["sm.consolidation.step_max_frags"] = "2";
+  config["sm.consolidation.steps"] = "1";
+  std::string pipeline_depth;
+  std::string parallel_groups;
+  SECTION("Sequential") {
+    pipeline_depth = "1";
+    parallel_groups = "1";
+  }
+  SECTION("Pipelined") {
+    pipeline_depth = "3";
+    parallel_groups = "1";
+  }
+  SECTION("Pipelined, parallel groups") {
+    pipeline_depth = "3";
+    parallel_groups = "2";
+  }
+  config["sm.consolidation.pipeline_depth"] = pipeline_depth;
+  config["sm.consolidation.parallel_groups"] = parallel_groups;
+  REQUIRE_NOTHROW(Array::consolidate(ctx, array_name, &config));
+  REQUIRE_NOTHROW(Array::vacuum(ctx, array_name, &config));
+  CHECK(
+      tiledb::test::num_fragments(array_name) ==
+      (parallel_groups == "2" ? 2 : 3));
+
+  // Read back all the cells
+  std::vector<int> d_r(20);
+  std::vector<int> a_r(20);
+  Array array_r(ctx, array_name, TILEDB_READ);
+  Query query_r(ctx, array_r, TILEDB_READ);
+  query_r.set_layout(TILEDB_GLOBAL_ORDER)
+      .set_data_buffer("d", d_r)
+      .set_data_buffer("a", a_r);
+  REQUIRE(query_r.submit() == Query::Status::COMPLETE);
+  array_r.close();
+
+  std::vector<int> c_d;
+  for (const auto& c : coords)
+    c_d.insert(c_d.end(), c.begin(), c.end());
+  CHECK(d_r == c_d);
+  CHECK(a_r == c_d);
+
+  remove_array(array_name);
+}
@@ -32,8 +32,14 @@
 
 #include "catch.hpp"
 #include "tiledb/sm/cpp_api/tiledb"
+#include "tiledb/sm/cpp_api/tiledb_experimental"
 #include "tiledb/sm/misc/utils.h"
 
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <tuple>
+
 using namespace tiledb;
 
 TEST_CASE("C++ API: Test get query layout", "[cppapi][query]") {
@@ -344,3 +350,452 @@ TEST_CASE(
   if (vfs.is_dir(array_name))
     vfs.remove_dir(array_name);
 }
+
+TEST_CASE("C++ API: Test query aggregates", "[cppapi][query][aggregate]") {
+  const std::string array_name = "cpp_unit_array";
+  Context ctx;
+  VFS vfs(ctx);
+
+  if (vfs.is_dir(array_name))
+    vfs.remove_dir(array_name);
+
+  // Create a sparse array with tiles of 10 cells.
+  Domain domain(ctx);
+  domain.add_dimension(Dimension::create<int64_t>(ctx, "d", {{1, 100}}, 10));
+  ArraySchema schema(ctx, TILEDB_SPARSE);
+  schema.set_domain(domain).set_capacity(10).set_allows_dups(true);
+  auto attr = Attribute::create<int32_t>(ctx, "a");
+  attr.set_nullable(true);
+  schema.add_attribute(attr);
+  Array::create(array_name, schema);
+
+  // Write cells 1 to 40 with a = d, a being null when d is a multiple of 10.
+  std::vector<int64_t> d(40);
+  std::vector<int32_t> a(40);
+  std::vector<uint8_t> a_validity(40);
+  for (int32_t i = 0; i < 40; i++) {
+    d[i] = i + 1;
+    a[i] = i + 1;
+    a_validity[i] = (i + 1) % 10 == 0 ? 0 : 1;
+  }
+  Array array_w(ctx, array_name, TILEDB_WRITE);
+  Query query_w(ctx, array_w, TILEDB_WRITE);
+  query_w.set_layout(TILEDB_GLOBAL_ORDER)
+      .set_data_buffer("d", d)
+      .set_data_buffer("a", a)
+      .set_validity_buffer("a", a_validity);
+  query_w.submit();
+  query_w.finalize();
+  array_w.close();
+
+  Array array(ctx, array_name, TILEDB_READ);
+
+  SECTION("No subarray") {
+    Query query(ctx, array, TILEDB_READ);
+    CHECK(query.aggregate<uint64_t>("", TILEDB_AGGREGATE_COUNT) == 40);
+    CHECK(query.aggregate<uint64_t>("a", TILEDB_AGGREGATE_NULL_COUNT) == 4);
+    CHECK(query.aggregate<int64_t>("a", TILEDB_AGGREGATE_SUM) == 720);
+    CHECK(query.aggregate<int32_t>("a", TILEDB_AGGREGATE_MIN) == 1);
+    CHECK(query.aggregate<int32_t>("a", TILEDB_AGGREGATE_MAX) == 39);
+
+    // The 4 tiles are answered from the tile metadata, for each of the 5
+    // aggregates.
+    auto stats = query.stats();
+    CHECK(
+        stats.find("\"Context.StorageManager.Query.AggregateReader.metadata_"
+                   "tile_num\": 20") != std::string::npos);
+  }
+
+  SECTION("Subarray") {
+    // Tiles [1, 10] and [31, 40] are partially covered and read, for each of
+    // the 5 aggregates.
+    Query query(ctx, array, TILEDB_READ);
+    Subarray subarray(ctx, array);
+    subarray.add_range<int64_t>(0, 5, 35);
+    query.set_subarray(subarray);
+    CHECK(query.aggregate<uint64_t>("", TILEDB_AGGREGATE_COUNT) == 31);
+    CHECK(query.aggregate<uint64_t>("a", TILEDB_AGGREGATE_NULL_COUNT) == 3);
+    CHECK(query.aggregate<int64_t>("a", TILEDB_AGGREGATE_SUM) == 560);
+    CHECK(query.aggregate<int32_t>("a", TILEDB_AGGREGATE_MIN) == 5);
+    CHECK(query.aggregate<int32_t>("a", TILEDB_AGGREGATE_MAX) == 35);
+
+    auto stats = query.stats();
+    CHECK(
+        stats.find("\"Context.StorageManager.Query.AggregateReader.metadata_"
+                   "tile_num\": 10") != std::string::npos);
+    CHECK(
+        stats.find("\"Context.StorageManager.Query.AggregateReader.read_tile_"
+                   "num\": 10") != std::string::npos);
+  }
+
+  SECTION("Subarray and query condition") {
+    Query query(ctx, array, TILEDB_READ);
+    Subarray subarray(ctx, array);
+    subarray.add_range<int64_t>(0, 5, 35);
+    query.set_subarray(subarray);
+    QueryCondition qc(ctx);
+    int32_t val = 15;
+    qc.init("a", &val, sizeof(int32_t), TILEDB_LT);
+    query.set_condition(qc);
+    CHECK(query.aggregate<uint64_t>("", TILEDB_AGGREGATE_COUNT) == 9);
+    CHECK(query.aggregate<int64_t>("a", TILEDB_AGGREGATE_SUM) == 85);
+    CHECK(query.aggregate<int32_t>("a", TILEDB_AGGREGATE_MAX) == 14);
+  }
+
+  SECTION("Empty result") {
+    Query query(ctx, array, TILEDB_READ);
+    Subarray subarray(ctx, array);
+    subarray.add_range<int64_t>(0, 50, 60);
+    query.set_subarray(subarray);
+    CHECK(query.aggregate<uint64_t>("", TILEDB_AGGREGATE_COUNT) == 0);
+    CHECK(!query.aggregate<int32_t>("a", TILEDB_AGGREGATE_MIN).has_value());
+  }
+
+  SECTION("Errors") {
+    Query query(ctx, array, TILEDB_READ);
+    CHECK_THROWS_AS(
+        query.aggregate<int32_t>("a", TILEDB_AGGREGATE_SUM), TileDBError);
+    CHECK_THROWS_AS(
+        query.aggregate<uint64_t>("d", TILEDB_AGGREGATE_SUM), TileDBError);
+  }
+
+  array.close();
+
+  if (vfs.is_dir(array_name))
+    vfs.remove_dir(array_name);
+}
+
+TEST_CASE(
+    "C++ API: Test query aggregates with overlapping fragments",
+    "[cppapi][query][aggregate][overlap]") {
+  const std::string array_name = "cpp_unit_array";
+  Context ctx;
+  VFS vfs(ctx);
+
+  if (vfs.is_dir(array_name))
+    vfs.remove_dir(array_name);
+
+  // Create a sparse array without duplicates, with tiles of 10 cells.
+  Domain domain(ctx);
+  domain.add_dimension(Dimension::create<int64_t>(ctx, "d", {{1, 100}}, 10));
+  ArraySchema schema(ctx, TILEDB_SPARSE);
+  schema.set_domain(domain).set_capacity(10);
+  schema.add_attribute(Attribute::create<int32_t>(ctx, "a"));
+  Array::create(array_name, schema);
+
+  // Write cells 1 to 20 with a = d, then overwrite cells 11 to 15 with
+  // a = 100 and add cells 21 to 25 with a = 1.
+  auto write = [&](std::vector<int64_t> d, std::vector<int32_t> a) {
+    Array array_w(ctx, array_name, TILEDB_WRITE);
+    Query query_w(ctx, array_w, TILEDB_WRITE);
+    query_w.set_layout(TILEDB_GLOBAL_ORDER)
+        .set_data_buffer("d", d)
+        .set_data_buffer("a", a);
+    query_w.submit();
+    query_w.finalize();
+    array_w.close();
+  };
+  std::vector<int64_t> d1(20);
+  std::vector<int32_t> a1(20);
+  for (int32_t i = 0; i < 20; i++) {
+    d1[i] = i + 1;
+    a1[i] = i + 1;
+  }
+  write(d1, a1);
+  std::vector<int64_t> d2(10);
+  std::vector<int32_t> a2(10);
+  for (int32_t i = 0; i < 10; i++) {
+    d2[i] = i < 5 ? i + 11 : i + 16;
+    a2[i] = i < 5 ? 100 : 1;
+  }
+  write(d2, a2);
+
+  Array array(ctx, array_name, TILEDB_READ);
+
+  SECTION("No subarray") {
+    // Cells 11 to 15 are only counted once, with their latest value.
+    Query query(ctx, array, TILEDB_READ);
+    CHECK(query.aggregate<uint64_t>("", TILEDB_AGGREGATE_COUNT) == 25);
+    CHECK(query.aggregate<int64_t>("a", TILEDB_AGGREGATE_SUM) == 650);
+    CHECK(query.aggregate<int32_t>("a", TILEDB_AGGREGATE_MIN) == 1);
+    CHECK(query.aggregate<int32_t>("a", TILEDB_AGGREGATE_MAX) == 100);
+
+    auto stats = query.stats();
+    CHECK(
+        stats.find("\"Context.StorageManager.Query.AggregateReader."
+                   "reconciled_tile_num\"") != std::string::npos);
+  }
+
+  SECTION("Subarray and query condition") {
+    // The overwritten cells 11 to 15 do not satisfy the condition anymore.
+    Query query(ctx, array, TILEDB_READ);
+    Subarray subarray(ctx, array);
+    subarray.add_range<int64_t>(0, 5, 22);
+    query.set_subarray(subarray);
+    QueryCondition qc(ctx);
+    int32_t val = 50;
+    qc.init("a", &val, sizeof(int32_t), TILEDB_LT);
+    query.set_condition(qc);
+    CHECK(query.aggregate<uint64_t>("", TILEDB_AGGREGATE_COUNT) == 13);
+    CHECK(query.aggregate<int64_t>("a", TILEDB_AGGREGATE_SUM) == 137);
+    CHECK(query.aggregate<int32_t>("a", TILEDB_AGGREGATE_MAX) == 20);
+  }
+
+  array.close();
+
+  if (vfs.is_dir(array_name))
+    vfs.remove_dir(array_name);
+}
+
+TEST_CASE(
+    "C++ API: Test query aggregates on dense arrays",
+    "[cppapi][query][aggregate][dense]") {
+  const std::string array_name = "cpp_unit_array";
+  Context ctx;
+  VFS vfs(ctx);
+
+  if (vfs.is_dir(array_name))
+    vfs.remove_dir(array_name);
+
+  Domain domain(ctx);
+  domain.add_dimension(Dimension::create<int64_t>(ctx, "d", {{1, 10}}, 10));
+  ArraySchema schema(ctx, TILEDB_DENSE);
+  schema.set_domain(domain);
+  schema.add_attribute(Attribute::create<int32_t>(ctx, "a"));
+  Array::create(array_name, schema);
+
+  // Dense arrays are read with a regular read query instead.
+  Array array(ctx, array_name, TILEDB_READ);
+  Query query(ctx, array, TILEDB_READ);
+  CHECK_THROWS_AS(
+      query.aggregate<uint64_t>("", TILEDB_AGGREGATE_COUNT), TileDBError);
+  array.close();
+
+  if (vfs.is_dir(array_name))
+    vfs.remove_dir(array_name);
+}
+
+TEST_CASE(
+    "C++ API: Test unordered write sorting", "[cppapi][query][unordered]") {
+  const std::string array_name = "cpp_unit_array";
+  Context ctx;
+  VFS vfs(ctx);
+
+  if (vfs.is_dir(array_name))
+    vfs.remove_dir(array_name);
+
+  // The int32 and float64 coordinates are sorted on packed keys.
+  auto tile_order = GENERATE(TILEDB_ROW_MAJOR, TILEDB_COL_MAJOR);
+  auto cell_order = GENERATE(TILEDB_ROW_MAJOR, TILEDB_COL_MAJOR);
+  Domain domain(ctx);
+  domain.add_dimension(Dimension::create<int32_t>(ctx, "d1", {{-100, 99}}, 10))
+      .add_dimension(Dimension::create<double>(ctx, "d2", {{-1.0, 1.0}}, 0.5));
+  ArraySchema schema(ctx, TILEDB_SPARSE);
+  schema.set_domain(domain).set_order({{tile_order, cell_order}});
+  schema.set_allows_dups(true);
+  schema.add_attribute(Attribute::create<int32_t>(ctx, "a"));
+  Array::create(array_name, schema);
+
+  // Write random cells, with duplicates and signed zeros.
+  const int32_t cell_num = 2000;
+  std::mt19937 gen(0);
+  std::uniform_int_distribution<int32_t> d1_dist(-100, 99);
+  std::uniform_real_distribution<double> d2_dist(-1.0, 1.0);
+  std::vector<int32_t> d1(cell_num);
+  std::vector<double> d2(cell_num);
+  std::vector<int32_t> a(cell_num);
+  for (int32_t i = 0; i < cell_num; i++) {
+    d1[i] = d1_dist(gen);
+    d2[i] = i % 10 == 0 ? (i % 20 == 0 ? 0.0 : -0.0) : d2_dist(gen);
+    a[i] = i;
+  }
+  for (int32_t i = 0; i < 100; i++) {
+    d1[cell_num - 1 - i] = d1[i];
+    d2[cell_num - 1 - i] = d2[i];
+  }
+
+  Array array_w(ctx, array_name, TILEDB_WRITE);
+  Query query_w(ctx, array_w, TILEDB_WRITE);
+  query_w.set_layout(TILEDB_UNORDERED)
+      .set_data_buffer("d1", d1)
+      .set_data_buffer("d2", d2)
+      .set_data_buffer("a", a);
+  query_w.submit();
+  array_w.close();
+
+  // Read back in global order.
+  Array array_r(ctx, array_name, TILEDB_READ);
+  Query query_r(ctx, array_r, TILEDB_READ);
+  std::vector<int32_t> r_d1(cell_num);
+  std::vector<double> r_d2(cell_num);
+  std::vector<int32_t> r_a(cell_num);
+  query_r.set_layout(TILEDB_GLOBAL_ORDER)
+      .set_data_buffer("d1", r_d1)
+      .set_data_buffer("d2", r_d2)
+      .set_data_buffer("a", r_a);
+  REQUIRE(query_r.submit() == Query::Status::COMPLETE);
+  REQUIRE(query_r.result_buffer_elements()["a"].second == (uint64_t)cell_num);
+  array_r.close();
+
+  // Check the cells against the global order.
+  auto key = [&](int32_t i) {
+    auto t1 = (d1[i] + 100) / 10;
+    auto t2 = static_cast<uint64_t>((d2[i] + 1.0) / 0.5);
+    std::tuple<uint64_t, uint64_t, double, double> k;
+    if (tile_order == TILEDB_ROW_MAJOR) {
+      std::get<0>(k) = t1;
+      std::get<1>(k) = t2;
+    } else {
+      std::get<0>(k) = t2;
+      std::get<1>(k) = t1;
+    }
+    if (cell_order == TILEDB_ROW_MAJOR) {
+      std::get<2>(k) = d1[i];
+      std::get<3>(k) = d2[i];
+    } else {
+      std::get<2>(k) = d2[i];
+      std::get<3>(k) = d1[i];
+    }
+    return k;
+  };
+  std::vector<int32_t> order(a);
+  std::stable_sort(order.begin(), order.end(), [&](int32_t l, int32_t r) {
+    return key(l) < key(r);
+  });
+  for (int32_t i = 0; i < cell_num; i++) {
+    CHECK(r_d1[i] == d1[r_a[i]]);
+    CHECK(r_d2[i] == d2[r_a[i]]);
+    CHECK(key(r_a[i]) == key(order[i]));
+  }
+
+  if (vfs.is_dir(array_name))
+    vfs.remove_dir(array_name);
+}
+
+TEST_CASE("C++ API: Test query trace", "[cppapi][query][trace]") {
+  const std::string array_name = "cpp_unit_array";
+  Context ctx;
+  VFS vfs(ctx);
+
+  if (vfs.is_dir(array_name))
+    vfs.remove_dir(array_name);
+
+  // Create and write
+  Domain domain(ctx);
+  domain.add_dimension(Dimension::create<int>(ctx, "rows", {{0, 3}}, 4));
+  ArraySchema schema(ctx, TILEDB_SPARSE);
+  schema.set_domain(domain);
+  schema.add_attribute(Attribute::create<int>(ctx, "a"));
+  Array::create(array_name, schema);
+
+  std::vector<int> rows = {0, 1, 2, 3}, a = {1, 2, 3, 4};
+  Array array_w(ctx, array_name, TILEDB_WRITE);
+  Query query_w(ctx, array_w);
+  query_w.set_layout(TILEDB_UNORDERED)
+      .set_data_buffer("rows", rows)
+      .set_data_buffer("a", a);
+  query_w.submit();
+  array_w.close();
+
+  // Read, with tracing enabled or not
+  const bool trace = GENERATE(true, false);
+  Array array(ctx, array_name, TILEDB_READ);
+  Query query(ctx, array);
+  if (trace) {
+    Config config;
+    config["sm.query.trace_max_span_num"] = "1000";
+    query.set_config(config);
+  }
+  std::vector<int> rows_r(4), a_r(4);
+  query.set_layout(TILEDB_UNORDERED)
+      .set_data_buffer("rows", rows_r)
+      .set_data_buffer("a", a_r);
+  query.submit();
+  CHECK(query.query_status() == Query::Status::COMPLETE);
+  CHECK(a_r == a);
+
+#ifdef TILEDB_STATS
+  // The reader phases report latency percentiles in the stats
+  CHECK(query.stats().find("Reader.dowork.p99") != std::string::npos);
+
+  const std::string trace_json = QueryExperimental::get_trace(ctx, query);
+  if (trace) {
+    CHECK(trace_json.find("\"traceEvents\"") != std::string::npos);
+    CHECK(trace_json.find("Reader.dowork\"") != std::string::npos);
+  } else {
+    CHECK(trace_json.empty());
+  }
+#endif
+
+  array.close();
+
+  if (vfs.is_dir(array_name))
+    vfs.remove_dir(array_name);
+}
+
+TEST_CASE(
+    "C++ API: Test query aggregates with NaN values",
+    "[cppapi][query][aggregate][nan]") {
+  const std::string array_name = "cpp_unit_array";
+  Context ctx;
+  VFS vfs(ctx);
+
+  if (vfs.is_dir(array_name))
+    vfs.remove_dir(array_name);
+
+  // Create a sparse array with tiles of 10 cells.
+  Domain domain(ctx);
+  domain.add_dimension(Dimension::create<int64_t>(ctx, "d", {{1, 100}}, 10));
+  ArraySchema schema(ctx, TILEDB_SPARSE);
+  schema.set_domain(domain).set_capacity(10).set_allows_dups(true);
+  schema.add_attribute(Attribute::create<double>(ctx, "a"));
+  Array::create(array_name, schema);
+
+  // Write cells 1 to 20 with a = d, a being NaN for cells 1 and 6.
+  std::vector<int64_t> d(20);
+  std::vector<double> a(20);
+  for (int32_t i = 0; i < 20; i++) {
+    d[i] = i + 1;
+    a[i] = i + 1;
+  }
+  a[0] = std::numeric_limits<double>::quiet_NaN();
+  a[5] = std::numeric_limits<double>::quiet_NaN();
+  Array array_w(ctx, array_name, TILEDB_WRITE);
+  Query query_w(ctx, array_w, TILEDB_WRITE);
+  query_w.set_layout(TILEDB_GLOBAL_ORDER)
+      .set_data_buffer("d", d)
+      .set_data_buffer("a", a);
+  query_w.submit();
+  query_w.finalize();
+  array_w.close();
+
+  Array array(ctx, array_name, TILEDB_READ);
+
+  SECTION("No subarray") {
+    // NaN values are ignored, the tiles are read for both aggregates.
+    Query query(ctx, array, TILEDB_READ);
+    CHECK(query.aggregate<double>("a", TILEDB_AGGREGATE_MIN) == 2);
+    CHECK(query.aggregate<double>("a", TILEDB_AGGREGATE_MAX) == 20);
+
+    auto stats = query.stats();
+    CHECK(
+        stats.find("\"Context.StorageManager.Query.AggregateReader.read_tile_"
+                   "num\": 4") != std::string::npos);
+  }
+
+  SECTION("Subarray") {
+    // Tile [1, 10] is covered and tile [11, 20] partially covered, they
+    // give the same results.
+    Query query(ctx, array, TILEDB_READ);
+    Subarray subarray(ctx, array);
+    subarray.add_range<int64_t>(0, 1, 15);
+    query.set_subarray(subarray);
+    CHECK(query.aggregate<double>("a", TILEDB_AGGREGATE_MIN) == 2);
+    CHECK(query.aggregate<double>("a", TILEDB_AGGREGATE_MAX) == 15);
+  }
+
+  array.close();
+
+  if (vfs.is_dir(array_name))
+    vfs.remove_dir(array_name);
+}
@@ -3464,6 +3464,74 @@ TEST_CASE(
   Tile::set_max_tile_chunk_size(constants::max_tile_chunk_size);
 }
 
+TEST_CASE("Filter: Test in-place stages", "[filter][in-place]") {
+  tiledb::sm::Config config;
+
+  // Many chunks of increasing values, with increasing deltas.
+  const uint64_t nelts = 100000;
+  const uint64_t tile_size = nelts * sizeof(uint64_t);
+  const uint64_t cell_size = sizeof(uint64_t);
+  const uint32_t dim_num = 0;
+
+  FilterPipeline pipeline;
+  ThreadPool tp(4);
+
+  SECTION("- Delta, bit width reduction, compression") {
+    CHECK(pipeline.add_filter(PositiveDeltaFilter()).ok());
+    CHECK(pipeline.add_filter(BitWidthReductionFilter()).ok());
+    CHECK(pipeline
+              .add_filter(
+                  CompressionFilter(tiledb::sm::Compressor::ZSTD, 1))
+              .ok());
+  }
+
+  SECTION("- Delta, delta") {
+    CHECK(pipeline.add_filter(PositiveDeltaFilter()).ok());
+    CHECK(pipeline.add_filter(PositiveDeltaFilter()).ok());
+  }
+
+  SECTION("- Checksum, delta, byteshuffle, checksum") {
+    CHECK(pipeline.add_filter(ChecksumMD5Filter()).ok());
+    CHECK(pipeline.add_filter(PositiveDeltaFilter()).ok());
+    CHECK(pipeline.add_filter(ByteshuffleFilter()).ok());
+    CHECK(pipeline.add_filter(ChecksumSHA256Filter()).ok());
+  }
+
+  SECTION("- Byteshuffle, checksum, compression") {
+    CHECK(pipeline.add_filter(ByteshuffleFilter()).ok());
+    CHECK(pipeline.add_filter(ChecksumMD5Filter()).ok());
+    CHECK(pipeline.add_filter(CompressionFilter(tiledb::sm::Compressor::LZ4, 5))
+              .ok());
+  }
+
+  Tile tile;
+  tile.init_unfiltered(
+      constants::format_version,
+      Datatype::UINT64,
+      tile_size,
+      cell_size,
+      dim_num);
+  for (uint64_t i = 0; i < nelts; i++) {
+    const uint64_t val = i * i;
+    CHECK(tile.write(&val, i * sizeof(uint64_t), sizeof(uint64_t)).ok());
+  }
+
+  CHECK(pipeline.run_forward(&test::g_helper_stats, &tile, nullptr, &tp).ok());
+  CHECK(tile.size() == 0);
+  CHECK(tile.filtered_buffer().size() != 0);
+
+  CHECK(tile.alloc_data(tile_size).ok());
+  CHECK(
+      pipeline.run_reverse(&test::g_helper_stats, &tile, nullptr, &tp, config)
+          .ok());
+  CHECK(tile.filtered_buffer().size() == 0);
+  for (uint64_t i = 0; i < nelts; i++) {
+    uint64_t elt = 0;
+    CHECK(tile.read(&elt, i * sizeof(uint64_t), sizeof(uint64_t)).ok());
+    CHECK(elt == i * i);
+  }
+}
+
 TEST_CASE("Filter: Test bitshuffle", "[filter][bitshuffle]") {
   tiledb::sm::Config config;
 
@@ -0,0 +1,174 @@
+/**
+ * @file   unit-fragment-metadata-cache.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2017-2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file unit-tests class FragmentMetadataCache.
+ */
+
+#include "catch.hpp"
+#include "tiledb/sm/buffer/buffer.h"
+#include "tiledb/sm/cache/fragment_metadata_cache.h"
+#include "tiledb/sm/stats/stats.h"
+
+#include <cstring>
+
+using namespace tiledb::common;
+using namespace tiledb::sm;
+
+struct FragmentMetadataCacheFx {
+  stats::Stats stats_;
+  FragmentMetadataCache* cache_;
+
+  FragmentMetadataCacheFx()
+      : stats_("test") {
+    cache_ = new FragmentMetadataCache(&stats_, 100);
+  }
+
+  ~FragmentMetadataCacheFx() {
+    delete cache_;
+  }
+
+  /** Returns a buffer of `nbytes` bytes set to `c`. */
+  Buffer make_buffer(uint64_t nbytes, char c) {
+    Buffer buff;
+    std::string data(nbytes, c);
+    CHECK(buff.write(data.data(), nbytes).ok());
+    return buff;
+  }
+
+  /**
+   * Returns true if the generic tile at `offset` of fragment `name` is in the
+   * cache, checking that its bytes are set to `c`.
+   */
+  bool cached(
+      const std::string& name,
+      uint32_t version,
+      uint64_t offset,
+      uint64_t nbytes,
+      char c) {
+    Buffer buff;
+    bool success = false;
+    Status st = cache_->read(
+        URI("file:///" + name), version, offset, &buff, &success);
+    CHECK(st.ok());
+    if (success) {
+      CHECK(buff.size() == nbytes);
+      CHECK(buff.offset() == 0);
+      CHECK(std::string((char*)buff.data(), nbytes) == std::string(nbytes, c));
+    }
+    return success;
+  }
+};
+
+TEST_CASE_METHOD(
+    FragmentMetadataCacheFx,
+    "Unit-test class FragmentMetadataCache",
+    "[fragment_metadata_cache]") {
+  // An item larger than the cache is not inserted
+  CHECK(cache_->insert(URI("file:///f0"), 15, 0, make_buffer(200, 'x')).ok());
+  CHECK(cache_->size() == 0);
+  CHECK(!cached("f0", 15, 0, 200, 'x'));
+
+  // Items are keyed by fragment, format version and offset. Each item counts
+  // its bytes and the bytes of the fragment URI against the budget.
+  CHECK(cache_->insert(URI("file:///f1"), 15, 0, make_buffer(10, 'a')).ok());
+  CHECK(cache_->insert(URI("file:///f1/"), 15, 8, make_buffer(10, 'b')).ok());
+  CHECK(cache_->insert(URI("file:///f2"), 15, 0, make_buffer(10, 'c')).ok());
+  CHECK(cache_->size() == 3 * (10 + std::string("file:///f1").size()));
+  CHECK(cached("f1", 15, 0, 10, 'a'));
+  CHECK(cached("f1", 15, 8, 10, 'b'));
+  CHECK(cached("f2", 15, 0, 10, 'c'));
+  CHECK(!cached("f1", 14, 0, 10, 'a'));
+  CHECK(!cached("f1", 15, 4, 10, 'a'));
+  CHECK(!cached("f3", 15, 0, 10, 'a'));
+
+  // Inserting an existing item replaces it
+  CHECK(cache_->insert(URI("file:///f2"), 15, 0, make_buffer(10, 'd')).ok());
+  CHECK(cached("f2", 15, 0, 10, 'd'));
+  CHECK(cache_->size() == 3 * (10 + std::string("file:///f1").size()));
+
+  // Touch f1 at offset 0, making f1 at offset 8 the least recently used item
+  CHECK(cached("f1", 15, 0, 10, 'a'));
+  CHECK(cache_->insert(URI("file:///f4"), 15, 0, make_buffer(31, 'e')).ok());
+  CHECK(!cached("f1", 15, 8, 10, 'b'));
+  CHECK(cached("f1", 15, 0, 10, 'a'));
+  CHECK(cached("f2", 15, 0, 10, 'd'));
+  CHECK(cached("f4", 15, 0, 31, 'e'));
+
+  // Footers are cached with the metadata file size and footer offset
+  Buffer footer = make_buffer(5, 'f');
+  CHECK(cache_->insert_footer(URI("file:///f1"), 15, 1000, 995, footer).ok());
+  uint64_t meta_file_size = 0, footer_offset = 0;
+  Buffer buff;
+  bool success = false;
+  CHECK(cache_
+            ->read_footer(
+                URI("file:///f1"),
+                15,
+                &meta_file_size,
+                &footer_offset,
+                &buff,
+                &success)
+            .ok());
+  CHECK(success);
+  CHECK(meta_file_size == 1000);
+  CHECK(footer_offset == 995);
+  CHECK(buff.size() == 5);
+  CHECK(!memcmp(buff.data(), footer.data(), 5));
+  CHECK(cache_
+            ->read_footer(
+                URI("file:///f2"),
+                15,
+                &meta_file_size,
+                &footer_offset,
+                &buff,
+                &success)
+            .ok());
+  CHECK(!success);
+
+  // Invalidating a fragment evicts all of its items
+  CHECK(cache_->invalidate(URI("file:///f1/")) == 2);
+  CHECK(!cached("f1", 15, 0, 10, 'a'));
+  CHECK(cache_
+            ->read_footer(
+                URI("file:///f1"),
+                15,
+                &meta_file_size,
+                &footer_offset,
+                &buff,
+                &success)
+            .ok());
+  CHECK(!success);
+  CHECK(cached("f2", 15, 0, 10, 'd'));
+  CHECK(cache_->invalidate(URI("file:///f1")) == 0);
+
+  // Clear the cache
+  cache_->clear();
+  CHECK(cache_->size() == 0);
+  CHECK(!cached("f2", 15, 0, 10, 'd'));
+}
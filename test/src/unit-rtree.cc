@@ -313,6 +313,40 @@ TEST_CASE("RTree: Test 1D R-tree, height 2", "[rtree][1d][2h]") {
   CHECK(overlap.tiles_[1].second == 2.0 / 3);
 }
 
+TEST_CASE("RTree: Test freeing the flat levels", "[rtree][1d][flat]") {
+  std::vector<bool> is_default(1, false);
+  int32_t dim_dom[] = {1, 1000};
+  int32_t dim_extent = 10;
+  Domain dom1 =
+      create_domain({"d"}, {Datatype::INT32}, {dim_dom}, {&dim_extent});
+  std::vector<NDRange> mbrs = create_mbrs<int32_t, 1>({1, 3, 5, 10, 20, 22});
+  const Domain d1{&dom1};
+  RTree rtree(&d1, 3);
+  rtree.set_leaves(mbrs);
+  rtree.build_tree();
+
+  // The root and the 3 leaves, with a start and an end each.
+  CHECK(rtree.flat_levels_size() == 4 * 2 * sizeof(int32_t));
+
+  // Queries give the same results without the flat levels.
+  NDRange range(1);
+  int32_t r_partial[] = {6, 21};
+  range[0].set_range(r_partial, 2 * sizeof(int32_t));
+  auto flat_overlap = rtree.get_tile_overlap(range, is_default);
+  rtree.free_flat_levels();
+  CHECK(rtree.flat_levels_size() == 0);
+  auto overlap = rtree.get_tile_overlap(range, is_default);
+  CHECK(overlap.tiles_ == flat_overlap.tiles_);
+  CHECK(overlap.tile_ranges_ == flat_overlap.tile_ranges_);
+  CHECK(overlap.tiles_.size() == 2);
+
+  // Freeing the tree reports the flat levels it holds.
+  rtree.set_leaves(mbrs);
+  rtree.build_tree();
+  CHECK(rtree.free_memory() == 4 * 2 * sizeof(int32_t));
+  CHECK(rtree.height() == 0);
+}
+
 TEST_CASE("RTree: Test 1D R-tree, height 3", "[rtree][1d][3h]") {
   // Build tree
   std::vector<bool> is_default(1, false);
@@ -1213,3 +1247,89 @@ TEST_CASE(
   CHECK(overlap.tiles_[1].second == 1.0 / 3);
   */
 }
+
+TEST_CASE(
+    "RTree: Test 2D R-tree, batched tile overlap against brute force",
+    "[rtree][2d][batch]") {
+  // Build a tree over a grid of 20x20 tiles in row-major order
+  int32_t dim_dom[] = {1, 1000};
+  int32_t dim_extent = 10;
+  Domain dom = create_domain(
+      {"d1", "d2"},
+      {Datatype::INT32, Datatype::INT32},
+      {dim_dom, dim_dom},
+      {&dim_extent, &dim_extent});
+  std::vector<int32_t> mbr_vals;
+  for (int32_t i = 0; i < 20; ++i) {
+    for (int32_t j = 0; j < 20; ++j) {
+      mbr_vals.insert(
+          mbr_vals.end(),
+          {i * 10 + 1, i * 10 + 8, j * 10 + 2, j * 10 + 10});
+    }
+  }
+  std::vector<NDRange> mbrs = create_mbrs<int32_t, 2>(mbr_vals);
+  const Domain d{&dom};
+  RTree rtree(&d, 5);
+  rtree.set_leaves(mbrs);
+  rtree.build_tree();
+  CHECK(rtree.height() == 5);
+
+  // Create random ranges
+  std::srand(7);
+  std::vector<NDRange> ranges(100);
+  for (auto& range : ranges) {
+    range.resize(2);
+    for (unsigned dim = 0; dim < 2; ++dim) {
+      int32_t r[2] = {1 + std::rand() % 200, 1 + std::rand() % 200};
+      if (r[0] > r[1])
+        std::swap(r[0], r[1]);
+      range[dim].set_range(r, sizeof(r));
+    }
+  }
+
+  for (bool first_default : {false, true}) {
+    std::vector<bool> is_default = {first_default, false};
+    std::vector<TileOverlap> overlaps;
+    rtree.get_tile_overlap(ranges, is_default, &overlaps);
+    REQUIRE(overlaps.size() == ranges.size());
+
+    for (size_t r = 0; r < ranges.size(); ++r) {
+      // The batched and single range queries agree
+      auto overlap = rtree.get_tile_overlap(ranges[r], is_default);
+      CHECK(overlap.tile_ranges_ == overlaps[r].tile_ranges_);
+      CHECK(overlap.tiles_ == overlaps[r].tiles_);
+
+      // Both agree with testing every leaf
+      std::vector<uint64_t> full, partial;
+      for (const auto& [start, end] : overlap.tile_ranges_) {
+        for (auto t = start; t <= end; ++t)
+          full.push_back(t);
+      }
+      for (const auto& [t, ratio] : overlap.tiles_) {
+        partial.push_back(t);
+        CHECK(ratio == d.overlap_ratio(ranges[r], is_default, mbrs[t]));
+      }
+      std::vector<uint64_t> expected_full, expected_partial;
+      for (uint64_t t = 0; t < mbrs.size(); ++t) {
+        auto ratio = d.overlap_ratio(ranges[r], is_default, mbrs[t]);
+        if (ratio == 1.0)
+          expected_full.push_back(t);
+        else if (ratio != 0.0)
+          expected_partial.push_back(t);
+      }
+      CHECK(full == expected_full);
+      CHECK(partial == expected_partial);
+
+      // The tile bitmap of each dimension agrees with testing every leaf
+      for (unsigned dim = 0; dim < 2; ++dim) {
+        std::vector<uint8_t> bitmap(mbrs.size(), 0);
+        rtree.compute_tile_bitmap(ranges[r][dim], dim, &bitmap);
+        for (uint64_t t = 0; t < mbrs.size(); ++t) {
+          CHECK(
+              bitmap[t] ==
+              d.dimension_ptr(dim)->overlap(ranges[r][dim], mbrs[t][dim]));
+        }
+      }
+    }
+  }
+}
@@ -44,6 +44,9 @@
 
 #include <catch.hpp>
 
+#include <algorithm>
+#include <thread>
+
 using namespace tiledb;
 using namespace tiledb::test;
 
@@ -63,6 +66,8 @@ struct CSparseGlobalOrderFx {
   std::string ratio_array_data_;
   std::string ratio_coords_;
   std::string ratio_query_condition_;
+  std::string merge_partition_min_cells_;
+  std::string compute_concurrency_level_;
 
   void create_default_array_1d(bool allow_dups = false);
   void write_1d_fragment(
@@ -109,6 +114,9 @@ void CSparseGlobalOrderFx::reset_config() {
   ratio_array_data_ = "0.1";
   ratio_coords_ = "0.5";
   ratio_query_condition_ = "0.25";
+  merge_partition_min_cells_ = "65536";
+  compute_concurrency_level_ =
+      std::to_string(std::thread::hardware_concurrency());
   update_config();
 }
 
@@ -170,6 +178,22 @@ void CSparseGlobalOrderFx::update_config() {
           &error) == TILEDB_OK);
   REQUIRE(error == nullptr);
 
+  REQUIRE(
+      tiledb_config_set(
+          config,
+          "sm.query.sparse_global_order.merge_partition_min_cells",
+          merge_partition_min_cells_.c_str(),
+          &error) == TILEDB_OK);
+  REQUIRE(error == nullptr);
+
+  REQUIRE(
+      tiledb_config_set(
+          config,
+          "sm.compute_concurrency_level",
+          compute_concurrency_level_.c_str(),
+          &error) == TILEDB_OK);
+  REQUIRE(error == nullptr);
+
   REQUIRE(tiledb_ctx_alloc(config, &ctx_) == TILEDB_OK);
   REQUIRE(error == nullptr);
   REQUIRE(tiledb_vfs_alloc(ctx_, config, &vfs_) == TILEDB_OK);
@@ -910,6 +934,119 @@ TEST_CASE_METHOD(
   CHECK(!std::memcmp(data_c, data_r, data_r_size));
 }
 
+TEST_CASE_METHOD(
+    CSparseGlobalOrderFx,
+    "Sparse global order reader: parallel merge with dups",
+    "[sparse-global-order][merge][parallel][dups]") {
+  // Create default array.
+  reset_config();
+  create_default_array_1d(true);
+
+  bool use_subarray = GENERATE(true, false);
+  bool use_qc = GENERATE(true, false);
+  bool small_coords_budget = GENERATE(true, false);
+  uint64_t buffer_cells = GENERATE(7, 200);
+
+  // Write fragments with overlapping coordinates.
+  int num_frags = 8;
+  std::vector<std::pair<int, int>> expected;
+  for (int f = 0; f < num_frags; f++) {
+    std::vector<int> coords;
+    std::vector<int> data;
+    for (int i = 0; i < 10; i++) {
+      coords.emplace_back(1 + (2 * i + f) % 20);
+    }
+    std::sort(coords.begin(), coords.end());
+    for (int i = 0; i < 10; i++) {
+      data.emplace_back(f + i);
+      if ((!use_subarray || coords[i] <= 10) && (!use_qc || data[i] < 11)) {
+        expected.emplace_back(coords[i], data[i]);
+      }
+    }
+
+    uint64_t coords_size = coords.size() * sizeof(int);
+    uint64_t data_size = data.size() * sizeof(int);
+    write_1d_fragment(coords.data(), &coords_size, data.data(), &data_size);
+  }
+
+  // Merge with at least one cell per range, on multiple threads.
+  merge_partition_min_cells_ = "1";
+  compute_concurrency_level_ = "4";
+  if (small_coords_budget) {
+    total_budget_ = "10000";
+    ratio_coords_ = "0.2";
+  }
+  update_config();
+
+  // Read until complete.
+  std::vector<int> coords_r(buffer_cells);
+  std::vector<int> data_r(buffer_cells);
+  uint64_t coords_r_size = coords_r.size() * sizeof(int);
+  uint64_t data_r_size = data_r.size() * sizeof(int);
+  tiledb_array_t* array = nullptr;
+  tiledb_query_t* query = nullptr;
+  auto rc = read(
+      use_subarray,
+      use_qc,
+      coords_r.data(),
+      &coords_r_size,
+      data_r.data(),
+      &data_r_size,
+      &query,
+      &array);
+  CHECK(rc == TILEDB_OK);
+
+  std::vector<std::pair<int, int>> results;
+  tiledb_query_status_t status;
+  while (true) {
+    for (uint64_t c = 0; c < coords_r_size / sizeof(int); c++) {
+      results.emplace_back(coords_r[c], data_r[c]);
+    }
+
+    tiledb_query_get_status(ctx_, query, &status);
+    if (status != TILEDB_INCOMPLETE) {
+      break;
+    }
+
+    coords_r_size = coords_r.size() * sizeof(int);
+    data_r_size = data_r.size() * sizeof(int);
+    rc = tiledb_query_submit(ctx_, query);
+    REQUIRE(rc == TILEDB_OK);
+  }
+  CHECK(status == TILEDB_COMPLETED);
+
+  // The coordinates are in global order, the order of duplicates is not
+  // defined.
+  CHECK(std::is_sorted(
+      results.begin(), results.end(), [](const auto& a, const auto& b) {
+        return a.first < b.first;
+      }));
+  std::sort(results.begin(), results.end());
+  std::sort(expected.begin(), expected.end());
+  CHECK(results == expected);
+
+  // Without a small budget, all tiles are loaded at once and the cells are
+  // merged in parallel.
+  if (!small_coords_budget && buffer_cells == 200) {
+    auto stats =
+        ((sm::SparseGlobalOrderReader<uint8_t>*)query->query_->strategy())
+            ->stats();
+    REQUIRE(stats != nullptr);
+    auto counters = stats->counters();
+    REQUIRE(counters != nullptr);
+    auto merge_range_num =
+        counters->find("Context.StorageManager.Query.Reader.merge_range_num");
+    REQUIRE(merge_range_num != counters->end());
+    CHECK(merge_range_num->second > 1);
+  }
+
+  // Clean up.
+  rc = tiledb_array_close(ctx_, array);
+  CHECK(rc == TILEDB_OK);
+  tiledb_array_free(&array);
+  tiledb_query_free(&query);
+}
+
 TEST_CASE(
     "Sparse global order reader: user buffer cannot fit single cell",
     "[sparse-global-order][user-buffer][too-small]") {
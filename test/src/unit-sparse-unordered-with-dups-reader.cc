@@ -46,6 +46,8 @@
 
 #include <catch.hpp>
 
+#include <chrono>
+
 using namespace tiledb::sm;
 using namespace tiledb::test;
 
@@ -64,6 +66,8 @@ struct CSparseUnorderedWithDupsFx {
   std::string ratio_array_data_;
   std::string ratio_coords_;
   std::string ratio_query_condition_;
+  std::string context_budget_;
+  std::string admission_timeout_;
 
   void create_default_array_1d();
   void create_default_array_1d_string();
@@ -118,6 +122,8 @@ void CSparseUnorderedWithDupsFx::reset_config() {
   ratio_array_data_ = "0.1";
   ratio_coords_ = "0.5";
   ratio_query_condition_ = "0.25";
+  context_budget_ = "0";
+  admission_timeout_ = "10";
   update_config();
 }
 
@@ -179,6 +185,20 @@ void CSparseUnorderedWithDupsFx::update_config() {
           &error) == TILEDB_OK);
   REQUIRE(error == nullptr);
 
+  REQUIRE(
+      tiledb_config_set(
+          config, "sm.mem.context_budget", context_budget_.c_str(), &error) ==
+      TILEDB_OK);
+  REQUIRE(error == nullptr);
+
+  REQUIRE(
+      tiledb_config_set(
+          config,
+          "sm.mem.admission_timeout_ms",
+          admission_timeout_.c_str(),
+          &error) == TILEDB_OK);
+  REQUIRE(error == nullptr);
+
   REQUIRE(tiledb_ctx_alloc(config, &ctx_) == TILEDB_OK);
   REQUIRE(error == nullptr);
   REQUIRE(tiledb_vfs_alloc(ctx_, config, &vfs_) == TILEDB_OK);
@@ -689,6 +709,110 @@ TEST_CASE_METHOD(
       std::string::npos);
 }
 
+TEST_CASE_METHOD(
+    CSparseUnorderedWithDupsFx,
+    "Sparse unordered with dups reader: context budget exceeded",
+    "[sparse-unordered-with-dups][context-budget][budget-exceeded]") {
+  // Create default array.
+  reset_config();
+  create_default_array_1d();
+
+  // Write a fragment.
+  int coords[] = {1, 2, 3, 4, 5};
+  uint64_t coords_size = sizeof(coords);
+  int data[] = {1, 2, 3, 4, 5};
+  uint64_t data_size = sizeof(data);
+  write_1d_fragment(coords, &coords_size, data, &data_size);
+
+  // The context budget fits one reader, which reserves 90% of its budget.
+  context_budget_ = "1000000";
+  update_config();
+
+  // The first read reserves its budget until the query is freed.
+  int coords_r[5];
+  int data_r[5];
+  uint64_t coords_r_size = sizeof(coords_r);
+  uint64_t data_r_size = sizeof(data_r);
+  tiledb_query_t* query = nullptr;
+  tiledb_array_t* array = nullptr;
+  auto rc = read(
+      false,
+      false,
+      coords_r,
+      &coords_r_size,
+      data_r,
+      &data_r_size,
+      &query,
+      &array);
+  CHECK(rc == TILEDB_OK);
+  CHECK(coords_r_size == sizeof(coords));
+
+  // The second read cannot reserve a tenth of its budget.
+  coords_r_size = sizeof(coords_r);
+  data_r_size = sizeof(data_r);
+  rc = read(false, false, coords_r, &coords_r_size, data_r, &data_r_size);
+  CHECK(rc == TILEDB_ERR);
+
+  // Check we hit the correct error.
+  tiledb_error_t* error = NULL;
+  rc = tiledb_ctx_get_last_error(ctx_, &error);
+  CHECK(rc == TILEDB_OK);
+
+  const char* msg;
+  rc = tiledb_error_message(error, &msg);
+  CHECK(rc == TILEDB_OK);
+
+  std::string error_str(msg);
+  CHECK(
+      error_str.find("Not enough memory available in the context memory "
+                     "budget") != std::string::npos);
+
+  // Free the first query, the next read gets its budget.
+  rc = tiledb_array_close(ctx_, array);
+  CHECK(rc == TILEDB_OK);
+  tiledb_array_free(&array);
+  tiledb_query_free(&query);
+
+  coords_r_size = sizeof(coords_r);
+  data_r_size = sizeof(data_r);
+  rc = read(false, false, coords_r, &coords_r_size, data_r, &data_r_size);
+  CHECK(rc == TILEDB_OK);
+  CHECK(coords_r_size == sizeof(coords));
+}
+
+TEST_CASE_METHOD(
+    CSparseUnorderedWithDupsFx,
+    "Sparse unordered with dups reader: context budget below reader budget",
+    "[sparse-unordered-with-dups][context-budget]") {
+  // Create default array.
+  reset_config();
+  create_default_array_1d();
+
+  // Write a fragment.
+  int coords[] = {1, 2, 3, 4, 5};
+  uint64_t coords_size = sizeof(coords);
+  int data[] = {1, 2, 3, 4, 5};
+  uint64_t data_size = sizeof(data);
+  write_1d_fragment(coords, &coords_size, data, &data_size);
+
+  // The reader requests more than the whole context budget, no release can
+  // satisfy it so it should shrink right away instead of waiting.
+  context_budget_ = "500000";
+  admission_timeout_ = "60000";
+  update_config();
+
+  int coords_r[5];
+  int data_r[5];
+  uint64_t coords_r_size = sizeof(coords_r);
+  uint64_t data_r_size = sizeof(data_r);
+  auto start = std::chrono::steady_clock::now();
+  auto rc = read(false, false, coords_r, &coords_r_size, data_r, &data_r_size);
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  CHECK(rc == TILEDB_OK);
+  CHECK(coords_r_size == sizeof(coords));
+  CHECK(elapsed < std::chrono::seconds(30));
+}
+
 TEST_CASE_METHOD(
     CSparseUnorderedWithDupsFx,
     "Sparse unordered with dups reader: tile offsets budget exceeded",
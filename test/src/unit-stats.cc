@@ -0,0 +1,178 @@
+/**
+ * @file   unit-stats.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Tests the `Stats` class.
+ */
+
+#include <catch.hpp>
+#include "tiledb/sm/stats/stats.h"
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace tiledb::sm::stats;
+
+#ifdef TILEDB_STATS
+
+TEST_CASE("Stats: Test registered counters and timers", "[stats]") {
+  Stats stats("test");
+  Stats* child = stats.create_child("Child");
+
+  const StatId id = child->register_stat("op");
+  CHECK(child->register_stat("op") == id);
+  CHECK(child->register_stat("other_op") != id);
+
+  // Registered and named updates of the same stat are merged.
+  child->add_counter(id, 2);
+  child->add_counter("op", 3);
+  { auto timer = child->start_timer(id); }
+  { auto timer = child->start_timer("op"); }
+
+  const std::string dump = stats.dump(2, 0);
+  CHECK(dump.find("\"test.Child.op\": 5") != std::string::npos);
+  CHECK(dump.find("\"test.Child.op.sum\"") != std::string::npos);
+  CHECK(dump.find("\"test.Child.op.avg\"") != std::string::npos);
+  CHECK(dump.find("timer_count") == std::string::npos);
+  CHECK(dump.find("other_op") == std::string::npos);
+
+  // The serialization maps include the registered stats.
+  CHECK((*child->counters())["test.Child.op"] == 5);
+  CHECK((*child->counters())["test.Child.op.timer_count"] == 2);
+  CHECK(child->timers()->count("test.Child.op.max") == 1);
+  CHECK(
+      stats.dump(2, 0).find("\"test.Child.op\": 5") != std::string::npos);
+
+  stats.reset();
+  CHECK(stats.dump(2, 0).empty());
+}
+
+TEST_CASE("Stats: Test concurrent counters and timers", "[stats]") {
+  Stats stats("test");
+  const StatId id = stats.register_stat("op");
+
+  const unsigned thread_num = 16;
+  const uint64_t update_num = 10000;
+  std::vector<std::thread> threads;
+  for (unsigned t = 0; t < thread_num; t++) {
+    threads.emplace_back([&stats, id]() {
+      for (uint64_t i = 0; i < update_num; i++) {
+        auto timer = stats.start_timer(id);
+        stats.add_counter(id, 1);
+      }
+    });
+  }
+  for (auto& thread : threads)
+    thread.join();
+
+  CHECK((*stats.counters())["test.op"] == thread_num * update_num);
+  CHECK((*stats.counters())["test.op.timer_count"] == thread_num * update_num);
+}
+
+TEST_CASE("Stats: Test many registered stats", "[stats]") {
+  Stats stats("test");
+
+  // The registered stats span several chunks of increasing size.
+  const unsigned stat_num = 5000;
+  std::vector<StatId> ids;
+  for (unsigned i = 0; i < stat_num; i++)
+    ids.emplace_back(stats.register_stat("op" + std::to_string(i)));
+  for (unsigned i = 0; i < stat_num; i++)
+    stats.add_counter(ids[i], i + 1);
+
+  auto counters = stats.counters();
+  for (unsigned i = 0; i < stat_num; i++)
+    CHECK((*counters)["test.op" + std::to_string(i)] == i + 1);
+}
+
+TEST_CASE("Stats: Test timer histograms", "[stats]") {
+  Stats stats("test");
+  Stats* child1 = stats.create_child("Child");
+  Stats* child2 = stats.create_child("Child");
+
+  // The timers of both children are merged in the histogram.
+  const StatId id = child1->register_histogram("op");
+  child2->register_histogram("op");
+  for (unsigned i = 0; i < 100; i++) {
+    auto timer = child1->start_timer(id);
+  }
+  {
+    auto timer = child2->start_timer("op");
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  }
+  { auto timer = child2->start_timer("other_op"); }
+
+  const std::string dump = stats.dump(2, 0);
+  CHECK(dump.find("\"test.Child.op.p50\"") != std::string::npos);
+  CHECK(dump.find("\"test.Child.op.p99\"") != std::string::npos);
+  CHECK(dump.find("\"test.Child.op.p999\"") != std::string::npos);
+  CHECK(dump.find("\"test.Child.other_op.p50\"") == std::string::npos);
+
+  // The straggler is the 99.9th percentile, within the bucket width.
+  auto pos = dump.find("\"test.Child.op.p999\": ");
+  REQUIRE(pos != std::string::npos);
+  const double p999 = std::stod(dump.substr(pos + 22));
+  CHECK(p999 > 0.015);
+  CHECK(p999 < 0.1);
+  pos = dump.find("\"test.Child.op.p50\": ");
+  REQUIRE(pos != std::string::npos);
+  CHECK(std::stod(dump.substr(pos + 21)) < 0.015);
+}
+
+TEST_CASE("Stats: Test trace", "[stats]") {
+  Stats stats("test");
+  Stats* child = stats.create_child("Child");
+  CHECK(child->dump_trace().empty());
+
+  // Only the timers of the traced subtree are recorded, up to the
+  // trace capacity.
+  child->enable_trace(3);
+  Stats* grandchild = child->create_child("Grandchild");
+  { auto timer = stats.start_timer("untraced_op"); }
+  {
+    auto timer = child->start_timer("outer_op");
+    auto timer2 = grandchild->start_timer("inner_op");
+  }
+  for (unsigned i = 0; i < 3; i++) {
+    auto timer = child->start_timer("op");
+  }
+
+  const std::string trace = child->dump_trace();
+  CHECK(trace.find("\"traceEvents\"") == 1);
+  CHECK(trace.find("untraced_op") == std::string::npos);
+  CHECK(trace.find("\"name\": \"test.Child.outer_op\"") != std::string::npos);
+  CHECK(
+      trace.find("\"name\": \"test.Child.Grandchild.inner_op\"") !=
+      std::string::npos);
+  CHECK(trace.find("\"ph\": \"X\"") != std::string::npos);
+  CHECK(trace.find("\"dropped_span_num\": 2") != std::string::npos);
+}
+
+#endif
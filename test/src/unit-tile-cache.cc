@@ -0,0 +1,290 @@
+/**
+ * @file unit-tile-cache.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2017-2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file unit-tests class TileCache.
+ */
+
+#include "catch.hpp"
+#include "tiledb/sm/cache/tile_cache.h"
+#include "tiledb/sm/stats/stats.h"
+#include "tiledb/sm/tile/filtered_buffer.h"
+
+using namespace tiledb::common;
+using namespace tiledb::sm;
+
+#define CACHE_SIZE 10 * sizeof(int)
+#define CACHE_ZERO_SIZE 0
+
+struct TileCacheFx {
+  stats::Stats stats_;
+  TileCache* tile_cache_;
+
+  TileCacheFx()
+      : stats_("test") {
+    tile_cache_ = new TileCache(&stats_, CACHE_SIZE);
+  }
+
+  ~TileCacheFx() {
+    delete tile_cache_;
+  }
+
+  /** Returns the key of a tile of fragment `fragment_id`. */
+  static TileCacheKey key(uint64_t fragment_id, uint64_t tile_idx = 0) {
+    return TileCacheKey(fragment_id, 0, TileCacheFile::FIXED, tile_idx);
+  }
+
+  /** Returns true if the first `nbytes` of a tile are in the cache. */
+  bool cached(TileCache* cache, uint64_t fragment_id, uint64_t nbytes) {
+    FilteredBuffer buf(nbytes);
+    bool success = false;
+    Status st = cache->read(key(fragment_id), buf, nbytes, &success);
+    CHECK(st.ok());
+    return success;
+  }
+
+  /** Inserts a tile of `nbytes` of fragment `fragment_id` in the cache. */
+  void insert(TileCache* cache, uint64_t fragment_id, uint64_t nbytes) {
+    FilteredBuffer v(nbytes);
+    Status st = cache->insert(key(fragment_id), std::move(v));
+    CHECK(st.ok());
+  }
+};
+
+TEST_CASE_METHOD(TileCacheFx, "Unit-test class TileCache", "[tile_cache]") {
+  // Insert an object larger than CACHE_SIZE
+  insert(tile_cache_, 0, CACHE_SIZE + 1);
+  CHECK(!cached(tile_cache_, 0, sizeof(int)));
+
+  // Prepare some vectors
+  FilteredBuffer v1(sizeof(int) * 3);
+  FilteredBuffer v2(sizeof(int) * 3);
+  FilteredBuffer v3(sizeof(int) * 3);
+
+  for (int i = 0; i < 3; ++i) {
+    v1.data_as<int>()[i] = i;
+    v2.data_as<int>()[i] = 3 + i;
+    v3.data_as<int>()[i] = 6 + i;
+  }
+
+  // Insert 3 items in the cache
+  FilteredBuffer v1_cp(v1);
+  Status st = tile_cache_->insert(key(1), std::move(v1_cp));
+  CHECK(st.ok());
+  FilteredBuffer v2_cp(v2);
+  st = tile_cache_->insert(key(2), std::move(v2_cp));
+  CHECK(st.ok());
+  FilteredBuffer v3_cp(v3);
+  st = tile_cache_->insert(key(3), std::move(v3_cp));
+  CHECK(st.ok());
+  CHECK(tile_cache_->size() == 9 * sizeof(int));
+
+  // Read non-existent item, and items of a cached fragment with another tile
+  // index, field or file
+  FilteredBuffer v_buf(3 * sizeof(int));
+  bool success;
+  st = tile_cache_->read(key(0), v_buf, sizeof(int), &success);
+  CHECK(st.ok());
+  CHECK(!success);
+  st = tile_cache_->read(key(1, 1), v_buf, sizeof(int), &success);
+  CHECK(st.ok());
+  CHECK(!success);
+  st = tile_cache_->read(
+      TileCacheKey(1, 1, TileCacheFile::FIXED, 0),
+      v_buf,
+      sizeof(int),
+      &success);
+  CHECK(st.ok());
+  CHECK(!success);
+  st = tile_cache_->read(
+      TileCacheKey(1, 0, TileCacheFile::VAR, 0), v_buf, sizeof(int), &success);
+  CHECK(st.ok());
+  CHECK(!success);
+
+  // Read full v3
+  st = tile_cache_->read(key(3), v_buf, 3 * sizeof(int), &success);
+  CHECK(st.ok());
+  CHECK(success);
+  CHECK(!memcmp(v_buf.data(), v3.data(), 3 * sizeof(int)));
+
+  // Read partial v2, which makes v1 the least recently used item
+  st = tile_cache_->read(key(2), v_buf, sizeof(int), &success);
+  CHECK(st.ok());
+  CHECK(success);
+  CHECK(*reinterpret_cast<int*>(v_buf.data()) == v2.data_as<int>()[0]);
+
+  // Read out of bounds
+  st = tile_cache_->read(key(2), v_buf, 4 * sizeof(int), &success);
+  CHECK(!st.ok());
+
+  // Test eviction: the order is v1-v3-v2, so v1 and v3 are evicted
+  insert(tile_cache_, 4, sizeof(int) * 5);
+  CHECK(!cached(tile_cache_, 1, sizeof(int)));
+  CHECK(!cached(tile_cache_, 3, sizeof(int)));
+  CHECK(cached(tile_cache_, 2, sizeof(int)));
+  CHECK(cached(tile_cache_, 4, sizeof(int)));
+  CHECK(tile_cache_->size() == 8 * sizeof(int));
+#ifdef TILEDB_STATS
+  CHECK(
+      stats_.dump(2, 0).find("\"test.TileCache.evicted_tile_num\": 2") !=
+      std::string::npos);
+#endif
+
+  // Test clear
+  tile_cache_->clear();
+  CHECK(tile_cache_->size() == 0);
+  CHECK(!cached(tile_cache_, 2, sizeof(int)));
+  CHECK(!cached(tile_cache_, 4, sizeof(int)));
+}
+
+TEST_CASE_METHOD(TileCacheFx, "TileCache item invalidation", "[tile_cache]") {
+  insert(tile_cache_, 1, sizeof(int) * 3);
+  insert(tile_cache_, 2, sizeof(int) * 3);
+
+  // Check invalidate non-existent key
+  bool success;
+  Status st = tile_cache_->invalidate(key(0), &success);
+  CHECK(st.ok());
+  CHECK(!success);
+  CHECK(tile_cache_->size() == 6 * sizeof(int));
+
+  // Check invalidate head of list
+  st = tile_cache_->invalidate(key(1), &success);
+  CHECK(st.ok());
+  CHECK(success);
+  st = tile_cache_->invalidate(key(1), &success);
+  CHECK(st.ok());
+  CHECK(!success);
+  CHECK(tile_cache_->size() == 3 * sizeof(int));
+
+  insert(tile_cache_, 3, sizeof(int) * 3);
+  insert(tile_cache_, 4, sizeof(int) * 4);
+  CHECK(tile_cache_->size() == 10 * sizeof(int));
+
+  // Check invalidate middle of list
+  st = tile_cache_->invalidate(key(3), &success);
+  CHECK(st.ok());
+  CHECK(success);
+  CHECK(!cached(tile_cache_, 3, sizeof(int)));
+
+  // Check invalidate end of list
+  st = tile_cache_->invalidate(key(4), &success);
+  CHECK(st.ok());
+  CHECK(success);
+  CHECK(!cached(tile_cache_, 4, sizeof(int)));
+
+  // Check invalidate final element
+  st = tile_cache_->invalidate(key(2), &success);
+  CHECK(st.ok());
+  CHECK(success);
+  CHECK(tile_cache_->size() == 0);
+}
+
+TEST_CASE_METHOD(TileCacheFx, "TileCache of 0 capacity", "[tile_cache]") {
+  TileCache tile_cache(&stats_, CACHE_ZERO_SIZE);
+  CHECK(tile_cache.size() == 0);
+
+  // Test insert and read
+  insert(&tile_cache, 0, CACHE_ZERO_SIZE + 1);
+  CHECK(!cached(&tile_cache, 0, sizeof(int)));
+  CHECK(tile_cache.size() == 0);
+
+  // Test invalidate
+  bool success;
+  Status st = tile_cache.invalidate(key(0), &success);
+  CHECK(st.ok());
+  CHECK(!success);
+}
+
+TEST_CASE_METHOD(
+    TileCacheFx, "TileCache eviction policies", "[tile_cache]") {
+  // Read a hot tile once, then scan four other tiles through the cache.
+  auto scan = [&](TileCache* cache) {
+    insert(cache, 10, sizeof(int) * 3);
+    CHECK(cached(cache, 10, sizeof(int)));
+    insert(cache, 11, sizeof(int) * 3);
+    insert(cache, 12, sizeof(int) * 3);
+    insert(cache, 13, sizeof(int) * 3);
+    insert(cache, 14, sizeof(int) * 3);
+    CHECK(cache->size() == 9 * sizeof(int));
+    CHECK(cached(cache, 14, sizeof(int)));
+  };
+
+  SECTION("LRU") {
+    TileCache cache(&stats_, CACHE_SIZE, 1, TileCachePolicy::LRU);
+    scan(&cache);
+    CHECK(!cached(&cache, 10, sizeof(int)));
+  }
+
+  SECTION("SLRU") {
+    TileCache cache(&stats_, CACHE_SIZE, 1, TileCachePolicy::SLRU);
+    scan(&cache);
+    CHECK(cached(&cache, 10, sizeof(int)));
+    CHECK(!cached(&cache, 11, sizeof(int)));
+    CHECK(!cached(&cache, 12, sizeof(int)));
+  }
+}
+
+TEST_CASE_METHOD(TileCacheFx, "TileCache shards", "[tile_cache]") {
+  const uint64_t shard_num = 4;
+  TileCache cache(&stats_, 1024 * shard_num, shard_num);
+  CHECK(cache.shard_num() == shard_num);
+
+  // Tiles larger than a shard are not cached.
+  insert(&cache, 100, 1025);
+  CHECK(!cached(&cache, 100, 1));
+
+  // Tiles spread over the shards are all found again.
+  for (int i = 0; i < 16; ++i)
+    insert(&cache, i, 16);
+  CHECK(cache.size() == 16 * 16);
+  for (int i = 0; i < 16; ++i)
+    CHECK(cached(&cache, i, 16));
+
+  // Clearing empties all shards.
+  cache.clear();
+  CHECK(cache.size() == 0);
+}
+
+TEST_CASE_METHOD(
+    TileCacheFx, "TileCache derived shard number", "[tile_cache]") {
+  const uint64_t min_size = TileCache::min_auto_shard_size_;
+
+  // Small caches keep a single shard, so that any tile that fits in the
+  // cache is cached.
+  TileCache cache(&stats_, 10000000, 0);
+  CHECK(cache.shard_num() == 1);
+  CHECK(TileCache::auto_shard_num(0) == 1);
+  CHECK(TileCache::auto_shard_num(2 * min_size - 1) == 1);
+
+  // Larger caches get one shard per minimum shard size, up to a maximum.
+  CHECK(TileCache::auto_shard_num(2 * min_size) == 2);
+  CHECK(
+      TileCache::auto_shard_num(1000 * min_size) ==
+      TileCache::max_auto_shard_num_);
+}
@@ -241,6 +241,272 @@ TEST_CASE("VFS: Test read batching", "[vfs]") {
   REQUIRE(vfs->terminate().ok());
 }
 
+TEST_CASE("VFS: Test read batching stats", "[vfs]") {
+  ThreadPool compute_tp(4);
+  ThreadPool io_tp(4);
+  stats::Stats stats("test");
+
+  URI testfile("vfs_unit_test_data");
+  std::unique_ptr<VFS> vfs(new VFS);
+  REQUIRE(vfs->init(&stats, &compute_tp, &io_tp, nullptr, nullptr).ok());
+
+  bool exists = false;
+  REQUIRE(vfs->is_file(testfile, &exists).ok());
+  if (exists)
+    REQUIRE(vfs->remove_file(testfile).ok());
+
+  // Write some data.
+  const unsigned nelts = 100;
+  uint32_t data_write[nelts];
+  for (unsigned i = 0; i < nelts; i++) {
+    data_write[i] = i;
+  }
+  REQUIRE(vfs->write(testfile, data_write, nelts * sizeof(uint32_t)).ok());
+  REQUIRE(vfs->close_file(testfile).ok());
+
+  // Read every other element: the regions are merged into a single read
+  // that also reads the gaps between them.
+  std::vector<Tile> tiles(nelts / 2);
+  std::vector<tuple<uint64_t, Tile*, uint64_t>> regions;
+  for (unsigned i = 0; i < nelts / 2; i++) {
+    tiles[i].filtered_buffer().expand(sizeof(uint32_t));
+    regions.emplace_back(2 * i * sizeof(uint32_t), &tiles[i], sizeof(uint32_t));
+  }
+  std::vector<ThreadPool::Task> tasks;
+  REQUIRE(vfs->read_all(testfile, regions, &io_tp, &tasks).ok());
+  REQUIRE(io_tp.wait_all(tasks).ok());
+  for (unsigned i = 0; i < nelts / 2; i++) {
+    CHECK(tiles[i].filtered_buffer().data_as<uint32_t>()[0] == 2 * i);
+  }
+
+  auto dump = stats.dump(2, 0);
+  CHECK(
+      dump.find("\"test.VFS.read_batch_saved_ops_num\": 49") !=
+      std::string::npos);
+  CHECK(
+      dump.find("\"test.VFS.read_batch_wasted_byte_num\": 196") !=
+      std::string::npos);
+
+  REQUIRE(vfs->remove_file(testfile).ok());
+  REQUIRE(vfs->terminate().ok());
+}
+
+TEST_CASE("VFS: Test adaptive read-ahead", "[vfs][read-ahead]") {
+  ThreadPool compute_tp(4);
+  ThreadPool io_tp(4);
+  stats::Stats stats("test");
+
+  Config default_config, vfs_config;
+  vfs_config.set("vfs.read_ahead_size", "4096");
+  vfs_config.set("vfs.read_ahead_max_size", "65536");
+  vfs_config.set("vfs.read_ahead_local", "true");
+  std::unique_ptr<VFS> vfs(new VFS);
+  REQUIRE(vfs->init(&stats, &compute_tp, &io_tp, &default_config, &vfs_config)
+              .ok());
+
+  const bool memfs = GENERATE(false, true);
+  URI testfile(memfs ? "mem://vfs_unit_test_data" : "vfs_unit_test_data");
+  bool exists = false;
+  REQUIRE(vfs->is_file(testfile, &exists).ok());
+  if (exists)
+    REQUIRE(vfs->remove_file(testfile).ok());
+
+  // Write some data.
+  const unsigned nelts = 100000;
+  std::vector<uint32_t> data_write(nelts);
+  for (unsigned i = 0; i < nelts; i++) {
+    data_write[i] = i;
+  }
+  REQUIRE(
+      vfs->write(testfile, data_write.data(), nelts * sizeof(uint32_t)).ok());
+  REQUIRE(vfs->close_file(testfile).ok());
+
+  const unsigned chunk = 250;
+  std::vector<uint32_t> data_read(chunk);
+  SECTION("Sequential reads") {
+    // Read the file sequentially in small chunks: the reads after the first
+    // are served from the read-ahead buffers, which are prefetched.
+    for (unsigned i = 0; i < nelts; i += chunk) {
+      REQUIRE(vfs->read(
+                     testfile,
+                     i * sizeof(uint32_t),
+                     data_read.data(),
+                     chunk * sizeof(uint32_t))
+                  .ok());
+      for (unsigned j = 0; j < chunk; j++) {
+        REQUIRE(data_read[j] == i + j);
+      }
+    }
+    REQUIRE(vfs->terminate().ok());
+
+    auto dump = stats.dump(2, 0);
+    CHECK(dump.find("\"test.VFS.read_ahead_hit_num\"") != std::string::npos);
+    CHECK(
+        dump.find("\"test.VFS.read_ahead_prefetch_num\"") !=
+        std::string::npos);
+  }
+
+  SECTION("Random reads") {
+    // Read the file backwards: the first read fills a read-ahead buffer
+    // that is never used, after which read-ahead is disabled for the file.
+    for (int64_t i = nelts - chunk; i >= 0; i -= 10 * chunk) {
+      REQUIRE(vfs->read(
+                     testfile,
+                     i * sizeof(uint32_t),
+                     data_read.data(),
+                     chunk * sizeof(uint32_t))
+                  .ok());
+      for (unsigned j = 0; j < chunk; j++) {
+        REQUIRE(data_read[j] == static_cast<uint32_t>(i + j));
+      }
+    }
+    REQUIRE(vfs->terminate().ok());
+
+    auto dump = stats.dump(2, 0);
+    CHECK(dump.find("\"test.VFS.read_ahead_hit_num\"") == std::string::npos);
+    CHECK(
+        dump.find("\"test.VFS.read_ahead_prefetch_num\"") ==
+        std::string::npos);
+  }
+
+  SECTION("Rewritten file") {
+    // Rewriting a file drops its read-ahead buffers.
+    REQUIRE(vfs->read(testfile, 0, data_read.data(), sizeof(uint32_t)).ok());
+    REQUIRE(data_read[0] == 0);
+    REQUIRE(vfs->remove_file(testfile).ok());
+    std::reverse(data_write.begin(), data_write.end());
+    REQUIRE(vfs->write(testfile, data_write.data(), nelts * sizeof(uint32_t))
+                .ok());
+    REQUIRE(vfs->close_file(testfile).ok());
+    REQUIRE(vfs->read(testfile, 0, data_read.data(), sizeof(uint32_t)).ok());
+    CHECK(data_read[0] == nelts - 1);
+    REQUIRE(vfs->terminate().ok());
+  }
+
+  REQUIRE(vfs->remove_file(testfile).ok());
+}
+
+TEST_CASE("VFS: Test no read-ahead for local files", "[vfs][read-ahead]") {
+  ThreadPool compute_tp(4);
+  ThreadPool io_tp(4);
+  stats::Stats stats("test");
+
+  Config default_config, vfs_config;
+  std::unique_ptr<VFS> vfs(new VFS);
+  REQUIRE(vfs->init(&stats, &compute_tp, &io_tp, &default_config, &vfs_config)
+              .ok());
+
+  URI testfile("vfs_unit_test_data");
+  bool exists = false;
+  REQUIRE(vfs->is_file(testfile, &exists).ok());
+  if (exists)
+    REQUIRE(vfs->remove_file(testfile).ok());
+
+  const unsigned nelts = 10000;
+  std::vector<uint32_t> data_write(nelts);
+  for (unsigned i = 0; i < nelts; i++) {
+    data_write[i] = i;
+  }
+  REQUIRE(
+      vfs->write(testfile, data_write.data(), nelts * sizeof(uint32_t)).ok());
+  REQUIRE(vfs->close_file(testfile).ok());
+
+  // Sequential reads of a local file go straight to the file by default.
+  const unsigned chunk = 250;
+  std::vector<uint32_t> data_read(chunk);
+  for (unsigned i = 0; i < nelts; i += chunk) {
+    REQUIRE(vfs->read(
+                   testfile,
+                   i * sizeof(uint32_t),
+                   data_read.data(),
+                   chunk * sizeof(uint32_t))
+                .ok());
+    REQUIRE(data_read[0] == i);
+  }
+  REQUIRE(vfs->terminate().ok());
+
+  auto dump = stats.dump(2, 0);
+  CHECK(dump.find("\"test.VFS.read_ahead_hit_num\"") == std::string::npos);
+  CHECK(
+      dump.find("\"test.VFS.read_ahead_prefetch_num\"") == std::string::npos);
+
+  REQUIRE(vfs->remove_file(testfile).ok());
+}
+
+TEST_CASE("VFS: Test multi-file read batching", "[vfs][io-uring]") {
+  ThreadPool compute_tp(4);
+  ThreadPool io_tp(4);
+
+  const bool io_uring = GENERATE(false, true);
+  Config default_config, vfs_config;
+  vfs_config.set("vfs.file.io_uring", io_uring ? "true" : "false");
+  vfs_config.set("vfs.file.io_uring_queue_depth", "4");
+  std::unique_ptr<VFS> vfs(new VFS);
+  REQUIRE(vfs->init(
+                 &g_helper_stats,
+                 &compute_tp,
+                 &io_tp,
+                 &default_config,
+                 &vfs_config)
+              .ok());
+
+  // Write two files with different contents.
+  const unsigned nelts = 100;
+  std::vector<URI> testfiles = {URI("vfs_unit_test_data_1"),
+                                URI("vfs_unit_test_data_2")};
+  for (unsigned f = 0; f < testfiles.size(); f++) {
+    bool exists = false;
+    REQUIRE(vfs->is_file(testfiles[f], &exists).ok());
+    if (exists)
+      REQUIRE(vfs->remove_file(testfiles[f]).ok());
+
+    std::vector<uint32_t> data_write(nelts);
+    for (unsigned i = 0; i < nelts; i++)
+      data_write[i] = f * nelts + i;
+    REQUIRE(vfs->write(
+                   testfiles[f], data_write.data(), nelts * sizeof(uint32_t))
+                .ok());
+    REQUIRE(vfs->close_file(testfiles[f]).ok());
+  }
+
+  // Read every element from one of the files, with more reads than the
+  // queue depth.
+  std::vector<Tile> tiles(nelts);
+  std::unordered_map<
+      URI,
+      std::vector<tuple<uint64_t, Tile*, uint64_t>>,
+      URIHasher>
+      all_regions;
+  for (unsigned i = 0; i < nelts; i++) {
+    tiles[i].filtered_buffer().expand(sizeof(uint32_t));
+    all_regions[testfiles[i % 2]].emplace_back(
+        i * sizeof(uint32_t), &tiles[i], sizeof(uint32_t));
+  }
+
+  std::vector<ThreadPool::Task> tasks;
+  REQUIRE(vfs->read_all(all_regions, &io_tp, &tasks, false).ok());
+  REQUIRE(io_tp.wait_all(tasks).ok());
+  for (unsigned i = 0; i < nelts; i++) {
+    CHECK(
+        tiles[i].filtered_buffer().data_as<uint32_t>()[0] ==
+        (i % 2) * nelts + i);
+  }
+
+  // Reading past the end of a file fails.
+  tasks.clear();
+  all_regions.clear();
+  all_regions[testfiles[0]].emplace_back(
+      nelts * sizeof(uint32_t), &tiles[0], sizeof(uint32_t));
+  auto st = vfs->read_all(all_regions, &io_tp, &tasks, false);
+  if (st.ok())
+    st = io_tp.wait_all(tasks);
+  CHECK(!st.ok());
+
+  for (const auto& testfile : testfiles)
+    REQUIRE(vfs->remove_file(testfile).ok());
+  REQUIRE(vfs->terminate().ok());
+}
+
 #ifdef _WIN32
 
 TEST_CASE("VFS: Test long paths (Win32)", "[vfs][windows]") {
@@ -34,49 +34,123 @@
 #ifndef TILEDB_MEMORY_TRACKER_H
 #define TILEDB_MEMORY_TRACKER_H
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <limits>
+#include <mutex>
+
 #include "tiledb/common/status.h"
 
 namespace tiledb {
 namespace sm {
 
+/**
+ * Tracks the memory used against a budget. Trackers form a hierarchy: the
+ * memory taken from a tracker is also taken from its parent, so a tracker
+ * only grants memory that is within its own budget and the budgets of all
+ * its ancestors (e.g. context -> array).
+ */
 class MemoryTracker {
  public:
-  /** Constructor. */
-  MemoryTracker() {
-    memory_usage_ = 0;
-    memory_budget_ = std::numeric_limits<uint32_t>::max();
-  };
+  /**
+   * Constructor.
+   *
+   * @param parent The parent tracker, or `nullptr` for a root tracker.
+   */
+  MemoryTracker(MemoryTracker* parent = nullptr)
+      : parent_(parent)
+      , memory_usage_(0)
+      , memory_peak_(0)
+      , memory_peak_reported_(0)
+      , memory_budget_(std::numeric_limits<uint32_t>::max())
+      , waiter_num_(0){};
 
-  /** Destructor. */
-  ~MemoryTracker() = default;
+  /** Destructor. Returns the memory still taken to the parent. */
+  ~MemoryTracker() {
+    if (parent_ != nullptr)
+      parent_->release_memory(memory_usage_);
+  }
 
   DISABLE_COPY_AND_COPY_ASSIGN(MemoryTracker);
   DISABLE_MOVE_AND_MOVE_ASSIGN(MemoryTracker);
 
   /**
-   * Take memory from the budget.
+   * Take memory from the budget of this tracker and of its ancestors.
    *
    * @param size The memory size.
    * @return true if the memory is available, false otherwise.
    */
   bool take_memory(uint64_t size) {
-    std::lock_guard<std::mutex> lg(mutex_);
-    if (memory_usage_ + size <= memory_budget_) {
-      memory_usage_ += size;
-      return true;
+    uint64_t usage = memory_usage_.load();
+    do {
+      const uint64_t budget = memory_budget_.load();
+      if (size > budget || usage > budget - size)
+        return false;
+    } while (!memory_usage_.compare_exchange_weak(usage, usage + size));
+
+    if (parent_ != nullptr && !parent_->take_memory(size)) {
+      memory_usage_ -= size;
+      return false;
+    }
+
+    uint64_t peak = memory_peak_.load();
+    while (usage + size > peak &&
+           !memory_peak_.compare_exchange_weak(peak, usage + size)) {
     }
 
-    return false;
+    return true;
   }
 
   /**
-   * Release memory from the budget.
+   * Take `size` memory, waiting up to `timeout` for other users to release
+   * enough of it. Past the timeout, takes the memory available instead if
+   * it is at least `min_size`. A `size` over the budget of this tracker or
+   * of an ancestor can never be taken, so it does not wait for it. Only
+   * releases through this tracker wake up the wait, so this is meant for
+   * root trackers.
+   *
+   * @param size The memory size.
+   * @param min_size The minimum memory size to take past the timeout.
+   * @param timeout How long to wait for `size` to be available.
+   * @return The memory size taken, `0` if it could not take `min_size`.
+   */
+  uint64_t take_memory(
+      uint64_t size, uint64_t min_size, std::chrono::milliseconds timeout) {
+    if (take_memory(size))
+      return size;
+
+    if (size <= get_memory_budget_total()) {
+      std::unique_lock<std::mutex> lck(mutex_);
+      ++waiter_num_;
+      const bool taken =
+          cv_.wait_for(lck, timeout, [&]() { return take_memory(size); });
+      --waiter_num_;
+      if (taken)
+        return size;
+    }
+
+    // Shrink the request to the memory available
+    while (true) {
+      const uint64_t available = std::min(size, get_memory_available_total());
+      if (available == 0 || available < min_size)
+        return 0;
+      if (take_memory(available))
+        return available;
+    }
+  }
+
+  /**
+   * Release memory from the budget of this tracker and of its ancestors.
    *
    * @param size The memory size.
    */
   void release_memory(uint64_t size) {
-    std::lock_guard<std::mutex> lg(mutex_);
     memory_usage_ -= size;
+    if (parent_ != nullptr)
+      parent_->release_memory(size);
+    notify_waiters();
   }
 
   /**
@@ -85,25 +159,60 @@ class MemoryTracker {
    * @param size The memory budget size.
    */
   void set_budget(uint64_t size) {
-    std::lock_guard<std::mutex> lg(mutex_);
     memory_budget_ = size;
+    notify_waiters();
   }
 
   /**
    * Get the memory usage.
    */
   uint64_t get_memory_usage() {
-    std::lock_guard<std::mutex> lg(mutex_);
     return memory_usage_;
   }
 
+  /**
+   * Get the highest memory usage so far.
+   */
+  uint64_t get_memory_peak() {
+    return memory_peak_;
+  }
+
+  /**
+   * Get how much the highest memory usage grew since the last call, so that
+   * the values returned to all callers sum up to the peak.
+   *
+   * @return The peak growth since the last call.
+   */
+  uint64_t take_memory_peak_growth() {
+    const uint64_t peak = memory_peak_.load();
+    uint64_t reported = memory_peak_reported_.load();
+    while (reported < peak &&
+           !memory_peak_reported_.compare_exchange_weak(reported, peak)) {
+    }
+
+    return reported < peak ? peak - reported : 0;
+  }
+
   /**
    * Get available room based on budget
    * @return available amount left in budget
    */
   uint64_t get_memory_available() {
-    std::lock_guard<std::mutex> lg(mutex_);
-    return memory_budget_ - memory_usage_;
+    const uint64_t budget = memory_budget_;
+    const uint64_t usage = memory_usage_;
+    return usage < budget ? budget - usage : 0;
+  }
+
+  /**
+   * Get available room based on the budgets of this tracker and of its
+   * ancestors.
+   * @return available amount left in all budgets
+   */
+  uint64_t get_memory_available_total() {
+    const uint64_t available = get_memory_available();
+    return parent_ == nullptr ?
+               available :
+               std::min(available, parent_->get_memory_available_total());
   }
 
   /**
@@ -111,22 +220,54 @@ class MemoryTracker {
    * @return budget
    */
   uint64_t get_memory_budget() {
-    std::lock_guard<std::mutex> lg(mutex_);
     return memory_budget_;
   }
 
+  /**
+   * Get the smallest memory budget of this tracker and of its ancestors.
+   */
+  uint64_t get_memory_budget_total() {
+    const uint64_t budget = get_memory_budget();
+    return parent_ == nullptr ?
+               budget :
+               std::min(budget, parent_->get_memory_budget_total());
+  }
+
  private:
-  /** Protects all member variables. */
-  std::mutex mutex_;
+  /** Wakes up the callers waiting for memory, if any. */
+  void notify_waiters() {
+    if (waiter_num_ > 0) {
+      std::lock_guard<std::mutex> lg(mutex_);
+      cv_.notify_all();
+    }
+  }
+
+  /** The parent tracker, or `nullptr` for a root tracker. */
+  MemoryTracker* const parent_;
 
   /** Memory usage for tracked structures. */
-  uint64_t memory_usage_;
+  std::atomic<uint64_t> memory_usage_;
+
+  /** Highest memory usage so far. */
+  std::atomic<uint64_t> memory_peak_;
+
+  /** Peak already returned by `take_memory_peak_growth`. */
+  std::atomic<uint64_t> memory_peak_reported_;
 
   /** Memory budget. */
-  uint64_t memory_budget_;
+  std::atomic<uint64_t> memory_budget_;
+
+  /** Number of callers waiting for memory. */
+  std::atomic<uint64_t> waiter_num_;
+
+  /** Protects waiting for memory. */
+  std::mutex mutex_;
+
+  /** Signals the callers waiting for memory upon releases. */
+  std::condition_variable cv_;
 };
 
 }  // namespace sm
 }  // namespace tiledb
 
-#endif  // TILEDB_OPEN_ARRAY_MEMORY_TRACKER_H
\ No newline at end of file
+#endif  // TILEDB_MEMORY_TRACKER_H
@@ -0,0 +1,185 @@
+/**
+ * @file   cpu_affinity.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines helpers to pin threads to CPUs and NUMA nodes.
+ */
+
+#include "tiledb/common/thread_pool/cpu_affinity.h"
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace tiledb::common {
+
+namespace {
+
+/** Reads the first line of a (sysfs) file, or "" if it cannot be read. */
+std::string read_line(const std::string& path) {
+  std::ifstream ifs(path);
+  std::string line;
+  if (ifs.good())
+    std::getline(ifs, line);
+  return line;
+}
+
+}  // namespace
+
+Status parse_cpu_list(const std::string& str, std::vector<uint32_t>* cpus) {
+  cpus->clear();
+
+  size_t pos = 0;
+  while (pos < str.size()) {
+    auto end = str.find(',', pos);
+    if (end == std::string::npos)
+      end = str.size();
+    const std::string range = str.substr(pos, end - pos);
+    pos = end + 1;
+
+    if (range.empty())
+      continue;
+
+    // A range is either "N" or "N-M".
+    uint32_t first, last;
+    try {
+      size_t idx;
+      const auto dash = range.find('-');
+      first = static_cast<uint32_t>(std::stoul(range, &idx));
+      if (dash == std::string::npos) {
+        last = first;
+        if (idx != range.size())
+          throw std::invalid_argument(range);
+      } else {
+        if (idx != dash)
+          throw std::invalid_argument(range);
+        const std::string last_str = range.substr(dash + 1);
+        last = static_cast<uint32_t>(std::stoul(last_str, &idx));
+        if (idx != last_str.size())
+          throw std::invalid_argument(range);
+      }
+    } catch (const std::exception&) {
+      return Status_ThreadPoolError("Invalid CPU list '" + str + "'");
+    }
+
+    if (last < first)
+      return Status_ThreadPoolError("Invalid CPU range '" + range + "'");
+    for (uint32_t cpu = first; cpu <= last; ++cpu)
+      cpus->emplace_back(cpu);
+  }
+
+  std::sort(cpus->begin(), cpus->end());
+  cpus->erase(std::unique(cpus->begin(), cpus->end()), cpus->end());
+
+  return Status::Ok();
+}
+
+std::vector<uint32_t> available_cpus() {
+  std::vector<uint32_t> cpus;
+#ifdef __linux__
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+    for (uint32_t cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+      if (CPU_ISSET(cpu, &set))
+        cpus.emplace_back(cpu);
+    }
+    return cpus;
+  }
+#endif
+  const uint32_t n = std::max(1u, std::thread::hardware_concurrency());
+  for (uint32_t cpu = 0; cpu < n; ++cpu)
+    cpus.emplace_back(cpu);
+  return cpus;
+}
+
+uint32_t numa_node_of_cpu(const uint32_t cpu) {
+#ifdef __linux__
+  std::vector<uint32_t> nodes;
+  if (!parse_cpu_list(read_line("/sys/devices/system/node/online"), &nodes)
+           .ok())
+    return 0;
+
+  for (auto node : nodes) {
+    std::vector<uint32_t> node_cpus;
+    const auto path = "/sys/devices/system/node/node" + std::to_string(node) +
+                      "/cpulist";
+    if (parse_cpu_list(read_line(path), &node_cpus).ok() &&
+        std::binary_search(node_cpus.begin(), node_cpus.end(), cpu))
+      return node;
+  }
+#else
+  (void)cpu;
+#endif
+  return 0;
+}
+
+std::vector<CpuAffinity> worker_affinities(
+    const std::vector<uint32_t>& cpus, const bool numa_aware) {
+  std::vector<CpuAffinity> affinities;
+  if (cpus.empty())
+    return affinities;
+
+  if (!numa_aware) {
+    affinities.push_back({cpus, numa_node_of_cpu(cpus[0])});
+    return affinities;
+  }
+
+  std::map<uint32_t, std::vector<uint32_t>> node_cpus;
+  for (auto cpu : cpus)
+    node_cpus[numa_node_of_cpu(cpu)].emplace_back(cpu);
+  for (auto& [node, n_cpus] : node_cpus)
+    affinities.push_back({std::move(n_cpus), node});
+
+  return affinities;
+}
+
+bool pin_thread(std::thread& thread, const CpuAffinity& affinity) {
+#ifdef __linux__
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (auto cpu : affinity.cpus_) {
+    if (cpu >= CPU_SETSIZE)
+      return false;
+    CPU_SET(cpu, &set);
+  }
+  return pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set) ==
+         0;
+#else
+  (void)thread;
+  (void)affinity;
+  return true;
+#endif
+}
+
+}  // namespace tiledb::common
@@ -0,0 +1,91 @@
+/**
+ * @file   cpu_affinity.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file declares helpers to pin threads to CPUs and NUMA nodes.
+ */
+
+#ifndef TILEDB_CPU_AFFINITY_H
+#define TILEDB_CPU_AFFINITY_H
+
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "tiledb/common/status.h"
+
+namespace tiledb::common {
+
+/** A set of CPUs a thread may run on, all on the same NUMA node. */
+struct CpuAffinity {
+  /** The CPUs. */
+  std::vector<uint32_t> cpus_;
+
+  /** The NUMA node of the CPUs. */
+  uint32_t node_;
+};
+
+/**
+ * Parses a CPU list in the Linux `cpuset` format, for example "0-3,8,10-11".
+ *
+ * @param str The CPU list.
+ * @param cpus The parsed, sorted and deduplicated CPUs.
+ * @return Status
+ */
+Status parse_cpu_list(const std::string& str, std::vector<uint32_t>* cpus);
+
+/** Returns the CPUs the calling process is allowed to run on. */
+std::vector<uint32_t> available_cpus();
+
+/** Returns the NUMA node of `cpu`, or 0 if it cannot be determined. */
+uint32_t numa_node_of_cpu(uint32_t cpu);
+
+/**
+ * Returns the affinities to pin the workers of a thread pool to.
+ *
+ * @param cpus The CPUs the workers may run on.
+ * @param numa_aware If `true`, returns one affinity per NUMA node spanned by
+ *     `cpus`, so that each worker stays on a single node. Otherwise returns a
+ *     single affinity with all of `cpus`.
+ * @return The affinities, empty if `cpus` is empty.
+ */
+std::vector<CpuAffinity> worker_affinities(
+    const std::vector<uint32_t>& cpus, bool numa_aware);
+
+/**
+ * Pins `thread` to the CPUs of `affinity`. This is only supported on Linux;
+ * on other platforms it does nothing.
+ *
+ * @return `false` if the thread could not be pinned.
+ */
+bool pin_thread(std::thread& thread, const CpuAffinity& affinity);
+
+}  // namespace tiledb::common
+
+#endif  // TILEDB_CPU_AFFINITY_H
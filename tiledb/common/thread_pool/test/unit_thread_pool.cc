@@ -36,6 +36,8 @@
 #include <atomic>
 #include <catch.hpp>
 #include <cstdio>
+#include <future>
+#include <mutex>
 #include <iostream>
 #include <vector>
 
@@ -591,3 +593,187 @@ TEST_CASE("ThreadPool: Test Exceptions", "[threadpool]") {
     REQUIRE(result == 207);
   }
 }
+
+TEST_CASE("ThreadPool: Test scheduling strategies", "[threadpool]") {
+  ThreadPool::Scheduling scheduling = ThreadPool::Scheduling::WorkStealing;
+
+  SECTION("- Shared queue") {
+    scheduling = ThreadPool::Scheduling::SharedQueue;
+  }
+
+  SECTION("- Work stealing") {
+    scheduling = ThreadPool::Scheduling::WorkStealing;
+  }
+
+  ThreadPool pool{4, scheduling};
+
+  // Nested parallelism: each outer task schedules and waits on inner tasks.
+  std::atomic<int> result(0);
+  const size_t num_outer = 10;
+  const size_t num_inner = 20;
+  std::vector<ThreadPool::Task> tasks;
+  for (size_t i = 0; i < num_outer; ++i) {
+    tasks.emplace_back(pool.execute([&]() {
+      std::vector<ThreadPool::Task> inner_tasks;
+      for (size_t j = 0; j < num_inner; ++j) {
+        inner_tasks.emplace_back(pool.execute([&result]() {
+          std::this_thread::sleep_for(std::chrono::milliseconds(random_ms()));
+          ++result;
+          return Status::Ok();
+        }));
+      }
+      return pool.wait_all(inner_tasks);
+    }));
+  }
+  REQUIRE(pool.wait_all(tasks).ok());
+  REQUIRE(result == num_outer * num_inner);
+
+  auto stats = pool.task_stats();
+  CHECK(stats.executed_num_ == num_outer + num_inner * num_outer);
+  CHECK(stats.queue_depth_ == 0);
+  CHECK(stats.max_queue_depth_ >= 1);
+  CHECK(stats.max_queue_depth_ <= num_outer + num_inner * num_outer);
+  if (scheduling == ThreadPool::Scheduling::SharedQueue) {
+    CHECK(stats.stolen_num_ == 0);
+  }
+}
+
+TEST_CASE("ThreadPool: Test shared queue FIFO order", "[threadpool]") {
+  ThreadPool::Scheduling scheduling = ThreadPool::Scheduling::WorkStealing;
+
+  SECTION("- Shared queue") {
+    scheduling = ThreadPool::Scheduling::SharedQueue;
+  }
+
+  SECTION("- Work stealing") {
+    scheduling = ThreadPool::Scheduling::WorkStealing;
+  }
+
+  ThreadPool pool{1, scheduling};
+
+  // Block the only worker until all tasks are scheduled.
+  std::promise<void> gate;
+  std::shared_future<void> gate_future = gate.get_future().share();
+  std::vector<ThreadPool::Task> tasks;
+  tasks.emplace_back(pool.execute([gate_future]() {
+    gate_future.wait();
+    return Status::Ok();
+  }));
+
+  std::mutex order_mtx;
+  std::vector<size_t> order;
+  const size_t num_tasks = 50;
+  for (size_t i = 0; i < num_tasks; ++i) {
+    tasks.emplace_back(pool.execute([&order_mtx, &order, i]() {
+      std::lock_guard<std::mutex> lock(order_mtx);
+      order.push_back(i);
+      return Status::Ok();
+    }));
+  }
+  gate.set_value();
+
+  // Wait without helping, so that the worker executes all the tasks.
+  for (auto& task : tasks) {
+    task.wait();
+  }
+  REQUIRE(pool.wait_all(tasks).ok());
+
+  REQUIRE(order.size() == num_tasks);
+  for (size_t i = 0; i < num_tasks; ++i) {
+    CHECK(order[i] == i);
+  }
+}
+
+TEST_CASE("ThreadPool: Test work stealing", "[threadpool]") {
+  ThreadPool pool{4};
+
+  // A single task schedules all the work on its own deque, idle workers
+  // must steal it.
+  std::atomic<int> result(0);
+  std::vector<ThreadPool::Task> tasks;
+  tasks.emplace_back(pool.execute([&]() {
+    std::vector<ThreadPool::Task> inner_tasks;
+    for (size_t j = 0; j < 100; ++j) {
+      inner_tasks.emplace_back(pool.execute([&result]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        ++result;
+        return Status::Ok();
+      }));
+    }
+    return pool.wait_all(inner_tasks);
+  }));
+
+  // Wait without helping, so that the outer task runs on a worker.
+  tasks[0].wait();
+  REQUIRE(pool.wait_all(tasks).ok());
+  REQUIRE(result == 100);
+  CHECK(pool.task_stats().stolen_num_ > 0);
+}
+
+TEST_CASE("ThreadPool: Test CPU list parsing", "[threadpool]") {
+  std::vector<uint32_t> cpus;
+  REQUIRE(parse_cpu_list("", &cpus).ok());
+  CHECK(cpus.empty());
+  REQUIRE(parse_cpu_list("3", &cpus).ok());
+  CHECK(cpus == std::vector<uint32_t>{3});
+  REQUIRE(parse_cpu_list("8,0-3,2", &cpus).ok());
+  CHECK(cpus == std::vector<uint32_t>{0, 1, 2, 3, 8});
+
+  CHECK(!parse_cpu_list("a", &cpus).ok());
+  CHECK(!parse_cpu_list("1-", &cpus).ok());
+  CHECK(!parse_cpu_list("3-1", &cpus).ok());
+  CHECK(!parse_cpu_list("1-2-3", &cpus).ok());
+}
+
+TEST_CASE("ThreadPool: Test CPU affinity", "[threadpool]") {
+  auto cpus = available_cpus();
+  REQUIRE(!cpus.empty());
+
+  // One affinity per NUMA node, covering all the CPUs.
+  auto affinity = worker_affinities(cpus, true);
+  REQUIRE(!affinity.empty());
+  size_t cpu_num = 0;
+  for (auto& a : affinity) {
+    cpu_num += a.cpus_.size();
+    for (auto cpu : a.cpus_) {
+      CHECK(numa_node_of_cpu(cpu) == a.node_);
+    }
+  }
+  CHECK(cpu_num == cpus.size());
+  CHECK(worker_affinities(cpus, false).size() == 1);
+  CHECK(worker_affinities({}, true).empty());
+
+  // Pinned workers execute tasks and report them on their node.
+  auto scheduling = GENERATE(
+      ThreadPool::Scheduling::SharedQueue,
+      ThreadPool::Scheduling::WorkStealing);
+  ThreadPool pool{4, scheduling, affinity};
+  std::atomic<int> result(0);
+  std::vector<ThreadPool::Task> tasks;
+  for (int i = 0; i < 100; ++i) {
+    tasks.emplace_back(pool.execute([&result]() {
+      ++result;
+      return Status::Ok();
+    }));
+  }
+  // Wait without helping, so that all tasks run on workers.
+  for (auto& task : tasks) {
+    task.wait();
+  }
+  REQUIRE(pool.wait_all(tasks).ok());
+  REQUIRE(result == 100);
+
+  auto stats = pool.task_stats();
+  uint64_t executed_num = 0;
+  for (size_t node = 0; node < stats.node_executed_num_.size(); ++node) {
+    executed_num += stats.node_executed_num_[node];
+    if (stats.node_executed_num_[node] > 0) {
+      bool found = false;
+      for (auto& a : affinity) {
+        found |= a.node_ == node;
+      }
+      CHECK(found);
+    }
+  }
+  CHECK(executed_num == 100);
+}
@@ -30,7 +30,9 @@
  * This file defines the ThreadPool class.
  */
 
+#include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <memory>
 #include <queue>
 #include <thread>
@@ -40,14 +42,36 @@
 
 namespace tiledb::common {
 
+namespace {
+
+/** The thread pool the calling thread is a worker of, if any. */
+thread_local const ThreadPool* tp_worker_pool = nullptr;
+
+/** The index of the calling thread among the workers of `tp_worker_pool`. */
+thread_local size_t tp_worker_idx = 0;
+
+}  // namespace
+
 // Constructor.  May throw an exception on error.  No logging is done as the
 // logger may not yet be initialized.
-ThreadPool::ThreadPool(size_t n)
-    : concurrency_level_(n) {
+ThreadPool::ThreadPool(
+    size_t n, Scheduling scheduling, const std::vector<CpuAffinity>& affinity)
+    : scheduling_(scheduling)
+    , worker_tasks_(scheduling == Scheduling::WorkStealing ? n : 0)
+    , worker_nodes_(n, 0)
+    , multi_node_(false)
+    , sleeping_num_(0)
+    , pending_num_(0)
+    , shutdown_(false)
+    , executed_num_(0)
+    , stolen_num_(0)
+    , max_queue_depth_(0)
+    , idle_time_ns_(0)
+    , concurrency_level_(n) {
   // If concurrency_level_ is set to zero, construct the thread pool in shutdown
-  // state.  Explicitly shut down the task queue as well.
+  // state.
   if (concurrency_level_ == 0) {
-    task_queue_.drain();
+    shutdown_ = true;
     return;
   }
 
@@ -61,6 +85,17 @@ ThreadPool::ThreadPool(size_t n)
     throw std::runtime_error(msg);
   }
 
+  // Assign the workers to NUMA nodes before any of them starts.
+  uint32_t max_node = 0;
+  if (!affinity.empty()) {
+    for (size_t i = 0; i < concurrency_level_; ++i) {
+      worker_nodes_[i] = affinity[i % affinity.size()].node_;
+      max_node = std::max(max_node, worker_nodes_[i]);
+      multi_node_ |= worker_nodes_[i] != worker_nodes_[0];
+    }
+  }
+  node_executed_num_ = std::vector<std::atomic<uint64_t>>(max_node + 1);
+
   threads_.reserve(concurrency_level_);
 
   for (size_t i = 0; i < concurrency_level_; ++i) {
@@ -73,7 +108,7 @@ ThreadPool::ThreadPool(size_t n)
     size_t tries = 3;
     while (tries--) {
       try {
-        tmp = std::thread(&ThreadPool::worker, this);
+        tmp = std::thread(&ThreadPool::worker, this, i);
       } catch (const std::system_error& e) {
         if (e.code() != std::errc::resource_unavailable_try_again ||
             tries == 0) {
@@ -90,6 +125,16 @@ ThreadPool::ThreadPool(size_t n)
       break;
     }
 
+    if (!affinity.empty() &&
+        !pin_thread(tmp, affinity[i % affinity.size()])) {
+      threads_.emplace_back(std::move(tmp));
+      shutdown();
+      throw std::runtime_error(
+          "Error initializing thread pool of concurrency level " +
+          std::to_string(concurrency_level_) +
+          "; Cannot pin worker thread to the requested CPUs");
+    }
+
     try {
       threads_.emplace_back(std::move(tmp));
     } catch (...) {
@@ -99,28 +144,181 @@ ThreadPool::ThreadPool(size_t n)
   }
 }
 
-void ThreadPool::worker() {
+void ThreadPool::TaskDeque::push_back(TaskPtr&& task) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  tasks_.emplace_back(std::move(task));
+  size_.store(tasks_.size());
+}
+
+std::optional<ThreadPool::TaskPtr> ThreadPool::TaskDeque::pop_back() {
+  // Skip locking empty deques, as idle threads probe all of them.
+  if (size_.load() == 0) {
+    return std::nullopt;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (tasks_.empty()) {
+    return std::nullopt;
+  }
+  TaskPtr task = std::move(tasks_.back());
+  tasks_.pop_back();
+  size_.store(tasks_.size());
+  return task;
+}
+
+std::optional<ThreadPool::TaskPtr> ThreadPool::TaskDeque::pop_front() {
+  if (size_.load() == 0) {
+    return std::nullopt;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (tasks_.empty()) {
+    return std::nullopt;
+  }
+  TaskPtr task = std::move(tasks_.front());
+  tasks_.pop_front();
+  size_.store(tasks_.size());
+  return task;
+}
+
+void ThreadPool::enqueue(TaskPtr&& task) {
+  if (scheduling_ == Scheduling::WorkStealing && tp_worker_pool == this) {
+    worker_tasks_[tp_worker_idx].push_back(std::move(task));
+  } else {
+    shared_tasks_.push_back(std::move(task));
+  }
+
+  // Update the queue depth statistics.
+  const uint64_t depth = static_cast<uint64_t>(++pending_num_);
+  uint64_t max_depth = max_queue_depth_.load();
+  while (depth > max_depth &&
+         !max_queue_depth_.compare_exchange_weak(max_depth, depth)) {
+  }
+
+  // Wake up a sleeping worker. A worker increments `sleeping_num_` before
+  // checking `pending_num_` under `sleep_mutex_`, so either it sees the new
+  // task, or it is sleeping by the time the mutex is acquired here.
+  if (sleeping_num_.load() > 0) {
+    { std::lock_guard<std::mutex> lock(sleep_mutex_); }
+    sleep_cv_.notify_one();
+  }
+}
+
+std::optional<ThreadPool::TaskPtr> ThreadPool::pop_task() {
+  std::optional<TaskPtr> task;
+  const bool is_worker = tp_worker_pool == this;
+  const size_t deque_num = worker_tasks_.size();
+
+  // The most recent task of the calling worker comes first, as its data is
+  // most likely still in cache.
+  if (is_worker && deque_num > 0) {
+    task = worker_tasks_[tp_worker_idx].pop_back();
+  }
+
+  if (!task) {
+    task = shared_tasks_.pop_front();
+  }
+
+  // Steal the oldest task of another worker, which is likely to be the
+  // largest pending piece of work. Workers spanning several NUMA nodes first
+  // try the workers of their own node, whose data is in local memory.
+  if (!task) {
+    const size_t start = is_worker ? tp_worker_idx + 1 : 0;
+    const bool local_first = is_worker && multi_node_;
+    for (int pass = local_first ? 0 : 1; pass < 2 && !task; ++pass) {
+      for (size_t i = 0; i < deque_num && !task; ++i) {
+        const size_t idx = (start + i) % deque_num;
+        if (is_worker && idx == tp_worker_idx) {
+          continue;
+        }
+        if (pass == 0 && worker_nodes_[idx] != worker_nodes_[tp_worker_idx]) {
+          continue;
+        }
+        task = worker_tasks_[idx].pop_front();
+        if (task) {
+          ++stolen_num_;
+        }
+      }
+    }
+  }
+
+  if (task) {
+    --pending_num_;
+  }
+
+  return task;
+}
+
+void ThreadPool::run_task(TaskPtr& task) {
+  (*task)();
+  ++executed_num_;
+  if (tp_worker_pool == this) {
+    ++node_executed_num_[worker_nodes_[tp_worker_idx]];
+  }
+}
+
+void ThreadPool::worker(const size_t idx) {
+  tp_worker_pool = this;
+  tp_worker_idx = idx;
+
   while (true) {
-    auto val = task_queue_.pop();
-    if (val) {
-      (*(*val))();
-    } else {
+    if (auto task = pop_task()) {
+      run_task(*task);
+      continue;
+    }
+
+    // Sleep until a task is scheduled. Pending tasks are still executed
+    // after shutdown.
+    std::unique_lock<std::mutex> lock(sleep_mutex_);
+    ++sleeping_num_;
+    if (!shutdown_ && pending_num_.load() <= 0) {
+      const auto start = std::chrono::steady_clock::now();
+      sleep_cv_.wait(
+          lock, [this]() { return shutdown_ || pending_num_.load() > 0; });
+      idle_time_ns_ += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                           std::chrono::steady_clock::now() - start)
+                           .count();
+    }
+    --sleeping_num_;
+
+    if (shutdown_ && pending_num_.load() <= 0) {
       break;
     }
   }
+
+  tp_worker_pool = nullptr;
 }
 
 // shutdown is private and only called by constructor and destructor (RAII), so
 // shutdown won't be called from multiple threads.
 void ThreadPool::shutdown() {
   concurrency_level_.store(0);
-  task_queue_.drain();
+  {
+    std::lock_guard<std::mutex> lock(sleep_mutex_);
+    shutdown_ = true;
+  }
+  sleep_cv_.notify_all();
   for (auto&& t : threads_) {
     t.join();
   }
   threads_.clear();
 }
 
+ThreadPool::TaskStats ThreadPool::task_stats() const {
+  TaskStats stats;
+  stats.executed_num_ = executed_num_.load();
+  stats.stolen_num_ = stolen_num_.load();
+  stats.queue_depth_ =
+      static_cast<uint64_t>(std::max<int64_t>(pending_num_.load(), 0));
+  stats.max_queue_depth_ = max_queue_depth_.load();
+  stats.idle_time_ns_ = idle_time_ns_.load();
+  stats.node_executed_num_.reserve(node_executed_num_.size());
+  for (auto& num : node_executed_num_) {
+    stats.node_executed_num_.emplace_back(num.load());
+  }
+  return stats;
+}
+
 Status ThreadPool::wait_all(std::vector<Task>& tasks) {
   auto statuses = wait_all_status(tasks);
   for (auto& st : statuses) {
@@ -188,8 +386,8 @@ std::vector<Status> ThreadPool::wait_all_status(std::vector<Task>& tasks) {
 
       // In the meantime, try to do something useful to make progress (and avoid
       // deadlock)
-      if (auto val = task_queue_.try_pop()) {
-        (*(*val))();
+      if (auto val = pop_task()) {
+        run_task(*val);
       } else {
         // If nothing useful to do, yield so we don't burn cycles
         // going through the task list over and over (thereby slowing down other
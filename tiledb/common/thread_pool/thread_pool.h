@@ -33,15 +33,21 @@
 #ifndef TILEDB_THREAD_POOL_H
 #define TILEDB_THREAD_POOL_H
 
-#include "producer_consumer_queue.h"
-
+#include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <functional>
 #include <future>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
 
 #include "tiledb/common/common.h"
 #include "tiledb/common/logger_public.h"
 #include "tiledb/common/macros.h"
 #include "tiledb/common/status.h"
+#include "tiledb/common/thread_pool/cpu_affinity.h"
 
 namespace tiledb::common {
 
@@ -49,6 +55,46 @@ class ThreadPool {
  public:
   using Task = std::future<Status>;
 
+  /** The task scheduling strategy. */
+  enum class Scheduling {
+    /** All workers pop tasks from a single shared queue. */
+    SharedQueue,
+
+    /**
+     * Each worker owns a task deque. Tasks scheduled by a worker are pushed
+     * to its own deque and popped in LIFO order, so nested parallel work
+     * stays on the thread that produced it. Idle workers steal the oldest
+     * tasks of the other deques. Tasks scheduled by other threads go to a
+     * shared queue.
+     */
+    WorkStealing
+  };
+
+  /** Task-level statistics of the thread pool. */
+  struct TaskStats {
+    /** The number of executed tasks. */
+    uint64_t executed_num_;
+
+    /** The number of tasks stolen from the deque of another worker. */
+    uint64_t stolen_num_;
+
+    /** The number of tasks waiting to be executed. */
+    uint64_t queue_depth_;
+
+    /** The maximum number of tasks that waited to be executed at once. */
+    uint64_t max_queue_depth_;
+
+    /** The total time worker threads slept waiting for tasks, in ns. */
+    uint64_t idle_time_ns_;
+
+    /**
+     * The number of tasks executed by the workers of each NUMA node, indexed
+     * by node. Tasks executed by non-worker threads while waiting are not
+     * included.
+     */
+    std::vector<uint64_t> node_executed_num_;
+  };
+
   /* ********************************* */
   /*     CONSTRUCTORS & DESTRUCTORS    */
   /* ********************************* */
@@ -61,8 +107,16 @@ class ThreadPool {
    * zero will construct the thread pool in its shutdown state--constructed but
    * not accepting nor executing any tasks.  A value of 256*hardware_concurrency
    * or larger is an error.
+   * @param scheduling The task scheduling strategy.
+   * @param affinity The CPUs to pin the workers to. Worker `i` is pinned to
+   * `affinity[i % affinity.size()]`. If empty, the workers are not pinned.
+   * With the work-stealing strategy, idle workers steal from workers of
+   * their own NUMA node first.
    */
-  explicit ThreadPool(size_t n);
+  explicit ThreadPool(
+      size_t n,
+      Scheduling scheduling = Scheduling::WorkStealing,
+      const std::vector<CpuAffinity>& affinity = {});
 
   /** Deleted default constructor */
   ThreadPool() = delete;
@@ -110,7 +164,7 @@ class ThreadPool {
 
     std::future<R> future = task->get_future();
 
-    task_queue_.push(task);
+    enqueue(std::move(task));
 
     return future;
   }
@@ -153,22 +207,103 @@ class ThreadPool {
    */
   std::vector<Status> wait_all_status(std::vector<Task>& tasks);
 
+  /** Returns a snapshot of the task-level statistics. */
+  TaskStats task_stats() const;
+
   /* ********************************* */
-  /*         PRIVATE ATTRIBUTES        */
+  /*         PRIVATE DATATYPES         */
   /* ********************************* */
 
  private:
+  using TaskPtr = shared_ptr<std::packaged_task<Status()>>;
+
+  /** A task deque, aligned to avoid false sharing between workers. */
+  struct alignas(64) TaskDeque {
+    /** Protects `tasks_`. */
+    std::mutex mutex_;
+
+    /** The tasks. */
+    std::deque<TaskPtr> tasks_;
+
+    /** The size of `tasks_`, readable without locking `mutex_`. */
+    std::atomic<size_t> size_{0};
+
+    /** Pushes `task` at the back of the deque. */
+    void push_back(TaskPtr&& task);
+
+    /** Pops a task from the back of the deque, if any. */
+    std::optional<TaskPtr> pop_back();
+
+    /** Pops a task from the front of the deque, if any. */
+    std::optional<TaskPtr> pop_front();
+  };
+
+  /* ********************************* */
+  /*         PRIVATE METHODS           */
+  /* ********************************* */
+
+  /** Schedules `task` for execution. */
+  void enqueue(TaskPtr&& task);
+
+  /**
+   * Pops the next task to execute on the calling thread: first from the
+   * deque of the calling worker, then from the shared queue, then by
+   * stealing from the other workers.
+   */
+  std::optional<TaskPtr> pop_task();
+
+  /** Executes `task`. */
+  void run_task(TaskPtr& task);
+
   /** The worker thread routine */
-  void worker();
+  void worker(size_t idx);
 
   /** Terminate threads in the thread pool */
   void shutdown();
 
-  /** Producer-consumer queue where functions to be executed are kept */
-  ProducerConsumerQueue<
-      shared_ptr<std::packaged_task<Status()>>,
-      std::deque<shared_ptr<std::packaged_task<Status()>>>>
-      task_queue_;
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** The task scheduling strategy. */
+  const Scheduling scheduling_;
+
+  /**
+   * Tasks scheduled by non-worker threads, or by all threads when the
+   * scheduling strategy is `Scheduling::SharedQueue`, executed in FIFO order.
+   */
+  TaskDeque shared_tasks_;
+
+  /** The task deque of each worker (`Scheduling::WorkStealing` only). */
+  std::vector<TaskDeque> worker_tasks_;
+
+  /** The NUMA node of each worker. */
+  std::vector<uint32_t> worker_nodes_;
+
+  /** Set if the workers span more than one NUMA node. */
+  bool multi_node_;
+
+  /** Protects `shutdown_` and idle workers going to sleep. */
+  std::mutex sleep_mutex_;
+
+  /** Wakes up idle workers when tasks are scheduled. */
+  std::condition_variable sleep_cv_;
+
+  /** The number of workers sleeping on `sleep_cv_`. */
+  std::atomic<size_t> sleeping_num_;
+
+  /** The number of scheduled tasks that have not been popped yet. */
+  std::atomic<int64_t> pending_num_;
+
+  /** Set when the thread pool is shutting down. */
+  bool shutdown_;
+
+  /** Task-level statistics, see `TaskStats`. */
+  std::atomic<uint64_t> executed_num_;
+  std::atomic<uint64_t> stolen_num_;
+  std::atomic<uint64_t> max_queue_depth_;
+  std::atomic<uint64_t> idle_time_ns_;
+  std::vector<std::atomic<uint64_t>> node_executed_num_;
 
   /** The worker threads */
   std::vector<std::thread> threads_;
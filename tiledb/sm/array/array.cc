@@ -78,7 +78,8 @@ Array::Array(const URI& array_uri, StorageManager* storage_manager)
     , config_(storage_manager_->config())
     , remote_(array_uri.is_tiledb())
     , metadata_loaded_(false)
-    , non_empty_domain_computed_(false) {
+    , non_empty_domain_computed_(false)
+    , memory_tracker_(storage_manager_->memory_tracker()) {
 }
 
 /* ********************************* */
@@ -282,6 +283,8 @@ Status Array::open(
     array_schema_latest_ = array_schema_latest.value();
   } else if (query_type == QueryType::READ) {
     try {
+      auto timer_se =
+          storage_manager_->stats()->start_timer("array_open_load_directory");
       array_dir_ = ArrayDirectory(
           storage_manager_->vfs(),
           storage_manager_->compute_tp(),
@@ -351,6 +354,7 @@ Status Array::close() {
   non_empty_domain_computed_ = false;
   clear_last_max_buffer_sizes();
   fragment_metadata_.clear();
+  clear_mmap_files();
 
   if (remote_) {
     // Update array metadata for write queries if metadata was written by the
@@ -586,7 +590,9 @@ Status Array::reopen(uint64_t timestamp_start, uint64_t timestamp_end) {
 
   timestamp_start_ = timestamp_start;
   timestamp_end_opened_at_ = timestamp_end;
+  auto loaded_fragment_metadata = std::move(fragment_metadata_);
   fragment_metadata_.clear();
+  clear_mmap_files();
   metadata_.clear();
   metadata_loaded_ = false;
   non_empty_domain_.clear();
@@ -605,6 +611,8 @@ Status Array::reopen(uint64_t timestamp_start, uint64_t timestamp_end) {
   }
 
   try {
+    auto timer_se =
+        storage_manager_->stats()->start_timer("array_open_load_directory");
     array_dir_ = ArrayDirectory(
         storage_manager_->vfs(),
         storage_manager_->compute_tp(),
@@ -618,7 +626,7 @@ Status Array::reopen(uint64_t timestamp_start, uint64_t timestamp_end) {
   }
 
   auto&& [st, array_schema_latest, array_schemas, fragment_metadata] =
-      storage_manager_->array_reopen(this);
+      storage_manager_->array_reopen(this, loaded_fragment_metadata);
   RETURN_NOT_OK(st);
 
   array_schema_latest_ = array_schema_latest.value();
@@ -876,6 +884,20 @@ MemoryTracker* Array::memory_tracker() {
   return &memory_tracker_;
 }
 
+Status Array::mmap_file(const URI& uri, shared_ptr<MmapFile>* file) const {
+  std::lock_guard<std::mutex> lock(mmap_files_mtx_);
+  auto it = mmap_files_.find(uri.to_string());
+  if (it != mmap_files_.end()) {
+    *file = it->second;
+    return Status::Ok();
+  }
+
+  RETURN_NOT_OK(storage_manager_->vfs()->mmap(uri, file));
+  mmap_files_[uri.to_string()] = *file;
+
+  return Status::Ok();
+}
+
 /* ********************************* */
 /*          PRIVATE METHODS          */
 /* ********************************* */
@@ -886,6 +908,11 @@ void Array::clear_last_max_buffer_sizes() {
   last_max_buffer_sizes_subarray_.shrink_to_fit();
 }
 
+void Array::clear_mmap_files() {
+  std::lock_guard<std::mutex> lock(mmap_files_mtx_);
+  mmap_files_.clear();
+}
+
 Status Array::compute_max_buffer_sizes(const void* subarray) {
   // Applicable only to domains where all dimensions have the same type
   if (!array_schema_latest_->domain().all_dims_same_type()) {
@@ -34,6 +34,7 @@
 #define TILEDB_ARRAY_H
 
 #include <atomic>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -43,6 +44,7 @@
 #include "tiledb/sm/array/array_directory.h"
 #include "tiledb/sm/array_schema/array_schema.h"
 #include "tiledb/sm/crypto/encryption_key.h"
+#include "tiledb/sm/filesystem/mmap_file.h"
 #include "tiledb/sm/fragment/fragment_info.h"
 #include "tiledb/sm/metadata/metadata.h"
 
@@ -365,6 +367,17 @@ class Array {
   /** Returns the memory tracker. */
   MemoryTracker* memory_tracker();
 
+  /**
+   * Retrieves the memory mapping of a local fragment file, mapping the file
+   * on first use. The mappings are dropped when the array is closed or
+   * reopened; tiles that still reference a mapping keep it alive.
+   *
+   * @param uri The URI of the file.
+   * @param file Set to the mapped file.
+   * @return Status
+   */
+  Status mmap_file(const URI& uri, shared_ptr<MmapFile>* file) const;
+
  private:
   /* ********************************* */
   /*         PRIVATE ATTRIBUTES        */
@@ -468,6 +481,12 @@ class Array {
   /** Memory tracker for the array. */
   MemoryTracker memory_tracker_;
 
+  /** The local fragment files mapped by the readers, by URI. */
+  mutable std::unordered_map<std::string, shared_ptr<MmapFile>> mmap_files_;
+
+  /** Protects `mmap_files_`. */
+  mutable std::mutex mmap_files_mtx_;
+
   /* ********************************* */
   /*          PRIVATE METHODS          */
   /* ********************************* */
@@ -475,6 +494,9 @@ class Array {
   /** Clears the cached max buffer sizes and subarray. */
   void clear_last_max_buffer_sizes();
 
+  /** Drops the memory mappings of the fragment files. */
+  void clear_mmap_files();
+
   /**
    * Computes the maximum buffer sizes for all attributes given a subarray,
    * which are cached locally in the instance.
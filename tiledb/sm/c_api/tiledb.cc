@@ -47,6 +47,7 @@
 #include "tiledb/sm/config/config.h"
 #include "tiledb/sm/config/config_iter.h"
 #include "tiledb/sm/cpp_api/core_interface.h"
+#include "tiledb/sm/enums/aggregate_op.h"
 #include "tiledb/sm/enums/array_type.h"
 #include "tiledb/sm/enums/encryption_type.h"
 #include "tiledb/sm/enums/filesystem.h"
@@ -3458,6 +3459,32 @@ int32_t tiledb_query_get_est_result_size_var_nullable(
   return TILEDB_OK;
 }
 
+int32_t tiledb_query_get_aggregate(
+    tiledb_ctx_t* ctx,
+    const tiledb_query_t* query,
+    const char* name,
+    tiledb_aggregate_op_t op,
+    void* value,
+    uint64_t* value_size) {
+  if (sanity_check(ctx) == TILEDB_ERR || sanity_check(ctx, query) == TILEDB_ERR)
+    return TILEDB_ERR;
+
+  if (SAVE_ERROR_CATCH(
+          ctx, tiledb::sm::aggregate_op_is_valid(static_cast<uint32_t>(op))))
+    return TILEDB_ERR;
+
+  if (SAVE_ERROR_CATCH(
+          ctx,
+          query->query_->get_aggregate(
+              name,
+              static_cast<tiledb::sm::AggregateOp>(op),
+              value,
+              value_size)))
+    return TILEDB_ERR;
+
+  return TILEDB_OK;
+}
+
 int32_t tiledb_query_get_fragment_num(
     tiledb_ctx_t* ctx, const tiledb_query_t* query, uint32_t* num) {
   if (sanity_check(ctx) == TILEDB_ERR || sanity_check(ctx, query) == TILEDB_ERR)
@@ -7085,6 +7112,34 @@ TILEDB_EXPORT int32_t tiledb_query_get_status_details(
   return TILEDB_OK;
 }
 
+int32_t tiledb_query_get_trace(
+    tiledb_ctx_t* ctx, tiledb_query_t* query, char** trace_json) {
+  if (sanity_check(ctx) == TILEDB_ERR || sanity_check(ctx, query) == TILEDB_ERR)
+    return TILEDB_ERR;
+
+  if (trace_json == nullptr)
+    return TILEDB_ERR;
+
+  const std::string str = query->query_->stats()->dump_trace();
+
+  *trace_json = static_cast<char*>(std::malloc(str.size() + 1));
+  if (*trace_json == nullptr)
+    return TILEDB_ERR;
+
+  std::memcpy(*trace_json, str.data(), str.size());
+  (*trace_json)[str.size()] = '\0';
+
+  return TILEDB_OK;
+}
+
+int32_t tiledb_query_free_trace(char** trace_json) {
+  if (trace_json != nullptr) {
+    std::free(*trace_json);
+    *trace_json = nullptr;
+  }
+  return TILEDB_OK;
+}
+
 }  // namespace tiledb::common::detail
 
 /* ****************************** */
@@ -8729,6 +8784,17 @@ int32_t tiledb_query_get_est_result_size_var_nullable(
       ctx, query, name, size_off, size_val, size_validity);
 }
 
+int32_t tiledb_query_get_aggregate(
+    tiledb_ctx_t* ctx,
+    const tiledb_query_t* query,
+    const char* name,
+    tiledb_aggregate_op_t op,
+    void* value,
+    uint64_t* value_size) noexcept {
+  return api_entry<detail::tiledb_query_get_aggregate>(
+      ctx, query, name, op, value, value_size);
+}
+
 int32_t tiledb_query_get_fragment_num(
     tiledb_ctx_t* ctx, const tiledb_query_t* query, uint32_t* num) noexcept {
   return api_entry<detail::tiledb_query_get_fragment_num>(ctx, query, num);
@@ -10215,3 +10281,12 @@ TILEDB_EXPORT int32_t tiledb_query_get_status_details(
     tiledb_query_status_details_t* status) noexcept {
   return api_entry<detail::tiledb_query_get_status_details>(ctx, query, status);
 }
+
+TILEDB_EXPORT int32_t tiledb_query_get_trace(
+    tiledb_ctx_t* ctx, tiledb_query_t* query, char** trace_json) noexcept {
+  return api_entry<detail::tiledb_query_get_trace>(ctx, query, trace_json);
+}
+
+TILEDB_EXPORT int32_t tiledb_query_free_trace(char** trace_json) noexcept {
+  return api_entry<detail::tiledb_query_free_trace>(trace_json);
+}
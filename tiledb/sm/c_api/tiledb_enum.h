@@ -271,6 +271,19 @@
     TILEDB_QUERY_CONDITION_COMBINATION_OP_ENUM(NOT) = 2,
 #endif
 
+#ifdef TILEDB_AGGREGATE_OP_ENUM
+    /** Number of cells */
+    TILEDB_AGGREGATE_OP_ENUM(AGGREGATE_COUNT) = 0,
+    /** Sum of the non-null values */
+    TILEDB_AGGREGATE_OP_ENUM(AGGREGATE_SUM) = 1,
+    /** Minimum of the non-null values */
+    TILEDB_AGGREGATE_OP_ENUM(AGGREGATE_MIN) = 2,
+    /** Maximum of the non-null values */
+    TILEDB_AGGREGATE_OP_ENUM(AGGREGATE_MAX) = 3,
+    /** Number of null values */
+    TILEDB_AGGREGATE_OP_ENUM(AGGREGATE_NULL_COUNT) = 4,
+#endif
+
 #ifdef TILEDB_SERIALIZATION_TYPE_ENUM
     /** Serialize to json */
     TILEDB_SERIALIZATION_TYPE_ENUM(JSON),
@@ -320,6 +320,44 @@ TILEDB_EXPORT int32_t tiledb_query_get_status_details(
     tiledb_query_t* query,
     tiledb_query_status_details_t* status) TILEDB_NOEXCEPT;
 
+/**
+ * Retrieves the trace of a query as Chrome trace JSON, which can be loaded
+ * in `chrome://tracing` or Perfetto. The trace holds a complete event for
+ * each timer that ran for the query, with its start, duration and thread.
+ * Tracing is enabled by setting `sm.query.trace_max_span_num` in the query
+ * config before the query is submitted; otherwise the trace is empty.
+ * VFS timers are recorded by the context rather than by the query, so they
+ * do not appear in the trace.
+ *
+ * **Example:**
+ *
+ * @code{.c}
+ * char* trace_json;
+ * tiledb_query_get_trace(ctx, query, &trace_json);
+ * tiledb_query_free_trace(&trace_json);
+ * @endcode
+ *
+ * @param ctx The TileDB context.
+ * @param query The query object.
+ * @param trace_json Will be set to point to an allocated string containing
+ *   the trace, which must be freed with `tiledb_query_free_trace`.
+ * @return `TILEDB_OK` for success and `TILEDB_ERR` for error.
+ */
+TILEDB_EXPORT int32_t tiledb_query_get_trace(
+    tiledb_ctx_t* ctx,
+    tiledb_query_t* query,
+    char** trace_json) TILEDB_NOEXCEPT;
+
+/**
+ * Frees the memory associated with a previously retrieved query trace.
+ *
+ * @param trace_json Pointer to a trace retrieved with
+ *   `tiledb_query_get_trace`.
+ * @return `TILEDB_OK` for success and `TILEDB_ERR` for error.
+ */
+TILEDB_EXPORT int32_t tiledb_query_free_trace(char** trace_json)
+    TILEDB_NOEXCEPT;
+
 /* ********************************* */
 /*              CONTEXT              */
 /* ********************************* */
@@ -0,0 +1,236 @@
+/**
+ * @file   fragment_metadata_cache.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2017-2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file implements class FragmentMetadataCache.
+ */
+
+#include "tiledb/sm/cache/fragment_metadata_cache.h"
+
+#include <cassert>
+#include <cstring>
+#include <limits>
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+/** The offset in the item key of the footer of a fragment metadata file. */
+static constexpr uint64_t footer_key_offset =
+    std::numeric_limits<uint64_t>::max();
+
+/* ****************************** */
+/*    CONSTRUCTORS & DESTRUCTORS  */
+/* ****************************** */
+
+FragmentMetadataCache::FragmentMetadataCache(
+    stats::Stats* const parent_stats, const uint64_t max_size)
+    : stats_(parent_stats->create_child("FragmentMetadataCache"))
+    , max_size_(max_size)
+    , size_(0) {
+}
+
+FragmentMetadataCache::~FragmentMetadataCache() = default;
+
+/* ****************************** */
+/*               API              */
+/* ****************************** */
+
+Status FragmentMetadataCache::insert(
+    const URI& fragment_uri,
+    const uint32_t version,
+    const uint64_t offset,
+    const Buffer& buff) {
+  insert(CacheItem(make_key(fragment_uri, version, offset), buff));
+  return Status::Ok();
+}
+
+Status FragmentMetadataCache::read(
+    const URI& fragment_uri,
+    const uint32_t version,
+    const uint64_t offset,
+    Buffer* const buff,
+    bool* const success) {
+  assert(success);
+  const auto key = make_key(fragment_uri, version, offset);
+  {
+    std::lock_guard<std::mutex> lg(mtx_);
+    *success = read(key, buff) != nullptr;
+  }
+
+  stats_->add_counter(*success ? "hit_num" : "miss_num", 1);
+  return Status::Ok();
+}
+
+Status FragmentMetadataCache::insert_footer(
+    const URI& fragment_uri,
+    const uint32_t version,
+    const uint64_t meta_file_size,
+    const uint64_t footer_offset,
+    const Buffer& buff) {
+  CacheItem item(make_key(fragment_uri, version, footer_key_offset), buff);
+  item.meta_file_size_ = meta_file_size;
+  item.footer_offset_ = footer_offset;
+  insert(std::move(item));
+  return Status::Ok();
+}
+
+Status FragmentMetadataCache::read_footer(
+    const URI& fragment_uri,
+    const uint32_t version,
+    uint64_t* const meta_file_size,
+    uint64_t* const footer_offset,
+    Buffer* const buff,
+    bool* const success) {
+  assert(success);
+  const auto key = make_key(fragment_uri, version, footer_key_offset);
+  {
+    std::lock_guard<std::mutex> lg(mtx_);
+    auto item = read(key, buff);
+    *success = item != nullptr;
+    if (*success) {
+      *meta_file_size = item->meta_file_size_;
+      *footer_offset = item->footer_offset_;
+    }
+  }
+
+  stats_->add_counter(*success ? "footer_hit_num" : "footer_miss_num", 1);
+  return Status::Ok();
+}
+
+uint64_t FragmentMetadataCache::invalidate(const URI& fragment_uri) {
+  const auto uri = fragment_uri.remove_trailing_slash().to_string();
+  uint64_t invalidated_num = 0;
+  {
+    // Fragments are vacuumed rarely, so a scan of all items is preferred
+    // over an index by fragment.
+    std::lock_guard<std::mutex> lg(mtx_);
+    for (auto it = item_ll_.begin(); it != item_ll_.end();) {
+      auto next = std::next(it);
+      if (it->key_.fragment_uri_ == uri) {
+        erase(it);
+        ++invalidated_num;
+      }
+      it = next;
+    }
+  }
+
+  if (invalidated_num > 0)
+    stats_->add_counter("invalidated_num", invalidated_num);
+
+  return invalidated_num;
+}
+
+void FragmentMetadataCache::clear() {
+  std::lock_guard<std::mutex> lg(mtx_);
+  item_map_.clear();
+  item_ll_.clear();
+  size_ = 0;
+}
+
+uint64_t FragmentMetadataCache::size() const {
+  std::lock_guard<std::mutex> lg(mtx_);
+  return size_;
+}
+
+/* ****************************** */
+/*         PRIVATE METHODS        */
+/* ****************************** */
+
+std::size_t FragmentMetadataCache::KeyHasher::operator()(
+    const Key& key) const {
+  return std::hash<std::string>()(key.fragment_uri_) ^
+         ((key.offset_ + key.version_) * 0x9e3779b97f4a7c15ULL);
+}
+
+FragmentMetadataCache::Key FragmentMetadataCache::make_key(
+    const URI& fragment_uri, const uint32_t version, const uint64_t offset) {
+  return Key{fragment_uri.remove_trailing_slash().to_string(), version, offset};
+}
+
+void FragmentMetadataCache::insert(CacheItem&& item) {
+  const uint64_t size = item.size();
+
+  // Do nothing if the item is bigger than the cache maximum size.
+  if (size > max_size_)
+    return;
+
+  uint64_t evicted_num = 0;
+  {
+    std::lock_guard<std::mutex> lg(mtx_);
+
+    // Replace the existing item, if another thread inserted it first.
+    auto item_it = item_map_.find(item.key_);
+    if (item_it != item_map_.end())
+      erase(item_it->second);
+
+    // Evict items until there is room for `item`.
+    while (size_ + size > max_size_) {
+      erase(item_ll_.begin());
+      ++evicted_num;
+    }
+
+    item_ll_.emplace_back(std::move(item));
+    item_map_.emplace(item_ll_.back().key_, std::prev(item_ll_.end()));
+    size_ += size;
+  }
+
+  if (evicted_num > 0)
+    stats_->add_counter("evicted_num", evicted_num);
+}
+
+const FragmentMetadataCache::CacheItem* FragmentMetadataCache::read(
+    const Key& key, Buffer* const buff) {
+  auto item_it = item_map_.find(key);
+  if (item_it == item_map_.end())
+    return nullptr;
+
+  // Touch the item to make it the most recently used item.
+  auto it = item_it->second;
+  item_ll_.splice(item_ll_.end(), item_ll_, it);
+
+  const auto& cached = it->buff_;
+  if (!buff->realloc(cached.size()).ok())
+    return nullptr;
+  if (cached.size() > 0)
+    std::memcpy(buff->data(), cached.data(), cached.size());
+  buff->set_size(cached.size());
+  buff->reset_offset();
+
+  return &*it;
+}
+
+void FragmentMetadataCache::erase(std::list<CacheItem>::iterator it) {
+  size_ -= it->size();
+  item_map_.erase(it->key_);
+  item_ll_.erase(it);
+}
+
+}  // namespace sm
+}  // namespace tiledb
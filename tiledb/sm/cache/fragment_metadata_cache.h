@@ -0,0 +1,292 @@
+/**
+ * @file   fragment_metadata_cache.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2017-2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class FragmentMetadataCache.
+ */
+
+#ifndef TILEDB_FRAGMENT_METADATA_CACHE_H
+#define TILEDB_FRAGMENT_METADATA_CACHE_H
+
+#include "tiledb/common/macros.h"
+#include "tiledb/common/status.h"
+#include "tiledb/sm/buffer/buffer.h"
+#include "tiledb/sm/filesystem/uri.h"
+#include "tiledb/sm/stats/stats.h"
+
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+/**
+ * Caches the fragment metadata read from storage, across all the arrays
+ * opened in a context. An item is the footer of a fragment metadata file,
+ * or the contents of one of its generic tiles (R-tree, tile offsets, tile
+ * var sizes, tile min/max, etc.) after unfiltering. Items are keyed by the
+ * fragment URI, the fragment format version and the offset of the item in
+ * the fragment metadata file, and are evicted in LRU order once their total
+ * byte size exceeds the cache budget.
+ *
+ * Fragments are immutable once committed, so the items never go stale while
+ * the fragment exists; the items of a fragment are dropped with
+ * `invalidate` when the fragment is vacuumed.
+ *
+ * This class is thread-safe.
+ */
+class FragmentMetadataCache {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /**
+   * Constructor.
+   *
+   * @param parent_stats The parent stats to inherit from.
+   * @param max_size The maximum cache byte size.
+   */
+  FragmentMetadataCache(stats::Stats* parent_stats, uint64_t max_size);
+
+  /** Destructor. */
+  ~FragmentMetadataCache();
+
+  DISABLE_COPY_AND_COPY_ASSIGN(FragmentMetadataCache);
+  DISABLE_MOVE_AND_MOVE_ASSIGN(FragmentMetadataCache);
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /**
+   * Inserts a copy of the unfiltered generic tile stored at `offset` in the
+   * metadata file of a fragment.
+   *
+   * @param fragment_uri The fragment URI.
+   * @param version The fragment format version.
+   * @param offset The offset of the generic tile in the metadata file.
+   * @param buff The unfiltered generic tile contents.
+   * @return Status
+   */
+  Status insert(
+      const URI& fragment_uri,
+      uint32_t version,
+      uint64_t offset,
+      const Buffer& buff);
+
+  /**
+   * Reads the unfiltered generic tile stored at `offset` in the metadata
+   * file of a fragment.
+   *
+   * @param fragment_uri The fragment URI.
+   * @param version The fragment format version.
+   * @param offset The offset of the generic tile in the metadata file.
+   * @param buff The buffer the tile contents are copied into. Its offset is
+   *     reset.
+   * @param success `true` if the tile was read from the cache and `false`
+   *     otherwise.
+   * @return Status
+   */
+  Status read(
+      const URI& fragment_uri,
+      uint32_t version,
+      uint64_t offset,
+      Buffer* buff,
+      bool* success);
+
+  /**
+   * Inserts a copy of the footer of the metadata file of a fragment.
+   *
+   * @param fragment_uri The fragment URI.
+   * @param version The fragment format version parsed from the fragment
+   *     name, `UINT32_MAX` if the name does not hold it.
+   * @param meta_file_size The size of the fragment metadata file.
+   * @param footer_offset The offset of the footer in the metadata file.
+   * @param buff The footer contents.
+   * @return Status
+   */
+  Status insert_footer(
+      const URI& fragment_uri,
+      uint32_t version,
+      uint64_t meta_file_size,
+      uint64_t footer_offset,
+      const Buffer& buff);
+
+  /**
+   * Reads the footer of the metadata file of a fragment.
+   *
+   * @param fragment_uri The fragment URI.
+   * @param version The fragment format version parsed from the fragment
+   *     name, `UINT32_MAX` if the name does not hold it.
+   * @param meta_file_size Set to the size of the fragment metadata file.
+   * @param footer_offset Set to the offset of the footer in the metadata
+   *     file.
+   * @param buff The buffer the footer is copied into. Its offset is reset.
+   * @param success `true` if the footer was read from the cache and `false`
+   *     otherwise.
+   * @return Status
+   */
+  Status read_footer(
+      const URI& fragment_uri,
+      uint32_t version,
+      uint64_t* meta_file_size,
+      uint64_t* footer_offset,
+      Buffer* buff,
+      bool* success);
+
+  /**
+   * Evicts all the items of a fragment, of any format version.
+   *
+   * @param fragment_uri The fragment URI.
+   * @return The number of evicted items.
+   */
+  uint64_t invalidate(const URI& fragment_uri);
+
+  /** Clears the cache, deleting all cached items. */
+  void clear();
+
+  /** Returns the total byte size of the cached items. */
+  uint64_t size() const;
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE DATATYPES         */
+  /* ********************************* */
+
+  /** The key of a cached item. */
+  struct Key {
+    /** Equality operator. */
+    bool operator==(const Key& other) const {
+      return offset_ == other.offset_ && version_ == other.version_ &&
+             fragment_uri_ == other.fragment_uri_;
+    }
+
+    /** The fragment URI, without a trailing slash. */
+    std::string fragment_uri_;
+
+    /** The fragment format version. */
+    uint32_t version_;
+
+    /**
+     * The offset of the item in the fragment metadata file, `UINT64_MAX`
+     * for the footer.
+     */
+    uint64_t offset_;
+  };
+
+  /** Hash operator for `Key`. */
+  struct KeyHasher {
+    std::size_t operator()(const Key& key) const;
+  };
+
+  /** A cached item. */
+  struct CacheItem {
+    /** Constructor. */
+    CacheItem(const Key& key, const Buffer& buff)
+        : key_(key)
+        , buff_(buff)
+        , meta_file_size_(0)
+        , footer_offset_(0) {
+    }
+
+    /** The item key. */
+    Key key_;
+
+    /** The item contents. */
+    Buffer buff_;
+
+    /** The size of the fragment metadata file (footer only). */
+    uint64_t meta_file_size_;
+
+    /** The offset of the footer in the fragment metadata file. */
+    uint64_t footer_offset_;
+
+    /** The number of bytes the item counts against the budget. */
+    uint64_t size() const {
+      return buff_.size() + key_.fragment_uri_.size();
+    }
+  };
+
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** The class stats. */
+  stats::Stats* stats_;
+
+  /** Protects all cache state. */
+  mutable std::mutex mtx_;
+
+  /** The maximum cache byte size. */
+  const uint64_t max_size_;
+
+  /** The current cache byte size. */
+  uint64_t size_;
+
+  /** Items in LRU order, the head being evicted first. */
+  std::list<CacheItem> item_ll_;
+
+  /** Maps a key to its node in `item_ll_`. */
+  std::unordered_map<Key, std::list<CacheItem>::iterator, KeyHasher>
+      item_map_;
+
+  /* ********************************* */
+  /*         PRIVATE METHODS           */
+  /* ********************************* */
+
+  /** Returns the key of an item. */
+  static Key make_key(
+      const URI& fragment_uri, uint32_t version, uint64_t offset);
+
+  /**
+   * Inserts `item`, replacing any item with the same key and evicting the
+   * least recently used items until it fits.
+   */
+  void insert(CacheItem&& item);
+
+  /**
+   * Looks up the item with `key`, marking it as the most recently used one
+   * and copying its contents into `buff`. Must be called with `mtx_` held.
+   *
+   * @return The item, or `nullptr` if it is not cached.
+   */
+  const CacheItem* read(const Key& key, Buffer* buff);
+
+  /** Removes the item at `it`. Must be called with `mtx_` held. */
+  void erase(std::list<CacheItem>::iterator it);
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_FRAGMENT_METADATA_CACHE_H
@@ -0,0 +1,163 @@
+/**
+ * @file   read_ahead_cache.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2017-2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class ReadAheadCache.
+ */
+
+#ifndef TILEDB_READ_AHEAD_CACHE_H
+#define TILEDB_READ_AHEAD_CACHE_H
+
+#include "tiledb/common/macros.h"
+#include "tiledb/common/status.h"
+#include "tiledb/sm/buffer/buffer.h"
+#include "tiledb/sm/cache/lru_cache.h"
+#include "tiledb/sm/filesystem/uri.h"
+
+#include <mutex>
+#include <string>
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+/**
+ * Represents a sub-range of data within a URI file at a
+ * specific file offset.
+ */
+struct ReadAheadBuffer {
+  /* ********************************* */
+  /*            CONSTRUCTORS           */
+  /* ********************************* */
+
+  /** Value Constructor. */
+  ReadAheadBuffer(const uint64_t offset, Buffer&& buffer)
+      : offset_(offset)
+      , buffer_(std::move(buffer)) {
+  }
+
+  /** Move Constructor. */
+  ReadAheadBuffer(ReadAheadBuffer&& other)
+      : offset_(other.offset_)
+      , buffer_(std::move(other.buffer_)) {
+  }
+
+  /* ********************************* */
+  /*             OPERATORS             */
+  /* ********************************* */
+
+  /** Move-Assign Operator. */
+  ReadAheadBuffer& operator=(ReadAheadBuffer&& other) {
+    offset_ = other.offset_;
+    buffer_ = std::move(other.buffer_);
+    return *this;
+  }
+
+  DISABLE_COPY_AND_COPY_ASSIGN(ReadAheadBuffer);
+
+  /* ********************************* */
+  /*             ATTRIBUTES            */
+  /* ********************************* */
+
+  /** The offset within the associated URI. */
+  uint64_t offset_;
+
+  /** The buffered data at `offset`. */
+  Buffer buffer_;
+};
+
+/**
+ * An LRU cache of `ReadAheadBuffer` objects keyed by a URI string.
+ */
+class ReadAheadCache : public LRUCache<std::string, ReadAheadBuffer> {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /** Constructor. */
+  ReadAheadCache(const uint64_t max_cached_buffers);
+
+  /** Destructor. */
+  virtual ~ReadAheadCache() = default;
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /**
+   * Attempts to read a buffer from the cache.
+   *
+   * @param uri The URI associated with the buffer to cache.
+   * @param offset The offset that buffer starts at within the URI.
+   * @param buffer The buffer to cache.
+   * @param nbytes The number of bytes within the buffer.
+   * @param success True if `buffer` was read from the cache.
+   * @return Status
+   */
+  Status read(
+      const URI& uri,
+      uint64_t offset,
+      void* buffer,
+      uint64_t nbytes,
+      bool* success);
+
+  /**
+   * Writes a cached buffer for the given uri.
+   *
+   * @param uri The URI associated with the buffer to cache.
+   * @param offset The offset that buffer starts at within the URI.
+   * @param buffer The buffer to cache.
+   * @return Status
+   */
+  Status insert(const URI& uri, uint64_t offset, Buffer&& buffer);
+
+  /**
+   * Evicts the cached buffer of the given URI, or the cached buffers of all
+   * URIs in the given directory.
+   *
+   * @param uri The URI of the file or directory.
+   * @param is_dir `true` if `uri` is a directory.
+   * @return Status
+   */
+  Status invalidate(const URI& uri, bool is_dir);
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  // Protects LRUCache routines.
+  std::mutex lru_mtx_;
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_READ_AHEAD_CACHE_H
@@ -0,0 +1,190 @@
+/**
+ * @file   read_ahead_tracker.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2017-2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file implements class ReadAheadTracker.
+ */
+
+#include "tiledb/sm/cache/read_ahead_tracker.h"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+/* ****************************** */
+/*   CONSTRUCTORS & DESTRUCTORS   */
+/* ****************************** */
+
+ReadAheadTracker::ReadAheadTracker(const uint64_t max_tracked_uris)
+    : LRUCache(max_tracked_uris)
+    , last_id_(0) {
+}
+
+/* ****************************** */
+/*               API              */
+/* ****************************** */
+
+Status ReadAheadTracker::access(
+    const URI& uri,
+    const uint64_t offset,
+    const uint64_t nbytes,
+    const uint64_t min_window,
+    const uint64_t max_window,
+    uint64_t* const window,
+    uint64_t* const id) {
+  std::lock_guard<std::mutex> lg(lru_mtx_);
+
+  const std::string uri_str = uri.to_string();
+  ReadAheadState state;
+  if (!has_item(uri_str)) {
+    state.id_ = ++last_id_;
+    state.window_ = min_window;
+    state.sequential_ = false;
+    state.cached_end_ = 0;
+    state.file_size_ = std::numeric_limits<uint64_t>::max();
+    state.prefetching_ = false;
+  } else {
+    state = *get_item(uri_str);
+    state.sequential_ = offset >= state.next_offset_ &&
+                        offset - state.next_offset_ <= state.window_;
+    if (state.sequential_) {
+      state.window_ = state.window_ == 0 ?
+                          min_window :
+                          std::min(state.window_ * 2, max_window);
+    } else {
+      state.window_ /= 2;
+      if (state.window_ < min_window)
+        state.window_ = 0;
+    }
+  }
+  state.next_offset_ = offset + nbytes;
+
+  *window = state.window_;
+  *id = state.id_;
+  return LRUCache::insert(uri_str, std::move(state), 1);
+}
+
+Status ReadAheadTracker::insert(
+    ReadAheadCache* const cache,
+    const URI& uri,
+    const uint64_t id,
+    const uint64_t offset,
+    Buffer&& buffer,
+    const bool eof,
+    const bool prefetched) {
+  std::lock_guard<std::mutex> lg(lru_mtx_);
+
+  const std::string uri_str = uri.to_string();
+  if (!has_item(uri_str) || get_item(uri_str)->id_ != id)
+    return Status::Ok();
+
+  // Keep the cached buffer if a prefetched buffer does not extend it,
+  // as the reads may have overtaken the prefetch.
+  ReadAheadState state = *get_item(uri_str);
+  const uint64_t end = offset + buffer.size();
+  if (eof)
+    state.file_size_ = end;
+  if (prefetched)
+    state.prefetching_ = false;
+  if (buffer.size() > 0 && (!prefetched || end > state.cached_end_)) {
+    state.cached_end_ = end;
+    RETURN_NOT_OK(cache->insert(uri, offset, std::move(buffer)));
+  }
+
+  return LRUCache::insert(uri_str, std::move(state), 1);
+}
+
+Status ReadAheadTracker::start_prefetch(
+    const URI& uri,
+    uint64_t* const id,
+    uint64_t* const offset,
+    uint64_t* const nbytes,
+    bool* const prefetch) {
+  std::lock_guard<std::mutex> lg(lru_mtx_);
+
+  *prefetch = false;
+  const std::string uri_str = uri.to_string();
+  if (!has_item(uri_str))
+    return Status::Ok();
+
+  ReadAheadState state = *get_item(uri_str);
+  if (!state.sequential_ || state.prefetching_ || state.window_ == 0 ||
+      state.next_offset_ >= state.file_size_)
+    return Status::Ok();
+  if (state.cached_end_ > state.next_offset_ &&
+      state.cached_end_ - state.next_offset_ >= state.window_ / 2)
+    return Status::Ok();
+
+  *id = state.id_;
+  *offset = state.next_offset_;
+  *nbytes = std::min(state.window_, state.file_size_ - state.next_offset_);
+  state.prefetching_ = true;
+  *prefetch = true;
+  return LRUCache::insert(uri_str, std::move(state), 1);
+}
+
+Status ReadAheadTracker::end_prefetch(const URI& uri, const uint64_t id) {
+  std::lock_guard<std::mutex> lg(lru_mtx_);
+
+  const std::string uri_str = uri.to_string();
+  if (!has_item(uri_str) || get_item(uri_str)->id_ != id)
+    return Status::Ok();
+
+  ReadAheadState state = *get_item(uri_str);
+  state.prefetching_ = false;
+  return LRUCache::insert(uri_str, std::move(state), 1);
+}
+
+Status ReadAheadTracker::invalidate(
+    ReadAheadCache* const cache, const URI& uri, const bool is_dir) {
+  std::lock_guard<std::mutex> lg(lru_mtx_);
+
+  bool success;
+  if (!is_dir) {
+    RETURN_NOT_OK(LRUCache::invalidate(uri.to_string(), &success));
+  } else {
+    const std::string prefix = uri.add_trailing_slash().to_string();
+    std::vector<std::string> keys;
+    for (auto it = item_iter_begin(); it != item_iter_end(); ++it) {
+      if (it->key_.compare(0, prefix.size(), prefix) == 0)
+        keys.push_back(it->key_);
+    }
+    for (const auto& key : keys)
+      RETURN_NOT_OK(LRUCache::invalidate(key, &success));
+  }
+
+  return cache->invalidate(uri, is_dir);
+}
+
+}  // namespace sm
+}  // namespace tiledb
@@ -0,0 +1,199 @@
+/**
+ * @file   read_ahead_tracker.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2017-2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class ReadAheadTracker.
+ */
+
+#ifndef TILEDB_READ_AHEAD_TRACKER_H
+#define TILEDB_READ_AHEAD_TRACKER_H
+
+#include "tiledb/common/status.h"
+#include "tiledb/sm/buffer/buffer.h"
+#include "tiledb/sm/cache/lru_cache.h"
+#include "tiledb/sm/cache/read_ahead_cache.h"
+#include "tiledb/sm/filesystem/uri.h"
+
+#include <mutex>
+#include <string>
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+/**
+ * The access pattern of a single URI, used to size its read-ahead.
+ */
+struct ReadAheadState {
+  /** Identifies the state; a new state is created after invalidation. */
+  uint64_t id_;
+
+  /** The offset following the last read. */
+  uint64_t next_offset_;
+
+  /** The read-ahead window size. Read-ahead is disabled if `0`. */
+  uint64_t window_;
+
+  /** `true` if the last read continued the previous one. */
+  bool sequential_;
+
+  /** The offset following the most recently cached read-ahead buffer. */
+  uint64_t cached_end_;
+
+  /** The file size, once a read-ahead has reached the end of the file. */
+  uint64_t file_size_;
+
+  /** `true` while a read-ahead buffer is being prefetched. */
+  bool prefetching_;
+};
+
+/**
+ * An LRU cache of `ReadAheadState` objects keyed by a URI string. It
+ * detects sequential reads per URI and adapts the read-ahead window:
+ * the window doubles with every sequential read up to a maximum, and halves
+ * with every random read until read-ahead is disabled for the URI.
+ *
+ * This class is thread-safe.
+ */
+class ReadAheadTracker : public LRUCache<std::string, ReadAheadState> {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /** Constructor. */
+  ReadAheadTracker(const uint64_t max_tracked_uris);
+
+  /** Destructor. */
+  virtual ~ReadAheadTracker() = default;
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /**
+   * Records a read and computes the read-ahead window for it.
+   *
+   * @param uri The URI of the file.
+   * @param offset The offset where the read begins.
+   * @param nbytes Number of bytes to read.
+   * @param min_window The initial window size.
+   * @param max_window The maximum window size.
+   * @param window Set to the read-ahead window size, `0` if read-ahead is
+   *     disabled.
+   * @param id Set to the identifier of the URI state.
+   * @return Status
+   */
+  Status access(
+      const URI& uri,
+      uint64_t offset,
+      uint64_t nbytes,
+      uint64_t min_window,
+      uint64_t max_window,
+      uint64_t* window,
+      uint64_t* id);
+
+  /**
+   * Caches a read-ahead buffer, unless the URI was invalidated since the
+   * buffer was read.
+   *
+   * @param cache The read-ahead cache.
+   * @param uri The URI of the file.
+   * @param id The identifier of the URI state the buffer was read for.
+   * @param offset The offset that buffer starts at within the URI.
+   * @param buffer The buffer to cache.
+   * @param eof `true` if the buffer reaches the end of the file.
+   * @param prefetched `true` if the buffer was prefetched.
+   * @return Status
+   */
+  Status insert(
+      ReadAheadCache* cache,
+      const URI& uri,
+      uint64_t id,
+      uint64_t offset,
+      Buffer&& buffer,
+      bool eof,
+      bool prefetched);
+
+  /**
+   * Starts a prefetch if the last read of the URI was sequential and it
+   * consumed more than half of the window from the cached read-ahead
+   * buffer.
+   *
+   * @param uri The URI of the file.
+   * @param id Set to the identifier of the URI state.
+   * @param offset Set to the offset to prefetch from.
+   * @param nbytes Set to the number of bytes to prefetch.
+   * @param prefetch Set to `true` if a prefetch should be issued.
+   * @return Status
+   */
+  Status start_prefetch(
+      const URI& uri,
+      uint64_t* id,
+      uint64_t* offset,
+      uint64_t* nbytes,
+      bool* prefetch);
+
+  /**
+   * Ends a prefetch that did not cache a buffer.
+   *
+   * @param uri The URI of the file.
+   * @param id The identifier of the URI state the prefetch was issued for.
+   * @return Status
+   */
+  Status end_prefetch(const URI& uri, uint64_t id);
+
+  /**
+   * Forgets the access pattern of the given URI, or of all URIs in the
+   * given directory, and evicts their cached read-ahead buffers. Buffers
+   * that are still being prefetched for them are dropped.
+   *
+   * @param cache The read-ahead cache.
+   * @param uri The URI of the file or directory.
+   * @param is_dir `true` if `uri` is a directory.
+   * @return Status
+   */
+  Status invalidate(ReadAheadCache* cache, const URI& uri, bool is_dir);
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** The identifier of the most recently created URI state. */
+  uint64_t last_id_;
+
+  // Protects LRUCache routines.
+  std::mutex lru_mtx_;
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_READ_AHEAD_TRACKER_H
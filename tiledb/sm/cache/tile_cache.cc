@@ -0,0 +1,268 @@
+/**
+ * @file   tile_cache.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2017-2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file implements class TileCache.
+ */
+
+#include "tiledb/sm/cache/tile_cache.h"
+#include "tiledb/common/logger.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+/* ****************************** */
+/*    CONSTRUCTORS & DESTRUCTORS  */
+/* ****************************** */
+
+TileCache::TileCache(
+    stats::Stats* const parent_stats,
+    const uint64_t max_size,
+    const uint64_t shard_num,
+    const TileCachePolicy policy)
+    : stats_(parent_stats->create_child("TileCache")) {
+  const uint64_t num = shard_num == 0 ? auto_shard_num(max_size) : shard_num;
+  shards_.reserve(num);
+  for (uint64_t i = 0; i < num; ++i) {
+    shards_.emplace_back(tdb_new(Shard, max_size / num, policy));
+  }
+}
+
+TileCache::~TileCache() = default;
+
+/* ****************************** */
+/*               API              */
+/* ****************************** */
+
+Status TileCache::insert(
+    const TileCacheKey& key, FilteredBuffer&& buffer, const bool overwrite) {
+  const uint64_t size = buffer.size();
+  auto& s = shard(key);
+
+  uint64_t evicted_num = 0;
+  {
+    std::lock_guard<std::mutex> lg(s.mtx_);
+
+    // Do nothing if the tile is bigger than the shard maximum size.
+    if (size > s.max_size_)
+      return Status::Ok();
+
+    auto item_it = s.item_map_.find(key);
+    if (item_it != s.item_map_.end()) {
+      if (!overwrite)
+        return Status::Ok();
+
+      // Replace the existing item.
+      s.erase(item_it->second);
+    }
+
+    // Evict items until there is room for `buffer`.
+    while (s.size_ + size > s.max_size_) {
+      s.evict();
+      ++evicted_num;
+    }
+
+    // New items always start in the probationary segment.
+    s.probation_ll_.emplace_back(key, std::move(buffer));
+    s.item_map_.emplace(key, std::prev(s.probation_ll_.end()));
+    s.size_ += size;
+  }
+
+  if (evicted_num > 0)
+    stats_->add_counter("evicted_tile_num", evicted_num);
+
+  return Status::Ok();
+}
+
+Status TileCache::read(
+    const TileCacheKey& key,
+    FilteredBuffer& buffer,
+    const uint64_t nbytes,
+    bool* const success) {
+  return read(key, static_cast<void*>(buffer.data()), nbytes, success);
+}
+
+Status TileCache::read(
+    const TileCacheKey& key,
+    void* const buffer,
+    const uint64_t nbytes,
+    bool* const success) {
+  assert(success);
+  *success = false;
+
+  auto& s = shard(key);
+  std::lock_guard<std::mutex> lg(s.mtx_);
+
+  // Check if the cache contains the tile.
+  auto item_it = s.item_map_.find(key);
+  if (item_it == s.item_map_.end())
+    return Status::Ok();
+
+  // Check the bounds of the read.
+  const FilteredBuffer& cached_buffer = item_it->second->buffer_;
+  if (cached_buffer.size() < nbytes) {
+    return LOG_STATUS(
+        Status_LRUCacheError("Failed to read item; Byte range out of bounds"));
+  }
+
+  // Copy the requested range into the output `buffer`.
+  memcpy(buffer, cached_buffer.data(), nbytes);
+
+  // Touch the item to make it the most recently used item.
+  s.touch(item_it->second);
+
+  *success = true;
+  return Status::Ok();
+}
+
+Status TileCache::invalidate(const TileCacheKey& key, bool* const success) {
+  assert(success);
+  *success = false;
+
+  auto& s = shard(key);
+  std::lock_guard<std::mutex> lg(s.mtx_);
+
+  auto item_it = s.item_map_.find(key);
+  if (item_it == s.item_map_.end())
+    return Status::Ok();
+
+  s.erase(item_it->second);
+  *success = true;
+
+  return Status::Ok();
+}
+
+void TileCache::clear() {
+  for (auto& s : shards_) {
+    std::lock_guard<std::mutex> lg(s->mtx_);
+    s->clear();
+  }
+}
+
+uint64_t TileCache::auto_shard_num(const uint64_t max_size) {
+  return std::clamp<uint64_t>(
+      max_size / min_auto_shard_size_, 1, max_auto_shard_num_);
+}
+
+uint64_t TileCache::shard_num() const {
+  return shards_.size();
+}
+
+uint64_t TileCache::size() const {
+  uint64_t size = 0;
+  for (auto& s : shards_) {
+    std::lock_guard<std::mutex> lg(s->mtx_);
+    size += s->size_;
+  }
+
+  return size;
+}
+
+/* ****************************** */
+/*         PRIVATE METHODS        */
+/* ****************************** */
+
+TileCache::Shard& TileCache::shard(const TileCacheKey& key) {
+  return *shards_[TileCacheKeyHasher()(key) % shards_.size()];
+}
+
+TileCache::Shard::Shard(const uint64_t max_size, const TileCachePolicy policy)
+    : policy_(policy)
+    , max_size_(max_size)
+    , max_protected_size_(
+          policy == TileCachePolicy::SLRU ? max_size / 5 * 4 : 0)
+    , size_(0)
+    , protected_size_(0) {
+}
+
+void TileCache::Shard::evict() {
+  assert(!probation_ll_.empty() || !protected_ll_.empty());
+
+  // Probationary items are always evicted before protected items.
+  if (!probation_ll_.empty())
+    erase(probation_ll_.begin());
+  else
+    erase(protected_ll_.begin());
+}
+
+void TileCache::Shard::erase(std::list<CacheItem>::iterator it) {
+  const uint64_t size = it->buffer_.size();
+  item_map_.erase(it->key_);
+  size_ -= size;
+  if (it->protected_) {
+    protected_size_ -= size;
+    protected_ll_.erase(it);
+  } else {
+    probation_ll_.erase(it);
+  }
+}
+
+void TileCache::Shard::touch(std::list<CacheItem>::iterator it) {
+  // Plain LRU: move the item to the end of the list.
+  if (policy_ == TileCachePolicy::LRU) {
+    probation_ll_.splice(probation_ll_.end(), probation_ll_, it);
+    return;
+  }
+
+  // SLRU: a hit promotes the item to the end of the protected segment.
+  // Splicing keeps `it` valid, so `item_map_` needs no update.
+  if (it->protected_) {
+    protected_ll_.splice(protected_ll_.end(), protected_ll_, it);
+    return;
+  }
+
+  protected_ll_.splice(protected_ll_.end(), probation_ll_, it);
+  it->protected_ = true;
+  protected_size_ += it->buffer_.size();
+
+  // Demote the least recently used protected items back to the end of the
+  // probationary segment until the protected segment fits its budget.
+  while (protected_size_ > max_protected_size_ && protected_ll_.size() > 1) {
+    auto lru = protected_ll_.begin();
+    lru->protected_ = false;
+    protected_size_ -= lru->buffer_.size();
+    probation_ll_.splice(probation_ll_.end(), protected_ll_, lru);
+  }
+}
+
+void TileCache::Shard::clear() {
+  item_map_.clear();
+  probation_ll_.clear();
+  protected_ll_.clear();
+  size_ = 0;
+  protected_size_ = 0;
+}
+
+}  // namespace sm
+}  // namespace tiledb
@@ -0,0 +1,352 @@
+/**
+ * @file   tile_cache.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2017-2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class TileCache.
+ */
+
+#ifndef TILEDB_TILE_CACHE_H
+#define TILEDB_TILE_CACHE_H
+
+#include "tiledb/common/heap_memory.h"
+#include "tiledb/common/macros.h"
+#include "tiledb/common/status.h"
+#include "tiledb/sm/stats/stats.h"
+#include "tiledb/sm/tile/filtered_buffer.h"
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+/** The eviction policy of the tile cache. */
+enum class TileCachePolicy : uint8_t {
+  /** Evicts the least recently used tile. */
+  LRU,
+
+  /**
+   * Segmented LRU: tiles enter a probationary segment and are promoted to a
+   * protected segment on their first hit. Tiles that are read only once (for
+   * example by a full scan) are evicted before any protected tile.
+   */
+  SLRU
+};
+
+/** The file of a field that a cached tile is stored in. */
+enum class TileCacheFile : uint8_t {
+  /** The file of the fixed-size data or of the offsets. */
+  FIXED,
+
+  /** The file of the var-size data. */
+  VAR,
+
+  /** The file of the validity data. */
+  VALIDITY
+};
+
+/**
+ * Fixed-size key of a cached tile, made only of integers: the id of the
+ * fragment the tile belongs to, the index of its field in the fragment
+ * together with the file of that field, and the index of the tile.
+ */
+struct TileCacheKey {
+  /**
+   * Constructor.
+   *
+   * @param fragment_id The id of the fragment, unique among the fragments
+   *     sharing the cache.
+   * @param field_idx The index of the attribute/dimension in the fragment.
+   * @param file The file of the field the tile is stored in.
+   * @param tile_idx The index of the tile in the fragment.
+   */
+  TileCacheKey(
+      uint64_t fragment_id,
+      uint64_t field_idx,
+      TileCacheFile file,
+      uint64_t tile_idx)
+      : fragment_id_(fragment_id)
+      , file_id_((field_idx << 2) | static_cast<uint64_t>(file))
+      , tile_idx_(tile_idx) {
+  }
+
+  /** Equality operator. */
+  bool operator==(const TileCacheKey& other) const {
+    return fragment_id_ == other.fragment_id_ && file_id_ == other.file_id_ &&
+           tile_idx_ == other.tile_idx_;
+  }
+
+  /** The id of the fragment. */
+  uint64_t fragment_id_;
+
+  /** The index of the field in the fragment and the file of the field. */
+  uint64_t file_id_;
+
+  /** The index of the tile in the fragment. */
+  uint64_t tile_idx_;
+};
+
+/** Hash operator for `TileCacheKey`. */
+struct TileCacheKeyHasher {
+  std::size_t operator()(const TileCacheKey& key) const {
+    uint64_t h = key.fragment_id_ * 0x9e3779b97f4a7c15ULL;
+    h = (h ^ key.file_id_) * 0xff51afd7ed558ccdULL;
+    h = (h ^ key.tile_idx_) * 0xc4ceb9fe1a85ec53ULL;
+    return static_cast<std::size_t>(h ^ (h >> 32));
+  }
+};
+
+/**
+ * Caches the bytes of tiles, keyed by `TileCacheKey`. The maximum capacity of
+ * the cache is defined as a total allocated byte size among all cached
+ * `FilteredBuffer` objects.
+ *
+ * The cache is split into a number of shards, each owning an equal part of
+ * the byte budget and protected by its own mutex, so that concurrent readers
+ * of different tiles rarely contend on the same lock.
+ *
+ * This class is thread-safe.
+ */
+class TileCache {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /**
+   * Constructor.
+   *
+   * @param parent_stats The parent stats to inherit from.
+   * @param max_size The maximum cache byte size.
+   * @param shard_num The number of shards. Each shard holds
+   *     `max_size / shard_num` bytes. If 0, it is derived from `max_size`
+   *     with `auto_shard_num`.
+   * @param policy The eviction policy.
+   */
+  TileCache(
+      stats::Stats* parent_stats,
+      uint64_t max_size,
+      uint64_t shard_num = 1,
+      TileCachePolicy policy = TileCachePolicy::LRU);
+
+  /** Destructor. */
+  ~TileCache();
+
+  DISABLE_COPY_AND_COPY_ASSIGN(TileCache);
+  DISABLE_MOVE_AND_MOVE_ASSIGN(TileCache);
+
+  /* ********************************* */
+  /*             CONSTANTS             */
+  /* ********************************* */
+
+  /** The minimum shard byte size when deriving the number of shards. */
+  static constexpr uint64_t min_auto_shard_size_ = 64 * 1024 * 1024;
+
+  /** The maximum number of shards when deriving the number of shards. */
+  static constexpr uint64_t max_auto_shard_num_ = 16;
+
+  /**
+   * Returns the number of shards of a cache of `max_size` bytes: one per
+   * `min_auto_shard_size_` bytes, at least 1 and at most
+   * `max_auto_shard_num_`, so that small caches keep a single shard and
+   * can hold any tile that fits in the cache.
+   */
+  static uint64_t auto_shard_num(uint64_t max_size);
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /**
+   * Inserts the tile with the input key into the cache. Note that the cache
+   * *owns* the buffer after insertion.
+   *
+   * @param key The key of the tile.
+   * @param buffer The buffer to store.
+   * @param overwrite If `true`, if the tile exists in the cache it will be
+   *     overwritten. Otherwise, the new buffer will be deleted.
+   * @return Status
+   */
+  Status insert(
+      const TileCacheKey& key, FilteredBuffer&& buffer, bool overwrite = true);
+
+  /**
+   * Reads the first `nbytes` of the tile with the input key.
+   *
+   * @param key The key of the tile.
+   * @param buffer The buffer that will store the data to be read.
+   * @param nbytes The number of bytes to be read.
+   * @param success `true` if the data were read from the cache and `false`
+   *     otherwise.
+   * @return Status.
+   */
+  Status read(
+      const TileCacheKey& key,
+      FilteredBuffer& buffer,
+      uint64_t nbytes,
+      bool* success);
+
+  /**
+   * Reads the first `nbytes` of the tile with the input key into a raw
+   * buffer.
+   *
+   * @param key The key of the tile.
+   * @param buffer The buffer that will store the data to be read. It must
+   *     hold at least `nbytes` bytes.
+   * @param nbytes The number of bytes to be read.
+   * @param success `true` if the data were read from the cache and `false`
+   *     otherwise.
+   * @return Status.
+   */
+  Status read(
+      const TileCacheKey& key,
+      void* buffer,
+      uint64_t nbytes,
+      bool* success);
+
+  /**
+   * Invalidates and evicts the tile with the input key.
+   *
+   * @param key The key of the tile.
+   * @param success Set to `true` if the tile was removed successfully; if
+   *    the tile did not exist in the cache, set to `false`.
+   * @return Status
+   */
+  Status invalidate(const TileCacheKey& key, bool* success);
+
+  /** Clears the cache, deleting all cached tiles. */
+  void clear();
+
+  /** Returns the number of shards. */
+  uint64_t shard_num() const;
+
+  /** Returns the total byte size of the cached tiles. */
+  uint64_t size() const;
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE DATATYPES         */
+  /* ********************************* */
+
+  /** A cached tile. */
+  struct CacheItem {
+    /** Constructor. */
+    CacheItem(const TileCacheKey& key, FilteredBuffer&& buffer)
+        : key_(key)
+        , buffer_(std::move(buffer))
+        , protected_(false) {
+    }
+
+    /** The key of the tile. */
+    TileCacheKey key_;
+
+    /** The tile bytes. */
+    FilteredBuffer buffer_;
+
+    /** Set when the item is in the protected segment (SLRU only). */
+    bool protected_;
+  };
+
+  /** A part of the cache with its own byte budget and lock. */
+  struct Shard {
+    /** Constructor. */
+    Shard(uint64_t max_size, TileCachePolicy policy);
+
+    /** Protects all shard state. */
+    std::mutex mtx_;
+
+    /** The eviction policy. */
+    const TileCachePolicy policy_;
+
+    /** The maximum shard byte size. */
+    const uint64_t max_size_;
+
+    /** The maximum byte size of the protected segment (SLRU only). */
+    const uint64_t max_protected_size_;
+
+    /** The current shard byte size. */
+    uint64_t size_;
+
+    /** The current byte size of the protected segment (SLRU only). */
+    uint64_t protected_size_;
+
+    /**
+     * Items in LRU order, the head being evicted first. With the SLRU policy
+     * this is the probationary segment.
+     */
+    std::list<CacheItem> probation_ll_;
+
+    /** The protected segment in LRU order (SLRU only). */
+    std::list<CacheItem> protected_ll_;
+
+    /** Maps a key to its node in `probation_ll_` or `protected_ll_`. */
+    std::unordered_map<
+        TileCacheKey,
+        std::list<CacheItem>::iterator,
+        TileCacheKeyHasher>
+        item_map_;
+
+    /** Evicts the next item. Must be called with `mtx_` held. */
+    void evict();
+
+    /** Removes the item at `it`. Must be called with `mtx_` held. */
+    void erase(std::list<CacheItem>::iterator it);
+
+    /** Marks the item at `it` as used. Must be called with `mtx_` held. */
+    void touch(std::list<CacheItem>::iterator it);
+
+    /** Removes all items. Must be called with `mtx_` held. */
+    void clear();
+  };
+
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** The class stats. */
+  stats::Stats* stats_;
+
+  /** The shards. */
+  std::vector<tdb_unique_ptr<Shard>> shards_;
+
+  /* ********************************* */
+  /*         PRIVATE METHODS           */
+  /* ********************************* */
+
+  /** Returns the shard that holds `key`. */
+  Shard& shard(const TileCacheKey& key);
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_TILE_CACHE_H
@@ -76,15 +76,26 @@ const std::string Config::SM_CHECK_COORD_OOB = "true";
 const std::string Config::SM_READ_RANGE_OOB = "warn";
 const std::string Config::SM_CHECK_GLOBAL_ORDER = "true";
 const std::string Config::SM_TILE_CACHE_SIZE = "10000000";
+const std::string Config::SM_TILE_CACHE_SHARD_NUM = "0";
+const std::string Config::SM_TILE_CACHE_POLICY = "lru";
+const std::string Config::SM_TILE_CACHE_UNFILTERED_SIZE = "0";
+const std::string Config::SM_TILE_CACHE_UNFILTERED_MIN_RATIO = "1.0";
+const std::string Config::SM_FRAGMENT_METADATA_CACHE_SIZE = "0";
 const std::string Config::SM_SKIP_EST_SIZE_PARTITIONING = "false";
 const std::string Config::SM_MEMORY_BUDGET = "5368709120";       // 5GB
 const std::string Config::SM_MEMORY_BUDGET_VAR = "10737418240";  // 10GB;
 const std::string Config::SM_QUERY_DENSE_READER = "refactored";
 const std::string Config::SM_QUERY_SPARSE_GLOBAL_ORDER_READER = "refactored";
+const std::string
+    Config::SM_QUERY_SPARSE_GLOBAL_ORDER_MERGE_PARTITION_MIN_CELLS = "65536";
 const std::string Config::SM_QUERY_SPARSE_UNORDERED_WITH_DUPS_READER =
     "refactored";
+const std::string Config::SM_QUERY_TRACE_MAX_SPAN_NUM = "0";
 const std::string Config::SM_MEM_MALLOC_TRIM = "true";
 const std::string Config::SM_MEM_TOTAL_BUDGET = "10737418240";  // 10GB;
+const std::string Config::SM_MEM_CONTEXT_BUDGET = "0";
+const std::string Config::SM_MEM_ADMISSION_TIMEOUT_MS = "1000";
+const std::string Config::SM_MEM_TILE_BUFFER_POOL_SIZE = "0";
 const std::string Config::SM_MEM_SPARSE_GLOBAL_ORDER_RATIO_COORDS = "0.5";
 const std::string Config::SM_MEM_SPARSE_GLOBAL_ORDER_RATIO_QUERY_CONDITION =
     "0.25";
@@ -103,9 +114,14 @@ const std::string Config::SM_COMPUTE_CONCURRENCY_LEVEL =
     utils::parse::to_str(std::thread::hardware_concurrency());
 const std::string Config::SM_IO_CONCURRENCY_LEVEL =
     utils::parse::to_str(std::thread::hardware_concurrency());
+const std::string Config::SM_COMPUTE_CPU_SET = "";
+const std::string Config::SM_IO_CPU_SET = "";
+const std::string Config::SM_NUMA_AWARE = "false";
 const std::string Config::SM_SKIP_CHECKSUM_VALIDATION = "false";
 const std::string Config::SM_CONSOLIDATION_AMPLIFICATION = "1.0";
 const std::string Config::SM_CONSOLIDATION_BUFFER_SIZE = "50000000";
+const std::string Config::SM_CONSOLIDATION_PIPELINE_DEPTH = "1";
+const std::string Config::SM_CONSOLIDATION_PARALLEL_GROUPS = "1";
 const std::string Config::SM_CONSOLIDATION_PURGE_DELETED_CELLS = "false";
 const std::string Config::SM_CONSOLIDATION_STEPS = "4294967295";
 const std::string Config::SM_CONSOLIDATION_STEP_MIN_FRAGS = "4294967295";
@@ -132,8 +148,13 @@ const std::string Config::VFS_FILE_POSIX_FILE_PERMISSIONS = "644";
 const std::string Config::VFS_FILE_POSIX_DIRECTORY_PERMISSIONS = "755";
 const std::string Config::VFS_FILE_MAX_PARALLEL_OPS =
     Config::SM_IO_CONCURRENCY_LEVEL;
+const std::string Config::VFS_FILE_IO_URING = "false";
+const std::string Config::VFS_FILE_IO_URING_QUEUE_DEPTH = "256";
+const std::string Config::VFS_FILE_MMAP = "false";
 const std::string Config::VFS_READ_AHEAD_SIZE = "102400";          // 100KiB
 const std::string Config::VFS_READ_AHEAD_CACHE_SIZE = "10485760";  // 10MiB;
+const std::string Config::VFS_READ_AHEAD_MAX_SIZE = "1048576";     // 1MiB
+const std::string Config::VFS_READ_AHEAD_LOCAL = "false";
 const std::string Config::VFS_AZURE_STORAGE_ACCOUNT_NAME = "";
 const std::string Config::VFS_AZURE_STORAGE_ACCOUNT_KEY = "";
 const std::string Config::VFS_AZURE_STORAGE_SAS_TOKEN = "";
@@ -243,6 +264,14 @@ Config::Config() {
   param_values_["sm.read_range_oob"] = SM_READ_RANGE_OOB;
   param_values_["sm.check_global_order"] = SM_CHECK_GLOBAL_ORDER;
   param_values_["sm.tile_cache_size"] = SM_TILE_CACHE_SIZE;
+  param_values_["sm.tile_cache_shard_num"] = SM_TILE_CACHE_SHARD_NUM;
+  param_values_["sm.tile_cache_policy"] = SM_TILE_CACHE_POLICY;
+  param_values_["sm.tile_cache_unfiltered_size"] =
+      SM_TILE_CACHE_UNFILTERED_SIZE;
+  param_values_["sm.tile_cache_unfiltered_min_ratio"] =
+      SM_TILE_CACHE_UNFILTERED_MIN_RATIO;
+  param_values_["sm.fragment_metadata_cache_size"] =
+      SM_FRAGMENT_METADATA_CACHE_SIZE;
   param_values_["sm.skip_est_size_partitioning"] =
       SM_SKIP_EST_SIZE_PARTITIONING;
   param_values_["sm.memory_budget"] = SM_MEMORY_BUDGET;
@@ -250,10 +279,16 @@ Config::Config() {
   param_values_["sm.query.dense.reader"] = SM_QUERY_DENSE_READER;
   param_values_["sm.query.sparse_global_order.reader"] =
       SM_QUERY_SPARSE_GLOBAL_ORDER_READER;
+  param_values_["sm.query.sparse_global_order.merge_partition_min_cells"] =
+      SM_QUERY_SPARSE_GLOBAL_ORDER_MERGE_PARTITION_MIN_CELLS;
   param_values_["sm.query.sparse_unordered_with_dups.reader"] =
       SM_QUERY_SPARSE_UNORDERED_WITH_DUPS_READER;
+  param_values_["sm.query.trace_max_span_num"] = SM_QUERY_TRACE_MAX_SPAN_NUM;
   param_values_["sm.mem.malloc_trim"] = SM_MEM_MALLOC_TRIM;
   param_values_["sm.mem.total_budget"] = SM_MEM_TOTAL_BUDGET;
+  param_values_["sm.mem.context_budget"] = SM_MEM_CONTEXT_BUDGET;
+  param_values_["sm.mem.admission_timeout_ms"] = SM_MEM_ADMISSION_TIMEOUT_MS;
+  param_values_["sm.mem.tile_buffer_pool_size"] = SM_MEM_TILE_BUFFER_POOL_SIZE;
   param_values_["sm.mem.reader.sparse_global_order.ratio_coords"] =
       SM_MEM_SPARSE_GLOBAL_ORDER_RATIO_COORDS;
   param_values_["sm.mem.reader.sparse_global_order.ratio_query_condition"] =
@@ -274,10 +309,17 @@ Config::Config() {
   param_values_["sm.enable_signal_handlers"] = SM_ENABLE_SIGNAL_HANDLERS;
   param_values_["sm.compute_concurrency_level"] = SM_COMPUTE_CONCURRENCY_LEVEL;
   param_values_["sm.io_concurrency_level"] = SM_IO_CONCURRENCY_LEVEL;
+  param_values_["sm.compute_cpu_set"] = SM_COMPUTE_CPU_SET;
+  param_values_["sm.io_cpu_set"] = SM_IO_CPU_SET;
+  param_values_["sm.numa_aware"] = SM_NUMA_AWARE;
   param_values_["sm.skip_checksum_validation"] = SM_SKIP_CHECKSUM_VALIDATION;
   param_values_["sm.consolidation.amplification"] =
       SM_CONSOLIDATION_AMPLIFICATION;
   param_values_["sm.consolidation.buffer_size"] = SM_CONSOLIDATION_BUFFER_SIZE;
+  param_values_["sm.consolidation.pipeline_depth"] =
+      SM_CONSOLIDATION_PIPELINE_DEPTH;
+  param_values_["sm.consolidation.parallel_groups"] =
+      SM_CONSOLIDATION_PARALLEL_GROUPS;
   param_values_["sm.consolidation.purge_deleted_cells"] =
       SM_CONSOLIDATION_PURGE_DELETED_CELLS;
   param_values_["sm.consolidation.step_min_frags"] =
@@ -305,11 +347,17 @@ Config::Config() {
   param_values_["vfs.min_batch_size"] = VFS_MIN_BATCH_SIZE;
   param_values_["vfs.read_ahead_size"] = VFS_READ_AHEAD_SIZE;
   param_values_["vfs.read_ahead_cache_size"] = VFS_READ_AHEAD_CACHE_SIZE;
+  param_values_["vfs.read_ahead_max_size"] = VFS_READ_AHEAD_MAX_SIZE;
+  param_values_["vfs.read_ahead_local"] = VFS_READ_AHEAD_LOCAL;
   param_values_["vfs.file.posix_file_permissions"] =
       VFS_FILE_POSIX_FILE_PERMISSIONS;
   param_values_["vfs.file.posix_directory_permissions"] =
       VFS_FILE_POSIX_DIRECTORY_PERMISSIONS;
   param_values_["vfs.file.max_parallel_ops"] = VFS_FILE_MAX_PARALLEL_OPS;
+  param_values_["vfs.file.io_uring"] = VFS_FILE_IO_URING;
+  param_values_["vfs.file.io_uring_queue_depth"] =
+      VFS_FILE_IO_URING_QUEUE_DEPTH;
+  param_values_["vfs.file.mmap"] = VFS_FILE_MMAP;
   param_values_["vfs.azure.storage_account_name"] =
       VFS_AZURE_STORAGE_ACCOUNT_NAME;
   param_values_["vfs.azure.storage_account_key"] =
@@ -559,6 +607,19 @@ Status Config::unset(const std::string& param) {
     param_values_["sm.check_global_order"] = SM_CHECK_GLOBAL_ORDER;
   } else if (param == "sm.tile_cache_size") {
     param_values_["sm.tile_cache_size"] = SM_TILE_CACHE_SIZE;
+  } else if (param == "sm.tile_cache_shard_num") {
+    param_values_["sm.tile_cache_shard_num"] = SM_TILE_CACHE_SHARD_NUM;
+  } else if (param == "sm.tile_cache_policy") {
+    param_values_["sm.tile_cache_policy"] = SM_TILE_CACHE_POLICY;
+  } else if (param == "sm.tile_cache_unfiltered_size") {
+    param_values_["sm.tile_cache_unfiltered_size"] =
+        SM_TILE_CACHE_UNFILTERED_SIZE;
+  } else if (param == "sm.tile_cache_unfiltered_min_ratio") {
+    param_values_["sm.tile_cache_unfiltered_min_ratio"] =
+        SM_TILE_CACHE_UNFILTERED_MIN_RATIO;
+  } else if (param == "sm.fragment_metadata_cache_size") {
+    param_values_["sm.fragment_metadata_cache_size"] =
+        SM_FRAGMENT_METADATA_CACHE_SIZE;
   } else if (param == "sm.memory_budget") {
     param_values_["sm.memory_budget"] = SM_MEMORY_BUDGET;
   } else if (param == "sm.memory_budget_var") {
@@ -568,13 +629,26 @@ Status Config::unset(const std::string& param) {
   } else if (param == "sm.query.sparse_global_order.reader") {
     param_values_["sm.query.sparse_global_order.reader"] =
         SM_QUERY_SPARSE_GLOBAL_ORDER_READER;
+  } else if (
+      param == "sm.query.sparse_global_order.merge_partition_min_cells") {
+    param_values_["sm.query.sparse_global_order.merge_partition_min_cells"] =
+        SM_QUERY_SPARSE_GLOBAL_ORDER_MERGE_PARTITION_MIN_CELLS;
   } else if (param == "sm.query.sparse_unordered_with_dups.reader") {
     param_values_["sm.query.sparse_unordered_with_dups.reader"] =
         SM_QUERY_SPARSE_UNORDERED_WITH_DUPS_READER;
+  } else if (param == "sm.query.trace_max_span_num") {
+    param_values_["sm.query.trace_max_span_num"] = SM_QUERY_TRACE_MAX_SPAN_NUM;
   } else if (param == "sm.mem.malloc_trim") {
     param_values_["sm.mem.malloc_trim"] = SM_MEM_MALLOC_TRIM;
   } else if (param == "sm.mem.total_budget") {
     param_values_["sm.mem.total_budget"] = SM_MEM_TOTAL_BUDGET;
+  } else if (param == "sm.mem.context_budget") {
+    param_values_["sm.mem.context_budget"] = SM_MEM_CONTEXT_BUDGET;
+  } else if (param == "sm.mem.admission_timeout_ms") {
+    param_values_["sm.mem.admission_timeout_ms"] = SM_MEM_ADMISSION_TIMEOUT_MS;
+  } else if (param == "sm.mem.tile_buffer_pool_size") {
+    param_values_["sm.mem.tile_buffer_pool_size"] =
+        SM_MEM_TILE_BUFFER_POOL_SIZE;
   } else if (param == "sm.mem.reader.sparse_global_order.ratio_coords") {
     param_values_["sm.mem.reader.sparse_global_order.ratio_coords"] =
         SM_MEM_SPARSE_GLOBAL_ORDER_RATIO_COORDS;
@@ -613,12 +687,24 @@ Status Config::unset(const std::string& param) {
         SM_COMPUTE_CONCURRENCY_LEVEL;
   } else if (param == "sm.io_concurrency_level") {
     param_values_["sm.io_concurrency_level"] = SM_IO_CONCURRENCY_LEVEL;
+  } else if (param == "sm.compute_cpu_set") {
+    param_values_["sm.compute_cpu_set"] = SM_COMPUTE_CPU_SET;
+  } else if (param == "sm.io_cpu_set") {
+    param_values_["sm.io_cpu_set"] = SM_IO_CPU_SET;
+  } else if (param == "sm.numa_aware") {
+    param_values_["sm.numa_aware"] = SM_NUMA_AWARE;
   } else if (param == "sm.consolidation.amplification") {
     param_values_["sm.consolidation.amplification"] =
         SM_CONSOLIDATION_AMPLIFICATION;
   } else if (param == "sm.consolidation.buffer_size") {
     param_values_["sm.consolidation.buffer_size"] =
         SM_CONSOLIDATION_BUFFER_SIZE;
+  } else if (param == "sm.consolidation.pipeline_depth") {
+    param_values_["sm.consolidation.pipeline_depth"] =
+        SM_CONSOLIDATION_PIPELINE_DEPTH;
+  } else if (param == "sm.consolidation.parallel_groups") {
+    param_values_["sm.consolidation.parallel_groups"] =
+        SM_CONSOLIDATION_PARALLEL_GROUPS;
   } else if (param == "sm.consolidation.purge_deleted_cells") {
     param_values_["sm.consolidation.steps"] =
         SM_CONSOLIDATION_PURGE_DELETED_CELLS;
@@ -667,6 +753,10 @@ Status Config::unset(const std::string& param) {
     param_values_["vfs.read_ahead_size"] = VFS_READ_AHEAD_SIZE;
   } else if (param == "vfs.read_ahead_cache_size") {
     param_values_["vfs.read_ahead_cache_size"] = VFS_READ_AHEAD_CACHE_SIZE;
+  } else if (param == "vfs.read_ahead_max_size") {
+    param_values_["vfs.read_ahead_max_size"] = VFS_READ_AHEAD_MAX_SIZE;
+  } else if (param == "vfs.read_ahead_local") {
+    param_values_["vfs.read_ahead_local"] = VFS_READ_AHEAD_LOCAL;
   } else if (param == "vfs.file.posix_file_permissions") {
     param_values_["vfs.file.posix_file_permissions"] =
         VFS_FILE_POSIX_FILE_PERMISSIONS;
@@ -675,6 +765,13 @@ Status Config::unset(const std::string& param) {
         VFS_FILE_POSIX_DIRECTORY_PERMISSIONS;
   } else if (param == "vfs.file.max_parallel_ops") {
     param_values_["vfs.file.max_parallel_ops"] = VFS_FILE_MAX_PARALLEL_OPS;
+  } else if (param == "vfs.file.io_uring") {
+    param_values_["vfs.file.io_uring"] = VFS_FILE_IO_URING;
+  } else if (param == "vfs.file.io_uring_queue_depth") {
+    param_values_["vfs.file.io_uring_queue_depth"] =
+        VFS_FILE_IO_URING_QUEUE_DEPTH;
+  } else if (param == "vfs.file.mmap") {
+    param_values_["vfs.file.mmap"] = VFS_FILE_MMAP;
   } else if (param == "vfs.azure.storage_account_name") {
     param_values_["vfs.azure.storage_account_name"] =
         VFS_AZURE_STORAGE_ACCOUNT_NAME;
@@ -846,6 +943,29 @@ Status Config::sanity_check(
     RETURN_NOT_OK(utils::parse::convert(value, &v));
   } else if (param == "sm.tile_cache_size") {
     RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
+  } else if (
+      param == "sm.query.sparse_global_order.merge_partition_min_cells") {
+    RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
+  } else if (param == "sm.query.trace_max_span_num") {
+    RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
+  } else if (param == "sm.mem.context_budget") {
+    RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
+  } else if (param == "sm.mem.admission_timeout_ms") {
+    RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
+  } else if (param == "sm.mem.tile_buffer_pool_size") {
+    RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
+  } else if (param == "sm.tile_cache_shard_num") {
+    RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
+  } else if (param == "sm.tile_cache_policy") {
+    if (value != "lru" && value != "slru")
+      return LOG_STATUS(
+          Status_ConfigError("Invalid tile cache policy parameter value"));
+  } else if (param == "sm.tile_cache_unfiltered_size") {
+    RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
+  } else if (param == "sm.tile_cache_unfiltered_min_ratio") {
+    RETURN_NOT_OK(utils::parse::convert(value, &vf));
+  } else if (param == "sm.fragment_metadata_cache_size") {
+    RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
   } else if (param == "sm.memory_budget") {
     RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
   } else if (param == "sm.memory_budget_var") {
@@ -856,10 +976,22 @@ Status Config::sanity_check(
     RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
   } else if (param == "sm.io_concurrency_level") {
     RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
+  } else if (param == "sm.compute_cpu_set" || param == "sm.io_cpu_set") {
+    // The list is parsed when the thread pools are created; only its
+    // characters are checked here.
+    if (value.find_first_not_of("0123456789,-") != std::string::npos)
+      return LOG_STATUS(Status_ConfigError(
+          "Invalid CPU set parameter value '" + value + "'"));
+  } else if (param == "sm.numa_aware") {
+    RETURN_NOT_OK(utils::parse::convert(value, &v));
   } else if (param == "sm.consolidation.amplification") {
     RETURN_NOT_OK(utils::parse::convert(value, &vf));
   } else if (param == "sm.consolidation.buffer_size") {
     RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
+  } else if (param == "sm.consolidation.pipeline_depth") {
+    RETURN_NOT_OK(utils::parse::convert(value, &v32));
+  } else if (param == "sm.consolidation.parallel_groups") {
+    RETURN_NOT_OK(utils::parse::convert(value, &v32));
   } else if (param == "sm.consolidation.purge_deleted_cells") {
     RETURN_NOT_OK(utils::parse::convert(value, &v));
   } else if (param == "sm.consolidation.steps") {
@@ -890,12 +1022,22 @@ Status Config::sanity_check(
     RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
   } else if (param == "vfs.read_ahead_cache_size") {
     RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
+  } else if (param == "vfs.read_ahead_max_size") {
+    RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
+  } else if (param == "vfs.read_ahead_local") {
+    RETURN_NOT_OK(utils::parse::convert(value, &v));
   } else if (param == "vfs.file.posix_file_permissions") {
     RETURN_NOT_OK(utils::parse::convert(value, &v32));
   } else if (param == "vfs.file.posix_directory_permissions") {
     RETURN_NOT_OK(utils::parse::convert(value, &v32));
   } else if (param == "vfs.file.max_parallel_ops") {
     RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
+  } else if (param == "vfs.file.io_uring") {
+    RETURN_NOT_OK(utils::parse::convert(value, &v));
+  } else if (param == "vfs.file.io_uring_queue_depth") {
+    RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
+  } else if (param == "vfs.file.mmap") {
+    RETURN_NOT_OK(utils::parse::convert(value, &v));
   } else if (param == "vfs.s3.scheme") {
     if (value != "http" && value != "https")
       return LOG_STATUS(
@@ -143,6 +143,24 @@ class Config {
   /** The tile cache size. */
   static const std::string SM_TILE_CACHE_SIZE;
 
+  /** The number of independently locked shards of the tile cache. */
+  static const std::string SM_TILE_CACHE_SHARD_NUM;
+
+  /** The tile cache eviction policy, `lru` or `slru`. */
+  static const std::string SM_TILE_CACHE_POLICY;
+
+  /** The size of the cache of unfiltered tiles. */
+  static const std::string SM_TILE_CACHE_UNFILTERED_SIZE;
+
+  /**
+   * The minimum ratio of unfiltered to persisted size of a tile admitted in
+   * the unfiltered tile cache.
+   */
+  static const std::string SM_TILE_CACHE_UNFILTERED_MIN_RATIO;
+
+  /** The size of the cache of fragment metadata shared across arrays. */
+  static const std::string SM_FRAGMENT_METADATA_CACHE_SIZE;
+
   /** If `true`, bypass partitioning on estimated result sizes. */
   static const std::string SM_SKIP_EST_SIZE_PARTITIONING;
 
@@ -164,15 +182,44 @@ class Config {
   /** Which reader to use for sparse global order queries. */
   static const std::string SM_QUERY_SPARSE_GLOBAL_ORDER_READER;
 
+  /**
+   * Minimum number of cells to merge per thread for the sparse global order
+   * reader to merge in parallel.
+   */
+  static const std::string
+      SM_QUERY_SPARSE_GLOBAL_ORDER_MERGE_PARTITION_MIN_CELLS;
+
   /** Which reader to use for sparse unordered with dups queries. */
   static const std::string SM_QUERY_SPARSE_UNORDERED_WITH_DUPS_READER;
 
+  /** The maximum number of timer spans recorded in the trace of a query. */
+  static const std::string SM_QUERY_TRACE_MAX_SPAN_NUM;
+
   /** Should malloc_trim be called on query/ctx destructors. */
   static const std::string SM_MEM_MALLOC_TRIM;
 
   /** Maximum memory budget for readers and writers. */
   static const std::string SM_MEM_TOTAL_BUDGET;
 
+  /**
+   * Memory budget shared by the sparse readers and open arrays of a context.
+   * Dense readers and writers are not admitted against it. `0` means no
+   * limit.
+   */
+  static const std::string SM_MEM_CONTEXT_BUDGET;
+
+  /**
+   * How long a sparse reader waits for its budget to be admitted against the
+   * context budget before it runs with a smaller budget, in milliseconds.
+   */
+  static const std::string SM_MEM_ADMISSION_TIMEOUT_MS;
+
+  /**
+   * Maximum byte size of the released tile buffers kept by the context for
+   * reuse by later reads. `0` disables the pool.
+   */
+  static const std::string SM_MEM_TILE_BUFFER_POOL_SIZE;
+
   /** Ratio of the sparse global order reader budget used for coords. */
   static const std::string SM_MEM_SPARSE_GLOBAL_ORDER_RATIO_COORDS;
 
@@ -218,6 +265,15 @@ class Config {
   /** The maximum concurrency level for io-bound operations. */
   static const std::string SM_IO_CONCURRENCY_LEVEL;
 
+  /** The CPUs to pin the compute thread pool workers to. */
+  static const std::string SM_COMPUTE_CPU_SET;
+
+  /** The CPUs to pin the io thread pool workers to. */
+  static const std::string SM_IO_CPU_SET;
+
+  /** If `true`, each thread pool worker is pinned to a single NUMA node. */
+  static const std::string SM_NUMA_AWARE;
+
   /** If `true`, checksum validation will be skipped on reads. */
   static const std::string SM_SKIP_CHECKSUM_VALIDATION;
 
@@ -235,6 +291,12 @@ class Config {
   /** The buffer size for each attribute used in consolidation. */
   static const std::string SM_CONSOLIDATION_BUFFER_SIZE;
 
+  /** The number of buffer sets pipelining consolidation reads and writes. */
+  static const std::string SM_CONSOLIDATION_PIPELINE_DEPTH;
+
+  /** The maximum number of fragment groups consolidated in parallel. */
+  static const std::string SM_CONSOLIDATION_PARALLEL_GROUPS;
+
   /** Purge deleted cells or not. */
   static const std::string SM_CONSOLIDATION_PURGE_DELETED_CELLS;
 
@@ -350,12 +412,27 @@ class Config {
   /** The default maximum number of parallel file:/// operations. */
   static const std::string VFS_FILE_MAX_PARALLEL_OPS;
 
+  /** If `true`, batches of file:/// reads are submitted with io_uring. */
+  static const std::string VFS_FILE_IO_URING;
+
+  /** The maximum number of io_uring reads in flight. */
+  static const std::string VFS_FILE_IO_URING_QUEUE_DEPTH;
+
+  /** If `true`, the tiles of file:/// fragments are read from memory maps. */
+  static const std::string VFS_FILE_MMAP;
+
   /** The maximum size (in bytes) to read-ahead in the VFS. */
   static const std::string VFS_READ_AHEAD_SIZE;
 
   /** The maximum size (in bytes) of the VFS read-ahead cache . */
   static const std::string VFS_READ_AHEAD_CACHE_SIZE;
 
+  /** The maximum size (in bytes) to read-ahead for sequential reads. */
+  static const std::string VFS_READ_AHEAD_MAX_SIZE;
+
+  /** Whether to read-ahead the reads of local and in-memory files. */
+  static const std::string VFS_READ_AHEAD_LOCAL;
+
   /** Azure storage account name. */
   static const std::string VFS_AZURE_STORAGE_ACCOUNT_NAME;
 
@@ -33,15 +33,20 @@
 #include "tiledb/sm/consolidator/fragment_consolidator.h"
 #include "tiledb/common/logger.h"
 #include "tiledb/sm/array_schema/array_schema.h"
+#include "tiledb/sm/cache/fragment_metadata_cache.h"
 #include "tiledb/sm/enums/datatype.h"
 #include "tiledb/sm/enums/query_status.h"
 #include "tiledb/sm/enums/query_type.h"
+#include "tiledb/sm/misc/parallel_functions.h"
 #include "tiledb/sm/misc/tdb_time.h"
 #include "tiledb/sm/query/query.h"
 #include "tiledb/sm/stats/global_stats.h"
 #include "tiledb/sm/storage_manager/storage_manager.h"
 
+#include <deque>
+#include <future>
 #include <iostream>
+#include <mutex>
 #include <sstream>
 
 using namespace tiledb::common;
@@ -111,52 +116,113 @@ Status FragmentConsolidator::consolidate(
     return st;
   }
 
+  // Groups of sparse fragments with non-overlapping non-empty domains are
+  // independent, and are consolidated in parallel.
+  const auto& array_schema = array_for_reads->array_schema_latest();
+  const uint32_t max_groups =
+      array_schema.dense() ? 1 : std::max(config_.parallel_groups_, 1u);
+
   uint32_t step = 0;
-  std::vector<TimestampedURI> to_consolidate;
   do {
     // No need to consolidate if no more than 1 fragment exist
     if (fragment_info.fragment_num() <= 1)
       break;
 
-    // Find the next fragments to be consolidated
-    NDRange union_non_empty_domains;
-    st = compute_next_to_consolidate(
-        array_for_reads->array_schema_latest(),
-        fragment_info,
-        &to_consolidate,
-        &union_non_empty_domains);
-    if (!st.ok()) {
-      array_for_reads->close();
-      array_for_writes->close();
-      return st;
+    // Find the next fragment groups to be consolidated
+    std::vector<std::vector<TimestampedURI>> groups;
+    std::vector<NDRange> group_domains;
+    std::vector<bool> excluded;
+    while (groups.size() < max_groups) {
+      std::vector<TimestampedURI> to_consolidate;
+      NDRange union_non_empty_domains;
+      st = compute_next_to_consolidate(
+          array_schema,
+          fragment_info,
+          excluded,
+          group_domains,
+          &to_consolidate,
+          &union_non_empty_domains);
+      if (!st.ok()) {
+        array_for_reads->close();
+        array_for_writes->close();
+        return st;
+      }
+
+      // Check if there is anything to consolidate
+      if (to_consolidate.size() <= 1)
+        break;
+
+      // Exclude the selected fragments from the next groups
+      const auto& fragments = fragment_info.single_fragment_info_vec();
+      excluded.resize(fragments.size(), false);
+      for (size_t f = 0; f < fragments.size(); ++f) {
+        for (const auto& t : to_consolidate) {
+          if (fragments[f].uri() == t.uri_)
+            excluded[f] = true;
+        }
+      }
+      groups.emplace_back(std::move(to_consolidate));
+      group_domains.emplace_back(std::move(union_non_empty_domains));
     }
 
-    // Check if there is anything to consolidate
-    if (to_consolidate.size() <= 1)
+    if (groups.empty())
       break;
 
-    // Consolidate the selected fragments
-    URI new_fragment_uri;
-    st = consolidate_internal(
-        array_for_reads,
-        array_for_writes,
-        to_consolidate,
-        union_non_empty_domains,
-        &new_fragment_uri);
+    // Consolidate the selected fragments. Parallel groups read and write
+    // through arrays of their own, as reads load the group fragments.
+    std::vector<URI> new_fragment_uris(groups.size());
+    if (groups.size() == 1) {
+      st = consolidate_internal(
+          array_for_reads,
+          array_for_writes,
+          groups[0],
+          group_domains[0],
+          &new_fragment_uris[0]);
+    } else {
+      stats_->add_counter("consolidate_parallel_group_num", groups.size());
+      st = parallel_for(
+          storage_manager_->compute_tp(), 0, groups.size(), [&](uint64_t g) {
+            auto group_reads{make_shared<Array>(
+                HERE(), array_for_reads->array_uri(), storage_manager_)};
+            RETURN_NOT_OK(group_reads->open_without_fragments(
+                encryption_type, encryption_key, key_length));
+            auto group_writes{make_shared<Array>(
+                HERE(), array_for_reads->array_uri(), storage_manager_)};
+            RETURN_NOT_OK_ELSE(
+                group_writes->open(
+                    QueryType::WRITE,
+                    encryption_type,
+                    encryption_key,
+                    key_length),
+                group_reads->close());
+
+            auto st = consolidate_internal(
+                group_reads,
+                group_writes,
+                groups[g],
+                group_domains[g],
+                &new_fragment_uris[g]);
+            group_reads->close();
+            group_writes->close();
+            return st;
+          });
+    }
     if (!st.ok()) {
       array_for_reads->close();
       array_for_writes->close();
       return st;
     }
 
-    // Load info of the consolidated fragment and add it
-    // to the fragment info, replacing the fragments that it
+    // Load info of the consolidated fragments and add them
+    // to the fragment info, replacing the fragments that they
     // consolidated.
-    st = fragment_info.load_and_replace(new_fragment_uri, to_consolidate);
-    if (!st.ok()) {
-      array_for_reads->close();
-      array_for_writes->close();
-      return st;
+    for (size_t g = 0; g < groups.size(); ++g) {
+      st = fragment_info.load_and_replace(new_fragment_uris[g], groups[g]);
+      if (!st.ok()) {
+        array_for_reads->close();
+        array_for_writes->close();
+        return st;
+      }
     }
 
     // Advance number of steps
@@ -340,10 +406,13 @@ Status FragmentConsolidator::vacuum(const char* array_name) {
       });
   RETURN_NOT_OK(status);
 
-  // Delete fragment directories
+  // Delete fragment directories, dropping their cached metadata
+  auto fragment_metadata_cache = storage_manager_->fragment_metadata_cache();
   status = parallel_for(
       compute_tp, 0, fragment_uris_to_vacuum.size(), [&](size_t i) {
         RETURN_NOT_OK(vfs->remove_dir(fragment_uris_to_vacuum[i]));
+        if (fragment_metadata_cache != nullptr)
+          fragment_metadata_cache->invalidate(fragment_uris_to_vacuum[i]);
 
         return Status::Ok();
       });
@@ -410,10 +479,14 @@ Status FragmentConsolidator::consolidate_internal(
   // Get schema
   const auto& array_schema = array_for_reads->array_schema_latest();
 
-  // Prepare buffers
-  std::vector<ByteVec> buffers;
-  std::vector<uint64_t> buffer_sizes;
-  RETURN_NOT_OK(create_buffers(array_schema, &buffers, &buffer_sizes));
+  // Prepare buffers, one set per pipeline stage
+  const uint32_t depth = std::max(config_.pipeline_depth_, 1u);
+  std::vector<std::vector<ByteVec>> buffers(depth);
+  std::vector<std::vector<uint64_t>> buffer_sizes(depth);
+  for (uint32_t i = 0; i < depth; ++i) {
+    RETURN_NOT_OK(
+        create_buffers(array_schema, &buffers[i], &buffer_sizes[i]));
+  }
 
   // Create queries
   auto query_r = (Query*)nullptr;
@@ -483,31 +556,166 @@ Status FragmentConsolidator::consolidate_internal(
 Status FragmentConsolidator::copy_array(
     Query* query_r,
     Query* query_w,
-    std::vector<ByteVec>* buffers,
-    std::vector<uint64_t>* buffer_sizes) {
+    std::vector<std::vector<ByteVec>>* buffers,
+    std::vector<std::vector<uint64_t>>* buffer_sizes) {
   auto timer_se = stats_->start_timer("consolidate_copy_array");
 
-  // Set the read query buffers outside the repeated submissions.
-  // The Reader will reset the query buffer sizes to the original
-  // sizes, not the potentially smaller sizes of the results after
-  // the query submission.
-  RETURN_NOT_OK(set_query_buffers(query_r, buffers, buffer_sizes));
+  // With a single buffer set, read and write each batch in turn.
+  const size_t depth = buffers->size();
+  if (depth == 1) {
+    do {
+      // READ
+      RETURN_NOT_OK(read_batch(query_r, &(*buffers)[0], &(*buffer_sizes)[0]));
+
+      // WRITE
+      RETURN_NOT_OK(
+          write_batch(query_w, &(*buffers)[0], &(*buffer_sizes)[0]));
+    } while (query_r->status() == QueryStatus::INCOMPLETE);
+
+    return Status::Ok();
+  }
+
+  // Otherwise, the batches are queued to be written in order, while the next
+  // ones are read into the free buffer sets. A single task at a time drains
+  // the queue on the compute thread pool, and fulfills the promise of each
+  // batch once it is written, releasing its buffer set.
+  auto compute_tp = storage_manager_->compute_tp();
+  std::mutex queue_mtx;
+  std::deque<std::pair<size_t, std::promise<Status>>> queue;
+  bool draining = false;
+  Status write_st = Status::Ok();
+  auto drain = [&]() {
+    while (true) {
+      std::pair<size_t, std::promise<Status>> batch;
+      Status st;
+      {
+        std::lock_guard<std::mutex> lock(queue_mtx);
+        if (queue.empty()) {
+          draining = false;
+          return Status::Ok();
+        }
+        batch = std::move(queue.front());
+        queue.pop_front();
+        st = write_st;
+      }
 
+      // Skip the batches queued after a failed write.
+      if (st.ok()) {
+        try {
+          st = write_batch(
+              query_w,
+              &(*buffers)[batch.first],
+              &(*buffer_sizes)[batch.first]);
+        } catch (const std::exception& e) {
+          st = Status_ConsolidatorError(e.what());
+        }
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(queue_mtx);
+        if (!st.ok() && write_st.ok())
+          write_st = st;
+      }
+      batch.second.set_value(st);
+    }
+  };
+
+  // The futures of the batches written from each buffer set, and of the
+  // drain tasks.
+  std::vector<ThreadPool::Task> written(depth);
+  std::vector<ThreadPool::Task> drain_tasks;
+
+  size_t batch_num = 0;
+  Status st = Status::Ok();
   do {
-    // READ
-    RETURN_NOT_OK(query_r->submit());
+    // Wait for the previous batch in the buffer set to be written
+    const size_t set = batch_num++ % depth;
+    if (written[set].valid()) {
+      auto timer_wait = stats_->start_timer("consolidate_read_wait");
+      std::vector<ThreadPool::Task> tasks;
+      tasks.emplace_back(std::move(written[set]));
+      st = compute_tp->wait_all(tasks);
+      if (!st.ok())
+        break;
+    }
 
-    // Set explicitly the write query buffers, as the sizes may have
-    // been altered by the read query.
-    RETURN_NOT_OK(set_query_buffers(query_w, buffers, buffer_sizes));
+    // READ
+    st = read_batch(query_r, &(*buffers)[set], &(*buffer_sizes)[set]);
+    if (!st.ok())
+      break;
 
-    // WRITE
-    RETURN_NOT_OK(query_w->submit());
+    // Queue the batch for writing
+    std::promise<Status> promise;
+    written[set] = promise.get_future();
+    bool launch = false;
+    {
+      std::lock_guard<std::mutex> lock(queue_mtx);
+      queue.emplace_back(set, std::move(promise));
+      launch = !draining;
+      draining = true;
+    }
+    if (launch) {
+      auto task = compute_tp->execute(drain);
+      if (task.valid()) {
+        drain_tasks.emplace_back(std::move(task));
+      } else {
+        st = drain();
+        if (!st.ok())
+          break;
+      }
+    }
   } while (query_r->status() == QueryStatus::INCOMPLETE);
 
+  // Wait for the queued batches to be written, also on errors, as the
+  // writes use the buffers.
+  std::vector<ThreadPool::Task> tasks;
+  for (auto& task : written) {
+    if (task.valid())
+      tasks.emplace_back(std::move(task));
+  }
+  auto st_written = compute_tp->wait_all(tasks);
+  auto st_drain = compute_tp->wait_all(drain_tasks);
+  RETURN_NOT_OK(st);
+  RETURN_NOT_OK(st_written);
+  return st_drain;
+}
+
+Status FragmentConsolidator::read_batch(
+    Query* query_r,
+    std::vector<ByteVec>* buffers,
+    std::vector<uint64_t>* buffer_sizes) {
+  auto timer_se = stats_->start_timer("consolidate_read");
+
+  // Set the read query buffers to their full sizes, as the buffer set
+  // may have been used by a previous batch.
+  for (size_t i = 0; i < buffers->size(); ++i) {
+    (*buffer_sizes)[i] = (*buffers)[i].size();
+  }
+  RETURN_NOT_OK(set_query_buffers(query_r, buffers, buffer_sizes));
+  RETURN_NOT_OK(query_r->submit());
+
+  uint64_t nbytes = 0;
+  for (auto size : *buffer_sizes) {
+    nbytes += size;
+  }
+  stats_->add_counter("consolidate_batch_num", 1);
+  stats_->add_counter("consolidate_byte_num", nbytes);
+
   return Status::Ok();
 }
 
+Status FragmentConsolidator::write_batch(
+    Query* query_w,
+    std::vector<ByteVec>* buffers,
+    std::vector<uint64_t>* buffer_sizes) {
+  auto timer_se = stats_->start_timer("consolidate_write");
+
+  // Set explicitly the write query buffers, as the sizes may have
+  // been altered by the read query.
+  RETURN_NOT_OK(set_query_buffers(query_w, buffers, buffer_sizes));
+  return query_w->submit();
+}
+
 Status FragmentConsolidator::create_buffers(
     const ArraySchema& array_schema,
     std::vector<ByteVec>* buffers,
@@ -604,6 +812,8 @@ Status FragmentConsolidator::create_queries(
 Status FragmentConsolidator::compute_next_to_consolidate(
     const ArraySchema& array_schema,
     const FragmentInfo& fragment_info,
+    const std::vector<bool>& excluded,
+    const std::vector<NDRange>& excluded_domains,
     std::vector<TimestampedURI>* to_consolidate,
     NDRange* union_non_empty_domains) const {
   auto timer_se = stats_->start_timer("consolidate_compute_next");
@@ -650,8 +860,15 @@ Status FragmentConsolidator::compute_next_to_consolidate(
   for (size_t i = 0; i < row_num; ++i) {
     for (size_t j = 0; j < col_num; ++j) {
       if (i == 0) {  // In the first row we store the sizes of `fragments`
-        m_sizes[i][j] = fragments[j].fragment_size();
-        m_union[i][j] = fragments[j].non_empty_domain();
+        if (j < excluded.size() && excluded[j]) {
+          // Fragments taken by other groups are never selected
+          m_sizes[i][j] = UINT64_MAX;
+          m_union[i][j].clear();
+          m_union[i][j].shrink_to_fit();
+        } else {
+          m_sizes[i][j] = fragments[j].fragment_size();
+          m_union[i][j] = fragments[j].non_empty_domain();
+        }
       } else if (i + j >= col_num) {  // Non-valid entries
         m_sizes[i][j] = UINT64_MAX;
         m_union[i][j].clear();
@@ -660,7 +877,9 @@ Status FragmentConsolidator::compute_next_to_consolidate(
         auto ratio = (float)fragments[i + j - 1].fragment_size() /
                      fragments[i + j].fragment_size();
         ratio = (ratio <= 1.0f) ? ratio : 1.0f / ratio;
-        if (ratio >= size_ratio && (m_sizes[i - 1][j] != UINT64_MAX)) {
+        auto taken = i + j < excluded.size() && excluded[i + j];
+        if (!taken && ratio >= size_ratio &&
+            (m_sizes[i - 1][j] != UINT64_MAX)) {
           m_sizes[i][j] = m_sizes[i - 1][j] + fragments[i + j].fragment_size();
           m_union[i][j] = m_union[i - 1][j];
           domain.expand_ndrange(
@@ -680,6 +899,19 @@ Status FragmentConsolidator::compute_next_to_consolidate(
           m_union[i][j].shrink_to_fit();
         }
       }
+
+      // Entries overlapping the domain of another group are invalid, as the
+      // groups must be consolidated independently.
+      if (m_sizes[i][j] != UINT64_MAX) {
+        for (const auto& excluded_domain : excluded_domains) {
+          if (domain.overlap(m_union[i][j], excluded_domain)) {
+            m_sizes[i][j] = UINT64_MAX;
+            m_union[i][j].clear();
+            m_union[i][j].shrink_to_fit();
+            break;
+          }
+        }
+      }
     }
   }
 
@@ -816,6 +1048,14 @@ Status FragmentConsolidator::set_config(const Config* config) {
   RETURN_NOT_OK(merged_config.get<uint64_t>(
       "sm.consolidation.buffer_size", &config_.buffer_size_, &found));
   assert(found);
+  config_.pipeline_depth_ = 1;
+  RETURN_NOT_OK(merged_config.get<uint32_t>(
+      "sm.consolidation.pipeline_depth", &config_.pipeline_depth_, &found));
+  assert(found);
+  config_.parallel_groups_ = 1;
+  RETURN_NOT_OK(merged_config.get<uint32_t>(
+      "sm.consolidation.parallel_groups", &config_.parallel_groups_, &found));
+  assert(found);
   config_.size_ratio_ = 0.0f;
   RETURN_NOT_OK(merged_config.get<float>(
       "sm.consolidation.step_size_ratio", &config_.size_ratio_, &found));
@@ -150,6 +150,16 @@ class FragmentConsolidator : public Consolidator {
     float amplification_;
     /** Attribute buffer size. */
     uint64_t buffer_size_;
+    /**
+     * Number of buffer sets, so that reading the next batch of cells
+     * overlaps with writing the previous ones.
+     */
+    uint32_t pipeline_depth_;
+    /**
+     * Maximum number of non-overlapping fragment groups consolidated in
+     * parallel in a single step.
+     */
+    uint32_t parallel_groups_;
     /**
      * Number of consolidation steps performed in a single
      * consolidation invocation.
@@ -227,14 +237,44 @@ class FragmentConsolidator : public Consolidator {
   /**
    * Copies the array by reading from the fragments to be consolidated
    * with `query_r` and writing to the new fragment with `query_w`.
-   * It also appropriately sets the query buffers.
+   * It also appropriately sets the query buffers. With more than one
+   * buffer set, the batches are written in order on the compute thread
+   * pool while the next ones are read.
    *
    * @param query_r The read query.
    * @param query_w The write query.
+   * @param buffers The buffer sets.
+   * @param buffer_sizes The corresponding buffer sizes.
    * @return Status
    */
   Status copy_array(
       Query* query_r,
+      Query* query_w,
+      std::vector<std::vector<ByteVec>>* buffers,
+      std::vector<std::vector<uint64_t>>* buffer_sizes);
+
+  /**
+   * Reads the next batch of cells into the given buffers.
+   *
+   * @param query_r The read query.
+   * @param buffers The buffers to read into.
+   * @param buffer_sizes The corresponding buffer sizes.
+   * @return Status
+   */
+  Status read_batch(
+      Query* query_r,
+      std::vector<ByteVec>* buffers,
+      std::vector<uint64_t>* buffer_sizes);
+
+  /**
+   * Writes a batch of cells read into the given buffers.
+   *
+   * @param query_w The write query.
+   * @param buffers The buffers to write from.
+   * @param buffer_sizes The corresponding buffer sizes.
+   * @return Status
+   */
+  Status write_batch(
       Query* query_w,
       std::vector<ByteVec>* buffers,
       std::vector<uint64_t>* buffer_sizes);
@@ -284,6 +324,11 @@ class FragmentConsolidator : public Consolidator {
    *
    * @param array_schema The array schema.
    * @param fragment_info Information about all the fragments.
+   * @param excluded The fragments already chosen for consolidation in this
+   *     step, which cannot be chosen again. Empty if none.
+   * @param excluded_domains The unions of the non-empty domains of the
+   *     fragment groups already chosen in this step, which the chosen
+   *     fragments must not overlap.
    * @param to_consolidate The fragments to consolidate in the next step.
    * @param union_non_empty_domains The function will return here the
    *     union of the non-empty domains of the fragments in `to_consolidate`.
@@ -292,6 +337,8 @@ class FragmentConsolidator : public Consolidator {
   Status compute_next_to_consolidate(
       const ArraySchema& array_schema,
       const FragmentInfo& fragment_info,
+      const std::vector<bool>& excluded,
+      const std::vector<NDRange>& excluded_domains,
       std::vector<TimestampedURI>* to_consolidate,
       NDRange* union_non_empty_domains) const;
 
@@ -292,6 +292,38 @@ class Config {
    * - `sm.tile_cache_size` <br>
    *    The tile cache size in bytes. Any `uint64_t` value is acceptable. <br>
    *    **Default**: 10,000,000
+   * - `sm.tile_cache_shard_num` <br>
+   *    The number of shards of the tile cache. Each shard is locked
+   *    independently and holds `sm.tile_cache_size / sm.tile_cache_shard_num`
+   *    bytes, so tiles larger than that are not cached. Use a power of two of
+   *    the order of the number of threads reading concurrently. If 0, one
+   *    shard is used per 64 MiB of `sm.tile_cache_size`, at least 1 and at
+   *    most 16. <br>
+   *    **Default**: 0
+   * - `sm.tile_cache_policy` <br>
+   *    The tile cache eviction policy. `lru` evicts the least recently used
+   *    tile. `slru` (segmented LRU) evicts tiles that were read only once
+   *    before tiles that were read again, so that scans do not flush
+   *    frequently read tiles. <br>
+   *    **Default**: lru
+   * - `sm.tile_cache_unfiltered_size` <br>
+   *    The size in bytes of the cache of unfiltered (decompressed) tiles. A
+   *    tile found in this cache is neither read from storage nor unfiltered
+   *    again. `0` disables the cache. <br>
+   *    **Default**: 0
+   * - `sm.tile_cache_unfiltered_min_ratio` <br>
+   *    Only tiles with a non-empty filter pipeline whose unfiltered size is at
+   *    least this multiple of their persisted size are admitted in the
+   *    unfiltered tile cache. <br>
+   *    **Default**: 1.0
+   * - `sm.fragment_metadata_cache_size` <br>
+   *    The size in bytes of the context-wide cache of fragment metadata
+   *    footers, R-trees and tile offsets, shared by all the arrays opened with
+   *    the context. Metadata found in this cache is not read from storage
+   *    again when an array is reopened. Metadata of encrypted arrays is never
+   *    cached, except for the unencrypted footers. `0` disables the cache.
+   *    <br>
+   *    **Default**: 0
    * - `sm.array_schema_cache_size` <br>
    *    Array schema cache size in bytes. Any `uint64_t` value is acceptable.
    *    <br>
@@ -306,6 +338,22 @@ class Config {
    * - `sm.io_concurrency_level` <br>
    *    Upper-bound on number of threads to allocate for IO-bound tasks. <br>
    *    **Default*: # cores
+   * - `sm.compute_cpu_set` <br>
+   *    The CPUs to pin the threads for compute-bound tasks to, as a list of
+   *    CPUs and CPU ranges such as `0-3,8`. If empty, the threads are not
+   *    pinned. Only supported on Linux. <br>
+   *    **Default**: ""
+   * - `sm.io_cpu_set` <br>
+   *    The CPUs to pin the threads for IO-bound tasks to, in the same format
+   *    as `sm.compute_cpu_set`. Only supported on Linux. <br>
+   *    **Default**: ""
+   * - `sm.numa_aware` <br>
+   *    If `true`, each thread is pinned to the CPUs of a single NUMA node,
+   *    the threads being spread over the nodes spanned by
+   *    `sm.compute_cpu_set` and `sm.io_cpu_set` (all the available CPUs if
+   *    empty), and idle threads take work from threads of their own node
+   *    first. Only supported on Linux. <br>
+   *    **Default**: false
    * - `sm.vacuum.mode` <br>
    *    The vacuuming mode, one of `fragments` (remove consolidated fragments),
    *    `fragment_meta` (remove only consolidated fragment metadata), or
@@ -329,6 +377,18 @@ class Config {
    *    The size (in bytes) of the attribute buffers used during
    *    consolidation. <br>
    *    **Default**: 50,000,000
+   * - `sm.consolidation.pipeline_depth` <br>
+   *    The number of attribute buffer sets used during consolidation. With
+   *    more than one set, reading the next batch of cells overlaps with
+   *    filtering and writing the previous ones, at the cost of one more set of
+   *    `sm.consolidation.buffer_size` buffers each. <br>
+   *    **Default**: 1
+   * - `sm.consolidation.parallel_groups` <br>
+   *    The maximum number of fragment groups consolidated in parallel in a
+   *    single step of sparse array consolidation. The groups are chosen as in
+   *    the sequential algorithm, among the fragments not chosen yet, and must
+   *    have non-overlapping non-empty domains. <br>
+   *    **Default**: 1
    * - `sm.consolidation.steps` <br>
    *    The number of consolidation steps to be performed when executing
    *    the consolidation algorithm.<br>
@@ -386,10 +446,23 @@ class Config {
    *    Which reader to use for sparse global order queries. "refactored"
    *    or "legacy".<br>
    *    **Default**: legacy
+   * - `sm.query.sparse_global_order.merge_partition_min_cells` <br>
+   *    For arrays with duplicates, the refactored sparse global order reader
+   *    merges the cells of the fragments in parallel, splitting the global
+   *    order into key ranges. This is the minimum number of cells to merge
+   *    per range, fewer cells are merged on a single thread. <br>
+   *    **Default**: 65536
    * - `sm.query.sparse_unordered_with_dups.reader` <br>
    *    Which reader to use for sparse unordered with dups queries.
    *    "refactored" or "legacy".<br>
    *    **Default**: refactored
+   * - `sm.query.trace_max_span_num` <br>
+   *    The maximum number of timer spans recorded in the trace of a query,
+   *    which is retrieved with `QueryExperimental::get_trace`. The trace
+   *    memory (about 40 bytes per span) is allocated when the query is
+   *    submitted, and spans past the maximum are dropped. `0` disables
+   *    tracing. <br>
+   *    **Default**: 0
    * - `sm.mem.malloc_trim` <br>
    *    Should malloc_trim be called on context and query destruction? This
    *    might reduce residual memory usage. <br>
@@ -397,6 +470,26 @@ class Config {
    * - `sm.mem.total_budget` <br>
    *    Memory budget for readers and writers. <br>
    *    **Default**: 10GB
+   * - `sm.mem.context_budget` <br>
+   *    Memory budget shared by all the sparse readers and open arrays of the
+   *    context. Each sparse reader reserves its `sm.mem.total_budget`
+   *    against it before running. Only sparse reads and the metadata loaded
+   *    by open arrays are covered: dense reads and writes are not admitted
+   *    against this budget, and the memory of individual queries is only
+   *    reported in the stats. `0` means no limit. <br>
+   *    **Default**: 0
+   * - `sm.mem.admission_timeout_ms` <br>
+   *    How long a sparse reader waits for its full budget to be available
+   *    in `sm.mem.context_budget`, in milliseconds. Past it, the reader runs
+   *    with the budget available, or fails if that is under a tenth of its
+   *    budget. <br>
+   *    **Default**: 1000
+   * - `sm.mem.tile_buffer_pool_size` <br>
+   *    Maximum byte size of the released tile buffers the context keeps for
+   *    reuse by later reads, to save on allocations and page faults. Buffers
+   *    are rounded up to size classes of at most 25% overhead. `0` disables
+   *    the pool. <br>
+   *    **Default**: 0
    * - `sm.mem.reader.sparse_global_order.ratio_coords` <br>
    *    Ratio of the budget allocated for coordinates in the sparse global
    *    order reader. <br>
@@ -442,6 +535,19 @@ class Config {
    *    The the total maximum size of the read-ahead cache, which is an LRU.
    *    <br>
    *    **Default**: 10485760
+   * -  `vfs.read_ahead_max_size` <br>
+   *    The maximum byte size to read-ahead for a file that is read
+   *    sequentially. The read-ahead window of a file starts at
+   *    `vfs.read_ahead_size`, doubles with each sequential read up to this
+   *    size, and halves with each random read until read-ahead is disabled
+   *    for the file. Set it to `vfs.read_ahead_size` for a fixed window. <br>
+   *    **Default**: 1048576
+   * -  `vfs.read_ahead_local` <br>
+   *    If `true`, the reads of POSIX, Windows, HDFS and in-memory files are
+   *    read-ahead like the reads of cloud objects. Local files are already
+   *    cached by the operating system, so read-ahead is off for them by
+   *    default. <br>
+   *    **Default**: false
    * - `vfs.min_parallel_size` <br>
    *    The minimum number of bytes in a parallel VFS operation
    *    (except parallel S3 writes, which are controlled by
@@ -466,6 +572,23 @@ class Config {
    *    The maximum number of parallel operations on objects with `file:///`
    *    URIs. <br>
    *    **Default**: `sm.io_concurrency_level`
+   * - `vfs.file.io_uring` <br>
+   *    If `true`, the tile reads of a query on `file:///` URIs are submitted
+   *    together with io_uring and complete asynchronously, instead of using
+   *    one thread per read. Falls back to `pread` if io_uring is not
+   *    available. Only supported on Linux. <br>
+   *    **Default**: false
+   * - `vfs.file.io_uring_queue_depth` <br>
+   *    The maximum number of io_uring reads in flight per batch. Concurrent
+   *    batches use separate rings. <br>
+   *    **Default**: 256
+   * - `vfs.file.mmap` <br>
+   *    If `true`, the fragment files of arrays opened for reads on `file:///`
+   *    URIs are memory-mapped once per open array. Tiles with no filters, or
+   *    only checksum filters, are read from the mapped pages without being
+   *    copied to an intermediate buffer, and are referenced in place when they
+   *    consist of a single chunk. Not supported on Windows. <br>
+   *    **Default**: false
    * - `vfs.azure.storage_account_name` <br>
    *    Set the Azure Storage Account name. <br>
    *    **Default**: ""
@@ -52,6 +52,7 @@
 #include <functional>
 #include <iterator>
 #include <memory>
+#include <optional>
 #include <set>
 #include <string>
 #include <type_traits>
@@ -976,6 +977,53 @@ class Query {
     return {size_off, size_val, size_validity};
   }
 
+  /**
+   * Computes an aggregate over the cells of a sparse array that fall in the
+   * query subarray and satisfy the query condition, answering the fully
+   * covered tiles from the fragment tile metadata. `T` must match the
+   * aggregate value type: `uint64_t` for counts, `int64_t`, `uint64_t` or
+   * `double` for sums, and the attribute type for the minimum and maximum.
+   *
+   * **Example:**
+   *
+   * @code{.cpp}
+   * auto sum = query.aggregate<int64_t>("attr1", TILEDB_AGGREGATE_SUM);
+   * auto max = query.aggregate<int32_t>("attr1", TILEDB_AGGREGATE_MAX);
+   * @endcode
+   *
+   * @tparam T The aggregate value type.
+   * @param attr_name The attribute name. Ignored for `TILEDB_AGGREGATE_COUNT`.
+   * @param op The aggregate operator.
+   * @return The aggregate value, or `std::nullopt` for a minimum or maximum
+   *     without any non-null value.
+   */
+  template <typename T>
+  std::optional<T> aggregate(
+      const std::string& attr_name, tiledb_aggregate_op_t op) const {
+    auto& ctx = ctx_.get();
+    T value;
+    uint64_t value_size = sizeof(T);
+    ctx.handle_error(tiledb_query_get_aggregate(
+        ctx.ptr().get(),
+        query_.get(),
+        attr_name.c_str(),
+        op,
+        &value,
+        &value_size));
+    if (value_size == 0) {
+      return std::nullopt;
+    }
+
+    if (value_size != sizeof(T)) {
+      throw TileDBError(
+          "Cannot get aggregate; Value type size does not match the "
+          "aggregate size " +
+          std::to_string(value_size));
+    }
+
+    return value;
+  }
+
   /**
    * Returns the number of written fragments. Applicable only to WRITE queries.
    */
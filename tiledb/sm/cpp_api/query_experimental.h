@@ -0,0 +1,81 @@
+/**
+ * @file   query_experimental.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file declares the experimental C++ API for the query.
+ */
+
+#ifndef TILEDB_CPP_API_QUERY_EXPERIMENTAL_H
+#define TILEDB_CPP_API_QUERY_EXPERIMENTAL_H
+
+#include "context.h"
+#include "query.h"
+#include "tiledb.h"
+#include "tiledb_experimental.h"
+
+#include <cstdlib>
+#include <string>
+
+namespace tiledb {
+class QueryExperimental {
+ public:
+  /**
+   * Returns the trace of the query as Chrome trace JSON, or an empty string
+   * if tracing was not enabled with `sm.query.trace_max_span_num` in the
+   * query config before the query was submitted. VFS timers are recorded by
+   * the context, so they do not appear in the trace.
+   *
+   * **Example:**
+   *
+   * @code{.cpp}
+   * tiledb::Config config;
+   * config["sm.query.trace_max_span_num"] = "100000";
+   * query.set_config(config);
+   * query.submit();
+   * std::string trace = QueryExperimental::get_trace(ctx, query);
+   * @endcode
+   *
+   * @param ctx The TileDB context.
+   * @param query The query.
+   * @return The Chrome trace JSON.
+   */
+  static std::string get_trace(const Context& ctx, const Query& query) {
+    char* c_str;
+    ctx.handle_error(
+        tiledb_query_get_trace(ctx.ptr().get(), query.ptr().get(), &c_str));
+
+    // Copy `c_str` into `str`.
+    std::string str(c_str);
+    ctx.handle_error(tiledb_query_free_trace(&c_str));
+
+    return str;
+  }
+};
+}  // namespace tiledb
+
+#endif  // TILEDB_CPP_API_QUERY_EXPERIMENTAL_H
@@ -0,0 +1,100 @@
+/**
+ * @file aggregate_op.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This defines the tiledb AggregateOp enum that maps to the
+ * tiledb_aggregate_op_t C-api enum.
+ */
+
+#ifndef TILEDB_AGGREGATE_OP_H
+#define TILEDB_AGGREGATE_OP_H
+
+#include "tiledb/common/status.h"
+#include "tiledb/sm/misc/constants.h"
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+/** Defines the query aggregate ops. */
+enum class AggregateOp : uint8_t {
+#define TILEDB_AGGREGATE_OP_ENUM(id) id
+#include "tiledb/sm/c_api/tiledb_enum.h"
+#undef TILEDB_AGGREGATE_OP_ENUM
+};
+
+/** Returns the string representation of the input AggregateOp type. */
+inline const std::string& aggregate_op_str(AggregateOp aggregate_op) {
+  switch (aggregate_op) {
+    case AggregateOp::AGGREGATE_COUNT:
+      return constants::aggregate_op_count_str;
+    case AggregateOp::AGGREGATE_SUM:
+      return constants::aggregate_op_sum_str;
+    case AggregateOp::AGGREGATE_MIN:
+      return constants::aggregate_op_min_str;
+    case AggregateOp::AGGREGATE_MAX:
+      return constants::aggregate_op_max_str;
+    case AggregateOp::AGGREGATE_NULL_COUNT:
+      return constants::aggregate_op_null_count_str;
+    default:
+      return constants::empty_str;
+  }
+}
+
+/** Returns the AggregateOp given a string representation. */
+inline Status aggregate_op_enum(
+    const std::string& aggregate_op_str, AggregateOp* aggregate_op) {
+  if (aggregate_op_str == constants::aggregate_op_count_str)
+    *aggregate_op = AggregateOp::AGGREGATE_COUNT;
+  else if (aggregate_op_str == constants::aggregate_op_sum_str)
+    *aggregate_op = AggregateOp::AGGREGATE_SUM;
+  else if (aggregate_op_str == constants::aggregate_op_min_str)
+    *aggregate_op = AggregateOp::AGGREGATE_MIN;
+  else if (aggregate_op_str == constants::aggregate_op_max_str)
+    *aggregate_op = AggregateOp::AGGREGATE_MAX;
+  else if (aggregate_op_str == constants::aggregate_op_null_count_str)
+    *aggregate_op = AggregateOp::AGGREGATE_NULL_COUNT;
+  else
+    return Status_Error("Invalid AggregateOp " + aggregate_op_str);
+
+  return Status::Ok();
+}
+
+/** Returns an error if the input value is not a valid AggregateOp. */
+inline Status aggregate_op_is_valid(uint32_t aggregate_op_enum) {
+  if (aggregate_op_enum > 4)
+    return Status_Error("Invalid AggregateOp enum.");
+
+  return Status::Ok();
+}
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_AGGREGATE_OP_H
@@ -0,0 +1,122 @@
+/**
+ * @file   mmap_file.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *
+ * @section DESCRIPTION
+ *
+ * This file implements class MmapFile.
+ */
+
+#include "tiledb/sm/filesystem/mmap_file.h"
+#include "tiledb/common/logger.h"
+
+#include <cerrno>
+#include <cstring>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+/* ****************************** */
+/*   CONSTRUCTORS & DESTRUCTORS   */
+/* ****************************** */
+
+MmapFile::MmapFile()
+    : data_(nullptr)
+    , size_(0) {
+}
+
+MmapFile::~MmapFile() {
+#ifndef _WIN32
+  if (data_ != nullptr)
+    munmap(data_, size_);
+#endif
+}
+
+/* ****************************** */
+/*               API              */
+/* ****************************** */
+
+#ifndef _WIN32
+
+Status MmapFile::open(const std::string& path) {
+  if (data_ != nullptr)
+    return LOG_STATUS(Status_IOError(
+        "Cannot map file '" + path + "'; A file is already mapped"));
+
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd == -1)
+    return LOG_STATUS(Status_IOError(
+        "Cannot map file '" + path + "'; " + strerror(errno)));
+
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    close(fd);
+    return LOG_STATUS(Status_IOError(
+        "Cannot map file '" + path + "'; " + strerror(errno)));
+  }
+
+  // Empty files cannot be mapped.
+  size_ = static_cast<uint64_t>(st.st_size);
+  if (size_ == 0) {
+    close(fd);
+    return Status::Ok();
+  }
+
+  // The mapping stays valid after the file descriptor is closed.
+  void* ptr =
+      mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (ptr == MAP_FAILED) {
+    size_ = 0;
+    return LOG_STATUS(Status_IOError(
+        "Cannot map file '" + path + "'; " + strerror(errno)));
+  }
+  data_ = static_cast<char*>(ptr);
+
+  return Status::Ok();
+}
+
+#else
+
+Status MmapFile::open(const std::string& path) {
+  return LOG_STATUS(Status_IOError(
+      "Cannot map file '" + path + "'; Memory mapping is not supported"));
+}
+
+#endif
+
+}  // namespace sm
+}  // namespace tiledb
@@ -0,0 +1,107 @@
+/**
+ * @file   mmap_file.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class MmapFile.
+ */
+
+#ifndef TILEDB_MMAP_FILE_H
+#define TILEDB_MMAP_FILE_H
+
+#include <cstdint>
+#include <string>
+
+#include "tiledb/common/macros.h"
+#include "tiledb/common/status.h"
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+/**
+ * A memory mapping of a whole local file, released on destruction.
+ *
+ * The pages are mapped copy-on-write: the mapped memory may be modified in
+ * place, but modifications are private to the mapping and never reach the
+ * file. Memory mapping is not supported on Windows.
+ */
+class MmapFile {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /** Constructor. */
+  MmapFile();
+
+  /** Destructor. */
+  ~MmapFile();
+
+  DISABLE_COPY_AND_COPY_ASSIGN(MmapFile);
+  DISABLE_MOVE_AND_MOVE_ASSIGN(MmapFile);
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /**
+   * Maps the file at the input path.
+   *
+   * @param path The path of the file.
+   * @return Status
+   */
+  Status open(const std::string& path);
+
+  /** Returns the mapped file contents, `nullptr` if the file is empty. */
+  inline char* data() const {
+    return data_;
+  }
+
+  /** Returns the file size. */
+  inline uint64_t size() const {
+    return size_;
+  }
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** The mapped file contents. */
+  char* data_;
+
+  /** The file size. */
+  uint64_t size_;
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_MMAP_FILE_H
@@ -61,7 +61,8 @@ namespace tiledb {
 namespace sm {
 
 Posix::Posix()
-    : config_(default_config_) {
+    : config_(default_config_)
+    , use_mmap_(false) {
 }
 
 bool Posix::both_slashes(char a, char b) {
@@ -264,6 +265,27 @@ Status Posix::init(const Config& config, ThreadPool* vfs_thread_pool) {
   config_ = config;
   vfs_thread_pool_ = vfs_thread_pool;
 
+  // Set up io_uring, falling back to `pread` if it is not supported.
+  bool found = false;
+  bool use_io_uring = false;
+  RETURN_NOT_OK(config.get<bool>("vfs.file.io_uring", &use_io_uring, &found));
+  assert(found);
+  if (use_io_uring) {
+    uint64_t queue_depth = 0;
+    RETURN_NOT_OK(config.get<uint64_t>(
+        "vfs.file.io_uring_queue_depth", &queue_depth, &found));
+    assert(found);
+    uring_reader_.reset(
+        tdb_new(UringReader, static_cast<uint32_t>(queue_depth)));
+    if (!uring_reader_->available()) {
+      LOG_WARN("io_uring is not available; falling back to pread");
+      uring_reader_.reset();
+    }
+  }
+
+  RETURN_NOT_OK(config.get<bool>("vfs.file.mmap", &use_mmap_, &found));
+  assert(found);
+
   return Status::Ok();
 }
 
@@ -473,6 +495,70 @@ Status Posix::read(
   return Status::Ok();
 }
 
+Status Posix::read_batch(
+    const std::unordered_map<
+        std::string,
+        std::vector<tuple<uint64_t, void*, uint64_t>>>& regions) const {
+  // Open all files, closing them on exit.
+  std::vector<int> fds;
+  fds.reserve(regions.size());
+  auto close_fds = [&fds]() {
+    for (auto fd : fds)
+      close(fd);
+  };
+
+  std::vector<UringReader::Request> requests;
+  for (const auto& [path, file_regions] : regions) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1) {
+      close_fds();
+      return LOG_STATUS(Status_IOError(
+          "Cannot read from file '" + path + "'; " + strerror(errno)));
+    }
+    fds.emplace_back(fd);
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+      close_fds();
+      return LOG_STATUS(Status_IOError(
+          "Cannot read from file '" + path + "'; " + strerror(errno)));
+    }
+
+    for (const auto& [offset, buffer, nbytes] : file_regions) {
+      if (offset + nbytes > static_cast<uint64_t>(st.st_size)) {
+        close_fds();
+        return LOG_STATUS(Status_IOError(
+            "Cannot read from file '" + path + "'; Read exceeds file size"));
+      }
+      requests.push_back({fd, offset, buffer, nbytes});
+    }
+  }
+
+  Status st = Status::Ok();
+  if (uring_reader_ != nullptr) {
+    st = uring_reader_->read(requests);
+  } else {
+    for (const auto& r : requests) {
+      if (read_all(r.fd_, r.buffer_, r.nbytes_, r.offset_) != r.nbytes_) {
+        st = LOG_STATUS(
+            Status_IOError("Cannot read from files; File reading error"));
+        break;
+      }
+    }
+  }
+
+  close_fds();
+  return st;
+}
+
+bool Posix::uring_enabled() const {
+  return uring_reader_ != nullptr;
+}
+
+bool Posix::mmap_enabled() const {
+  return use_mmap_;
+}
+
 Status Posix::sync(const std::string& path) {
   uint32_t permissions = 0;
 
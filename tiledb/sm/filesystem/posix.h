@@ -40,11 +40,14 @@
 
 #include <functional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
+#include "tiledb/common/heap_memory.h"
 #include "tiledb/common/status.h"
 #include "tiledb/common/thread_pool.h"
 #include "tiledb/sm/config/config.h"
+#include "tiledb/sm/filesystem/uring_reader.h"
 
 using namespace tiledb::common;
 
@@ -214,6 +217,26 @@ class Posix {
       void* buffer,
       uint64_t nbytes) const;
 
+  /**
+   * Reads multiple regions from multiple files. With io_uring enabled, all
+   * the reads are submitted at once and complete asynchronously on the
+   * calling thread; otherwise each region is read with `pread`.
+   *
+   * @param regions Maps the name of each file to the regions to read from
+   *     it. Each region is a tuple `(file_offset, dest_buffer, nbytes)`.
+   * @return Status
+   */
+  Status read_batch(
+      const std::unordered_map<
+          std::string,
+          std::vector<tuple<uint64_t, void*, uint64_t>>>& regions) const;
+
+  /** Returns `true` if reads are batched with io_uring. */
+  bool uring_enabled() const;
+
+  /** Returns `true` if tiles may be read from memory-mapped files. */
+  bool mmap_enabled() const;
+
   /**
    * Syncs a file or directory.
    *
@@ -246,6 +269,15 @@ class Posix {
   /** Thread pool from parent VFS instance. */
   ThreadPool* vfs_thread_pool_;
 
+  /**
+   * Batches reads with io_uring, if enabled with `vfs.file.io_uring` and
+   * supported by the system.
+   */
+  tdb_unique_ptr<UringReader> uring_reader_;
+
+  /** Whether tiles may be read from memory-mapped files. */
+  bool use_mmap_;
+
   static void adjacent_slashes_dedup(std::string* path);
 
   static bool both_slashes(char a, char b);
@@ -0,0 +1,409 @@
+/**
+ * @file   uring_reader.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *
+ * @section DESCRIPTION
+ *
+ * This file implements class UringReader.
+ */
+
+#include "tiledb/sm/filesystem/uring_reader.h"
+#include "tiledb/common/logger.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <chrono>
+#include <deque>
+#include <string>
+#include <thread>
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define TILEDB_HAVE_IO_URING
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+#ifdef TILEDB_HAVE_IO_URING
+
+namespace {
+
+/**
+ * The maximum number of bytes of a single read submission; larger regions
+ * are read in several submissions, as completions report 32-bit results.
+ */
+const uint64_t max_read_nbytes = 1ULL << 30;
+
+/**
+ * The number of times a batch retries a submission rejected with EAGAIN
+ * or EBUSY while no reads are in flight, before failing.
+ */
+const uint32_t max_busy_retries = 10;
+
+/** The first backoff before such a retry, doubled after each attempt. */
+const uint64_t busy_backoff_us = 50;
+
+int io_uring_setup(unsigned entries, io_uring_params* params) {
+  return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int io_uring_enter(
+    int fd, unsigned to_submit, unsigned min_complete, unsigned flags) {
+  return static_cast<int>(syscall(
+      __NR_io_uring_enter, fd, to_submit, min_complete, flags, nullptr, 0));
+}
+
+void* map_ring(int fd, uint64_t size, uint64_t offset) {
+  void* ptr = mmap(
+      nullptr,
+      size,
+      PROT_READ | PROT_WRITE,
+      MAP_SHARED | MAP_POPULATE,
+      fd,
+      static_cast<off_t>(offset));
+  return ptr == MAP_FAILED ? nullptr : ptr;
+}
+
+template <class T>
+T* ring_ptr(void* ring, uint32_t offset) {
+  return reinterpret_cast<T*>(static_cast<char*>(ring) + offset);
+}
+
+}  // namespace
+
+/* ****************************** */
+/*              Ring              */
+/* ****************************** */
+
+UringReader::Ring::Ring(const uint32_t queue_depth)
+    : ring_fd_(-1)
+    , sq_entries_(0)
+    , sq_ring_(nullptr)
+    , cq_ring_(nullptr)
+    , sq_ring_size_(0)
+    , cq_ring_size_(0)
+    , sqes_(nullptr)
+    , sqes_size_(0) {
+  io_uring_params params;
+  memset(&params, 0, sizeof(params));
+  ring_fd_ = io_uring_setup(std::max<uint32_t>(queue_depth, 1), &params);
+  if (ring_fd_ < 0) {
+    ring_fd_ = -1;
+    return;
+  }
+
+  sq_entries_ = params.sq_entries;
+  sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+  cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+
+  // Recent kernels map both rings with a single mapping.
+#ifdef IORING_FEAT_SINGLE_MMAP
+  const bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+#else
+  const bool single_mmap = false;
+#endif
+  if (single_mmap)
+    sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+
+  sq_ring_ = map_ring(ring_fd_, sq_ring_size_, IORING_OFF_SQ_RING);
+  cq_ring_ = single_mmap ?
+                 sq_ring_ :
+                 map_ring(ring_fd_, cq_ring_size_, IORING_OFF_CQ_RING);
+  sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+  sqes_ = map_ring(ring_fd_, sqes_size_, IORING_OFF_SQES);
+  if (sq_ring_ == nullptr || cq_ring_ == nullptr || sqes_ == nullptr) {
+    teardown();
+    return;
+  }
+
+  sq_head_ = ring_ptr<uint32_t>(sq_ring_, params.sq_off.head);
+  sq_tail_ = ring_ptr<uint32_t>(sq_ring_, params.sq_off.tail);
+  sq_mask_ = ring_ptr<uint32_t>(sq_ring_, params.sq_off.ring_mask);
+  sq_array_ = ring_ptr<uint32_t>(sq_ring_, params.sq_off.array);
+  cq_head_ = ring_ptr<uint32_t>(cq_ring_, params.cq_off.head);
+  cq_tail_ = ring_ptr<uint32_t>(cq_ring_, params.cq_off.tail);
+  cq_mask_ = ring_ptr<uint32_t>(cq_ring_, params.cq_off.ring_mask);
+  cqes_ = ring_ptr<void>(cq_ring_, params.cq_off.cqes);
+}
+
+UringReader::Ring::~Ring() {
+  teardown();
+}
+
+bool UringReader::Ring::available() const {
+  return ring_fd_ != -1;
+}
+
+Status UringReader::Ring::read(const std::vector<Request>& requests) {
+  // The part of a request still to be read. The iovec must stay valid until
+  // the read completes.
+  struct PendingRead {
+    int fd_;
+    uint64_t offset_;
+    char* buffer_;
+    uint64_t nbytes_;
+    iovec iov_;
+  };
+  std::vector<PendingRead> reads(requests.size());
+  std::deque<size_t> to_submit;
+  for (size_t i = 0; i < requests.size(); ++i) {
+    const auto& r = requests[i];
+    reads[i] = {
+        r.fd_, r.offset_, static_cast<char*>(r.buffer_), r.nbytes_, {}};
+    if (r.nbytes_ > 0)
+      to_submit.push_back(i);
+  }
+
+  auto sqes = static_cast<io_uring_sqe*>(sqes_);
+  auto cqes = static_cast<io_uring_cqe*>(cqes_);
+  uint32_t in_flight = 0;
+  uint32_t unsubmitted = 0;
+  uint32_t busy_retries = 0;
+  std::string error;
+
+  while (in_flight > 0 || unsubmitted > 0 ||
+         (!to_submit.empty() && error.empty())) {
+    // Queue as many reads as the submission ring holds. Stop queueing new
+    // reads after an error, but still wait for the ones in flight, as they
+    // write to the caller's buffers.
+    uint32_t tail = *sq_tail_;
+    while (error.empty() && !to_submit.empty() &&
+           in_flight + unsubmitted < sq_entries_) {
+      const size_t idx = to_submit.front();
+      to_submit.pop_front();
+      auto& read = reads[idx];
+      read.iov_.iov_base = read.buffer_;
+      read.iov_.iov_len = std::min(read.nbytes_, max_read_nbytes);
+
+      const uint32_t sqe_idx = tail & *sq_mask_;
+      auto& sqe = sqes[sqe_idx];
+      memset(&sqe, 0, sizeof(sqe));
+      sqe.opcode = IORING_OP_READV;
+      sqe.fd = read.fd_;
+      sqe.off = read.offset_;
+      sqe.addr = reinterpret_cast<uint64_t>(&read.iov_);
+      sqe.len = 1;
+      sqe.user_data = idx;
+      sq_array_[sqe_idx] = sqe_idx;
+      ++tail;
+      ++unsubmitted;
+    }
+    __atomic_store_n(sq_tail_, tail, __ATOMIC_RELEASE);
+
+    // Submit the queued reads and wait for at least one completion.
+    const int submitted = io_uring_enter(
+        ring_fd_,
+        unsubmitted,
+        in_flight + unsubmitted > 0 ? 1 : 0,
+        IORING_ENTER_GETEVENTS);
+    if (submitted < 0) {
+      if (errno == EINTR)
+        continue;
+
+      // On EAGAIN or EBUSY nothing was submitted and the queued reads are
+      // retried after reaping, which frees room in the completion ring.
+      // Without reads in flight there is nothing to reap, so back off and
+      // give up after a few attempts.
+      bool failed = errno != EAGAIN && errno != EBUSY;
+      const std::string enter_error =
+          std::string("io_uring_enter error: ") + strerror(errno);
+      if (!failed) {
+        if (in_flight > 0) {
+          io_uring_enter(ring_fd_, 0, 1, IORING_ENTER_GETEVENTS);
+        } else if (busy_retries < max_busy_retries) {
+          std::this_thread::sleep_for(
+              std::chrono::microseconds(busy_backoff_us << busy_retries));
+          ++busy_retries;
+        } else {
+          failed = true;
+        }
+      }
+
+      if (failed) {
+        if (error.empty())
+          error = enter_error;
+        // Nothing more will be submitted; drop the queued entries so that
+        // they are not picked up by the next batch, and only reap the reads
+        // in flight.
+        unsubmitted = 0;
+        __atomic_store_n(sq_tail_, *sq_head_, __ATOMIC_RELEASE);
+        if (in_flight == 0)
+          break;
+      }
+    } else {
+      busy_retries = 0;
+      unsubmitted -= static_cast<uint32_t>(submitted);
+      in_flight += static_cast<uint32_t>(submitted);
+    }
+
+    // Reap the completions, re-queueing the rest of short reads.
+    uint32_t head = *cq_head_;
+    const uint32_t cq_tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+    for (; head != cq_tail; ++head) {
+      const auto& cqe = cqes[head & *cq_mask_];
+      auto& read = reads[cqe.user_data];
+      --in_flight;
+
+      if (cqe.res == -EINTR || cqe.res == -EAGAIN) {
+        to_submit.push_back(cqe.user_data);
+      } else if (cqe.res < 0) {
+        if (error.empty())
+          error = std::string("io_uring read error: ") + strerror(-cqe.res);
+      } else if (cqe.res == 0) {
+        if (error.empty())
+          error = "io_uring read error: Unexpected end of file";
+      } else {
+        read.offset_ += cqe.res;
+        read.buffer_ += cqe.res;
+        read.nbytes_ -= cqe.res;
+        if (read.nbytes_ > 0)
+          to_submit.push_back(cqe.user_data);
+      }
+    }
+    __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+  }
+
+  if (!error.empty())
+    return LOG_STATUS(Status_IOError("Cannot read from files; " + error));
+
+  return Status::Ok();
+}
+
+void UringReader::Ring::teardown() {
+  if (sqes_ != nullptr)
+    munmap(sqes_, sqes_size_);
+  if (cq_ring_ != nullptr && cq_ring_ != sq_ring_)
+    munmap(cq_ring_, cq_ring_size_);
+  if (sq_ring_ != nullptr)
+    munmap(sq_ring_, sq_ring_size_);
+  if (ring_fd_ != -1)
+    close(ring_fd_);
+
+  sqes_ = sq_ring_ = cq_ring_ = nullptr;
+  ring_fd_ = -1;
+}
+
+#else
+
+UringReader::Ring::Ring(uint32_t)
+    : ring_fd_(-1) {
+}
+
+UringReader::Ring::~Ring() = default;
+
+bool UringReader::Ring::available() const {
+  return false;
+}
+
+Status UringReader::Ring::read(const std::vector<Request>&) {
+  return LOG_STATUS(
+      Status_IOError("Cannot read from files; io_uring is not available"));
+}
+
+void UringReader::Ring::teardown() {
+}
+
+#endif
+
+/* ****************************** */
+/*   CONSTRUCTORS & DESTRUCTORS   */
+/* ****************************** */
+
+UringReader::UringReader(const uint32_t queue_depth)
+    : queue_depth_(std::max<uint32_t>(queue_depth, 1))
+    , pool_full_(false)
+    , available_(add_idle_ring()) {
+}
+
+UringReader::~UringReader() = default;
+
+/* ****************************** */
+/*               API              */
+/* ****************************** */
+
+bool UringReader::available() const {
+  return available_;
+}
+
+Status UringReader::read(const std::vector<Request>& requests) {
+  if (!available())
+    return LOG_STATUS(
+        Status_IOError("Cannot read from files; io_uring is not available"));
+
+  // The batch owns the ring until it returns, without holding any lock.
+  Ring* const ring = acquire_ring();
+  const Status st = ring->read(requests);
+  release_ring(ring);
+
+  return st;
+}
+
+/* ****************************** */
+/*         PRIVATE METHODS        */
+/* ****************************** */
+
+UringReader::Ring* UringReader::acquire_ring() {
+  std::unique_lock<std::mutex> lock(mtx_);
+  // Setting up a ring typically fails when out of locked memory; share the
+  // existing rings instead.
+  if (idle_rings_.empty() && !pool_full_ && !add_idle_ring())
+    pool_full_ = true;
+
+  cv_.wait(lock, [this]() { return !idle_rings_.empty(); });
+  Ring* const ring = idle_rings_.back();
+  idle_rings_.pop_back();
+  return ring;
+}
+
+bool UringReader::add_idle_ring() {
+  tdb_unique_ptr<Ring> ring(tdb_new(Ring, queue_depth_));
+  if (!ring->available())
+    return false;
+
+  idle_rings_.emplace_back(ring.get());
+  rings_.emplace_back(std::move(ring));
+  return true;
+}
+
+void UringReader::release_ring(Ring* const ring) {
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    idle_rings_.emplace_back(ring);
+  }
+  cv_.notify_one();
+}
+
+}  // namespace sm
+}  // namespace tiledb
@@ -0,0 +1,230 @@
+/**
+ * @file   uring_reader.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class UringReader.
+ */
+
+#ifndef TILEDB_URING_READER_H
+#define TILEDB_URING_READER_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "tiledb/common/heap_memory.h"
+#include "tiledb/common/macros.h"
+#include "tiledb/common/status.h"
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+/**
+ * Reads batches of file regions with Linux io_uring: all the reads of a batch
+ * are submitted with a single system call and complete asynchronously, so
+ * that a single thread can keep the device queue full.
+ *
+ * Each batch runs on a ring of its own, taken from a pool that grows with the
+ * number of concurrent batches, so concurrent queries never wait on each
+ * other's reads. A first ring is set up on construction. If io_uring is not
+ * supported (older kernels, non-Linux platforms, or system call filters),
+ * `available()` returns `false` and the reader must not be used.
+ *
+ * This class is thread-safe.
+ */
+class UringReader {
+ public:
+  /** A region of an open file to read. */
+  struct Request {
+    /** The open file descriptor. */
+    int fd_;
+
+    /** The offset in the file. */
+    uint64_t offset_;
+
+    /** The buffer to read into. */
+    void* buffer_;
+
+    /** The number of bytes to read. */
+    uint64_t nbytes_;
+  };
+
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /**
+   * Constructor.
+   *
+   * @param queue_depth The maximum number of reads in flight per batch.
+   */
+  explicit UringReader(uint32_t queue_depth);
+
+  /** Destructor. */
+  ~UringReader();
+
+  DISABLE_COPY_AND_COPY_ASSIGN(UringReader);
+  DISABLE_MOVE_AND_MOVE_ASSIGN(UringReader);
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /** Returns `true` if the first ring was set up successfully. */
+  bool available() const;
+
+  /**
+   * Reads all the requested regions. Returns once all reads have completed,
+   * even on error.
+   *
+   * @param requests The regions to read.
+   * @return Status
+   */
+  Status read(const std::vector<Request>& requests);
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE DATATYPES         */
+  /* ********************************* */
+
+  /** A submission and completion ring pair, used by one batch at a time. */
+  class Ring {
+   public:
+    /**
+     * Constructor.
+     *
+     * @param queue_depth The number of submission queue entries.
+     */
+    explicit Ring(uint32_t queue_depth);
+
+    /** Destructor. */
+    ~Ring();
+
+    DISABLE_COPY_AND_COPY_ASSIGN(Ring);
+    DISABLE_MOVE_AND_MOVE_ASSIGN(Ring);
+
+    /** Returns `true` if the ring was set up successfully. */
+    bool available() const;
+
+    /**
+     * Reads all the requested regions. Returns once all reads have
+     * completed, even on error.
+     *
+     * @param requests The regions to read.
+     * @return Status
+     */
+    Status read(const std::vector<Request>& requests);
+
+   private:
+    /** The ring file descriptor, -1 if unavailable. */
+    int ring_fd_;
+
+    /** The number of submission queue entries. */
+    uint32_t sq_entries_;
+
+    /** The mapped submission and completion rings. */
+    void* sq_ring_;
+    void* cq_ring_;
+    uint64_t sq_ring_size_;
+    uint64_t cq_ring_size_;
+
+    /** The mapped submission queue entries. */
+    void* sqes_;
+    uint64_t sqes_size_;
+
+    /** Pointers into the mapped submission ring. */
+    uint32_t* sq_head_;
+    uint32_t* sq_tail_;
+    uint32_t* sq_mask_;
+    uint32_t* sq_array_;
+
+    /** Pointers into the mapped completion ring. */
+    uint32_t* cq_head_;
+    uint32_t* cq_tail_;
+    uint32_t* cq_mask_;
+    void* cqes_;
+
+    /** Unmaps the rings and closes the ring file descriptor. */
+    void teardown();
+  };
+
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** The number of submission queue entries of each ring. */
+  const uint32_t queue_depth_;
+
+  /** Protects the ring pool. */
+  std::mutex mtx_;
+
+  /** Notified when a ring is returned to the pool. */
+  std::condition_variable cv_;
+
+  /** All the rings set up so far. */
+  std::vector<tdb_unique_ptr<Ring>> rings_;
+
+  /** The rings not used by any batch. */
+  std::vector<Ring*> idle_rings_;
+
+  /** Set when setting up a new ring failed, so that no more are tried. */
+  bool pool_full_;
+
+  /** Whether io_uring could be set up, fixed at construction. */
+  const bool available_;
+
+  /* ********************************* */
+  /*         PRIVATE METHODS           */
+  /* ********************************* */
+
+  /**
+   * Takes a ring from the pool, setting up a new one if all are in use. If
+   * a new ring cannot be set up, waits for one to be returned.
+   */
+  Ring* acquire_ring();
+
+  /** Returns a ring taken with `acquire_ring` to the pool. */
+  void release_ring(Ring* ring);
+
+  /**
+   * Sets up a new ring and adds it to the idle rings. The caller must hold
+   * `mtx_`, except during construction.
+   *
+   * @return `false` if the ring could not be set up.
+   */
+  bool add_idle_ring();
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_URING_READER_H
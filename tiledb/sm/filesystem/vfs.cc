@@ -54,14 +54,44 @@ using tiledb::common::filesystem::directory_entry;
 namespace tiledb {
 namespace sm {
 
+namespace {
+
+/** The maximum number of files whose access pattern is tracked. */
+const uint64_t read_ahead_max_tracked_uris = 4096;
+
+/** The backends of the per-backend read and write timers. */
+const std::vector<std::string> backend_names = {
+    "file", "hdfs", "memfs", "s3", "azure", "gcs"};
+
+/** Returns the index of the backend of `uri` in `backend_names`. */
+size_t backend_idx(const URI& uri) {
+  if (uri.is_hdfs())
+    return 1;
+  if (uri.is_memfs())
+    return 2;
+  if (uri.is_s3())
+    return 3;
+  if (uri.is_azure())
+    return 4;
+  if (uri.is_gcs())
+    return 5;
+  return 0;
+}
+
+}  // namespace
+
 /* ********************************* */
 /*     CONSTRUCTORS & DESTRUCTORS    */
 /* ********************************* */
 
 VFS::VFS()
     : stats_(nullptr)
+    , read_byte_num_stat_(0)
+    , read_ops_num_stat_(0)
     , init_(false)
     , read_ahead_size_(0)
+    , read_ahead_max_size_(0)
+    , read_ahead_local_(false)
     , compute_tp_(nullptr)
     , io_tp_(nullptr) {
 #ifdef HAVE_AZURE
@@ -79,6 +109,10 @@ VFS::VFS()
   supported_fs_.insert(Filesystem::MEMFS);
 }
 
+VFS::~VFS() {
+  cancelable_tasks_.cancel_all_tasks();
+}
+
 /* ********************************* */
 /*                API                */
 /* ********************************* */
@@ -416,6 +450,7 @@ Status VFS::remove_dir(const URI& uri) const {
     return LOG_STATUS(
         Status_VFSError("Cannot remove directory; VFS not "
                         "initialized"));
+  RETURN_NOT_OK(invalidate_read_ahead(uri, true));
 
   if (uri.is_file()) {
 #ifdef _WIN32
@@ -460,6 +495,7 @@ Status VFS::remove_file(const URI& uri) const {
   if (!init_)
     return LOG_STATUS(
         Status_VFSError("Cannot remove file; VFS not initialized"));
+  RETURN_NOT_OK(invalidate_read_ahead(uri, false));
 
   if (uri.is_file()) {
 #ifdef _WIN32
@@ -744,6 +780,14 @@ Status VFS::init(
     const Config* const ctx_config,
     const Config* const vfs_config) {
   stats_ = parent_stats->create_child("VFS");
+  read_byte_num_stat_ = stats_->register_stat("read_byte_num");
+  read_ops_num_stat_ = stats_->register_stat("read_ops_num");
+  for (const auto& backend : backend_names) {
+    read_backend_stats_.push_back(
+        stats_->register_histogram("read_" + backend));
+    write_backend_stats_.push_back(
+        stats_->register_histogram("write_" + backend));
+  }
 
   assert(compute_tp);
   assert(io_tp);
@@ -770,6 +814,19 @@ Status VFS::init(
       config_.get<uint64_t>("vfs.read_ahead_size", &read_ahead_size_, &found));
   assert(found);
 
+  // Store the maximum read-ahead size. The window never shrinks below the
+  // initial size, and never grows past what the cache can hold.
+  RETURN_NOT_OK(config_.get<uint64_t>(
+      "vfs.read_ahead_max_size", &read_ahead_max_size_, &found));
+  assert(found);
+  read_ahead_max_size_ = std::max(
+      read_ahead_size_, std::min(read_ahead_max_size_, read_ahead_cache_size));
+  RETURN_NOT_OK(config_.get<bool>(
+      "vfs.read_ahead_local", &read_ahead_local_, &found));
+  assert(found);
+  read_ahead_tracker_ = tdb_unique_ptr<ReadAheadTracker>(
+      tdb_new(ReadAheadTracker, read_ahead_max_tracked_uris));
+
 #ifdef HAVE_HDFS
   hdfs_ = tdb_unique_ptr<hdfs::HDFS>(tdb_new(hdfs::HDFS));
   RETURN_NOT_OK(hdfs_->init(config_));
@@ -808,6 +865,9 @@ Status VFS::init(
 }
 
 Status VFS::terminate() {
+  // Wait for the read-ahead prefetches, which reference this object.
+  cancelable_tasks_.cancel_all_tasks();
+
 #ifdef HAVE_S3
   return s3_.disconnect();
 #endif
@@ -916,6 +976,7 @@ tuple<Status, optional<std::vector<directory_entry>>> VFS::ls_with_sizes(
 Status VFS::move_file(const URI& old_uri, const URI& new_uri) {
   if (!init_)
     return LOG_STATUS(Status_VFSError("Cannot move file; VFS not initialized"));
+  RETURN_NOT_OK(invalidate_read_ahead(old_uri, false));
 
   // If new_uri exists, delete it or raise an error based on `force`
   bool is_file;
@@ -1006,6 +1067,8 @@ Status VFS::move_dir(const URI& old_uri, const URI& new_uri) {
   if (!init_)
     return LOG_STATUS(
         Status_VFSError("Cannot move directory; VFS not initialized"));
+  RETURN_NOT_OK(invalidate_read_ahead(old_uri, true));
+  RETURN_NOT_OK(invalidate_read_ahead(new_uri, true));
 
   // File
   if (old_uri.is_file()) {
@@ -1174,6 +1237,7 @@ Status VFS::copy_dir(const URI& old_uri, const URI& new_uri) {
   if (!init_)
     return LOG_STATUS(
         Status_VFSError("Cannot copy directory; VFS not initialized"));
+  RETURN_NOT_OK(invalidate_read_ahead(new_uri, true));
 
   // File
   if (old_uri.is_file()) {
@@ -1255,7 +1319,7 @@ Status VFS::read(
     void* const buffer,
     const uint64_t nbytes,
     bool use_read_ahead) {
-  stats_->add_counter("read_byte_num", nbytes);
+  stats_->add_counter(read_byte_num_stat_, nbytes);
 
   if (!init_)
     return LOG_STATUS(Status_VFSError("Cannot read; VFS not initialized"));
@@ -1323,26 +1387,34 @@ Status VFS::read_impl(
     void* const buffer,
     const uint64_t nbytes,
     const bool use_read_ahead) {
-  stats_->add_counter("read_ops_num", 1);
-
-  // We only check to use the read-ahead cache for cloud-storage
-  // backends. No-op the `use_read_ahead` to prevent the unused
-  // variable compiler warning.
-  (void)use_read_ahead;
-
-  if (uri.is_file()) {
-#ifdef _WIN32
-    return win_.read(uri.to_path(), offset, buffer, nbytes);
-#else
-    return posix_.read(uri.to_path(), offset, buffer, nbytes);
-#endif
-  }
-  if (uri.is_hdfs()) {
-#ifdef HAVE_HDFS
-    return hdfs_->read(uri, offset, buffer, nbytes);
-#else
-    return LOG_STATUS(Status_VFSError("TileDB was built without HDFS support"));
+  stats_->add_counter(read_ops_num_stat_, 1);
+  auto timer_se = stats_->start_timer(read_backend_stats_[backend_idx(uri)]);
+
+  // The backends that read exactly the requested bytes are read ahead
+  // within the file size, only if enabled: the operating system already
+  // caches local files.
+  if (uri.is_file() || uri.is_hdfs() || uri.is_memfs()) {
+#ifndef HAVE_HDFS
+    if (uri.is_hdfs())
+      return LOG_STATUS(
+          Status_VFSError("TileDB was built without HDFS support"));
 #endif
+    const auto read_fn = std::bind(
+        &VFS::read_bounded,
+        this,
+        std::placeholders::_1,
+        std::placeholders::_2,
+        std::placeholders::_3,
+        std::placeholders::_4,
+        std::placeholders::_5,
+        std::placeholders::_6);
+    return read_ahead_impl(
+        read_fn,
+        uri,
+        offset,
+        buffer,
+        nbytes,
+        use_read_ahead && read_ahead_local_);
   }
   if (uri.is_s3()) {
 #ifdef HAVE_S3
@@ -1396,14 +1468,61 @@ Status VFS::read_impl(
     return LOG_STATUS(Status_VFSError("TileDB was built without GCS support"));
 #endif
   }
-  if (uri.is_memfs()) {
-    return memfs_.read(uri.to_path(), offset, buffer, nbytes);
-  }
 
   return LOG_STATUS(
       Status_VFSError("Unsupported URI schemes: " + uri.to_string()));
 }
 
+Status VFS::read_bounded(
+    const URI& uri,
+    const off_t offset,
+    void* const buffer,
+    const uint64_t nbytes,
+    const uint64_t read_ahead_nbytes,
+    uint64_t* const nbytes_read) {
+  // Read ahead only up to the end of the file. The backend read errors out
+  // if the requested bytes exceed the file size.
+  uint64_t size = nbytes;
+  if (read_ahead_nbytes > 0) {
+    uint64_t file_size = 0;
+    if (uri.is_file()) {
+#ifdef _WIN32
+      RETURN_NOT_OK(win_.file_size(uri.to_path(), &file_size));
+#else
+      RETURN_NOT_OK(posix_.file_size(uri.to_path(), &file_size));
+#endif
+    } else if (uri.is_hdfs()) {
+#ifdef HAVE_HDFS
+      RETURN_NOT_OK(hdfs_->file_size(uri, &file_size));
+#endif
+    } else {
+      RETURN_NOT_OK(memfs_.file_size(uri.to_path(), &file_size));
+    }
+    const uint64_t offset_u64 = static_cast<uint64_t>(offset);
+    if (file_size > offset_u64 + nbytes)
+      size += std::min(read_ahead_nbytes, file_size - offset_u64 - nbytes);
+  }
+
+  if (size > 0) {
+    if (uri.is_file()) {
+#ifdef _WIN32
+      RETURN_NOT_OK(win_.read(uri.to_path(), offset, buffer, size));
+#else
+      RETURN_NOT_OK(posix_.read(uri.to_path(), offset, buffer, size));
+#endif
+    } else if (uri.is_hdfs()) {
+#ifdef HAVE_HDFS
+      RETURN_NOT_OK(hdfs_->read(uri, offset, buffer, size));
+#endif
+    } else {
+      RETURN_NOT_OK(memfs_.read(uri.to_path(), offset, buffer, size));
+    }
+  }
+
+  *nbytes_read = size;
+  return Status::Ok();
+}
+
 Status VFS::read_ahead_impl(
     const std::function<Status(
         const URI&, off_t, void*, uint64_t, uint64_t, uint64_t*)>& read_fn,
@@ -1419,37 +1538,49 @@ Status VFS::read_ahead_impl(
   if (!use_read_ahead)
     return read_fn(uri, offset, buffer, nbytes, 0, &nbytes_read);
 
+  // Size the read-ahead window after the access pattern of the file. The
+  // window grows while the file is read sequentially, and shrinks until
+  // read-ahead is disabled while the file is read randomly.
+  uint64_t window = 0;
+  uint64_t id = 0;
+  RETURN_NOT_OK(read_ahead_tracker_->access(
+      uri,
+      offset,
+      nbytes,
+      read_ahead_size_,
+      read_ahead_max_size_,
+      &window,
+      &id));
+
+  // Avoid a read if the requested buffer can be read from the
+  // read cache.
+  bool success;
+  RETURN_NOT_OK(read_ahead_cache_->read(uri, offset, buffer, nbytes, &success));
+  if (success) {
+    stats_->add_counter("read_ahead_hit_num", 1);
+    return prefetch(read_fn, uri);
+  }
+
   // Only perform a read-ahead if the requested read size
-  // is smaller than the size of the buffers in the read-ahead
-  // cache. This is because:
+  // is smaller than the read-ahead window. This is because:
   // 1. The read-ahead is primarily beneficial for IO patterns
   //    that consist of numerous small reads.
   // 2. Large reads may evict cached buffers that would be useful
   //    to a future small read.
   // 3. It saves us a copy. We must make a copy of the buffer at
   //    some point (one for the user, one for the cache).
-  if (nbytes >= read_ahead_size_)
+  if (nbytes >= window)
     return read_fn(uri, offset, buffer, nbytes, 0, &nbytes_read);
 
-  // Avoid a read if the requested buffer can be read from the
-  // read cache. Note that we intentionally do not use a read
-  // cache for local files because we rely on the operating
-  // system's file system to cache readahead data in memory.
-  // Additionally, we do not perform readahead with HDFS.
-  bool success;
-  RETURN_NOT_OK(read_ahead_cache_->read(uri, offset, buffer, nbytes, &success));
-  if (success)
-    return Status::Ok();
-
   // We will read directly into the read-ahead buffer and then copy
   // the subrange of this buffer back to the user to satisfy the
   // read request.
   Buffer ra_buffer;
-  RETURN_NOT_OK(ra_buffer.realloc(read_ahead_size_));
+  RETURN_NOT_OK(ra_buffer.realloc(window));
 
   // Calculate the exact number of bytes to populate `ra_buffer`
-  // with `read_ahead_size_` bytes.
-  const uint64_t ra_nbytes = read_ahead_size_ - nbytes;
+  // with `window` bytes.
+  const uint64_t ra_nbytes = window - nbytes;
 
   // Read into `ra_buffer`.
   RETURN_NOT_OK(
@@ -1459,13 +1590,72 @@ Status VFS::read_ahead_impl(
   assert(nbytes_read >= nbytes);
   std::memcpy(buffer, ra_buffer.data(), nbytes);
 
-  // Cache `ra_buffer` at `offset`.
+  // Cache `ra_buffer` at `offset`. A short read reached the end of the file.
   ra_buffer.set_size(nbytes_read);
-  RETURN_NOT_OK(read_ahead_cache_->insert(uri, offset, std::move(ra_buffer)));
+  RETURN_NOT_OK(read_ahead_tracker_->insert(
+      read_ahead_cache_.get(),
+      uri,
+      id,
+      offset,
+      std::move(ra_buffer),
+      nbytes_read < window,
+      false));
+
+  return prefetch(read_fn, uri);
+}
+
+Status VFS::prefetch(
+    const std::function<Status(
+        const URI&, off_t, void*, uint64_t, uint64_t, uint64_t*)>& read_fn,
+    const URI& uri) {
+  uint64_t id = 0;
+  uint64_t offset = 0;
+  uint64_t nbytes = 0;
+  bool prefetch = false;
+  RETURN_NOT_OK(read_ahead_tracker_->start_prefetch(
+      uri, &id, &offset, &nbytes, &prefetch));
+  if (!prefetch)
+    return Status::Ok();
+
+  stats_->add_counter("read_ahead_prefetch_num", 1);
+  stats_->add_counter("read_ahead_prefetch_byte_num", nbytes);
+
+  // The prefetch is best-effort: on failure the next read goes to the
+  // backend, which reports the error.
+  cancelable_tasks_.execute(
+      io_tp_,
+      [this, read_fn, uri, id, offset, nbytes]() {
+        Buffer ra_buffer;
+        uint64_t nbytes_read = 0;
+        Status st = ra_buffer.realloc(nbytes);
+        if (st.ok())
+          st = read_fn(uri, offset, ra_buffer.data(), 0, nbytes, &nbytes_read);
+        if (!st.ok()) {
+          RETURN_NOT_OK(read_ahead_tracker_->end_prefetch(uri, id));
+          return st;
+        }
+
+        ra_buffer.set_size(nbytes_read);
+        return read_ahead_tracker_->insert(
+            read_ahead_cache_.get(),
+            uri,
+            id,
+            offset,
+            std::move(ra_buffer),
+            nbytes_read < nbytes,
+            true);
+      },
+      [this, uri, id]() {
+        read_ahead_tracker_->end_prefetch(uri, id);
+      });
 
   return Status::Ok();
 }
 
+Status VFS::invalidate_read_ahead(const URI& uri, const bool is_dir) const {
+  return read_ahead_tracker_->invalidate(read_ahead_cache_.get(), uri, is_dir);
+}
+
 Status VFS::read_all(
     const URI& uri,
     const std::vector<tuple<uint64_t, Tile*, uint64_t>>& regions,
@@ -1482,6 +1672,20 @@ Status VFS::read_all(
   std::vector<BatchedRead> batches;
   RETURN_NOT_OK(compute_read_batches(regions, &batches));
 
+  // Report the requests saved by batching and the bytes read in the gaps
+  // between the batched regions.
+  uint64_t regions_nbytes = 0;
+  for (const auto& region : regions)
+    regions_nbytes += std::get<2>(region);
+  uint64_t batches_nbytes = 0;
+  for (const auto& batch : batches)
+    batches_nbytes += batch.nbytes;
+  stats_->add_counter(
+      "read_batch_saved_ops_num", regions.size() - batches.size());
+  stats_->add_counter(
+      "read_batch_wasted_byte_num",
+      batches_nbytes > regions_nbytes ? batches_nbytes - regions_nbytes : 0);
+
   // Read all the batches and copy to the original destinations.
   for (const auto& batch : batches) {
     URI uri_copy = uri;
@@ -1514,6 +1718,63 @@ Status VFS::read_all(
   return Status::Ok();
 }
 
+Status VFS::read_all(
+    const std::unordered_map<
+        URI,
+        std::vector<tuple<uint64_t, Tile*, uint64_t>>,
+        URIHasher>& all_regions,
+    ThreadPool* thread_pool,
+    std::vector<ThreadPool::Task>* tasks,
+    const bool use_read_ahead) {
+  if (!init_)
+    return LOG_STATUS(Status_VFSError("Cannot read all; VFS not initialized"));
+
+#ifndef _WIN32
+  // Submit the reads of all local files together with io_uring. There is no
+  // need to batch nearby regions, as each read is a single queue entry.
+  std::unordered_map<std::string, std::vector<tuple<uint64_t, void*, uint64_t>>>
+      local_regions;
+  if (posix_.uring_enabled()) {
+    uint64_t nbytes = 0;
+    uint64_t num_ops = 0;
+    for (const auto& [uri, regions] : all_regions) {
+      if (!uri.is_file())
+        continue;
+
+      auto& file_regions = local_regions[uri.to_path()];
+      for (const auto& region : regions) {
+        file_regions.emplace_back(
+            std::get<0>(region),
+            std::get<1>(region)->filtered_buffer().data(),
+            std::get<2>(region));
+        nbytes += std::get<2>(region);
+      }
+      num_ops += regions.size();
+    }
+
+    if (!local_regions.empty()) {
+      stats_->add_counter(read_byte_num_stat_, nbytes);
+      stats_->add_counter(read_ops_num_stat_, num_ops);
+      stats_->add_counter("read_uring_batch_num", 1);
+      tasks->push_back(thread_pool->execute(
+          [this, regions = std::move(local_regions)]() {
+            return posix_.read_batch(regions);
+          }));
+    }
+  }
+#endif
+
+  for (const auto& [uri, regions] : all_regions) {
+#ifndef _WIN32
+    if (posix_.uring_enabled() && uri.is_file())
+      continue;
+#endif
+    RETURN_NOT_OK(read_all(uri, regions, thread_pool, tasks, use_read_ahead));
+  }
+
+  return Status::Ok();
+}
+
 Status VFS::compute_read_batches(
     const std::vector<tuple<uint64_t, Tile*, uint64_t>>& regions,
     std::vector<BatchedRead>* batches) const {
@@ -1573,6 +1834,30 @@ Status VFS::compute_read_batches(
   return Status::Ok();
 }
 
+bool VFS::mmap_enabled() const {
+#ifdef _WIN32
+  return false;
+#else
+  return posix_.mmap_enabled();
+#endif
+}
+
+Status VFS::mmap(const URI& uri, shared_ptr<MmapFile>* file) const {
+  if (!init_)
+    return LOG_STATUS(Status_VFSError("Cannot mmap; VFS not initialized"));
+
+  if (!uri.is_file() || !mmap_enabled())
+    return LOG_STATUS(Status_VFSError(
+        "Cannot mmap '" + uri.to_string() +
+        "'; Memory mapping is only enabled for local files"));
+
+  auto mapped = make_shared<MmapFile>(HERE());
+  RETURN_NOT_OK(mapped->open(uri.to_path()));
+  *file = std::move(mapped);
+
+  return Status::Ok();
+}
+
 bool VFS::supports_fs(Filesystem fs) const {
   return (supported_fs_.find(fs) != supported_fs_.end());
 }
@@ -1747,6 +2032,8 @@ Status VFS::write(const URI& uri, const void* buffer, uint64_t buffer_size) {
 
   if (!init_)
     return LOG_STATUS(Status_VFSError("Cannot write; VFS not initialized"));
+  RETURN_NOT_OK(invalidate_read_ahead(uri, false));
+  auto timer_se = stats_->start_timer(write_backend_stats_[backend_idx(uri)]);
 
   if (uri.is_file()) {
 #ifdef _WIN32
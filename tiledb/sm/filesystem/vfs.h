@@ -37,6 +37,7 @@
 #include <list>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "tiledb/common/common.h"
@@ -44,9 +45,11 @@
 #include "tiledb/common/macros.h"
 #include "tiledb/common/status.h"
 #include "tiledb/sm/buffer/buffer.h"
-#include "tiledb/sm/cache/lru_cache.h"
+#include "tiledb/sm/cache/read_ahead_cache.h"
+#include "tiledb/sm/cache/read_ahead_tracker.h"
 #include "tiledb/sm/config/config.h"
 #include "tiledb/sm/filesystem/mem_filesystem.h"
+#include "tiledb/sm/filesystem/mmap_file.h"
 #include "tiledb/sm/misc/cancelable_tasks.h"
 #include "tiledb/sm/stats/stats.h"
 #include "uri.h"
@@ -96,8 +99,11 @@ class VFS {
   /** Constructor. */
   VFS();
 
-  /** Destructor. */
-  ~VFS() = default;
+  /**
+   * Destructor. Waits for the pending read-ahead prefetches, which reference
+   * this object, if `terminate()` was not called.
+   */
+  ~VFS();
 
   DISABLE_COPY_AND_COPY_ASSIGN(VFS);
   DISABLE_MOVE_AND_MOVE_ASSIGN(VFS);
@@ -262,9 +268,10 @@ class VFS {
       const Config* vfs_config);
 
   /**
-   * Terminates the virtual system. Must only be called if init() returned
-   * successfully. The behavior is undefined if not successfully invoked prior
-   * to destructing this object.
+   * Terminates the virtual system, waiting for the pending read-ahead
+   * prefetches. Must only be called if init() returned successfully. The
+   * behavior is undefined if not successfully invoked prior to destructing
+   * this object.
    *
    * @return Status
    */
@@ -359,6 +366,44 @@ class VFS {
       std::vector<ThreadPool::Task>* tasks,
       bool use_read_ahead = true);
 
+  /**
+   * Reads multiple regions from multiple files. If io_uring is enabled with
+   * `vfs.file.io_uring`, the regions of all local files are read directly
+   * into their destinations by a single task that submits all the reads at
+   * once. The regions of the other files are read as with the single-file
+   * `read_all`.
+   *
+   * @param all_regions Maps each file URI to the regions to read from it.
+   *    Each region is a tuple `(file_offset, dest_buffer, nbytes)`.
+   * @param thread_pool Thread pool to execute async read tasks to.
+   * @param tasks Vector to which new async read tasks are pushed.
+   * @param use_read_ahead Whether to use the read-ahead cache.
+   * @return Status
+   */
+  Status read_all(
+      const std::unordered_map<
+          URI,
+          std::vector<tuple<uint64_t, Tile*, uint64_t>>,
+          URIHasher>& all_regions,
+      ThreadPool* thread_pool,
+      std::vector<ThreadPool::Task>* tasks,
+      bool use_read_ahead = true);
+
+  /**
+   * Returns `true` if the tiles of local files may be read from memory maps,
+   * as enabled with `vfs.file.mmap`.
+   */
+  bool mmap_enabled() const;
+
+  /**
+   * Memory-maps a local file.
+   *
+   * @param uri The URI of the file.
+   * @param file Set to the mapped file.
+   * @return Status
+   */
+  Status mmap(const URI& uri, shared_ptr<MmapFile>* file) const;
+
   /** Checks if a given filesystem is supported. */
   bool supports_fs(Filesystem fs) const;
 
@@ -441,159 +486,6 @@ class VFS {
     std::vector<tuple<uint64_t, Tile*, uint64_t>> regions;
   };
 
-  /**
-   * Represents a sub-range of data within a URI file at a
-   * specific file offset.
-   */
-  struct ReadAheadBuffer {
-    /* ********************************* */
-    /*            CONSTRUCTORS           */
-    /* ********************************* */
-
-    /** Value Constructor. */
-    ReadAheadBuffer(const uint64_t offset, Buffer&& buffer)
-        : offset_(offset)
-        , buffer_(std::move(buffer)) {
-    }
-
-    /** Move Constructor. */
-    ReadAheadBuffer(ReadAheadBuffer&& other)
-        : offset_(other.offset_)
-        , buffer_(std::move(other.buffer_)) {
-    }
-
-    /* ********************************* */
-    /*             OPERATORS             */
-    /* ********************************* */
-
-    /** Move-Assign Operator. */
-    ReadAheadBuffer& operator=(ReadAheadBuffer&& other) {
-      offset_ = other.offset_;
-      buffer_ = std::move(other.buffer_);
-      return *this;
-    }
-
-    DISABLE_COPY_AND_COPY_ASSIGN(ReadAheadBuffer);
-
-    /* ********************************* */
-    /*             ATTRIBUTES            */
-    /* ********************************* */
-
-    /** The offset within the associated URI. */
-    uint64_t offset_;
-
-    /** The buffered data at `offset`. */
-    Buffer buffer_;
-  };
-
-  /**
-   * An LRU cache of `ReadAheadBuffer` objects keyed by a URI string.
-   */
-  class ReadAheadCache : public LRUCache<std::string, ReadAheadBuffer> {
-   public:
-    /* ********************************* */
-    /*     CONSTRUCTORS & DESTRUCTORS    */
-    /* ********************************* */
-
-    /** Constructor. */
-    ReadAheadCache(const uint64_t max_cached_buffers)
-        : LRUCache(max_cached_buffers) {
-    }
-
-    /** Destructor. */
-    virtual ~ReadAheadCache() = default;
-
-    /* ********************************* */
-    /*                API                */
-    /* ********************************* */
-
-    /**
-     * Attempts to read a buffer from the cache.
-     *
-     * @param uri The URI associated with the buffer to cache.
-     * @param offset The offset that buffer starts at within the URI.
-     * @param buffer The buffer to cache.
-     * @param nbytes The number of bytes within the buffer.
-     * @param success True if `buffer` was read from the cache.
-     * @return Status
-     */
-    Status read(
-        const URI& uri,
-        const uint64_t offset,
-        void* const buffer,
-        const uint64_t nbytes,
-        bool* const success) {
-      assert(success);
-      *success = false;
-
-      // Store the URI's string representation.
-      const std::string uri_str = uri.to_string();
-
-      // Protect access to the derived LRUCache routines.
-      std::lock_guard<std::mutex> lg(lru_mtx_);
-
-      // Check that a cached buffer exists for `uri`.
-      if (!has_item(uri_str))
-        return Status::Ok();
-
-      // Store a reference to the cached buffer.
-      const ReadAheadBuffer* const ra_buffer = get_item(uri_str);
-
-      // Check that the read offset is not below the offset of
-      // the cached buffer.
-      if (offset < ra_buffer->offset_)
-        return Status::Ok();
-
-      // Calculate the offset within the cached buffer that corresponds
-      // to the requested read offset.
-      const uint64_t offset_in_buffer = offset - ra_buffer->offset_;
-
-      // Check that both the start and end positions of the requested
-      // read range reside within the cached buffer.
-      if (offset_in_buffer + nbytes > ra_buffer->buffer_.size())
-        return Status::Ok();
-
-      // Copy the subrange of the cached buffer that satisfies the caller's
-      // read request back into their output `buffer`.
-      std::memcpy(
-          buffer,
-          static_cast<uint8_t*>(ra_buffer->buffer_.data()) + offset_in_buffer,
-          nbytes);
-
-      // Touch the item to make it the most recently used item.
-      touch_item(uri_str);
-
-      *success = true;
-      return Status::Ok();
-    }
-
-    /**
-     * Writes a cached buffer for the given uri.
-     *
-     * @param uri The URI associated with the buffer to cache.
-     * @param offset The offset that buffer starts at within the URI.
-     * @param buffer The buffer to cache.
-     * @return Status
-     */
-    Status insert(const URI& uri, const uint64_t offset, Buffer&& buffer) {
-      // Protect access to the derived LRUCache routines.
-      std::lock_guard<std::mutex> lg(lru_mtx_);
-
-      const uint64_t size = buffer.size();
-      ReadAheadBuffer ra_buffer(offset, std::move(buffer));
-      return LRUCache<std::string, ReadAheadBuffer>::insert(
-          uri.to_string(), std::move(ra_buffer), size);
-    }
-
-   private:
-    /* ********************************* */
-    /*         PRIVATE ATTRIBUTES        */
-    /* ********************************* */
-
-    // Protects LRUCache routines.
-    std::mutex lru_mtx_;
-  };
-
   /* ********************************* */
   /*         PRIVATE ATTRIBUTES        */
   /* ********************************* */
@@ -623,6 +515,18 @@ class VFS {
   /** The class stats. */
   stats::Stats* stats_;
 
+  /** The stat counting the bytes read, updated on every read. */
+  stats::StatId read_byte_num_stat_;
+
+  /** The stat counting the read operations, updated on every read. */
+  stats::StatId read_ops_num_stat_;
+
+  /** The histogram timers of the reads, one per backend. */
+  std::vector<stats::StatId> read_backend_stats_;
+
+  /** The histogram timers of the writes, one per backend. */
+  std::vector<stats::StatId> write_backend_stats_;
+
   /** The in-memory filesystem which is always supported */
   MemFilesystem memfs_;
 
@@ -632,9 +536,15 @@ class VFS {
   /** `true` if the VFS object has been initialized. */
   bool init_;
 
-  /** The byte size to read-ahead for each read. */
+  /** The initial byte size to read-ahead for the reads of a file. */
   uint64_t read_ahead_size_;
 
+  /** The maximum byte size to read-ahead for a sequential read. */
+  uint64_t read_ahead_max_size_;
+
+  /** `true` if the reads of local and in-memory files are read-ahead. */
+  bool read_ahead_local_;
+
   /** The set with the supported filesystems. */
   std::set<Filesystem> supported_fs_;
 
@@ -650,6 +560,9 @@ class VFS {
   /** The read-ahead cache. */
   tdb_unique_ptr<ReadAheadCache> read_ahead_cache_;
 
+  /** The access patterns sizing the read-ahead of each file. */
+  tdb_unique_ptr<ReadAheadTracker> read_ahead_tracker_;
+
   /* ********************************* */
   /*          PRIVATE METHODS          */
   /* ********************************* */
@@ -685,7 +598,29 @@ class VFS {
       bool use_read_ahead);
 
   /**
-   * Executes a read, using the read-ahead cache as necessary.
+   * Reads from a file whose backend reads exactly the requested bytes,
+   * reading up to `read_ahead_nbytes` more bytes before the end of the file.
+   *
+   * @param uri The URI of the file.
+   * @param offset The offset where the read begins.
+   * @param buffer The buffer to read into.
+   * @param nbytes Number of bytes to read.
+   * @param read_ahead_nbytes The number of bytes to read ahead.
+   * @param nbytes_read Set to the number of bytes read.
+   * @return Status
+   */
+  Status read_bounded(
+      const URI& uri,
+      off_t offset,
+      void* buffer,
+      uint64_t nbytes,
+      uint64_t read_ahead_nbytes,
+      uint64_t* nbytes_read);
+
+  /**
+   * Executes a read, using the read-ahead cache as necessary. The read-ahead
+   * window of the file adapts to its access pattern, and the next window of
+   * sequentially read files is prefetched asynchronously.
    *
    * @param read_fn The read routine to execute.
    * @param uri The URI of the file.
@@ -704,6 +639,29 @@ class VFS {
       const uint64_t nbytes,
       const bool use_read_ahead);
 
+  /**
+   * Prefetches the next read-ahead window of a sequentially read file on the
+   * I/O thread pool, if the cached read-ahead buffer is running out.
+   *
+   * @param read_fn The read routine to execute.
+   * @param uri The URI of the file.
+   * @return Status
+   */
+  Status prefetch(
+      const std::function<Status(
+          const URI&, off_t, void*, uint64_t, uint64_t, uint64_t*)>& read_fn,
+      const URI& uri);
+
+  /**
+   * Invalidates the read-ahead state and buffers of a file, or of all files
+   * in a directory, after they were modified.
+   *
+   * @param uri The URI of the file or directory.
+   * @param is_dir `true` if `uri` is a directory.
+   * @return Status
+   */
+  Status invalidate_read_ahead(const URI& uri, bool is_dir) const;
+
   /**
    * Retrieves the backend-specific max number of parallel operations for VFS
    * read.
@@ -49,6 +49,10 @@ ChecksumMD5Filter::ChecksumMD5Filter()
     : Filter(FilterType::FILTER_CHECKSUM_MD5) {
 }
 
+bool ChecksumMD5Filter::in_place() const {
+  return true;
+}
+
 ChecksumMD5Filter* ChecksumMD5Filter::clone_impl() const {
   return tdb_new(ChecksumMD5Filter);
 }
@@ -103,6 +103,9 @@ class ChecksumMD5Filter : public Filter {
       FilterBuffer* output,
       const Config& config) const override;
 
+  /** The data is forwarded as is, in place. */
+  bool in_place() const override;
+
  private:
   /** Returns a new clone of this filter. */
   ChecksumMD5Filter* clone_impl() const override;
@@ -49,6 +49,10 @@ ChecksumSHA256Filter::ChecksumSHA256Filter()
     : Filter(FilterType::FILTER_CHECKSUM_SHA256) {
 }
 
+bool ChecksumSHA256Filter::in_place() const {
+  return true;
+}
+
 ChecksumSHA256Filter* ChecksumSHA256Filter::clone_impl() const {
   return tdb_new(ChecksumSHA256Filter);
 }
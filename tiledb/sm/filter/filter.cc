@@ -111,6 +111,10 @@ FilterType Filter::type() const {
   return type_;
 }
 
+bool Filter::in_place() const {
+  return false;
+}
+
 void Filter::init_compression_resource_pool(uint64_t size) {
   (void)size;
 }
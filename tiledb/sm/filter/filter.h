@@ -136,6 +136,17 @@ class Filter {
       FilterBuffer* output,
       const Config& config) const = 0;
 
+  /**
+   * Returns true if this filter can run in place in both directions, i.e.
+   * with `output` a fixed allocation over the bytes of `input`. Such a
+   * filter must output exactly as many bytes as it reads, and write each
+   * output byte only after reading the input bytes up to the same offset.
+   *
+   * The pipeline uses it to run the filter over the buffer its previous
+   * stage wrote, instead of allocating another one and making another pass.
+   */
+  virtual bool in_place() const;
+
   /**
    * Initializes the filter compression resource pool if any
    *
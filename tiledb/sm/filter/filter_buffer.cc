@@ -151,6 +151,28 @@ Status FilterBuffer::set_fixed_allocation(void* buffer, uint64_t nbytes) {
   return Status::Ok();
 }
 
+Status FilterBuffer::set_in_place(const FilterBuffer* other) {
+  if (!buffers_.empty() || fixed_allocation_data_ != nullptr)
+    return LOG_STATUS(Status_FilterError(
+        "FilterBuffer error; cannot set in place: not empty."));
+  else if (read_only_)
+    return LOG_STATUS(
+        Status_FilterError("FilterBuffer error; cannot set in place: "
+                           "read-only."));
+  else if (other->buffers_.size() != 1)
+    return LOG_STATUS(
+        Status_FilterError("FilterBuffer error; cannot set in place: "
+                           "input is not a single buffer."));
+
+  const auto& input = other->buffers_.front();
+  buffers_.push_back(input.get_view(0, input.buffer()->size()));
+  fixed_allocation_data_ = buffers_.front().buffer()->data();
+  fixed_allocation_op_allowed_ = true;
+  reset_offset();
+
+  return Status::Ok();
+}
+
 Status FilterBuffer::copy_to(Buffer* dest) const {
   for (auto it = buffers_.cbegin(), ite = buffers_.cend(); it != ite; ++it) {
     Buffer* src = it->buffer();
@@ -282,11 +304,12 @@ Status FilterBuffer::write(const void* buffer, uint64_t nbytes) {
     // Write to the destination. We can't use Buffer::write() here as the
     // buffer may not own its data, and write() only works on owned buffers.
     uint64_t bytes_to_dest = std::min(bytes_avail_in_dest, bytes_left);
+    // Filters running in place write bytes back where they were read.
     uint64_t old_size = dest->size();
-    std::memcpy(
-        dest->value_ptr(current_relative_offset_),
-        (char*)buffer + src_offset,
-        bytes_to_dest);
+    void* const dest_ptr = dest->value_ptr(current_relative_offset_);
+    const char* const src_ptr = (const char*)buffer + src_offset;
+    if (dest_ptr != src_ptr)
+      std::memcpy(dest_ptr, src_ptr, bytes_to_dest);
 
     // Writing past the end (but still within the allocation) should update
     // the size accordingly.
@@ -523,11 +546,13 @@ Status FilterBuffer::append_view(
       // Normal case: append the view to the list of buffers.
       buffers_.push_back(std::move(view));
     } else {
-      // When fixed allocation is set, copy the data instead.
-      std::memcpy(
-          buffers_.front().buffer()->data(),
-          view.buffer()->data(),
-          view.buffer()->size());
+      // When fixed allocation is set, copy the data instead, unless the
+      // fixed allocation is the viewed buffer itself.
+      if (buffers_.front().buffer()->data() != view.buffer()->data())
+        std::memcpy(
+            buffers_.front().buffer()->data(),
+            view.buffer()->data(),
+            view.buffer()->size());
     }
 
     bytes_left -= bytes_from_buf;
@@ -215,6 +215,17 @@ class FilterBuffer {
    */
   Status set_fixed_allocation(void* buffer, uint64_t nbytes);
 
+  /**
+   * Sets this buffer to a fixed allocation over the bytes of `other`, which
+   * must consist of a single buffer, so that a filter running in place
+   * writes its output over its input. The underlying buffer of `other` is
+   * kept alive until this buffer is cleared.
+   *
+   * @param other Buffer whose bytes to write over
+   * @return Status
+   */
+  Status set_in_place(const FilterBuffer* other);
+
   /** Set the global offset to the given value. */
   void set_offset(uint64_t offset);
 
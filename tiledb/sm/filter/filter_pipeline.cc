@@ -46,11 +46,33 @@
 #include "tiledb/sm/stats/global_stats.h"
 #include "tiledb/sm/tile/tile.h"
 
+#include <algorithm>
+#include <cctype>
+
 using namespace tiledb::common;
 
 namespace tiledb {
 namespace sm {
 
+namespace {
+
+/**
+ * Returns true if a filter may run in place over `input`, i.e. if it is a
+ * single buffer outside of the `size` bytes at `data`, which are the
+ * caller's and must not be modified.
+ */
+bool in_place_writable(
+    const FilterBuffer& input, const void* const data, const uint64_t size) {
+  if (input.num_buffers() != 1)
+    return false;
+
+  const auto begin = static_cast<const char*>(input.buffers()[0].data());
+  const auto data_begin = static_cast<const char*>(data);
+  return begin + input.size() <= data_begin || begin >= data_begin + size;
+}
+
+}  // namespace
+
 FilterPipeline::FilterPipeline()
     : max_chunk_size_(constants::max_tile_chunk_size) {
 }
@@ -88,11 +110,13 @@ FilterPipeline& FilterPipeline::operator=(FilterPipeline&& other) {
 Status FilterPipeline::add_filter(const Filter& filter) {
   shared_ptr<Filter> copy(filter.clone());
   filters_.push_back(std::move(copy));
+  clear_filter_stats();
   return Status::Ok();
 }
 
 void FilterPipeline::clear() {
   filters_.clear();
+  clear_filter_stats();
 }
 
 tuple<Status, optional<std::vector<uint64_t>>>
@@ -151,7 +175,37 @@ FilterPipeline::get_var_chunk_sizes(
   return {Status::Ok(), std::move(chunk_offsets)};
 }
 
+shared_ptr<const std::vector<stats::StatId>>
+FilterPipeline::register_filter_stats(
+    stats::Stats* const stats, const std::string& prefix) const {
+  const uint64_t stats_uid = stats->uid();
+  {
+    std::unique_lock<std::mutex> lck(filter_stats_mtx_);
+    for (const auto& fs : filter_stats_) {
+      if (fs.stats_uid_ == stats_uid && fs.prefix_ == prefix)
+        return fs.ids_;
+    }
+  }
+
+  auto ids = make_shared<std::vector<stats::StatId>>(HERE());
+  ids->reserve(filters_.size());
+  for (const auto& f : filters_) {
+    std::string name = prefix + filter_type_str(f->type());
+    std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+    ids->push_back(stats->register_histogram(name));
+  }
+
+  // Registering is idempotent, so a concurrent registration of the same
+  // timers only adds a duplicate entry.
+  std::unique_lock<std::mutex> lck(filter_stats_mtx_);
+  if (filter_stats_.size() == max_filter_stats_num_)
+    filter_stats_.erase(filter_stats_.begin());
+  filter_stats_.push_back({stats_uid, prefix, ids});
+  return ids;
+}
+
 Status FilterPipeline::filter_chunks_forward(
+    stats::Stats* const writer_stats,
     const Tile& tile,
     Tile* const offsets_tile,
     uint32_t chunk_size,
@@ -175,6 +229,11 @@ Status FilterPipeline::filter_chunks_forward(
     }
   }
 
+  // Time each filter stage separately.
+  const auto filter_stats_ids =
+      register_filter_stats(writer_stats, "filter_");
+  const auto& filter_stats = *filter_stats_ids;
+
   // Vector storing the input and output of the final pipeline stage for each
   // chunk.
   std::vector<std::pair<FilterBufferPair, FilterBufferPair>> final_stage_io(
@@ -200,6 +259,8 @@ Status FilterPipeline::filter_chunks_forward(
     // Apply the filters sequentially.
     for (auto it = filters_.begin(), ite = filters_.end(); it != ite; ++it) {
       auto& f = *it;
+      auto timer_se =
+          writer_stats->start_timer(filter_stats[it - filters_.begin()]);
 
       // Clear and reset I/O buffers
       input_data.reset_offset();
@@ -210,6 +271,12 @@ Status FilterPipeline::filter_chunks_forward(
       output_data.clear();
       output_metadata.clear();
 
+      // Filters that can run in place write over the output of the
+      // previous stage, but never over the tile.
+      if (f->in_place() &&
+          in_place_writable(input_data, tile.data(), tile.size()))
+        RETURN_NOT_OK(output_data.set_in_place(&input_data));
+
       f->init_compression_resource_pool(compute_tp->concurrency_level());
 
       RETURN_NOT_OK(f->run_forward(
@@ -315,6 +382,7 @@ Status FilterPipeline::filter_chunks_forward(
 }
 
 Status FilterPipeline::filter_chunks_reverse(
+    stats::Stats* const reader_stats,
     Tile& tile,
     Tile* const offsets_tile,
     const std::vector<tuple<void*, uint32_t, uint32_t, uint32_t>>& input,
@@ -337,6 +405,11 @@ Status FilterPipeline::filter_chunks_reverse(
         Status_FilterError("Error incorrect unfiltered tile size allocated."));
   }
 
+  // Time each filter stage separately.
+  const auto filter_stats_ids =
+      register_filter_stats(reader_stats, "unfilter_");
+  const auto& filter_stats = *filter_stats_ids;
+
   // Run each chunk through the entire pipeline.
   auto status = parallel_for(compute_tp, 0, input.size(), [&](uint64_t i) {
     const auto& chunk_input = input[i];
@@ -347,71 +420,108 @@ Status FilterPipeline::filter_chunks_reverse(
     void* const metadata = std::get<0>(chunk_input);
     void* const chunk_data = (char*)metadata + metadata_len;
 
-    // TODO(ttd): can we instead allocate one FilterStorage per thread?
-    // or make it threadsafe?
-    FilterStorage storage;
-    FilterBuffer input_data(&storage), output_data(&storage);
-    FilterBuffer input_metadata(&storage), output_metadata(&storage);
-
-    // First filter's input is the filtered chunk data.
-    RETURN_NOT_OK(input_metadata.init(metadata, metadata_len));
-    RETURN_NOT_OK(input_data.init(chunk_data, filtered_chunk_len));
-
-    // If the pipeline is empty, just copy input to output.
-    if (filters_.empty()) {
-      void* output_chunk_buffer =
-          static_cast<char*>(tile.data()) + chunk_offsets[i];
-      RETURN_NOT_OK(input_data.copy_to(output_chunk_buffer));
-      return Status::Ok();
-    }
+    void* const output_chunk_buffer =
+        static_cast<char*>(tile.data()) + chunk_offsets[i];
+    return unfilter_chunk(
+        reader_stats,
+        filter_stats,
+        tile,
+        offsets_tile,
+        metadata,
+        metadata_len,
+        chunk_data,
+        filtered_chunk_len,
+        output_chunk_buffer,
+        orig_chunk_len,
+        compute_tp->concurrency_level(),
+        config);
+  });
 
-    // Apply the filters sequentially in reverse.
-    for (int64_t filter_idx = (int64_t)filters_.size() - 1; filter_idx >= 0;
-         filter_idx--) {
-      auto& f = filters_[filter_idx];
+  RETURN_NOT_OK(status);
 
-      // Clear and reset I/O buffers
-      input_data.reset_offset();
-      input_data.set_read_only(true);
-      input_metadata.reset_offset();
-      input_metadata.set_read_only(true);
+  return Status::Ok();
+}
 
-      output_data.clear();
-      output_metadata.clear();
+Status FilterPipeline::unfilter_chunk(
+    stats::Stats* const reader_stats,
+    const std::vector<stats::StatId>& filter_stats,
+    const Tile& tile,
+    Tile* const offsets_tile,
+    void* const metadata,
+    const uint32_t metadata_size,
+    void* const data,
+    const uint32_t data_size,
+    void* const output,
+    const uint32_t output_size,
+    const uint64_t concurrency_level,
+    const Config& config) const {
+  // TODO(ttd): can we instead allocate one FilterStorage per thread?
+  // or make it threadsafe?
+  FilterStorage storage;
+  FilterBuffer input_data(&storage), output_data(&storage);
+  FilterBuffer input_metadata(&storage), output_metadata(&storage);
+
+  // First filter's input is the filtered chunk data.
+  RETURN_NOT_OK(input_metadata.init(metadata, metadata_size));
+  RETURN_NOT_OK(input_data.init(data, data_size));
+
+  // If the pipeline is empty, just copy input to output.
+  if (filters_.empty()) {
+    RETURN_NOT_OK(input_data.copy_to(output));
+    return Status::Ok();
+  }
 
-      // Final filter: output directly into the shared output buffer.
-      bool last_filter = filter_idx == 0;
-      if (last_filter) {
-        void* output_chunk_buffer =
-            static_cast<char*>(tile.data()) + chunk_offsets[i];
-        RETURN_NOT_OK(output_data.set_fixed_allocation(
-            output_chunk_buffer, orig_chunk_len));
-      }
+  // The filter at `output_idx` writes the output chunk directly, and the
+  // filters before it, which all run in place, run over the output chunk.
+  int64_t output_idx = 0;
+  while (output_idx + 1 < (int64_t)filters_.size() &&
+         filters_[output_idx]->in_place())
+    output_idx++;
+
+  // Apply the filters sequentially in reverse.
+  for (int64_t filter_idx = (int64_t)filters_.size() - 1; filter_idx >= 0;
+       filter_idx--) {
+    auto& f = filters_[filter_idx];
+    auto timer_se = reader_stats->start_timer(filter_stats[filter_idx]);
+
+    // Clear and reset I/O buffers
+    input_data.reset_offset();
+    input_data.set_read_only(true);
+    input_metadata.reset_offset();
+    input_metadata.set_read_only(true);
+
+    output_data.clear();
+    output_metadata.clear();
+
+    if (filter_idx == output_idx) {
+      // Output directly into the shared output buffer.
+      RETURN_NOT_OK(output_data.set_fixed_allocation(output, output_size));
+    } else if (
+        filter_idx < output_idx ||
+        (f->in_place() && in_place_writable(input_data, data, data_size))) {
+      RETURN_NOT_OK(output_data.set_in_place(&input_data));
+    }
 
-      f->init_decompression_resource_pool(compute_tp->concurrency_level());
+    f->init_decompression_resource_pool(concurrency_level);
 
-      RETURN_NOT_OK(f->run_reverse(
-          tile,
-          offsets_tile,
-          &input_metadata,
-          &input_data,
-          &output_metadata,
-          &output_data,
-          config));
+    RETURN_NOT_OK(f->run_reverse(
+        tile,
+        offsets_tile,
+        &input_metadata,
+        &input_data,
+        &output_metadata,
+        &output_data,
+        config));
 
-      input_data.set_read_only(false);
-      input_metadata.set_read_only(false);
+    input_data.set_read_only(false);
+    input_metadata.set_read_only(false);
 
-      if (!last_filter) {
-        input_data.swap(output_data);
-        input_metadata.swap(output_metadata);
-        // Next input (input_buffers) now stores this output (output_buffers).
-      }
+    if (filter_idx > 0) {
+      input_data.swap(output_data);
+      input_metadata.swap(output_metadata);
+      // Next input (input_buffers) now stores this output (output_buffers).
     }
-    return Status::Ok();
-  });
-
-  RETURN_NOT_OK(status);
+  }
 
   return Status::Ok();
 }
@@ -458,6 +568,7 @@ Status FilterPipeline::run_forward(
   // 'filtered_buffer'.
   RETURN_NOT_OK_ELSE(
       filter_chunks_forward(
+          writer_stats,
           *tile,
           offsets_tile,
           chunk_size,
@@ -481,71 +592,32 @@ Status FilterPipeline::run_reverse_chunk_range(
     const uint64_t max_chunk_index,
     uint64_t concurrency_level,
     const Config& config) const {
+  // Time each filter stage separately.
+  const auto filter_stats_ids =
+      register_filter_stats(reader_stats, "unfilter_");
+  const auto& filter_stats = *filter_stats_ids;
+
   // Run each chunk through the entire pipeline.
   for (size_t i = min_chunk_index; i < max_chunk_index; i++) {
     auto& chunk = chunk_data.filtered_chunks_[i];
-    FilterStorage storage;
-    FilterBuffer input_data(&storage), output_data(&storage);
-    FilterBuffer input_metadata(&storage), output_metadata(&storage);
-
-    // First filter's input is the filtered chunk data.
-    RETURN_NOT_OK(input_metadata.init(
-        chunk.filtered_metadata_, chunk.filtered_metadata_size_));
-    RETURN_NOT_OK(
-        input_data.init(chunk.filtered_data_, chunk.filtered_data_size_));
-
-    // If the pipeline is empty, just copy input to output.
-    if (filters_.empty()) {
-      void* output_chunk_buffer =
-          static_cast<char*>(tile->data()) + chunk_data.chunk_offsets_[i];
-      RETURN_NOT_OK(input_data.copy_to(output_chunk_buffer));
-      continue;
-    }
-
-    // Apply the filters sequentially in reverse.
-    for (int64_t filter_idx = (int64_t)filters_.size() - 1; filter_idx >= 0;
-         filter_idx--) {
-      auto& f = filters_[filter_idx];
-
-      // Clear and reset I/O buffers
-      input_data.reset_offset();
-      input_data.set_read_only(true);
-      input_metadata.reset_offset();
-      input_metadata.set_read_only(true);
-
-      output_data.clear();
-      output_metadata.clear();
-
-      // Final filter: output directly into the shared output buffer.
-      bool last_filter = filter_idx == 0;
-      if (last_filter) {
-        void* output_chunk_buffer =
-            static_cast<char*>(tile->data()) + chunk_data.chunk_offsets_[i];
-        RETURN_NOT_OK(output_data.set_fixed_allocation(
-            output_chunk_buffer, chunk.unfiltered_data_size_));
-        reader_stats->add_counter(
-            "read_unfiltered_byte_num", chunk.unfiltered_data_size_);
-      }
-
-      f->init_decompression_resource_pool(concurrency_level);
-
-      RETURN_NOT_OK(f->run_reverse(
-          *tile,
-          nullptr,
-          &input_metadata,
-          &input_data,
-          &output_metadata,
-          &output_data,
-          config));
-
-      input_data.set_read_only(false);
-      input_metadata.set_read_only(false);
-
-      if (!last_filter) {
-        input_data.swap(output_data);
-        input_metadata.swap(output_metadata);
-        // Next input (input_buffers) now stores this output (output_buffers).
-      }
+    void* const output_chunk_buffer =
+        static_cast<char*>(tile->data()) + chunk_data.chunk_offsets_[i];
+    RETURN_NOT_OK(unfilter_chunk(
+        reader_stats,
+        filter_stats,
+        *tile,
+        nullptr,
+        chunk.filtered_metadata_,
+        chunk.filtered_metadata_size_,
+        chunk.filtered_data_,
+        chunk.filtered_data_size_,
+        output_chunk_buffer,
+        chunk.unfiltered_data_size_,
+        concurrency_level,
+        config));
+    if (!filters_.empty()) {
+      reader_stats->add_counter(
+          "read_unfiltered_byte_num", chunk.unfiltered_data_size_);
     }
   }
 
@@ -601,7 +673,7 @@ Status FilterPipeline::run_reverse_internal(
   reader_stats->add_counter("read_unfiltered_byte_num", total_orig_size);
 
   const Status st = filter_chunks_reverse(
-      *tile, offsets_tile, filtered_chunks, compute_tp, config);
+      reader_stats, *tile, offsets_tile, filtered_chunks, compute_tp, config);
   if (!st.ok()) {
     tile->clear_data();
     if (offsets_tile) {
@@ -715,6 +787,13 @@ bool FilterPipeline::empty() const {
 void FilterPipeline::swap(FilterPipeline& other) {
   filters_.swap(other.filters_);
   std::swap(max_chunk_size_, other.max_chunk_size_);
+  clear_filter_stats();
+  other.clear_filter_stats();
+}
+
+void FilterPipeline::clear_filter_stats() {
+  std::unique_lock<std::mutex> lck(filter_stats_mtx_);
+  filter_stats_.clear();
 }
 
 Status FilterPipeline::append_encryption_filter(
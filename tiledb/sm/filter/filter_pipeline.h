@@ -34,6 +34,8 @@
 #define TILEDB_FILTER_PIPELINE_H
 
 #include <memory>
+#include <mutex>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -340,6 +342,31 @@ class FilterPipeline {
   /** The max chunk size allowed within tiles. */
   uint32_t max_chunk_size_;
 
+  /** The filter stage timers registered on a stats instance. */
+  struct FilterStats {
+    /** The unique id of the stats instance. */
+    uint64_t stats_uid_;
+
+    /** The prefix of the timer names. */
+    std::string prefix_;
+
+    /** The timer stats, one per filter of the pipeline. */
+    shared_ptr<const std::vector<stats::StatId>> ids_;
+  };
+
+  /** The max number of registered filter stage timers kept. */
+  static constexpr size_t max_filter_stats_num_ = 8;
+
+  /** Protects `filter_stats_`. */
+  mutable std::mutex filter_stats_mtx_;
+
+  /**
+   * The filter stage timers registered by `register_filter_stats`, most
+   * recently registered last, so that each stats instance registers them
+   * once rather than once per tile.
+   */
+  mutable std::vector<FilterStats> filter_stats_;
+
   /**
    * Get the chunk offsets for a var sized tile so that integral cells are
    * within a chunk.
@@ -357,9 +384,26 @@ class FilterPipeline {
   tuple<Status, optional<std::vector<uint64_t>>> get_var_chunk_sizes(
       uint32_t chunk_size, Tile* const tile, Tile* const offsets_tile) const;
 
+  /**
+   * Registers the histogram timers of the filter stages on `stats`, named
+   * `prefix` followed by the filter type in lower case. The timers are
+   * only registered on the first call for a given stats instance and
+   * prefix, later calls return the cached ids.
+   *
+   * @param stats The stats to register the timers on.
+   * @param prefix The prefix of the timer names.
+   * @return The timer stats, one per filter of the pipeline.
+   */
+  shared_ptr<const std::vector<stats::StatId>> register_filter_stats(
+      stats::Stats* stats, const std::string& prefix) const;
+
+  /** Drops the registered filter stage timers, when the filters change. */
+  void clear_filter_stats();
+
   /**
    * Run the given buffer forward through the pipeline.
    *
+   * @param writer_stats Stats to record the filter stage timers to.
    * @param tile Current tile on which the filter pipeline is being run.
    * @param offsets_tile Current offsets tile for var sized attributes.
    * @param input buffer to process.
@@ -371,6 +415,7 @@ class FilterPipeline {
    * @return Status
    */
   Status filter_chunks_forward(
+      stats::Stats* writer_stats,
       const Tile& tile,
       Tile* const offsets_tile,
       uint32_t chunk_size,
@@ -381,6 +426,7 @@ class FilterPipeline {
   /**
    * Run the given list of chunks in reverse through the pipeline.
    *
+   * @param reader_stats Stats to record the filter stage timers to.
    * @param tile Current tile on which the filter pipeline is being run
    * @param offsets_tile Current offsets tile for var sized
    * attributes/dimensions.
@@ -392,12 +438,51 @@ class FilterPipeline {
    * @return Status
    */
   Status filter_chunks_reverse(
+      stats::Stats* reader_stats,
       Tile& tile,
       Tile* const offsets_tile,
       const std::vector<tuple<void*, uint32_t, uint32_t, uint32_t>>& input,
       ThreadPool* const compute_tp,
       const Config& config) const;
 
+  /**
+   * Runs a filtered chunk in reverse through the pipeline, into its place in
+   * the unfiltered tile.
+   *
+   * The filters that run in place are run over the output of the stage
+   * before them, when it does not alias the filtered chunk. The leading
+   * filters of the pipeline that run in place are run over the unfiltered
+   * chunk itself, which the stage before them writes directly.
+   *
+   * @param reader_stats Stats to record the filter stage timers to.
+   * @param filter_stats The filter stage timers.
+   * @param tile Current tile on which the filter pipeline is being run.
+   * @param offsets_tile Current offsets tile for var sized
+   *     attributes/dimensions.
+   * @param metadata The filtered chunk metadata.
+   * @param metadata_size The size of the filtered chunk metadata.
+   * @param data The filtered chunk data.
+   * @param data_size The size of the filtered chunk data.
+   * @param output The unfiltered chunk.
+   * @param output_size The size of the unfiltered chunk.
+   * @param concurrency_level The size of the decompression resource pools.
+   * @param config The global config.
+   * @return Status
+   */
+  Status unfilter_chunk(
+      stats::Stats* reader_stats,
+      const std::vector<stats::StatId>& filter_stats,
+      const Tile& tile,
+      Tile* const offsets_tile,
+      void* metadata,
+      uint32_t metadata_size,
+      void* data,
+      uint32_t data_size,
+      void* output,
+      uint32_t output_size,
+      uint64_t concurrency_level,
+      const Config& config) const;
+
   /**
    * The internal work routine for `run_reverse`.
    *
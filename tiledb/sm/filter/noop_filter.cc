@@ -44,6 +44,10 @@ NoopFilter::NoopFilter()
     : Filter(FilterType::FILTER_NONE) {
 }
 
+bool NoopFilter::in_place() const {
+  return true;
+}
+
 NoopFilter* NoopFilter::clone_impl() const {
   return new NoopFilter;
 }
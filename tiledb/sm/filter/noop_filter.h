@@ -77,6 +77,9 @@ class NoopFilter : public Filter {
       FilterBuffer* output,
       const Config& config) const override;
 
+  /** The filter forwards its input, in place. */
+  bool in_place() const override;
+
  private:
   /** Returns a new clone of this filter. */
   NoopFilter* clone_impl() const override;
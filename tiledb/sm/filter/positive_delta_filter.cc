@@ -177,8 +177,9 @@ Status PositiveDeltaFilter::run_forward(
   RETURN_NOT_OK(output_metadata->write(&total_num_windows, sizeof(uint32_t)));
 
   // Compress all parts.
+  std::vector<T> window;
   for (unsigned i = 0; i < num_parts; i++) {
-    RETURN_NOT_OK(encode_part<T>(&parts[i], output, output_metadata));
+    RETURN_NOT_OK(encode_part<T>(&parts[i], output, output_metadata, window));
   }
 
   return Status::Ok();
@@ -188,7 +189,8 @@ template <typename T>
 Status PositiveDeltaFilter::encode_part(
     ConstBuffer* input,
     FilterBuffer* output,
-    FilterBuffer* output_metadata) const {
+    FilterBuffer* output_metadata,
+    std::vector<T>& window) const {
   // Compute window size in bytes as a multiple of the element width
   auto input_bytes = static_cast<uint32_t>(input->size());
   uint32_t window_size = std::min(input_bytes, max_window_size_);
@@ -217,20 +219,23 @@ Status PositiveDeltaFilter::encode_part(
           output->write((char*)input->data() + input->offset(), window_nbytes));
       input->advance_offset(window_nbytes);
     } else {
-      // Encode and write the relative values to output.
-      T prev_value = input->value<T>();
+      // Encode the relative values of the window, then write them to output
+      // at once. The window is read entirely before it is written, so that
+      // the filter can run in place.
+      window.resize(window_nelts);
+      const T* values = static_cast<const T*>(input->cur_data());
+      T prev_value = values[0];
       for (uint32_t j = 0; j < window_nelts; j++) {
-        T curr_value = input->value<T>();
+        T curr_value = values[j];
         if (curr_value < prev_value)
           return LOG_STATUS(Status_FilterError(
               "Positive delta filter error: delta is not positive."));
 
-        T delta = curr_value - prev_value;
-        RETURN_NOT_OK(output->write(&delta, sizeof(T)));
-        input->advance_offset(sizeof(T));
-
+        window[j] = curr_value - prev_value;
         prev_value = curr_value;
       }
+      RETURN_NOT_OK(output->write(window.data(), window_nbytes));
+      input->advance_offset(window_nbytes);
     }
   }
 
@@ -334,6 +339,7 @@ Status PositiveDeltaFilter::run_reverse(
   output->reset_offset();
 
   // Read each window
+  std::vector<T> window;
   for (uint32_t i = 0; i < num_windows; i++) {
     uint32_t window_nbytes;
     T window_value_offset;
@@ -346,17 +352,17 @@ Status PositiveDeltaFilter::run_reverse(
       RETURN_NOT_OK(output->write(input, window_nbytes));
       input->advance_offset(window_nbytes);
     } else {
-      // Read and decode each window value.
+      // Read the window, decode it and write it at once, which also allows
+      // the filter to run in place.
       uint32_t window_nelts = window_nbytes / sizeof(T);
+      window.resize(window_nelts);
+      RETURN_NOT_OK(input->read(window.data(), window_nbytes));
       T prev_value = window_value_offset;
       for (uint32_t j = 0; j < window_nelts; j++) {
-        T delta;
-        RETURN_NOT_OK(input->read(&delta, sizeof(T)));
-        T decoded_value = prev_value + delta;
-        RETURN_NOT_OK(output->write(&decoded_value, tile_type_size));
-
-        prev_value = decoded_value;
+        prev_value += window[j];
+        window[j] = prev_value;
       }
+      RETURN_NOT_OK(output->write(window.data(), window_nbytes));
     }
   }
 
@@ -369,6 +375,10 @@ Status PositiveDeltaFilter::run_reverse(
   return Status::Ok();
 }
 
+bool PositiveDeltaFilter::in_place() const {
+  return true;
+}
+
 Status PositiveDeltaFilter::set_option_impl(
     FilterOption option, const void* value) {
   if (value == nullptr)
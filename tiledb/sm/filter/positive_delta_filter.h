@@ -111,6 +111,9 @@ class PositiveDeltaFilter : public Filter {
       FilterBuffer* output,
       const Config& config) const override;
 
+  /** Deltas are computed and applied element by element, in place. */
+  bool in_place() const override;
+
   /** Set the max window size (in bytes) to use. */
   void set_max_window_size(uint32_t max_window_size);
 
@@ -128,13 +131,15 @@ class PositiveDeltaFilter : public Filter {
    * @param input Buffer to encode
    * @param output Buffer to store encoded output.
    * @param output_metadata Buffer to store output metadata.
+   * @param window Scratch buffer for the encoded values of a window.
    * @return Status
    */
   template <typename T>
   Status encode_part(
       ConstBuffer* input,
       FilterBuffer* output,
-      FilterBuffer* output_metadata) const;
+      FilterBuffer* output_metadata,
+      std::vector<T>& window) const;
 
   /** Gets an option from this filter. */
   Status get_option_impl(FilterOption option, void* value) const override;
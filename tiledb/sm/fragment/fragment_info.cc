@@ -872,7 +872,7 @@ Status FragmentInfo::load(
   // Get the array schemas and fragment metadata.
   auto&& [st_schemas, array_schema_latest, array_schemas_all, fragment_metadata] =
       storage_manager_->load_array_schemas_and_fragment_metadata(
-          array_dir, nullptr, enc_key_);
+          array_dir, nullptr, enc_key_, {}, {});
   RETURN_NOT_OK(st_schemas);
   (void)array_schema_latest;  // Not needed here
   array_schemas_all_ = std::move(array_schemas_all.value());
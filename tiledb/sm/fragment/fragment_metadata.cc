@@ -41,6 +41,9 @@
 #include "tiledb/sm/array_schema/dimension.h"
 #include "tiledb/sm/array_schema/domain.h"
 #include "tiledb/sm/buffer/buffer.h"
+#include "tiledb/sm/cache/fragment_metadata_cache.h"
+#include "tiledb/sm/crypto/encryption_key.h"
+#include "tiledb/sm/enums/encryption_type.h"
 #include "tiledb/sm/filesystem/vfs.h"
 #include "tiledb/sm/fragment/fragment_metadata.h"
 #include "tiledb/sm/misc/constants.h"
@@ -54,7 +57,9 @@
 #include "tiledb/storage_format/uri/parse_uri.h"
 #include "tiledb/type/range/range.h"
 
+#include <atomic>
 #include <cassert>
+#include <cstring>
 #include <iostream>
 #include <numeric>
 #include <string>
@@ -65,11 +70,20 @@ using namespace tiledb::type;
 namespace tiledb {
 namespace sm {
 
+namespace {
+
+/** The tile cache id of the next fragment metadata instance. */
+std::atomic<uint64_t> next_tile_cache_id{0};
+
+}  // namespace
+
 /* ****************************** */
 /*   CONSTRUCTORS & DESTRUCTORS   */
 /* ****************************** */
 
-FragmentMetadata::FragmentMetadata() {
+FragmentMetadata::FragmentMetadata()
+    : tile_cache_id_(
+          next_tile_cache_id.fetch_add(1, std::memory_order_relaxed)) {
 }
 
 FragmentMetadata::FragmentMetadata(
@@ -88,6 +102,8 @@ FragmentMetadata::FragmentMetadata(
     , footer_size_(0)
     , footer_offset_(0)
     , fragment_uri_(fragment_uri)
+    , tile_cache_id_(
+          next_tile_cache_id.fetch_add(1, std::memory_order_relaxed))
     , has_consolidated_footer_(false)
     , last_tile_cell_num_(0)
     , has_timestamps_(has_timestamps)
@@ -111,6 +127,7 @@ FragmentMetadata::FragmentMetadata(const FragmentMetadata& other) {
   array_schema_ = other.array_schema_;
   dense_ = other.dense_;
   fragment_uri_ = other.fragment_uri_;
+  tile_cache_id_ = other.tile_cache_id_;
   timestamp_range_ = other.timestamp_range_;
   has_consolidated_footer_ = other.has_consolidated_footer_;
   rtree_ = other.rtree_;
@@ -132,6 +149,7 @@ FragmentMetadata& FragmentMetadata::operator=(const FragmentMetadata& other) {
   array_schema_ = other.array_schema_;
   dense_ = other.dense_;
   fragment_uri_ = other.fragment_uri_;
+  tile_cache_id_ = other.tile_cache_id_;
   timestamp_range_ = other.timestamp_range_;
   has_consolidated_footer_ = other.has_consolidated_footer_;
   rtree_ = other.rtree_;
@@ -710,6 +728,10 @@ const URI& FragmentMetadata::fragment_uri() const {
   return fragment_uri_;
 }
 
+uint64_t FragmentMetadata::tile_cache_id() const {
+  return tile_cache_id_;
+}
+
 bool FragmentMetadata::has_consolidated_footer() const {
   return has_consolidated_footer_;
 }
@@ -723,6 +745,15 @@ Status FragmentMetadata::get_tile_overlap(
   return Status::Ok();
 }
 
+Status FragmentMetadata::get_tile_overlap(
+    const std::vector<NDRange>& ranges,
+    std::vector<bool>& is_default,
+    std::vector<TileOverlap>* tile_overlaps) {
+  assert(version_ <= 2 || loaded_metadata_.rtree_);
+  rtree_.get_tile_overlap(ranges, is_default, tile_overlaps);
+  return Status::Ok();
+}
+
 void FragmentMetadata::compute_tile_bitmap(
     const Range& range, unsigned d, std::vector<uint8_t>* tile_bitmap) {
   assert(version_ <= 2 || loaded_metadata_.rtree_);
@@ -807,14 +838,6 @@ Status FragmentMetadata::load(
     Buffer* f_buff,
     uint64_t offset,
     std::unordered_map<std::string, shared_ptr<ArraySchema>> array_schemas) {
-  auto meta_uri = fragment_uri_.join_path(
-      std::string(constants::fragment_metadata_filename));
-  // Load the metadata file size when we are not reading from consolidated
-  // buffer
-  if (f_buff == nullptr)
-    RETURN_NOT_OK(
-        storage_manager_->vfs()->file_size(meta_uri, &meta_file_size_));
-
   // Get fragment name version
   uint32_t f_version;
   auto name = fragment_uri_.remove_trailing_slash().last_path_part();
@@ -828,8 +851,16 @@ Status FragmentMetadata::load(
   //    * __t1_t2_uuid
   //  - Version 3 corresponds to version 5 or higher
   //    * __t1_t2_uuid_version
-  if (f_version == 1)
+  if (f_version == 1) {
+    auto meta_uri = fragment_uri_.join_path(
+        std::string(constants::fragment_metadata_filename));
+    RETURN_NOT_OK(
+        storage_manager_->vfs()->file_size(meta_uri, &meta_file_size_));
     return load_v1_v2(encryption_key, array_schemas);
+  }
+
+  // Note: the metadata file size is loaded with the footer when we are not
+  // reading from consolidated buffer
   return load_v3_or_higher(encryption_key, f_buff, offset, array_schemas);
 }
 
@@ -1369,6 +1400,12 @@ tuple<Status, optional<URI>> FragmentMetadata::validity_uri(
               *encoded_name + "_validity" + constants::file_suffix)};
 }
 
+unsigned FragmentMetadata::field_idx(const std::string& name) const {
+  auto it = idx_map_.find(name);
+  assert(it != idx_map_.end());
+  return it->second;
+}
+
 const std::string& FragmentMetadata::array_schema_name() {
   return array_schema_name_;
 }
@@ -1813,6 +1850,22 @@ tuple<Status, optional<uint64_t>> FragmentMetadata::get_tile_null_count(
   return {Status::Ok(), null_count};
 }
 
+bool FragmentMetadata::tile_min_max_null_count_loaded(
+    const std::string& name) const {
+  auto it = idx_map_.find(name);
+  if (it == idx_map_.end()) {
+    return false;
+  }
+
+  auto idx = it->second;
+  if (!loaded_metadata_.tile_min_[idx] || !loaded_metadata_.tile_max_[idx]) {
+    return false;
+  }
+
+  return !array_schema_->is_nullable(name) ||
+         loaded_metadata_.tile_null_count_[idx];
+}
+
 tuple<Status, optional<std::vector<uint8_t>>> FragmentMetadata::get_min(
     const std::string& name) {
   auto it = idx_map_.find(name);
@@ -1983,6 +2036,13 @@ Status FragmentMetadata::load_rtree(const EncryptionKey& encryption_key) {
   ConstBuffer cbuff(&buff);
   RETURN_NOT_OK(rtree_.deserialize(&cbuff, &array_schema_->domain(), version_));
 
+  // Also charge the flat copy of the levels. Without budget for it, queries
+  // traverse the levels directly.
+  if (memory_tracker_ != nullptr &&
+      !memory_tracker_->take_memory(rtree_.flat_levels_size())) {
+    rtree_.free_flat_levels();
+  }
+
   loaded_metadata_.rtree_ = true;
 
   return Status::Ok();
@@ -2030,7 +2090,7 @@ uint64_t FragmentMetadata::footer_size() const {
 }
 
 Status FragmentMetadata::get_footer_offset_and_size(
-    uint64_t* offset, uint64_t* size) const {
+    uint64_t* offset, uint64_t* size, Buffer* tail) const {
   uint32_t f_version;
   auto name = fragment_uri_.remove_trailing_slash().last_path_part();
   RETURN_NOT_OK(utils::parse::get_fragment_name_version(name, &f_version));
@@ -2040,15 +2100,20 @@ Status FragmentMetadata::get_footer_offset_and_size(
   } else {
     URI fragment_metadata_uri = fragment_uri_.join_path(
         std::string(constants::fragment_metadata_filename));
-    uint64_t size_offset = meta_file_size_ - sizeof(uint64_t);
-    Buffer buff;
+    uint64_t tail_size = std::min(
+        meta_file_size_,
+        constants::fragment_metadata_footer_prefetch_size + sizeof(uint64_t));
+    if (tail_size < sizeof(uint64_t)) {
+      return LOG_STATUS(Status_FragmentMetadataError(
+          "Cannot load file footer; Fragment metadata file is too small"));
+    }
     RETURN_NOT_OK(storage_manager_->read(
-        fragment_metadata_uri, size_offset, &buff, sizeof(uint64_t)));
-    buff.reset_offset();
-    RETURN_NOT_OK(buff.read(size, sizeof(uint64_t)));
+        fragment_metadata_uri, meta_file_size_ - tail_size, tail, tail_size));
+    tail->set_offset(tail_size - sizeof(uint64_t));
+    RETURN_NOT_OK(tail->read(size, sizeof(uint64_t)));
+    tail->reset_offset();
     *offset = meta_file_size_ - *size - sizeof(uint64_t);
-    storage_manager_->stats()->add_counter(
-        "read_frag_meta_size", sizeof(uint64_t));
+    storage_manager_->stats()->add_counter("read_frag_meta_size", tail_size);
   }
 
   return Status::Ok();
@@ -4210,24 +4275,68 @@ tuple<Status, optional<Buffer>> FragmentMetadata::read_generic_tile_from_file(
   URI fragment_metadata_uri = fragment_uri_.join_path(
       std::string(constants::fragment_metadata_filename));
 
+  // The cache is shared by all the arrays of the context, so the decrypted
+  // metadata of encrypted arrays is not cached to not bypass the key check
+  auto cache = storage_manager_->fragment_metadata_cache();
+  if (encryption_key.encryption_type() != EncryptionType::NO_ENCRYPTION)
+    cache = nullptr;
+
+  if (cache != nullptr) {
+    Buffer buff;
+    bool in_cache = false;
+    RETURN_NOT_OK_TUPLE(
+        cache->read(fragment_uri_, version_, offset, &buff, &in_cache),
+        nullopt);
+    if (in_cache)
+      return {Status::Ok(), std::move(buff)};
+  }
+
   // Read metadata
   GenericTileIO tile_io(storage_manager_, fragment_metadata_uri);
   auto&& [st, buff_opt] =
       tile_io.read_generic(offset, encryption_key, storage_manager_->config());
   RETURN_NOT_OK_TUPLE(st, nullopt);
 
+  if (cache != nullptr) {
+    RETURN_NOT_OK_TUPLE(
+        cache->insert(fragment_uri_, version_, offset, *buff_opt), nullopt);
+  }
+
   return {Status::Ok(), std::move(*buff_opt)};
 }
 
 Status FragmentMetadata::read_file_footer(
-    Buffer* buff, uint64_t* footer_offset, uint64_t* footer_size) const {
+    Buffer* buff, uint64_t* footer_offset, uint64_t* footer_size) {
   URI fragment_metadata_uri = fragment_uri_.join_path(
       std::string(constants::fragment_metadata_filename));
 
-  // Get footer offset
-  RETURN_NOT_OK(get_footer_offset_and_size(footer_offset, footer_size));
-
-  storage_manager_->stats()->add_counter("read_frag_meta_size", *footer_size);
+  // The format version is not known before the footer is read, so the
+  // footer is cached with the version in the fragment name
+  auto cache = storage_manager_->fragment_metadata_cache();
+  uint32_t name_version = UINT32_MAX;
+  bool in_cache = false;
+  Buffer tail;
+  if (cache != nullptr) {
+    auto name = fragment_uri_.remove_trailing_slash().last_path_part();
+    RETURN_NOT_OK(utils::parse::get_fragment_version(name, &name_version));
+    RETURN_NOT_OK(cache->read_footer(
+        fragment_uri_,
+        name_version,
+        &meta_file_size_,
+        footer_offset,
+        buff,
+        &in_cache));
+  }
+
+  if (in_cache) {
+    *footer_size = buff->size();
+  } else {
+    // Get footer offset
+    RETURN_NOT_OK(storage_manager_->vfs()->file_size(
+        fragment_metadata_uri, &meta_file_size_));
+    RETURN_NOT_OK(
+        get_footer_offset_and_size(footer_offset, footer_size, &tail));
+  }
 
   if (memory_tracker_ != nullptr &&
       !memory_tracker_->take_memory(*footer_size)) {
@@ -4239,9 +4348,31 @@ Status FragmentMetadata::read_file_footer(
         std::to_string(memory_tracker_->get_memory_budget())));
   }
 
-  // Read footer
-  return storage_manager_->read(
-      fragment_metadata_uri, *footer_offset, buff, *footer_size);
+  if (in_cache)
+    return Status::Ok();
+
+  // Read footer, unless it was prefetched with its size
+  if (tail.size() >= *footer_size + sizeof(uint64_t)) {
+    RETURN_NOT_OK(buff->realloc(*footer_size));
+    std::memcpy(
+        buff->data(),
+        tail.data(tail.size() - sizeof(uint64_t) - *footer_size),
+        *footer_size);
+    buff->set_size(*footer_size);
+    buff->reset_offset();
+  } else {
+    storage_manager_->stats()->add_counter(
+        "read_frag_meta_size", *footer_size);
+    RETURN_NOT_OK(storage_manager_->read(
+        fragment_metadata_uri, *footer_offset, buff, *footer_size));
+  }
+
+  if (cache != nullptr) {
+    RETURN_NOT_OK(cache->insert_footer(
+        fragment_uri_, name_version, meta_file_size_, *footer_offset, *buff));
+  }
+
+  return Status::Ok();
 }
 
 Status FragmentMetadata::write_generic_tile_to_file(
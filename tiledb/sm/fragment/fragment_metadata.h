@@ -232,6 +232,14 @@ class FragmentMetadata {
   /** Returns the fragment URI. */
   const URI& fragment_uri() const;
 
+  /**
+   * Returns the id of the fragment in the keys of the tile caches. The id
+   * is unique to this metadata instance and its copies, so the cached tiles
+   * of the fragment are shared by the arrays that share its metadata, and
+   * are left to be evicted once the metadata is freed.
+   */
+  uint64_t tile_cache_id() const;
+
   /** Returns true if the metadata footer is consolidated. */
   bool has_consolidated_footer() const;
 
@@ -253,6 +261,14 @@ class FragmentMetadata {
       std::vector<bool>& is_default,
       TileOverlap* tile_overlap);
 
+  /**
+   * Retrieves the overlap of all MBRs with each of the input ND ranges.
+   */
+  Status get_tile_overlap(
+      const std::vector<NDRange>& ranges,
+      std::vector<bool>& is_default,
+      std::vector<TileOverlap>* tile_overlaps);
+
   /**
    * Compute tile bitmap for the curent fragment/range/dimension.
    */
@@ -522,6 +538,9 @@ class FragmentMetadata {
   /** Returns the validity URI of the input nullable attribute. */
   tuple<Status, optional<URI>> validity_uri(const std::string& name) const;
 
+  /** Returns the index of the input attribute/dimension in the fragment. */
+  unsigned field_idx(const std::string& name) const;
+
   /** Return the array schema name. */
   const std::string& array_schema_name();
 
@@ -678,6 +697,15 @@ class FragmentMetadata {
   tuple<Status, optional<uint64_t>> get_tile_null_count(
       const std::string& name, uint64_t tile_idx);
 
+  /**
+   * Returns true if the tile min and max values, and the tile null counts for
+   * nullable attributes, are loaded for a given attribute.
+   *
+   * @param name The input attribute.
+   * @return See above.
+   */
+  bool tile_min_max_null_count_loaded(const std::string& name) const;
+
   /**
    * Retrieves the min value for a given attribute or dimension.
    *
@@ -945,6 +973,9 @@ class FragmentMetadata {
   /** The uri of the fragment the metadata belongs to. */
   URI fragment_uri_;
 
+  /** The id of the fragment in the keys of the tile caches. */
+  uint64_t tile_cache_id_;
+
   /** True if the fragment metadata footer appears in a consolidated file. */
   bool has_consolidated_footer_;
 
@@ -1085,8 +1116,14 @@ class FragmentMetadata {
   /**
    * Retrieves the offset in the fragment metadata file of the footer
    * (which contains the generic tile offsets) along with its size.
+   *
+   * When the footer size is stored at the end of the file, it is read along
+   * with up to `constants::fragment_metadata_footer_prefetch_size` bytes
+   * before it in a single request, and these bytes are returned in `tail`.
+   * Otherwise `tail` is left empty.
    */
-  Status get_footer_offset_and_size(uint64_t* offset, uint64_t* size) const;
+  Status get_footer_offset_and_size(
+      uint64_t* offset, uint64_t* size, Buffer* tail) const;
 
   /**
    * Returns the size of the fragment metadata footer
@@ -1674,17 +1711,21 @@ class FragmentMetadata {
 
   /**
    * Reads the contents of a generic tile starting at the input offset,
-   * and stores them into buffer ``buff``.
+   * and stores them into buffer ``buff``. The contents are served from and
+   * inserted into the fragment metadata cache of the storage manager, if it
+   * is enabled and the array is not encrypted.
    */
   tuple<Status, optional<Buffer>> read_generic_tile_from_file(
       const EncryptionKey& encryption_key, uint64_t offset) const;
 
   /**
    * Reads the fragment metadata file footer (which contains the generic tile
-   * offsets) into the input buffer.
+   * offsets) into the input buffer, loading the size of the metadata file
+   * as well. The footer is served from and inserted into the fragment
+   * metadata cache of the storage manager, if it is enabled.
    */
   Status read_file_footer(
-      Buffer* buff, uint64_t* footer_offset, uint64_t* footer_size) const;
+      Buffer* buff, uint64_t* footer_offset, uint64_t* footer_size);
 
   /**
    * Writes the contents of the input buffer as a separate
@@ -89,6 +89,12 @@ const std::string array_commits_dir_name = "__commits";
 /** The fragment metadata file name. */
 const std::string fragment_metadata_filename = "__fragment_metadata.tdb";
 
+/**
+ * The number of bytes read from the end of a fragment metadata file to get
+ * the footer size, which most often also holds the whole footer.
+ */
+const uint64_t fragment_metadata_footer_prefetch_size = 16384;
+
 /** The default tile capacity. */
 const uint64_t capacity = 10000;
 
@@ -319,6 +325,21 @@ const std::string query_condition_combination_op_or_str = "OR";
 /** TILEDB_NOT Query Condition Combination Op String **/
 const std::string query_condition_combination_op_not_str = "NOT";
 
+/** TILEDB_AGGREGATE_COUNT Aggregate Op String **/
+const std::string aggregate_op_count_str = "COUNT";
+
+/** TILEDB_AGGREGATE_SUM Aggregate Op String **/
+const std::string aggregate_op_sum_str = "SUM";
+
+/** TILEDB_AGGREGATE_MIN Aggregate Op String **/
+const std::string aggregate_op_min_str = "MIN";
+
+/** TILEDB_AGGREGATE_MAX Aggregate Op String **/
+const std::string aggregate_op_max_str = "MAX";
+
+/** TILEDB_AGGREGATE_NULL_COUNT Aggregate Op String **/
+const std::string aggregate_op_null_count_str = "NULL_COUNT";
+
 /** TILEDB_COMPRESSION Filter type string */
 const std::string filter_type_compression_str = "COMPRESSION";
 
@@ -218,6 +218,12 @@ extern const std::string ignore_file_suffix;
 /** The fragment metadata file name. */
 extern const std::string fragment_metadata_filename;
 
+/**
+ * The number of bytes read from the end of a fragment metadata file to get
+ * the footer size, which most often also holds the whole footer.
+ */
+extern const uint64_t fragment_metadata_footer_prefetch_size;
+
 /** Default datatype for a generic tile. */
 extern const Datatype generic_tile_datatype;
 
@@ -305,6 +311,21 @@ extern const std::string query_condition_combination_op_or_str;
 /** TILEDB_NOT Query Condition Combination Op String **/
 extern const std::string query_condition_combination_op_not_str;
 
+/** TILEDB_AGGREGATE_COUNT Aggregate Op String **/
+extern const std::string aggregate_op_count_str;
+
+/** TILEDB_AGGREGATE_SUM Aggregate Op String **/
+extern const std::string aggregate_op_sum_str;
+
+/** TILEDB_AGGREGATE_MIN Aggregate Op String **/
+extern const std::string aggregate_op_min_str;
+
+/** TILEDB_AGGREGATE_MAX Aggregate Op String **/
+extern const std::string aggregate_op_max_str;
+
+/** TILEDB_AGGREGATE_NULL_COUNT Aggregate Op String **/
+extern const std::string aggregate_op_null_count_str;
+
 /** TILEDB_COMPRESSION Filter type string */
 extern const std::string filter_type_compression_str;
 
@@ -35,10 +35,17 @@
 #define TILEDB_HILBERT_H
 
 #include <sys/types.h>
+#include <array>
+#include <cassert>
 #include <cmath>
+#include <cstdint>
 #include <cstdlib>
 #include <iostream>
 
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
 namespace tiledb {
 namespace sm {
 
@@ -129,6 +136,7 @@ class Hilbert {
       , dim_num_(dim_num) {
     assert(dim_num >= 0 && dim_num < HC_MAX_DIM);
     assert(bits * dim_num <= int(sizeof(uint64_t) * 8 - 1));
+    init_deposit_masks();
   }
 
   /**
@@ -141,6 +149,7 @@ class Hilbert {
       : dim_num_(dim_num) {
     assert(dim_num >= 0 && dim_num < HC_MAX_DIM);
     bits_ = (sizeof(uint64_t) * 8 - 1) / dim_num_;
+    init_deposit_masks();
   }
 
   /** Destructor. */
@@ -174,18 +183,43 @@ class Hilbert {
     axes_to_transpose(coords, bits_, dim_num_);
 
     // Convert the hilbert transpose form into an int64_t hilbert value
-    uint64_t c = 1;  // This is a bit shifted from right to left over coords[i]
-    uint64_t h = 1;  // This is a bit shifted from right to left over hilbert
-    for (int j = 0; j < bits_; ++j, c <<= 1) {
-      for (int i = dim_num_ - 1; i >= 0; --i, h <<= 1) {
-        if (coords[i] & c)
-          ret |= h;
-      }
-    }
+    ret = transpose_to_hilbert(coords);
 
     return ret;
   }
 
+  /**
+   * Converts the coordinates of a batch of cells to Hilbert values. This
+   * is equivalent to calling `coords_to_hilbert` on every cell, but the
+   * loops are specialized for 2 to 4 dimensions and the input coordinates
+   * are left untouched.
+   *
+   * @param coords The coordinates to be converted, one array of `num`
+   *     values per dimension.
+   * @param num The number of cells.
+   * @param hilbert The output Hilbert values, `num` of them.
+   * @return void
+   */
+  void coords_to_hilbert(
+      const uint64_t* const* coords, uint64_t num, uint64_t* hilbert) {
+    assert(coords != nullptr);
+    assert(hilbert != nullptr);
+    switch (dim_num_) {
+      case 2:
+        coords_to_hilbert<2>(coords, num, hilbert);
+        break;
+      case 3:
+        coords_to_hilbert<3>(coords, num, hilbert);
+        break;
+      case 4:
+        coords_to_hilbert<4>(coords, num, hilbert);
+        break;
+      default:
+        coords_to_hilbert<0>(coords, num, hilbert);
+        break;
+    }
+  }
+
   /**
    * Converts a Hilbert value into a set of coordinates.
    *
@@ -223,11 +257,92 @@ class Hilbert {
   int bits_;
   /** Number of dimensions. */
   int dim_num_;
+  /**
+   * The bits of the Hilbert value holding the transpose bits of each
+   * dimension, for depositing them with PDEP.
+   */
+  std::array<uint64_t, HC_MAX_DIM> deposit_masks_;
 
   /* ********************************* */
   /*           PRIVATE METHODS         */
   /* ********************************* */
 
+  /**
+   * Computes `deposit_masks_`. Bit `j` of the transpose of dimension `i`
+   * goes to bit `j * dim_num_ + dim_num_ - 1 - i` of the Hilbert value.
+   */
+  void init_deposit_masks() {
+    deposit_masks_.fill(0);
+    for (int i = 0; i < dim_num_; ++i) {
+      for (int j = 0; j < bits_; ++j)
+        deposit_masks_[i] |= (uint64_t)1 << (j * dim_num_ + dim_num_ - 1 - i);
+    }
+  }
+
+  /**
+   * Returns the table spreading the bits of a byte `n` bits apart, i.e.
+   * bit `k` of the index is bit `k * n` of the entry.
+   *
+   * @param n Number of dimensions.
+   */
+  static const uint64_t* spread_table(int n) {
+    static const auto tables = [] {
+      std::array<std::array<uint64_t, 256>, HC_MAX_DIM> tables{};
+      for (int d = 1; d < HC_MAX_DIM; ++d) {
+        for (int b = 0; b < 256; ++b) {
+          for (int k = 0; k < 8 && k * d < 64; ++k) {
+            if (b & (1 << k))
+              tables[d][b] |= (uint64_t)1 << (k * d);
+          }
+        }
+      }
+      return tables;
+    }();
+    return tables[n].data();
+  }
+
+  /**
+   * Interleaves the bits of the transpose form of a Hilbert value into the
+   * Hilbert value, one instruction per dimension with BMI2 or one table
+   * lookup per byte of every dimension otherwise.
+   *
+   * @param X The transpose form of the Hilbert value.
+   * @return The Hilbert value.
+   */
+  uint64_t transpose_to_hilbert(const uint64_t* X) const {
+    uint64_t ret = 0;
+#if defined(__BMI2__)
+    for (int i = 0; i < dim_num_; ++i)
+      ret |= _pdep_u64(X[i], deposit_masks_[i]);
+#else
+    const uint64_t* spread = spread_table(dim_num_);
+    const uint64_t mask = ((uint64_t)1 << bits_) - 1;
+    for (int i = 0; i < dim_num_; ++i) {
+      uint64_t x = X[i] & mask;
+      for (int s = dim_num_ - 1 - i; x != 0; x >>= 8, s += 8 * dim_num_)
+        ret |= spread[x & 255] << s;
+    }
+#endif
+    return ret;
+  }
+
+  /**
+   * Implements the batched `coords_to_hilbert`, for `N` dimensions, or
+   * `dim_num_` dimensions if `N` is zero.
+   */
+  template <int N>
+  void coords_to_hilbert(
+      const uint64_t* const* coords, uint64_t num, uint64_t* hilbert) {
+    const int n = N > 0 ? N : dim_num_;
+    uint64_t X[HC_MAX_DIM];
+    for (uint64_t c = 0; c < num; ++c) {
+      for (int i = 0; i < n; ++i)
+        X[i] = coords[i][c];
+      axes_to_transpose(X, bits_, n);
+      hilbert[c] = transpose_to_hilbert(X);
+    }
+  }
+
   /**
    * From John Skilling's work. It converts the input coordinates
    * to what is called the transpose of the Hilbert value. This is done
@@ -262,19 +377,17 @@ class Hilbert {
     uint64_t P, Q, t;
     int i;
 
-    // Inverse undo
+    // Inverse undo. The coordinate bits are close to random, so instead of
+    // branching on them both the invert and the exchange are masked.
     for (Q = (uint64_t)1 << (b - 1); Q > 1; Q >>= 1) {
       P = Q - 1;
-      if (X[0] & Q)  // invert
-        X[0] ^= P;
-      for (i = 1; i < n; i++)
-        if (X[i] & Q)  // invert
-          X[0] ^= P;
-        else {  // exchange
-          t = (X[0] ^ X[i]) & P;
-          X[0] ^= t;
-          X[i] ^= t;
-        }
+      X[0] ^= P & ((uint64_t)0 - ((X[0] & Q) != 0));  // invert
+      for (i = 1; i < n; i++) {
+        const uint64_t invert = (uint64_t)0 - ((X[i] & Q) != 0);
+        t = (X[0] ^ X[i]) & P & ~invert;  // exchange
+        X[0] ^= (P & invert) ^ t;
+        X[i] ^= t;
+      }
     }
 
     // Gray encode (inverse of decode)
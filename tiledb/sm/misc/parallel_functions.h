@@ -352,6 +352,94 @@ Status parallel_for_2d(
   return return_st;
 }
 
+/**
+ * Sort the given elements on an unsigned integer key of `key_bits` bits, with
+ * a parallel least significant digit radix sort. The sort is stable.
+ *
+ * Each pass counts the digits of contiguous chunks of the elements in
+ * parallel, then scatters every chunk to its own offsets within the digit
+ * buckets. Passes where all elements share the same digit are skipped.
+ *
+ * @tparam T Element type
+ * @tparam DigitT Function type, `digit(e, shift)` returning the key of
+ *     element `e` shifted right by `shift` bits (the bits above the digit
+ *     are masked out by the sort).
+ * @param tp The threadpool to use.
+ * @param v The elements to sort.
+ * @param key_bits The number of bits of the keys.
+ * @param digit Key accessor.
+ * @return Status
+ */
+template <typename T, typename DigitT>
+Status parallel_radix_sort(
+    ThreadPool* const tp,
+    std::vector<T>& v,
+    const uint64_t key_bits,
+    const DigitT& digit) {
+  assert(tp);
+
+  const uint64_t n = v.size();
+  if (n <= 1 || key_bits == 0)
+    return Status::Ok();
+
+  // Spread the key bits evenly over passes of at most 11 bits, so that the
+  // counts of a chunk fit in the L1 cache.
+  const uint64_t max_digit_bits = 11;
+  const uint64_t pass_num = (key_bits + max_digit_bits - 1) / max_digit_bits;
+  const uint64_t digit_bits = (key_bits + pass_num - 1) / pass_num;
+  const uint64_t bucket_num = uint64_t(1) << digit_bits;
+  const uint64_t mask = bucket_num - 1;
+
+  // Give every thread a chunk, unless the chunks would become so small
+  // that counting the buckets dominates.
+  const uint64_t min_chunk_len = 16 * bucket_num;
+  const uint64_t chunk_num = std::max<uint64_t>(
+      1, std::min<uint64_t>(tp->concurrency_level(), n / min_chunk_len));
+  const uint64_t chunk_len = (n + chunk_num - 1) / chunk_num;
+
+  std::vector<T> tmp(n);
+  std::vector<uint64_t> offsets(chunk_num * bucket_num);
+  for (uint64_t shift = 0; shift < key_bits; shift += digit_bits) {
+    // Count the digits of each chunk.
+    std::fill(offsets.begin(), offsets.end(), 0);
+    RETURN_NOT_OK(parallel_for(tp, 0, chunk_num, [&](uint64_t c) {
+      auto counts = &offsets[c * bucket_num];
+      const uint64_t end = std::min(n, (c + 1) * chunk_len);
+      for (uint64_t i = c * chunk_len; i < end; ++i)
+        ++counts[digit(v[i], shift) & mask];
+      return Status::Ok();
+    }));
+
+    // Compute the offset of each chunk in each bucket, skipping the pass if
+    // a single bucket holds every element.
+    bool skip = false;
+    uint64_t offset = 0;
+    for (uint64_t b = 0; b < bucket_num && !skip; ++b) {
+      const uint64_t bucket_start = offset;
+      for (uint64_t c = 0; c < chunk_num; ++c) {
+        const uint64_t count = offsets[c * bucket_num + b];
+        offsets[c * bucket_num + b] = offset;
+        offset += count;
+      }
+      skip = offset - bucket_start == n;
+    }
+    if (skip)
+      continue;
+
+    // Scatter the chunks into the buckets.
+    RETURN_NOT_OK(parallel_for(tp, 0, chunk_num, [&](uint64_t c) {
+      auto chunk_offsets = &offsets[c * bucket_num];
+      const uint64_t end = std::min(n, (c + 1) * chunk_len);
+      for (uint64_t i = c * chunk_len; i < end; ++i)
+        tmp[chunk_offsets[digit(v[i], shift) & mask]++] = v[i];
+      return Status::Ok();
+    }));
+    v.swap(tmp);
+  }
+
+  return Status::Ok();
+}
+
 }  // namespace sm
 }  // namespace tiledb
 
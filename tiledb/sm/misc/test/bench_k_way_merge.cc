@@ -0,0 +1,214 @@
+/**
+ * @file   bench_k_way_merge.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Benchmarks the k-way merge strategies of the sparse global order reader
+ * over 10, 100 and 1000 sorted inputs (fragments): the serial merge on a
+ * binary heap, and the merge of key ranges split by sampled splitters in
+ * parallel.
+ *
+ * Usage: bench_k_way_merge [concurrency_level]
+ */
+
+#include "tiledb/sm/misc/parallel_functions.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <queue>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace tiledb::common;
+using namespace tiledb::sm;
+
+namespace {
+
+/** Total number of cells to merge. */
+const uint64_t cell_num = 1 << 22;
+
+/** 2D coordinates, compared in row-major order. */
+struct Cell {
+  uint32_t row_;
+  uint32_t col_;
+};
+
+/** A cell of an input. */
+struct Cursor {
+  const Cell* cell_;
+  uint64_t input_;
+};
+
+/** Comparator, `true` if `a` comes after `b`. */
+struct CursorCmp {
+  bool operator()(const Cursor& a, const Cursor& b) const {
+    if (a.cell_->row_ != b.cell_->row_)
+      return a.cell_->row_ > b.cell_->row_;
+    return a.cell_->col_ > b.cell_->col_;
+  }
+};
+
+/** Creates the sorted inputs. */
+std::vector<std::vector<Cell>> make_inputs(uint64_t input_num) {
+  std::mt19937 gen(0);
+  std::uniform_int_distribution<uint32_t> dist(0, 1 << 16);
+  std::vector<std::vector<Cell>> inputs(input_num);
+  for (auto& input : inputs) {
+    input.resize(cell_num / input_num);
+    for (auto& c : input)
+      c = {dist(gen), dist(gen)};
+    std::sort(input.begin(), input.end(), [](const Cell& a, const Cell& b) {
+      return CursorCmp()({&b, 0}, {&a, 0});
+    });
+  }
+
+  return inputs;
+}
+
+/** Merges [begin, end) of each input into `out` with a binary heap. */
+void merge_heap(
+    const std::vector<std::vector<Cell>>& inputs,
+    const std::vector<uint64_t>& begin,
+    const std::vector<uint64_t>& end,
+    std::vector<const Cell*>& out) {
+  std::priority_queue<Cursor, std::vector<Cursor>, CursorCmp> heap;
+  for (uint64_t i = 0; i < inputs.size(); i++) {
+    if (begin[i] < end[i])
+      heap.push({&inputs[i][begin[i]], i});
+  }
+
+  while (!heap.empty()) {
+    auto c = heap.top();
+    heap.pop();
+    out.emplace_back(c.cell_);
+    if (++c.cell_ != inputs[c.input_].data() + end[c.input_])
+      heap.push(c);
+  }
+}
+
+/** Merges key ranges split by sampled splitters in parallel. */
+void merge_parallel(
+    ThreadPool* tp,
+    const std::vector<std::vector<Cell>>& inputs,
+    std::vector<const Cell*>& out) {
+  const uint64_t input_num = inputs.size();
+  const uint64_t range_num = tp->concurrency_level();
+  const auto before = [](const Cell& a, const Cell& b) {
+    return CursorCmp()({&b, 0}, {&a, 0});
+  };
+
+  // Sample splitters.
+  std::vector<Cell> samples;
+  for (const auto& input : inputs) {
+    uint64_t sample_num = std::clamp<uint64_t>(
+        range_num * 16 / input_num, 1, input.size());
+    for (uint64_t s = 0; s < sample_num; s++)
+      samples.emplace_back(input[s * input.size() / sample_num]);
+  }
+  std::sort(samples.begin(), samples.end(), before);
+
+  // Range bounds per input.
+  std::vector<std::vector<uint64_t>> bounds(
+      range_num + 1, std::vector<uint64_t>(input_num));
+  for (uint64_t i = 0; i < input_num; i++) {
+    bounds[range_num][i] = inputs[i].size();
+    for (uint64_t r = 1; r < range_num; r++) {
+      const auto& splitter = samples[r * samples.size() / range_num];
+      bounds[r][i] = std::lower_bound(
+                         inputs[i].begin() + bounds[r - 1][i],
+                         inputs[i].end(),
+                         splitter,
+                         before) -
+                     inputs[i].begin();
+    }
+  }
+
+  // Merge and concatenate.
+  std::vector<std::vector<const Cell*>> range_out(range_num);
+  auto st = parallel_for(tp, 0, range_num, [&](uint64_t r) {
+    merge_heap(inputs, bounds[r], bounds[r + 1], range_out[r]);
+    return Status::Ok();
+  });
+  if (!st.ok())
+    std::cerr << st.to_string() << std::endl;
+
+  for (const auto& o : range_out)
+    out.insert(out.end(), o.begin(), o.end());
+}
+
+/** Runs `f` and prints its timing. */
+template <class F>
+void run(const std::string& name, uint64_t input_num, const F& f) {
+  std::vector<const Cell*> out;
+  out.reserve(cell_num);
+
+  // Warm up.
+  f(out);
+
+  const int reps = 5;
+  const auto start = std::chrono::steady_clock::now();
+  for (int r = 0; r < reps; ++r) {
+    out.clear();
+    f(out);
+  }
+  const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                      std::chrono::steady_clock::now() - start)
+                      .count() /
+                  static_cast<double>(reps);
+
+  std::cout << name << " [" << input_num << " inputs]: " << ms << " ms"
+            << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const size_t concurrency_level =
+      argc > 1 ? std::stoul(argv[1]) :
+                 std::max(1u, std::thread::hardware_concurrency());
+  ThreadPool tp(concurrency_level);
+
+  for (uint64_t input_num : {10, 100, 1000}) {
+    const auto inputs = make_inputs(input_num);
+    std::vector<uint64_t> begin(input_num, 0);
+    std::vector<uint64_t> end(input_num);
+    for (uint64_t i = 0; i < input_num; i++)
+      end[i] = inputs[i].size();
+
+    run("serial merge", input_num, [&](std::vector<const Cell*>& out) {
+      merge_heap(inputs, begin, end, out);
+    });
+    run("parallel key ranges", input_num, [&](std::vector<const Cell*>& out) {
+      merge_parallel(&tp, inputs, out);
+    });
+  }
+
+  return 0;
+}
@@ -0,0 +1,256 @@
+/**
+ * @file   bench_parallel_functions.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Benchmarks the `parallel_functions.h` routines on each `ThreadPool`
+ * scheduling strategy.
+ *
+ * Usage: bench_parallel_functions [concurrency_level]
+ */
+
+#include "tiledb/sm/misc/parallel_functions.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace tiledb::common;
+using namespace tiledb::sm;
+
+namespace {
+
+/** A small unit of CPU work. */
+uint64_t work(uint64_t i) {
+  uint64_t x = i;
+  for (int k = 0; k < 64; ++k)
+    x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+  return x;
+}
+
+/** A flat `parallel_for` over many small iterations. */
+void flat_parallel_for(ThreadPool* tp) {
+  const uint64_t n = 1 << 22;
+  std::vector<uint64_t> out(n);
+  auto st = parallel_for(tp, 0, n, [&](uint64_t i) {
+    out[i] = work(i);
+    return Status::Ok();
+  });
+  if (!st.ok())
+    std::cerr << st.to_string() << std::endl;
+}
+
+/**
+ * Nested `parallel_for`s, as in unfiltering tiles (inner) for each
+ * fragment (outer).
+ */
+void nested_parallel_for(ThreadPool* tp) {
+  const uint64_t outer = 64;
+  const uint64_t inner = 1 << 16;
+  std::vector<uint64_t> out(outer * inner);
+  auto st = parallel_for(tp, 0, outer, [&](uint64_t i) {
+    return parallel_for(tp, 0, inner, [&](uint64_t j) {
+      out[i * inner + j] = work(j);
+      return Status::Ok();
+    });
+  });
+  if (!st.ok())
+    std::cerr << st.to_string() << std::endl;
+}
+
+/** A `parallel_for_2d`, as in unfiltering tile chunk ranges. */
+void parallel_for_2d_chunks(ThreadPool* tp) {
+  const uint64_t tiles = 256;
+  const uint64_t ranges = 64;
+  std::vector<uint64_t> out(tiles * ranges);
+  auto st =
+      parallel_for_2d(tp, 0, tiles, 0, ranges, [&](uint64_t i, uint64_t j) {
+        uint64_t x = 0;
+        for (uint64_t k = 0; k < 256; ++k)
+          x += work(i * ranges + j + k);
+        out[i * ranges + j] = x;
+        return Status::Ok();
+      });
+  if (!st.ok())
+    std::cerr << st.to_string() << std::endl;
+}
+
+/** A `parallel_sort` of random integers. */
+void sort(ThreadPool* tp) {
+  std::mt19937_64 gen(0);
+  std::vector<uint64_t> v(1 << 22);
+  for (auto& x : v)
+    x = gen();
+  parallel_sort(tp, v.begin(), v.end());
+}
+
+/** Random 2D coordinates, sorted by their positions in the benchmarks. */
+struct Coords2D {
+  Coords2D() {
+    std::mt19937_64 gen(0);
+    std::uniform_int_distribution<int32_t> dist(-(1 << 20), 1 << 20);
+    d1_.resize(1 << 22);
+    d2_.resize(1 << 22);
+    for (size_t i = 0; i < d1_.size(); ++i) {
+      d1_[i] = dist(gen);
+      d2_[i] = dist(gen);
+    }
+  }
+
+  std::vector<int32_t> d1_;
+  std::vector<int32_t> d2_;
+};
+const Coords2D coords_2d;
+
+/**
+ * A `parallel_sort` of cell positions with a comparator that reads the
+ * coordinates of every dimension, as in sorting unordered writes.
+ */
+void positions_sort(ThreadPool* tp) {
+  std::vector<uint64_t> pos(coords_2d.d1_.size());
+  for (uint64_t i = 0; i < pos.size(); ++i)
+    pos[i] = i;
+  const auto& d1 = coords_2d.d1_;
+  const auto& d2 = coords_2d.d2_;
+  parallel_sort(tp, pos.begin(), pos.end(), [&](uint64_t a, uint64_t b) {
+    return d1[a] < d1[b] || (d1[a] == d1[b] && d2[a] < d2[b]);
+  });
+}
+
+/**
+ * A `parallel_radix_sort` of the same cell positions on keys packing the
+ * order-preserving coordinates of every dimension.
+ */
+void positions_radix_sort(ThreadPool* tp) {
+  struct Cell {
+    uint64_t key_;
+    uint64_t pos_;
+  };
+  std::vector<Cell> cells(coords_2d.d1_.size());
+  const uint64_t offset = 1 << 20;
+  for (uint64_t i = 0; i < cells.size(); ++i) {
+    cells[i].key_ = (coords_2d.d1_[i] + offset) << 21 |
+                    (coords_2d.d2_[i] + offset);
+    cells[i].pos_ = i;
+  }
+  auto st = parallel_radix_sort(
+      tp, cells, 42, [](const Cell& c, uint64_t shift) {
+        return c.key_ >> shift;
+      });
+  if (!st.ok())
+    std::cerr << st.to_string() << std::endl;
+}
+
+/** Runs `f` on a fresh pool and prints its timing and task statistics. */
+template <class F>
+void run(
+    const std::string& name,
+    const size_t concurrency_level,
+    const ThreadPool::Scheduling scheduling,
+    const std::vector<CpuAffinity>& affinity,
+    const F& f) {
+  ThreadPool tp(concurrency_level, scheduling, affinity);
+
+  // Warm up.
+  f(&tp);
+
+  const int reps = 5;
+  const auto start = std::chrono::steady_clock::now();
+  for (int r = 0; r < reps; ++r)
+    f(&tp);
+  const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                      std::chrono::steady_clock::now() - start)
+                      .count() /
+                  static_cast<double>(reps);
+
+  const auto stats = tp.task_stats();
+  std::cout << name << " ["
+            << (scheduling == ThreadPool::Scheduling::WorkStealing ?
+                    "work stealing" :
+                    "shared queue")
+            << "]: " << ms << " ms, " << stats.executed_num_ << " tasks, "
+            << stats.stolen_num_ << " stolen, max queue depth "
+            << stats.max_queue_depth_ << ", idle "
+            << stats.idle_time_ns_ / 1000000 << " ms";
+  if (stats.node_executed_num_.size() > 1) {
+    std::cout << ", tasks per NUMA node";
+    for (auto num : stats.node_executed_num_)
+      std::cout << " " << num;
+  }
+  std::cout << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const size_t concurrency_level =
+      argc > 1 ? std::stoul(argv[1]) :
+                 std::max(1u, std::thread::hardware_concurrency());
+
+  // Pass "numa" as the second argument to pin each worker to a NUMA node.
+  const bool numa_aware = argc > 2 && std::string(argv[2]) == "numa";
+  const auto affinity =
+      numa_aware ? worker_affinities(available_cpus(), true) :
+                   std::vector<CpuAffinity>();
+
+  for (auto scheduling :
+       {ThreadPool::Scheduling::SharedQueue,
+        ThreadPool::Scheduling::WorkStealing}) {
+    run("parallel_for",
+        concurrency_level,
+        scheduling,
+        affinity,
+        flat_parallel_for);
+    run("nested parallel_for",
+        concurrency_level,
+        scheduling,
+        affinity,
+        nested_parallel_for);
+    run("parallel_for_2d",
+        concurrency_level,
+        scheduling,
+        affinity,
+        parallel_for_2d_chunks);
+    run("parallel_sort", concurrency_level, scheduling, affinity, sort);
+    run("parallel_sort of positions",
+        concurrency_level,
+        scheduling,
+        affinity,
+        positions_sort);
+    run("parallel_radix_sort of positions",
+        concurrency_level,
+        scheduling,
+        affinity,
+        positions_radix_sort);
+  }
+
+  return 0;
+}
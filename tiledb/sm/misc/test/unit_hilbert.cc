@@ -33,6 +33,9 @@
 #include "catch.hpp"
 #include "tiledb/sm/misc/hilbert.h"
 
+#include <random>
+#include <vector>
+
 using namespace tiledb::sm;
 
 TEST_CASE("Hilbert: Test 2D", "[hilbert][2D]") {
@@ -89,4 +92,29 @@ TEST_CASE("Hilbert: Test default bits, getter", "[hilbert][bits][getter]") {
   Hilbert h(3);
   CHECK(h.bits() == 21);
   CHECK(h.dim_num() == 3);
-}
\ No newline at end of file
+}
+TEST_CASE("Hilbert: Test batch", "[hilbert][batch]") {
+  auto dim_num = GENERATE(2, 3, 4, 5, 9);
+  Hilbert h(dim_num);
+  const uint64_t max_val = ((uint64_t)1 << h.bits()) - 1;
+  const uint64_t num = 1000;
+
+  std::mt19937_64 gen(dim_num);
+  std::vector<std::vector<uint64_t>> coords(dim_num);
+  std::vector<const uint64_t*> dim_coords(dim_num);
+  for (int d = 0; d < dim_num; ++d) {
+    coords[d].resize(num);
+    for (auto& c : coords[d])
+      c = gen() & max_val;
+    dim_coords[d] = coords[d].data();
+  }
+
+  std::vector<uint64_t> values(num);
+  h.coords_to_hilbert(&dim_coords[0], num, &values[0]);
+  for (uint64_t c = 0; c < num; ++c) {
+    std::vector<uint64_t> cell(dim_num);
+    for (int d = 0; d < dim_num; ++d)
+      cell[d] = coords[d][c];
+    CHECK(values[c] == h.coords_to_hilbert(&cell[0]));
+  }
+}
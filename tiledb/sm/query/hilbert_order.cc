@@ -34,6 +34,31 @@
 
 namespace tiledb::sm::hilbert_order {
 
+namespace {
+/**
+ * Implements the batched `map_to_uint64` for datatype `T`, with the same
+ * arithmetic as `Dimension::map_to_uint64_2`.
+ */
+template <class T>
+void map_fixed_to_uint64(
+    const Dimension& dim,
+    const void* coords,
+    uint64_t num,
+    uint64_t max_bucket_val,
+    uint64_t* out) {
+  assert(!dim.domain().empty());
+
+  double dom_start_T = *(const T*)dim.domain().start_fixed();
+  double dom_end_T = *(const T*)dim.domain().end_fixed();
+  auto dom_range_T = dom_end_T - dom_start_T;
+  auto coords_T = static_cast<const T*>(coords);
+  for (uint64_t c = 0; c < num; ++c) {
+    auto norm_coord_T = coords_T[c] - dom_start_T;
+    out[c] = (norm_coord_T / dom_range_T) * max_bucket_val;
+  }
+}
+}  // namespace
+
 uint64_t map_to_uint64(
     const Dimension& dim,
     const QueryBuffer* buff,
@@ -56,6 +81,83 @@ uint64_t map_to_uint64(
   return dim.map_to_uint64(d.content(), d.size(), bits, max_bucket_val);
 }
 
+void map_to_uint64(
+    const Dimension& dim,
+    const void* coords,
+    uint64_t num,
+    int bits,
+    uint64_t max_bucket_val,
+    uint64_t* out) {
+  assert(!dim.var_size());
+
+  switch (dim.type()) {
+    case Datatype::INT32:
+      map_fixed_to_uint64<int32_t>(dim, coords, num, max_bucket_val, out);
+      break;
+    case Datatype::INT64:
+      map_fixed_to_uint64<int64_t>(dim, coords, num, max_bucket_val, out);
+      break;
+    case Datatype::INT8:
+      map_fixed_to_uint64<int8_t>(dim, coords, num, max_bucket_val, out);
+      break;
+    case Datatype::UINT8:
+      map_fixed_to_uint64<uint8_t>(dim, coords, num, max_bucket_val, out);
+      break;
+    case Datatype::INT16:
+      map_fixed_to_uint64<int16_t>(dim, coords, num, max_bucket_val, out);
+      break;
+    case Datatype::UINT16:
+      map_fixed_to_uint64<uint16_t>(dim, coords, num, max_bucket_val, out);
+      break;
+    case Datatype::UINT32:
+      map_fixed_to_uint64<uint32_t>(dim, coords, num, max_bucket_val, out);
+      break;
+    case Datatype::UINT64:
+      map_fixed_to_uint64<uint64_t>(dim, coords, num, max_bucket_val, out);
+      break;
+    case Datatype::FLOAT32:
+      map_fixed_to_uint64<float>(dim, coords, num, max_bucket_val, out);
+      break;
+    case Datatype::FLOAT64:
+      map_fixed_to_uint64<double>(dim, coords, num, max_bucket_val, out);
+      break;
+    case Datatype::DATETIME_YEAR:
+    case Datatype::DATETIME_MONTH:
+    case Datatype::DATETIME_WEEK:
+    case Datatype::DATETIME_DAY:
+    case Datatype::DATETIME_HR:
+    case Datatype::DATETIME_MIN:
+    case Datatype::DATETIME_SEC:
+    case Datatype::DATETIME_MS:
+    case Datatype::DATETIME_US:
+    case Datatype::DATETIME_NS:
+    case Datatype::DATETIME_PS:
+    case Datatype::DATETIME_FS:
+    case Datatype::DATETIME_AS:
+    case Datatype::TIME_HR:
+    case Datatype::TIME_MIN:
+    case Datatype::TIME_SEC:
+    case Datatype::TIME_MS:
+    case Datatype::TIME_US:
+    case Datatype::TIME_NS:
+    case Datatype::TIME_PS:
+    case Datatype::TIME_FS:
+    case Datatype::TIME_AS:
+      map_fixed_to_uint64<int64_t>(dim, coords, num, max_bucket_val, out);
+      break;
+    default: {
+      // Fall back to mapping every coordinate on its own
+      auto coord_size = dim.coord_size();
+      auto coords_bytes = static_cast<const uint8_t*>(coords);
+      for (uint64_t c = 0; c < num; ++c) {
+        out[c] = dim.map_to_uint64(
+            coords_bytes + c * coord_size, coord_size, bits, max_bucket_val);
+      }
+      break;
+    }
+  }
+}
+
 template uint64_t map_to_uint64<GlobalOrderResultCoords<uint8_t>>(
     const Dimension&,
     const GlobalOrderResultCoords<uint8_t>&,
@@ -51,5 +51,25 @@ uint64_t map_to_uint64(
     int bits,
     uint64_t max_bucket_val);
 
+/**
+ * The number of cells whose coordinates are mapped and converted to Hilbert
+ * values at once.
+ */
+inline constexpr uint64_t batch_size = 1024;
+
+/**
+ * Maps the fixed-size coordinates of `num` cells of `dim`, stored
+ * contiguously in `coords`, to uint64 values. This is equivalent to calling
+ * `Dimension::map_to_uint64` on every coordinate, without the per call
+ * dispatch on the datatype.
+ */
+void map_to_uint64(
+    const Dimension& dim,
+    const void* coords,
+    uint64_t num,
+    int bits,
+    uint64_t max_bucket_val,
+    uint64_t* out);
+
 }  // namespace tiledb::sm::hilbert_order
 #endif  // TILEDB_QUERY_HILBERT_ORDER_H
@@ -1565,28 +1565,22 @@ Status Reader::compute_result_coords(
   RETURN_CANCEL_OR_ERROR(load_tile_var_sizes(
       read_state_.partitioner_.subarray(), var_size_dim_names));
 
-  // Read and unfilter zipped coordinate tiles. Note that
-  // this will ignore fragments with a version >= 5.
-  RETURN_CANCEL_OR_ERROR(
-      read_coordinate_tiles(zipped_coords_names, tmp_result_tiles));
-  RETURN_CANCEL_OR_ERROR(unfilter_tiles(constants::coords, tmp_result_tiles));
-
-  // Read and unfilter unzipped coordinate tiles. Note that
-  // this will ignore fragments with a version < 5.
-  RETURN_CANCEL_OR_ERROR(read_coordinate_tiles(dim_names, tmp_result_tiles));
-  for (const auto& dim_name : dim_names) {
-    RETURN_CANCEL_OR_ERROR(unfilter_tiles(dim_name, tmp_result_tiles));
-  }
-
-  // Read and unfilter timestamps, if required.
+  // Read the coordinate tiles, and the timestamps if required, in a single
+  // batch. Zipped coordinate tiles are ignored for fragments with a
+  // version >= 5, unzipped ones for fragments with a version < 5.
+  std::vector<std::string> names = zipped_coords_names;
+  names.insert(names.end(), dim_names.begin(), dim_names.end());
   if (use_timestamps_) {
     std::vector<std::string> timestamps = {constants::timestamps};
     RETURN_CANCEL_OR_ERROR(
         load_tile_offsets(read_state_.partitioner_.subarray(), timestamps));
+    names.emplace_back(constants::timestamps);
+  }
+  RETURN_CANCEL_OR_ERROR(read_tiles(names, tmp_result_tiles));
 
-    RETURN_CANCEL_OR_ERROR(read_attribute_tiles(timestamps, tmp_result_tiles));
-    RETURN_CANCEL_OR_ERROR(
-        unfilter_tiles(constants::timestamps, tmp_result_tiles));
+  // Unfilter the tiles.
+  for (const auto& name : names) {
+    RETURN_CANCEL_OR_ERROR(unfilter_tiles(name, tmp_result_tiles));
   }
 
   // Compute the read coordinates for all fragments for each subarray range.
@@ -2042,17 +2036,33 @@ Status Reader::calculate_hilbert_values(
   auto max_bucket_val = ((uint64_t)1 << bits) - 1;
   auto coords_num = (uint64_t)hilbert_values->size();
 
-  // Calculate Hilbert values in parallel
+  // Calculate Hilbert values in parallel, on batches of cells
+  const uint64_t batch_size = hilbert_order::batch_size;
   auto status = parallel_for(
-      storage_manager_->compute_tp(), 0, coords_num, [&](uint64_t c) {
-        std::vector<uint64_t> coords(dim_num);
+      storage_manager_->compute_tp(),
+      0,
+      (coords_num + batch_size - 1) / batch_size,
+      [&](uint64_t b) {
+        const uint64_t begin = b * batch_size;
+        const uint64_t num = std::min(batch_size, coords_num - begin);
+        std::vector<uint64_t> coords(dim_num * num);
+        std::vector<const uint64_t*> dim_coords(dim_num);
         for (uint32_t d = 0; d < dim_num; ++d) {
           auto dim{array_schema_.dimension_ptr(d)};
-          coords[d] = hilbert_order::map_to_uint64(
-              *dim, *(iter_begin + c), d, bits, max_bucket_val);
+          auto out = &coords[d * num];
+          for (uint64_t c = 0; c < num; ++c) {
+            out[c] = hilbert_order::map_to_uint64(
+                *dim, *(iter_begin + begin + c), d, bits, max_bucket_val);
+          }
+          dim_coords[d] = out;
+        }
+
+        std::vector<uint64_t> values(num);
+        h.coords_to_hilbert(&dim_coords[0], num, values.data());
+        for (uint64_t c = 0; c < num; ++c) {
+          (*hilbert_values)[begin + c] =
+              std::pair<uint64_t, uint64_t>(values[c], begin + c);
         }
-        (*hilbert_values)[c] =
-            std::pair<uint64_t, uint64_t>(h.coords_to_hilbert(&coords[0]), c);
         return Status::Ok();
       });
 
@@ -36,6 +36,7 @@
 #include "tiledb/common/logger.h"
 #include "tiledb/common/memory.h"
 #include "tiledb/sm/array/array.h"
+#include "tiledb/sm/enums/aggregate_op.h"
 #include "tiledb/sm/enums/query_status.h"
 #include "tiledb/sm/enums/query_type.h"
 #include "tiledb/sm/fragment/fragment_metadata.h"
@@ -43,6 +44,7 @@
 #include "tiledb/sm/query/deletes_and_updates/deletes.h"
 #include "tiledb/sm/query/legacy/reader.h"
 #include "tiledb/sm/query/query_condition.h"
+#include "tiledb/sm/query/readers/aggregate_reader.h"
 #include "tiledb/sm/query/readers/dense_reader.h"
 #include "tiledb/sm/query/readers/sparse_global_order_reader.h"
 #include "tiledb/sm/query/readers/sparse_unordered_with_dups_reader.h"
@@ -554,6 +556,52 @@ Query::get_max_mem_size_map() {
       &config_, storage_manager_->compute_tp());
 }
 
+Status Query::get_aggregate(
+    const char* name, AggregateOp op, void* value, uint64_t* value_size) {
+  if (type_ != QueryType::READ) {
+    return logger_->status(Status_QueryError(
+        "Cannot get aggregate; Operation only supported for read queries"));
+  }
+
+  if (name == nullptr && op != AggregateOp::AGGREGATE_COUNT) {
+    return logger_->status(
+        Status_QueryError("Cannot get aggregate; Name cannot be null"));
+  }
+
+  if (value == nullptr || value_size == nullptr) {
+    return logger_->status(Status_QueryError(
+        "Cannot get aggregate; Value and value size cannot be null"));
+  }
+
+  if (array_->is_remote()) {
+    auto rest_client = storage_manager_->rest_client();
+    if (rest_client == nullptr) {
+      return logger_->status(Status_QueryError(
+          "Cannot get aggregate; remote array with no rest client."));
+    }
+
+    return rest_client->get_query_aggregate_from_rest(
+        array_->array_uri(),
+        this,
+        name == nullptr ? "" : name,
+        op,
+        value,
+        value_size);
+  }
+
+  AggregateReader reader(
+      stats_->create_child("AggregateReader"),
+      logger_,
+      storage_manager_,
+      array_,
+      config_,
+      buffers_,
+      subarray_,
+      layout_,
+      condition_);
+  return reader.compute(name == nullptr ? "" : name, op, value, value_size);
+}
+
 Status Query::get_written_fragment_num(uint32_t* num) const {
   if (type_ != QueryType::WRITE) {
     return logger_->status(Status_QueryError(
@@ -1007,6 +1055,15 @@ Status Query::init() {
       return logger_->status(Status_QueryError(errmsg.str()));
     }
 
+    // Record the timer spans of the query if tracing is enabled.
+    uint64_t trace_max_span_num = 0;
+    bool found = false;
+    RETURN_NOT_OK(config_.get<uint64_t>(
+        "sm.query.trace_max_span_num", &trace_max_span_num, &found));
+    assert(found);
+    if (trace_max_span_num > 0)
+      stats_->enable_trace(trace_max_span_num);
+
     RETURN_NOT_OK(check_buffer_names());
     RETURN_NOT_OK(create_strategy());
     RETURN_NOT_OK(strategy_->init());
@@ -60,6 +60,7 @@ namespace sm {
 class Array;
 class StorageManager;
 
+enum class AggregateOp : uint8_t;
 enum class QueryStatus : uint8_t;
 enum class QueryType : uint8_t;
 
@@ -327,6 +328,23 @@ class Query {
       uint64_t* size_val,
       uint64_t* size_validity);
 
+  /**
+   * Computes an aggregate over the cells of a sparse array that fall in the
+   * subarray and satisfy the query condition. Tiles that are fully covered
+   * and fully matched are answered from the fragment tile metadata, only the
+   * other tiles are read.
+   *
+   * @param name The attribute name. Ignored for `AGGREGATE_COUNT`.
+   * @param op The aggregate operator.
+   * @param value The buffer receiving the aggregate value.
+   * @param value_size On input, the size of `value` in bytes. On output, the
+   *     size of the aggregate value, which is 0 for a `AGGREGATE_MIN` or
+   *     `AGGREGATE_MAX` without any non-null value.
+   * @return Status
+   */
+  Status get_aggregate(
+      const char* name, AggregateOp op, void* value, uint64_t* value_size);
+
   /** Retrieves the number of written fragments. */
   Status get_written_fragment_num(uint32_t* num) const;
 
@@ -35,7 +35,9 @@
 #include "tiledb/sm/enums/datatype.h"
 #include "tiledb/sm/enums/query_condition_combination_op.h"
 #include "tiledb/sm/enums/query_condition_op.h"
+#include "tiledb/sm/fragment/fragment_metadata.h"
 #include "tiledb/sm/misc/utils.h"
+#include "tiledb/sm/tile/tile_metadata_generator.h"
 
 #include <algorithm>
 #include <functional>
@@ -342,6 +344,82 @@ struct QueryCondition::BinaryCmpNullChecks<T, QueryConditionOp::NE> {
   }
 };
 
+/** Partial template specialization for `QueryConditionOp::LT`. */
+template <typename T>
+struct QueryCondition::FixedSizeCmp<T, QueryConditionOp::LT> {
+  static inline bool cmp(const T lhs, const T rhs) {
+    return lhs < rhs;
+  }
+};
+
+/** Partial template specialization for `QueryConditionOp::LE`. */
+template <typename T>
+struct QueryCondition::FixedSizeCmp<T, QueryConditionOp::LE> {
+  static inline bool cmp(const T lhs, const T rhs) {
+    return lhs <= rhs;
+  }
+};
+
+/** Partial template specialization for `QueryConditionOp::GT`. */
+template <typename T>
+struct QueryCondition::FixedSizeCmp<T, QueryConditionOp::GT> {
+  static inline bool cmp(const T lhs, const T rhs) {
+    return lhs > rhs;
+  }
+};
+
+/** Partial template specialization for `QueryConditionOp::GE`. */
+template <typename T>
+struct QueryCondition::FixedSizeCmp<T, QueryConditionOp::GE> {
+  static inline bool cmp(const T lhs, const T rhs) {
+    return lhs >= rhs;
+  }
+};
+
+/** Partial template specialization for `QueryConditionOp::EQ`. */
+template <typename T>
+struct QueryCondition::FixedSizeCmp<T, QueryConditionOp::EQ> {
+  static inline bool cmp(const T lhs, const T rhs) {
+    return lhs == rhs;
+  }
+};
+
+/** Partial template specialization for `QueryConditionOp::NE`. */
+template <typename T>
+struct QueryCondition::FixedSizeCmp<T, QueryConditionOp::NE> {
+  static inline bool cmp(const T lhs, const T rhs) {
+    return lhs != rhs;
+  }
+};
+
+template <
+    typename T,
+    QueryConditionOp Op,
+    typename ResultType,
+    typename CombinationOp>
+void QueryCondition::apply_fixed_size_cells(
+    const T* values,
+    const uint8_t* validity,
+    const T condition_value,
+    const uint64_t count,
+    CombinationOp combination_op,
+    ResultType* result) {
+  // Split on the validity buffer outside of the loops so that neither loop
+  // carries a branch.
+  if (validity == nullptr) {
+    for (uint64_t c = 0; c < count; ++c) {
+      const bool cmp = FixedSizeCmp<T, Op>::cmp(values[c], condition_value);
+      result[c] = combination_op(result[c], static_cast<ResultType>(cmp));
+    }
+  } else {
+    for (uint64_t c = 0; c < count; ++c) {
+      const bool cmp = FixedSizeCmp<T, Op>::cmp(values[c], condition_value) &
+                       (validity[c] != 0);
+      result[c] = combination_op(result[c], static_cast<ResultType>(cmp));
+    }
+  }
+}
+
 template <typename T, QueryConditionOp Op, typename CombinationOp>
 void QueryCondition::apply_ast_node(
     const tdb_unique_ptr<ASTNode>& node,
@@ -432,6 +510,21 @@ void QueryCondition::apply_ast_node(
         uint64_t buffer_offset = start * cell_size;
         const uint64_t buffer_offset_inc = stride * cell_size;
 
+        // Contiguous single-value numeric cells take the vectorized path.
+        if constexpr (std::is_arithmetic_v<T>) {
+          if (stride == 1 && cell_size == sizeof(T) &&
+              condition_value_content != nullptr) {
+            apply_fixed_size_cells<T, Op>(
+                reinterpret_cast<const T*>(buffer) + start,
+                nullable ? buffer_validity + start : nullptr,
+                *static_cast<const T*>(condition_value_content),
+                length,
+                combination_op,
+                result_cell_bitmap.data() + starting_index);
+            c = length;
+          }
+        }
+
         // Iterate through each cell in this slab.
         while (c < length) {
           const bool null_cell =
@@ -978,6 +1071,20 @@ void QueryCondition::apply_ast_node_dense(
     uint64_t buffer_offset = (start + src_cell) * cell_size;
     const uint64_t buffer_offset_inc = stride * cell_size;
 
+    // Contiguous single-value numeric cells take the vectorized path.
+    if constexpr (std::is_arithmetic_v<T>) {
+      if (stride == 1 && cell_size == sizeof(T)) {
+        apply_fixed_size_cells<T, Op>(
+            reinterpret_cast<const T*>(buffer + buffer_offset),
+            buffer_validity == nullptr ? nullptr : buffer_validity + start,
+            *static_cast<const T*>(condition_value_content),
+            result_buffer.size(),
+            combination_op,
+            result_buffer.data());
+        return;
+      }
+    }
+
     // Iterate through each cell in this slab.
     for (uint64_t c = 0; c < result_buffer.size(); ++c) {
       // Get the cell value.
@@ -1689,6 +1796,20 @@ void QueryCondition::apply_ast_node_sparse(
     const uint64_t cell_size = tile.cell_size();
     const uint64_t buffer_el = tile.size() / cell_size;
 
+    // Single-value numeric cells take the vectorized path.
+    if constexpr (std::is_arithmetic_v<T>) {
+      if (cell_size == sizeof(T)) {
+        apply_fixed_size_cells<T, Op>(
+            reinterpret_cast<const T*>(buffer),
+            buffer_validity,
+            *static_cast<const T*>(condition_value_content),
+            buffer_el,
+            combination_op,
+            result_bitmap.data());
+        return;
+      }
+    }
+
     // Iterate through each cell without checking the bitmap to enable
     // vectorization.
     for (uint64_t c = 0; c < buffer_el; ++c) {
@@ -2042,6 +2163,300 @@ Status QueryCondition::apply_sparse(
   return Status::Ok();
 }
 
+template <typename T, QueryConditionOp Op>
+QueryCondition::TileMatch QueryCondition::tile_match_min_max(
+    const void* condition_value,
+    const uint64_t condition_value_size,
+    const void* min,
+    const uint64_t min_size,
+    const void* max,
+    const uint64_t max_size,
+    const bool all_valid) {
+  bool all = false;
+  bool none = false;
+  if constexpr (Op == QueryConditionOp::LT || Op == QueryConditionOp::LE) {
+    all = BinaryCmpNullChecks<T, Op>::cmp(
+        max, max_size, condition_value, condition_value_size);
+    none = !BinaryCmpNullChecks<T, Op>::cmp(
+        min, min_size, condition_value, condition_value_size);
+  } else if constexpr (
+      Op == QueryConditionOp::GT || Op == QueryConditionOp::GE) {
+    all = BinaryCmpNullChecks<T, Op>::cmp(
+        min, min_size, condition_value, condition_value_size);
+    none = !BinaryCmpNullChecks<T, Op>::cmp(
+        max, max_size, condition_value, condition_value_size);
+  } else {
+    // The condition value is in [min, max], and may be the only value.
+    const bool in_range =
+        BinaryCmpNullChecks<T, QueryConditionOp::LE>::cmp(
+            min, min_size, condition_value, condition_value_size) &&
+        BinaryCmpNullChecks<T, QueryConditionOp::GE>::cmp(
+            max, max_size, condition_value, condition_value_size);
+    const bool single_value =
+        in_range &&
+        BinaryCmpNullChecks<T, QueryConditionOp::EQ>::cmp(
+            min, min_size, condition_value, condition_value_size) &&
+        BinaryCmpNullChecks<T, QueryConditionOp::EQ>::cmp(
+            max, max_size, condition_value, condition_value_size);
+    if constexpr (Op == QueryConditionOp::EQ) {
+      all = single_value;
+      none = !in_range;
+    } else {
+      all = !in_range;
+      none = single_value;
+    }
+  }
+
+  if (none) {
+    return TileMatch::NONE;
+  }
+
+  // Null cells never match a non-null condition value.
+  return all && all_valid ? TileMatch::ALL : TileMatch::SOME;
+}
+
+template <typename T>
+QueryCondition::TileMatch QueryCondition::tile_match_min_max(
+    const tdb_unique_ptr<ASTNode>& node,
+    const void* min,
+    const uint64_t min_size,
+    const void* max,
+    const uint64_t max_size,
+    const bool all_valid) {
+  const void* condition_value = node->get_condition_value_view().content();
+  const uint64_t condition_value_size =
+      node->get_condition_value_view().size();
+  switch (node->get_op()) {
+    case QueryConditionOp::LT:
+      return tile_match_min_max<T, QueryConditionOp::LT>(
+          condition_value,
+          condition_value_size,
+          min,
+          min_size,
+          max,
+          max_size,
+          all_valid);
+    case QueryConditionOp::LE:
+      return tile_match_min_max<T, QueryConditionOp::LE>(
+          condition_value,
+          condition_value_size,
+          min,
+          min_size,
+          max,
+          max_size,
+          all_valid);
+    case QueryConditionOp::GT:
+      return tile_match_min_max<T, QueryConditionOp::GT>(
+          condition_value,
+          condition_value_size,
+          min,
+          min_size,
+          max,
+          max_size,
+          all_valid);
+    case QueryConditionOp::GE:
+      return tile_match_min_max<T, QueryConditionOp::GE>(
+          condition_value,
+          condition_value_size,
+          min,
+          min_size,
+          max,
+          max_size,
+          all_valid);
+    case QueryConditionOp::EQ:
+      return tile_match_min_max<T, QueryConditionOp::EQ>(
+          condition_value,
+          condition_value_size,
+          min,
+          min_size,
+          max,
+          max_size,
+          all_valid);
+    case QueryConditionOp::NE:
+      return tile_match_min_max<T, QueryConditionOp::NE>(
+          condition_value,
+          condition_value_size,
+          min,
+          min_size,
+          max,
+          max_size,
+          all_valid);
+    default:
+      return TileMatch::SOME;
+  }
+}
+
+QueryCondition::TileMatch QueryCondition::tile_match(
+    const tdb_unique_ptr<ASTNode>& node,
+    FragmentMetadata& fragment_metadata,
+    const uint64_t tile_idx) const {
+  if (node->is_expr()) {
+    switch (node->get_combination_op()) {
+      case QueryConditionCombinationOp::AND: {
+        auto match = TileMatch::ALL;
+        for (const auto& child : node->get_children()) {
+          auto child_match = tile_match(child, fragment_metadata, tile_idx);
+          if (child_match == TileMatch::NONE) {
+            return TileMatch::NONE;
+          }
+          if (child_match == TileMatch::SOME) {
+            match = TileMatch::SOME;
+          }
+        }
+        return match;
+      }
+      case QueryConditionCombinationOp::OR: {
+        auto match = TileMatch::NONE;
+        for (const auto& child : node->get_children()) {
+          auto child_match = tile_match(child, fragment_metadata, tile_idx);
+          if (child_match == TileMatch::ALL) {
+            return TileMatch::ALL;
+          }
+          if (child_match == TileMatch::SOME) {
+            match = TileMatch::SOME;
+          }
+        }
+        return match;
+      }
+      default:
+        return TileMatch::SOME;
+    }
+  }
+
+  // Dimensions, and attributes added to the schema after the fragment was
+  // written, have no tile metadata.
+  const auto& field_name = node->get_field_name();
+  const auto attribute =
+      fragment_metadata.array_schema()->attribute(field_name);
+  if (attribute == nullptr ||
+      !fragment_metadata.tile_min_max_null_count_loaded(field_name)) {
+    return TileMatch::SOME;
+  }
+
+  const auto cell_num = fragment_metadata.cell_num(tile_idx);
+  uint64_t null_count = 0;
+  if (attribute->nullable()) {
+    auto&& [st, count] =
+        fragment_metadata.get_tile_null_count(field_name, tile_idx);
+    if (!st.ok()) {
+      return TileMatch::SOME;
+    }
+    null_count = *count;
+  }
+
+  // A null condition value matches the null cells with the EQ operator, and
+  // the non-null cells with the NE operator.
+  if (node->get_condition_value_view().content() == nullptr) {
+    if (!attribute->nullable()) {
+      return TileMatch::SOME;
+    }
+
+    auto match_count = null_count;
+    if (node->get_op() == QueryConditionOp::NE) {
+      match_count = cell_num - null_count;
+    } else if (node->get_op() != QueryConditionOp::EQ) {
+      return TileMatch::SOME;
+    }
+
+    if (match_count == 0) {
+      return TileMatch::NONE;
+    }
+    return match_count == cell_num ? TileMatch::ALL : TileMatch::SOME;
+  }
+
+  // Null cells never match a non-null condition value.
+  if (null_count == cell_num) {
+    return TileMatch::NONE;
+  }
+
+  const auto type = attribute->type();
+  const auto var_size = attribute->var_size();
+  if (!TileMetadataGenerator::has_min_max_metadata(
+          type, false, var_size, attribute->cell_val_num())) {
+    return TileMatch::SOME;
+  }
+
+  auto&& [st_min, min, min_size] =
+      fragment_metadata.get_tile_min(field_name, tile_idx);
+  auto&& [st_max, max, max_size] =
+      fragment_metadata.get_tile_max(field_name, tile_idx);
+  if (!st_min.ok() || !st_max.ok() || *min == nullptr || *max == nullptr) {
+    return TileMatch::SOME;
+  }
+
+  const bool all_valid = null_count == 0;
+  switch (type) {
+    case Datatype::INT8:
+      return tile_match_min_max<int8_t>(
+          node, *min, *min_size, *max, *max_size, all_valid);
+    case Datatype::BOOL:
+    case Datatype::UINT8:
+      return tile_match_min_max<uint8_t>(
+          node, *min, *min_size, *max, *max_size, all_valid);
+    case Datatype::INT16:
+      return tile_match_min_max<int16_t>(
+          node, *min, *min_size, *max, *max_size, all_valid);
+    case Datatype::UINT16:
+      return tile_match_min_max<uint16_t>(
+          node, *min, *min_size, *max, *max_size, all_valid);
+    case Datatype::INT32:
+      return tile_match_min_max<int32_t>(
+          node, *min, *min_size, *max, *max_size, all_valid);
+    case Datatype::UINT32:
+      return tile_match_min_max<uint32_t>(
+          node, *min, *min_size, *max, *max_size, all_valid);
+    case Datatype::INT64:
+    case Datatype::DATETIME_YEAR:
+    case Datatype::DATETIME_MONTH:
+    case Datatype::DATETIME_WEEK:
+    case Datatype::DATETIME_DAY:
+    case Datatype::DATETIME_HR:
+    case Datatype::DATETIME_MIN:
+    case Datatype::DATETIME_SEC:
+    case Datatype::DATETIME_MS:
+    case Datatype::DATETIME_US:
+    case Datatype::DATETIME_NS:
+    case Datatype::DATETIME_PS:
+    case Datatype::DATETIME_FS:
+    case Datatype::DATETIME_AS:
+    case Datatype::TIME_HR:
+    case Datatype::TIME_MIN:
+    case Datatype::TIME_SEC:
+    case Datatype::TIME_MS:
+    case Datatype::TIME_US:
+    case Datatype::TIME_NS:
+    case Datatype::TIME_PS:
+    case Datatype::TIME_FS:
+    case Datatype::TIME_AS:
+      return tile_match_min_max<int64_t>(
+          node, *min, *min_size, *max, *max_size, all_valid);
+    case Datatype::UINT64:
+      return tile_match_min_max<uint64_t>(
+          node, *min, *min_size, *max, *max_size, all_valid);
+    case Datatype::STRING_ASCII:
+    case Datatype::CHAR:
+      // Fixed-size strings are not compared as strings by the writer.
+      if (!var_size) {
+        return TileMatch::SOME;
+      }
+      return tile_match_min_max<char*>(
+          node, *min, *min_size, *max, *max_size, all_valid);
+    default:
+      // Floating point tile min and max values are not reliable when the
+      // tile has NaN values, they are never used for pruning.
+      return TileMatch::SOME;
+  }
+}
+
+QueryCondition::TileMatch QueryCondition::tile_match(
+    FragmentMetadata& fragment_metadata, const uint64_t tile_idx) const {
+  if (!tree_) {
+    return TileMatch::ALL;
+  }
+
+  return tile_match(tree_, fragment_metadata, tile_idx);
+}
+
 QueryCondition QueryCondition::negated_condition() {
   return QueryCondition(tree_->get_negated_tree());
 }
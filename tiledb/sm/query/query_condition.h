@@ -49,10 +49,28 @@ using namespace tiledb::common;
 namespace tiledb {
 namespace sm {
 
+class FragmentMetadata;
 enum class QueryConditionCombinationOp : uint8_t;
 
 class QueryCondition {
  public:
+  /* ********************************* */
+  /*          PUBLIC DATATYPES         */
+  /* ********************************* */
+
+  /**
+   * The cells of a tile that match the condition, as far as it can be told
+   * from the tile metadata.
+   */
+  enum class TileMatch : uint8_t {
+    /** No cell matches the condition. */
+    NONE,
+    /** Some cells may match the condition, they need to be evaluated. */
+    SOME,
+    /** All cells match the condition. */
+    ALL
+  };
+
   /* ********************************* */
   /*     CONSTRUCTORS & DESTRUCTORS    */
   /* ********************************* */
@@ -193,6 +211,19 @@ class QueryCondition {
       ResultTile& result_tile,
       std::vector<BitmapType>& result_bitmap);
 
+  /**
+   * Evaluates this query condition against the min, max and null count
+   * metadata of a fragment tile, so that tiles that cannot match are not
+   * read and tiles that fully match are not evaluated cell by cell.
+   * Fields without loaded tile metadata make the tile a `SOME` match.
+   *
+   * @param fragment_metadata The metadata of the fragment of the tile.
+   * @param tile_idx The index of the tile in the fragment.
+   * @return The tile match.
+   */
+  TileMatch tile_match(
+      FragmentMetadata& fragment_metadata, uint64_t tile_idx) const;
+
   /**
    * Reverse the query condition using De Morgan's law.
    */
@@ -234,6 +265,14 @@ class QueryCondition {
   template <typename T, QueryConditionOp Cmp>
   struct BinaryCmp;
 
+  /**
+   * Performs a binary comparison between two fixed-size values passed by
+   * value. Keeping the condition value out of memory lets the compiler
+   * hoist it out of the comparison loop and vectorize the loop.
+   */
+  template <typename T, QueryConditionOp Cmp>
+  struct FixedSizeCmp;
+
   /* ********************************* */
   /*         PRIVATE ATTRIBUTES        */
   /* ********************************* */
@@ -250,6 +289,90 @@ class QueryCondition {
   /*          PRIVATE METHODS          */
   /* ********************************* */
 
+  /**
+   * Evaluates a value node against the min, max and null count metadata of a
+   * fragment tile, templated for a query condition operator.
+   *
+   * @param condition_value The value to compare to.
+   * @param condition_value_size The byte size of `condition_value`.
+   * @param min The tile min value.
+   * @param min_size The byte size of `min`.
+   * @param max The tile max value.
+   * @param max_size The byte size of `max`.
+   * @param all_valid Whether no cell of the tile is null.
+   * @return The tile match.
+   */
+  template <typename T, QueryConditionOp Op>
+  static TileMatch tile_match_min_max(
+      const void* condition_value,
+      uint64_t condition_value_size,
+      const void* min,
+      uint64_t min_size,
+      const void* max,
+      uint64_t max_size,
+      bool all_valid);
+
+  /**
+   * Evaluates a value node against the min, max and null count metadata of a
+   * fragment tile, templated on the attribute type.
+   *
+   * @param node The value node to evaluate.
+   * @param min The tile min value.
+   * @param min_size The byte size of `min`.
+   * @param max The tile max value.
+   * @param max_size The byte size of `max`.
+   * @param all_valid Whether no cell of the tile is null.
+   * @return The tile match.
+   */
+  template <typename T>
+  static TileMatch tile_match_min_max(
+      const tdb_unique_ptr<ASTNode>& node,
+      const void* min,
+      uint64_t min_size,
+      const void* max,
+      uint64_t max_size,
+      bool all_valid);
+
+  /**
+   * Evaluates a node of the AST against the metadata of a fragment tile.
+   *
+   * @param node The node to evaluate.
+   * @param fragment_metadata The metadata of the fragment of the tile.
+   * @param tile_idx The index of the tile in the fragment.
+   * @return The tile match.
+   */
+  TileMatch tile_match(
+      const tdb_unique_ptr<ASTNode>& node,
+      FragmentMetadata& fragment_metadata,
+      uint64_t tile_idx) const;
+
+  /**
+   * Applies a comparison on `count` contiguous fixed-size cells and folds
+   * each result into `result` with `combination_op`. The loop body has no
+   * branches or pointer indirections so it is compiled to SIMD code for the
+   * target instruction set (e.g. AVX2 when `COMPILER_SUPPORTS_AVX2` is set).
+   *
+   * @param values The cell values.
+   * @param validity The validity values, or `nullptr` if all cells are
+   *     to be considered valid. Invalid cells never match.
+   * @param condition_value The value to compare to.
+   * @param count The number of cells to process.
+   * @param combination_op The combination op.
+   * @param result The result buffer, of at least `count` elements.
+   */
+  template <
+      typename T,
+      QueryConditionOp Op,
+      typename ResultType,
+      typename CombinationOp>
+  static void apply_fixed_size_cells(
+      const T* values,
+      const uint8_t* validity,
+      const T condition_value,
+      const uint64_t count,
+      CombinationOp combination_op,
+      ResultType* result);
+
   /**
    * Applies a value node on primitive-typed result cell slabs,
    * templated for a query condition operator.
@@ -0,0 +1,983 @@
+/**
+ * @file   aggregate_reader.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file implements class AggregateReader.
+ */
+
+#include "tiledb/sm/query/readers/aggregate_reader.h"
+#include "tiledb/common/logger.h"
+#include "tiledb/sm/array/array.h"
+#include "tiledb/sm/array_schema/array_schema.h"
+#include "tiledb/sm/array_schema/dimension.h"
+#include "tiledb/sm/array_schema/domain.h"
+#include "tiledb/sm/enums/array_type.h"
+#include "tiledb/sm/enums/datatype.h"
+#include "tiledb/sm/fragment/fragment_metadata.h"
+#include "tiledb/sm/misc/parallel_functions.h"
+#include "tiledb/sm/query/readers/sparse_index_reader_base.h"
+#include "tiledb/sm/storage_manager/storage_manager.h"
+#include "tiledb/sm/subarray/subarray.h"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace tiledb {
+namespace sm {
+
+/* ****************************** */
+/*          CONSTRUCTORS          */
+/* ****************************** */
+
+AggregateReader::AggregateReader(
+    stats::Stats* stats,
+    shared_ptr<Logger> logger,
+    StorageManager* storage_manager,
+    Array* array,
+    Config& config,
+    std::unordered_map<std::string, QueryBuffer>& buffers,
+    Subarray& subarray,
+    Layout layout,
+    QueryCondition& condition)
+    : ReaderBase(
+          stats,
+          logger->clone("AggregateReader", ++logger_id_),
+          storage_manager,
+          array,
+          config,
+          buffers,
+          subarray,
+          layout,
+          condition) {
+  disable_cache_ = true;
+}
+
+/* ****************************** */
+/*               API              */
+/* ****************************** */
+
+Status AggregateReader::compute(
+    const std::string& name,
+    AggregateOp op,
+    void* value,
+    uint64_t* value_size) {
+  auto timer_se = stats_->start_timer("compute_aggregate");
+
+  // Dense cells outside of the written fragments hold fill values, and the
+  // cells that do not satisfy the query condition are returned as fill values
+  // by a read.
+  if (array_schema_.array_type() != ArrayType::SPARSE) {
+    return logger_->status(Status_ReaderError(
+        "Cannot compute aggregate; Aggregates are only supported on sparse "
+        "arrays, read the attribute of a dense array with a read query and "
+        "reduce the results instead"));
+  }
+
+  // The cell count does not depend on any attribute.
+  if (op == AggregateOp::AGGREGATE_COUNT) {
+    return compute<uint8_t>(name, op, value, value_size);
+  }
+
+  if (!array_schema_.is_attr(name)) {
+    return logger_->status(Status_ReaderError(
+        "Cannot compute aggregate; '" + name + "' is not an attribute"));
+  }
+
+  if (op == AggregateOp::AGGREGATE_NULL_COUNT) {
+    if (!array_schema_.is_nullable(name)) {
+      return logger_->status(Status_ReaderError(
+          "Cannot compute aggregate; Attribute '" + name +
+          "' is not nullable"));
+    }
+
+    return compute<uint8_t>(name, op, value, value_size);
+  }
+
+  if (array_schema_.var_size(name) || array_schema_.cell_val_num(name) != 1) {
+    return logger_->status(Status_ReaderError(
+        "Cannot compute aggregate; Attribute '" + name +
+        "' must be fixed-sized with a single value per cell"));
+  }
+
+  switch (array_schema_.type(name)) {
+    case Datatype::INT8:
+      return compute<int8_t>(name, op, value, value_size);
+    case Datatype::BOOL:
+    case Datatype::UINT8:
+      return compute<uint8_t>(name, op, value, value_size);
+    case Datatype::INT16:
+      return compute<int16_t>(name, op, value, value_size);
+    case Datatype::UINT16:
+      return compute<uint16_t>(name, op, value, value_size);
+    case Datatype::INT32:
+      return compute<int32_t>(name, op, value, value_size);
+    case Datatype::UINT32:
+      return compute<uint32_t>(name, op, value, value_size);
+    case Datatype::INT64:
+      return compute<int64_t>(name, op, value, value_size);
+    case Datatype::UINT64:
+      return compute<uint64_t>(name, op, value, value_size);
+    case Datatype::FLOAT32:
+      return compute<float>(name, op, value, value_size);
+    case Datatype::FLOAT64:
+      return compute<double>(name, op, value, value_size);
+    case Datatype::DATETIME_YEAR:
+    case Datatype::DATETIME_MONTH:
+    case Datatype::DATETIME_WEEK:
+    case Datatype::DATETIME_DAY:
+    case Datatype::DATETIME_HR:
+    case Datatype::DATETIME_MIN:
+    case Datatype::DATETIME_SEC:
+    case Datatype::DATETIME_MS:
+    case Datatype::DATETIME_US:
+    case Datatype::DATETIME_NS:
+    case Datatype::DATETIME_PS:
+    case Datatype::DATETIME_FS:
+    case Datatype::DATETIME_AS:
+    case Datatype::TIME_HR:
+    case Datatype::TIME_MIN:
+    case Datatype::TIME_SEC:
+    case Datatype::TIME_MS:
+    case Datatype::TIME_US:
+    case Datatype::TIME_NS:
+    case Datatype::TIME_PS:
+    case Datatype::TIME_FS:
+    case Datatype::TIME_AS:
+      return compute<int64_t>(name, op, value, value_size);
+    default:
+      return logger_->status(Status_ReaderError(
+          "Cannot compute aggregate; Unsupported datatype " +
+          datatype_str(array_schema_.type(name)) + " for attribute '" + name +
+          "'"));
+  }
+}
+
+/* ****************************** */
+/*        PRIVATE DATATYPES       */
+/* ****************************** */
+
+template <class T>
+void AggregateReader::AggregateState<T>::merge(const AggregateState<T>& other) {
+  count_ += other.count_;
+  null_count_ += other.null_count_;
+  add_to_sum(other.sum_);
+  if (other.has_min_max_) {
+    add_min_max(other.min_, other.max_);
+  }
+}
+
+template <class T>
+void AggregateReader::AggregateState<T>::add_to_sum(sum_type value) {
+  // Saturate on overflow, as the tile metadata sums do.
+  if constexpr (std::is_same<sum_type, int64_t>::value) {
+    if (sum_ > 0 && value > 0 &&
+        sum_ > std::numeric_limits<int64_t>::max() - value) {
+      sum_ = std::numeric_limits<int64_t>::max();
+    } else if (
+        sum_ < 0 && value < 0 &&
+        sum_ < std::numeric_limits<int64_t>::min() - value) {
+      sum_ = std::numeric_limits<int64_t>::min();
+    } else {
+      sum_ += value;
+    }
+  } else if constexpr (std::is_same<sum_type, uint64_t>::value) {
+    if (sum_ > std::numeric_limits<uint64_t>::max() - value) {
+      sum_ = std::numeric_limits<uint64_t>::max();
+    } else {
+      sum_ += value;
+    }
+  } else {
+    if ((sum_ < 0.0) == (value < 0.0) &&
+        std::abs(sum_) > std::numeric_limits<double>::max() - std::abs(value)) {
+      sum_ = sum_ < 0.0 ? std::numeric_limits<double>::lowest() :
+                          std::numeric_limits<double>::max();
+    } else {
+      sum_ += value;
+    }
+  }
+}
+
+template <class T>
+void AggregateReader::AggregateState<T>::add_min_max(T min, T max) {
+  // NaN values are not ordered, they are ignored.
+  if constexpr (std::is_floating_point<T>::value) {
+    if (std::isnan(min) || std::isnan(max)) {
+      return;
+    }
+  }
+
+  if (!has_min_max_ || min < min_) {
+    min_ = min;
+  }
+
+  if (!has_min_max_ || max > max_) {
+    max_ = max;
+  }
+
+  has_min_max_ = true;
+}
+
+/* ****************************** */
+/*        PRIVATE METHODS         */
+/* ****************************** */
+
+Status AggregateReader::check_fragments(
+    const std::string& name, AggregateOp op) const {
+  const auto relevant_fragments = subarray_.relevant_fragments();
+  const bool all_frag = !subarray_.is_set();
+  const auto fragment_num =
+      all_frag ? fragment_metadata_.size() : relevant_fragments->size();
+  for (size_t i = 0; i < fragment_num; i++) {
+    auto frag_idx = all_frag ? i : relevant_fragments->at(i);
+    auto& fragment = fragment_metadata_[frag_idx];
+
+    // Fragments written before the attribute was added to the schema would
+    // contribute fill values.
+    if (op != AggregateOp::AGGREGATE_COUNT &&
+        fragment->array_schema()->attribute(name) == nullptr) {
+      return logger_->status(Status_ReaderError(
+          "Cannot compute aggregate; Attribute '" + name +
+          "' is not present in all fragments"));
+    }
+  }
+
+  return Status::Ok();
+}
+
+std::vector<bool> AggregateReader::fragments_to_reconcile() const {
+  const auto fragment_num = fragment_metadata_.size();
+  std::vector<bool> reconcile(fragment_num, false);
+
+  // Cells with timestamps are filtered by the array open timestamps, and
+  // deduplicated within their fragment without duplicates.
+  const auto relevant_fragments = subarray_.relevant_fragments();
+  const bool all_frag = !subarray_.is_set();
+  const auto relevant_num =
+      all_frag ? fragment_num : relevant_fragments->size();
+  for (size_t i = 0; i < relevant_num; i++) {
+    const auto f = all_frag ? i : relevant_fragments->at(i);
+    if (include_timestamps(f)) {
+      reconcile[f] = true;
+    }
+  }
+
+  // Without duplicates, cells of overlapping fragments are deduplicated.
+  if (!array_schema_.allows_dups()) {
+    const auto& domain = array_schema_.domain();
+    for (size_t i = 0; i < relevant_num; i++) {
+      const auto first = all_frag ? i : relevant_fragments->at(i);
+      for (size_t j = i + 1; j < relevant_num; j++) {
+        const auto second = all_frag ? j : relevant_fragments->at(j);
+        if (domain.overlap(
+                fragment_metadata_[first]->non_empty_domain(),
+                fragment_metadata_[second]->non_empty_domain())) {
+          reconcile[first] = true;
+          reconcile[second] = true;
+        }
+      }
+    }
+  }
+
+  return reconcile;
+}
+
+Status AggregateReader::load_tile_data(
+    const std::string& name, AggregateOp op, const bool load_timestamps) {
+  auto timer_se = stats_->start_timer("load_tile_data");
+
+  // Preload the coordinate tile offsets. Zipped coordinates are ignored for
+  // fragments with a version >= 5, unzipped ones for versions < 5.
+  std::vector<std::string> var_size_to_load;
+  std::vector<std::string> dim_names;
+  const auto dim_num = array_schema_.dim_num();
+  for (unsigned d = 0; d < dim_num; ++d) {
+    dim_names.emplace_back(array_schema_.dimension_ptr(d)->name());
+    if (array_schema_.var_size(dim_names.back())) {
+      var_size_to_load.emplace_back(dim_names.back());
+    }
+  }
+  RETURN_NOT_OK(load_tile_offsets(subarray_, {constants::coords}));
+  RETURN_NOT_OK(load_tile_offsets(subarray_, dim_names));
+  if (load_timestamps) {
+    RETURN_NOT_OK(load_tile_offsets(subarray_, {constants::timestamps}));
+  }
+
+  // Attribute tile offsets, for the aggregated attribute and the query
+  // condition.
+  std::vector<std::string> attr_names;
+  if (op != AggregateOp::AGGREGATE_COUNT) {
+    attr_names.emplace_back(name);
+  }
+  if (!condition_.empty()) {
+    for (const auto& field_name : condition_.field_names()) {
+      if (array_schema_.is_dim(field_name) ||
+          std::find(attr_names.begin(), attr_names.end(), field_name) !=
+              attr_names.end()) {
+        continue;
+      }
+
+      attr_names.emplace_back(field_name);
+      if (array_schema_.var_size(field_name)) {
+        var_size_to_load.emplace_back(field_name);
+      }
+    }
+  }
+  RETURN_NOT_OK(load_tile_var_sizes(subarray_, var_size_to_load));
+  RETURN_NOT_OK(load_tile_offsets(subarray_, attr_names));
+
+  // Load the tile metadata of the aggregated attribute.
+  if (op != AggregateOp::AGGREGATE_COUNT) {
+    const auto encryption_key = array_->encryption_key();
+    const auto relevant_fragments = subarray_.relevant_fragments();
+    const bool all_frag = !subarray_.is_set();
+    const bool nullable = array_schema_.is_nullable(name);
+    const bool min_max_from_metadata =
+        (op == AggregateOp::AGGREGATE_MIN ||
+         op == AggregateOp::AGGREGATE_MAX) &&
+        !datatype_is_real(array_schema_.type(name));
+    auto status = parallel_for(
+        storage_manager_->compute_tp(),
+        0,
+        all_frag ? fragment_metadata_.size() : relevant_fragments->size(),
+        [&](const uint64_t i) {
+          auto frag_idx = all_frag ? i : relevant_fragments->at(i);
+          auto& fragment = fragment_metadata_[frag_idx];
+
+          if (op == AggregateOp::AGGREGATE_SUM) {
+            RETURN_NOT_OK(fragment->load_tile_sum_values(
+                *encryption_key, std::vector<std::string>{name}));
+          } else if (min_max_from_metadata) {
+            RETURN_NOT_OK(fragment->load_tile_min_values(
+                *encryption_key, std::vector<std::string>{name}));
+            RETURN_NOT_OK(fragment->load_tile_max_values(
+                *encryption_key, std::vector<std::string>{name}));
+          }
+
+          if (nullable) {
+            RETURN_NOT_OK(fragment->load_tile_null_count_values(
+                *encryption_key, std::vector<std::string>{name}));
+          }
+
+          return Status::Ok();
+        });
+    RETURN_NOT_OK_ELSE(status, logger_->status(status));
+  }
+
+  // Load the tile metadata used to evaluate the query condition on tiles.
+  RETURN_NOT_OK(load_query_condition_tile_metadata(subarray_));
+
+  return Status::Ok();
+}
+
+bool AggregateReader::tile_covered(unsigned f, uint64_t t) const {
+  if (!subarray_.is_set()) {
+    return true;
+  }
+
+  // The tile is covered if, on every dimension, one range covers its MBR.
+  const auto& domain = array_schema_.domain();
+  const auto& mbr = fragment_metadata_[f]->mbr(t);
+  for (unsigned d = 0; d < array_schema_.dim_num(); d++) {
+    if (subarray_.is_default(d)) {
+      continue;
+    }
+
+    const auto& ranges_for_dim = subarray_.ranges_for_dim(d);
+    std::vector<uint64_t> relevant_ranges;
+    domain.dimension_ptr(d)->relevant_ranges(
+        ranges_for_dim, mbr[d], relevant_ranges);
+    const auto covered = domain.dimension_ptr(d)->covered_vec(
+        ranges_for_dim, mbr[d], relevant_ranges);
+    if (std::find(covered.begin(), covered.end(), true) == covered.end()) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+template <class T>
+Status AggregateReader::compute(
+    const std::string& name,
+    AggregateOp op,
+    void* value,
+    uint64_t* value_size) {
+  // Compute the tile ranges intersecting the subarray, per fragment.
+  const auto fragment_num = fragment_metadata_.size();
+  std::vector<std::vector<std::pair<uint64_t, uint64_t>>> tile_ranges;
+  if (subarray_.is_set()) {
+    std::vector<FragIdx> frag_tile_idx;
+    frag_tile_idx.reserve(fragment_num);
+    for (size_t f = 0; f < fragment_num; f++) {
+      frag_tile_idx.emplace_back(0, 0);
+    }
+    RETURN_NOT_OK(subarray_.precompute_all_ranges_tile_overlap(
+        storage_manager_->compute_tp(), frag_tile_idx, &tile_ranges));
+  } else {
+    tile_ranges.resize(fragment_num);
+    for (size_t f = 0; f < fragment_num; f++) {
+      const auto tile_num = fragment_metadata_[f]->tile_num();
+      if (tile_num > 0) {
+        tile_ranges[f].emplace_back(0, tile_num - 1);
+      }
+    }
+  }
+
+  RETURN_NOT_OK(check_fragments(name, op));
+  const auto reconcile = fragments_to_reconcile();
+  bool load_timestamps = false;
+  for (unsigned f = 0; f < fragment_num; f++) {
+    load_timestamps |= reconcile[f] && include_timestamps(f);
+  }
+  RETURN_NOT_OK(load_tile_data(name, op, load_timestamps));
+
+  // Reduce the tiles that are covered by the subarray and fully matched by
+  // the query condition from their metadata, and collect the others. All
+  // the tiles of the fragments to reconcile are read, as their cells can
+  // hide the cells of other fragments whatever the query condition.
+  AggregateState<T> state;
+  std::vector<std::pair<unsigned, uint64_t>> tiles_to_read;
+  std::vector<std::pair<unsigned, uint64_t>> tiles_to_reconcile;
+  uint64_t metadata_tile_num = 0;
+  // Floating point tile min and max values are not reliable when the tile
+  // has NaN values, those tiles are always read.
+  const bool float_min_max = (op == AggregateOp::AGGREGATE_MIN ||
+                              op == AggregateOp::AGGREGATE_MAX) &&
+                             datatype_is_real(array_schema_.type(name));
+  for (unsigned f = 0; f < fragment_num; f++) {
+    // Tile metadata is only present from format version 11.
+    const bool has_tile_metadata =
+        op == AggregateOp::AGGREGATE_COUNT ||
+        (fragment_metadata_[f]->format_version() > 10 && !float_min_max);
+    for (const auto& range : tile_ranges[f]) {
+      for (uint64_t t = range.first; t <= range.second; t++) {
+        if (reconcile[f]) {
+          tiles_to_reconcile.emplace_back(f, t);
+          continue;
+        }
+
+        const auto match = condition_.empty() ? QueryCondition::TileMatch::ALL :
+                                                tile_match(f, t);
+        if (match == QueryCondition::TileMatch::NONE) {
+          continue;
+        }
+
+        if (has_tile_metadata && match == QueryCondition::TileMatch::ALL &&
+            tile_covered(f, t)) {
+          RETURN_NOT_OK(reduce_tile_metadata<T>(name, op, f, t, &state));
+          metadata_tile_num++;
+        } else {
+          tiles_to_read.emplace_back(f, t);
+        }
+      }
+    }
+  }
+  stats_->add_counter("metadata_tile_num", metadata_tile_num);
+  stats_->add_counter("read_tile_num", tiles_to_read.size());
+  stats_->add_counter("reconciled_tile_num", tiles_to_reconcile.size());
+
+  // Read and reduce the remaining tiles in batches, so that the tiles in
+  // memory are bounded by a few per compute thread.
+  const uint64_t batch_size =
+      4 * std::max<uint64_t>(
+              storage_manager_->compute_tp()->concurrency_level(), 1);
+  for (uint64_t start = 0; start < tiles_to_read.size(); start += batch_size) {
+    const uint64_t end =
+        std::min<uint64_t>(start + batch_size, tiles_to_read.size());
+    RETURN_NOT_OK(reduce_tiles<T>(
+        name,
+        op,
+        std::vector<std::pair<unsigned, uint64_t>>(
+            tiles_to_read.begin() + start, tiles_to_read.begin() + end),
+        &state));
+  }
+
+  LatestCells<T> latest_cells;
+  for (uint64_t start = 0; start < tiles_to_reconcile.size();
+       start += batch_size) {
+    const uint64_t end =
+        std::min<uint64_t>(start + batch_size, tiles_to_reconcile.size());
+    RETURN_NOT_OK(reconcile_tiles<T>(
+        name,
+        op,
+        std::vector<std::pair<unsigned, uint64_t>>(
+            tiles_to_reconcile.begin() + start,
+            tiles_to_reconcile.begin() + end),
+        &latest_cells,
+        &state));
+  }
+  reduce_latest_cells<T>(op, latest_cells, &state);
+
+  // Copy the aggregate value.
+  const void* result = nullptr;
+  uint64_t result_size = 0;
+  switch (op) {
+    case AggregateOp::AGGREGATE_COUNT:
+      result = &state.count_;
+      result_size = sizeof(state.count_);
+      break;
+    case AggregateOp::AGGREGATE_NULL_COUNT:
+      result = &state.null_count_;
+      result_size = sizeof(state.null_count_);
+      break;
+    case AggregateOp::AGGREGATE_SUM:
+      result = &state.sum_;
+      result_size = sizeof(state.sum_);
+      break;
+    case AggregateOp::AGGREGATE_MIN:
+      result = &state.min_;
+      result_size = state.has_min_max_ ? sizeof(T) : 0;
+      break;
+    case AggregateOp::AGGREGATE_MAX:
+      result = &state.max_;
+      result_size = state.has_min_max_ ? sizeof(T) : 0;
+      break;
+    default:
+      return logger_->status(
+          Status_ReaderError("Cannot compute aggregate; Unknown operator"));
+  }
+
+  if (*value_size < result_size) {
+    return logger_->status(Status_ReaderError(
+        "Cannot compute aggregate; Value buffer of " +
+        std::to_string(*value_size) + " bytes is too small for a " +
+        std::to_string(result_size) + " bytes value"));
+  }
+
+  std::memcpy(value, result, result_size);
+  *value_size = result_size;
+
+  return Status::Ok();
+}
+
+template <class T>
+Status AggregateReader::reduce_tile_metadata(
+    const std::string& name,
+    AggregateOp op,
+    unsigned f,
+    uint64_t t,
+    AggregateState<T>* state) const {
+  auto& fragment = fragment_metadata_[f];
+  const auto cell_num = fragment->cell_num(t);
+  state->count_ += cell_num;
+  if (op == AggregateOp::AGGREGATE_COUNT) {
+    return Status::Ok();
+  }
+
+  uint64_t null_count = 0;
+  if (array_schema_.is_nullable(name)) {
+    auto&& [st, tile_null_count] = fragment->get_tile_null_count(name, t);
+    RETURN_NOT_OK(st);
+    null_count = *tile_null_count;
+  }
+  state->null_count_ += null_count;
+
+  if (op == AggregateOp::AGGREGATE_SUM) {
+    auto&& [st, sum] = fragment->get_tile_sum(name, t);
+    RETURN_NOT_OK(st);
+    typename AggregateState<T>::sum_type tile_sum;
+    std::memcpy(&tile_sum, *sum, sizeof(tile_sum));
+    state->add_to_sum(tile_sum);
+  } else if (
+      (op == AggregateOp::AGGREGATE_MIN || op == AggregateOp::AGGREGATE_MAX) &&
+      null_count != cell_num) {
+    // Tiles with only nulls have no min and max values.
+    auto&& [st_min, min, min_size] = fragment->get_tile_min(name, t);
+    RETURN_NOT_OK(st_min);
+    auto&& [st_max, max, max_size] = fragment->get_tile_max(name, t);
+    RETURN_NOT_OK(st_max);
+    T tile_min, tile_max;
+    std::memcpy(&tile_min, *min, sizeof(T));
+    std::memcpy(&tile_max, *max, sizeof(T));
+    state->add_min_max(tile_min, tile_max);
+  }
+
+  return Status::Ok();
+}
+
+template <class T>
+Status AggregateReader::reduce_tiles(
+    const std::string& name,
+    AggregateOp op,
+    const std::vector<std::pair<unsigned, uint64_t>>& tiles,
+    AggregateState<T>* state) {
+  auto timer_se = stats_->start_timer("reduce_tiles");
+
+  // Create the result tiles.
+  std::vector<UnorderedWithDupsResultTile<uint8_t>> result_tiles;
+  std::vector<ResultTile*> result_tile_ptrs;
+  result_tiles.reserve(tiles.size());
+  result_tile_ptrs.reserve(tiles.size());
+  for (const auto& tile : tiles) {
+    result_tiles.emplace_back(
+        tile.first, tile.second, *fragment_metadata_[tile.first]);
+  }
+  for (auto& rt : result_tiles) {
+    result_tile_ptrs.emplace_back(&rt);
+  }
+
+  RETURN_NOT_OK(
+      read_and_unfilter_tiles(name, op, false, false, result_tile_ptrs));
+
+  // Reduce every tile in parallel.
+  const bool nullable = op != AggregateOp::AGGREGATE_COUNT &&
+                        array_schema_.is_nullable(name);
+  const bool use_values = op == AggregateOp::AGGREGATE_SUM ||
+                          op == AggregateOp::AGGREGATE_MIN ||
+                          op == AggregateOp::AGGREGATE_MAX;
+  std::vector<AggregateState<T>> states(result_tiles.size());
+  auto status = parallel_for(
+      storage_manager_->compute_tp(),
+      0,
+      result_tiles.size(),
+      [&](uint64_t i) {
+        auto& rt = result_tiles[i];
+        RETURN_NOT_OK(compute_tile_bitmap(&rt));
+
+        const T* values = nullptr;
+        const uint8_t* validity = nullptr;
+        if (nullable || use_values) {
+          auto tile_tuple = rt.tile_tuple(name);
+          if (use_values) {
+            values = std::get<0>(*tile_tuple).template data_as<T>();
+          }
+          if (nullable) {
+            validity = std::get<2>(*tile_tuple).template data_as<uint8_t>();
+          }
+        }
+
+        const auto& bitmap = rt.bitmap();
+        const auto cell_num =
+            fragment_metadata_[rt.frag_idx()]->cell_num(rt.tile_idx());
+        auto& tile_state = states[i];
+        for (uint64_t c = 0; c < cell_num; c++) {
+          if (!bitmap.empty() && bitmap[c] == 0) {
+            continue;
+          }
+
+          tile_state.count_++;
+          if (validity != nullptr && validity[c] == 0) {
+            tile_state.null_count_++;
+            continue;
+          }
+
+          if (op == AggregateOp::AGGREGATE_SUM) {
+            tile_state.add_to_sum(
+                static_cast<typename AggregateState<T>::sum_type>(values[c]));
+          } else if (use_values) {
+            tile_state.add_min_max(values[c], values[c]);
+          }
+        }
+
+        return Status::Ok();
+      });
+  RETURN_NOT_OK_ELSE(status, logger_->status(status));
+
+  for (const auto& tile_state : states) {
+    state->merge(tile_state);
+  }
+
+  return Status::Ok();
+}
+
+template <class T>
+Status AggregateReader::reconcile_tiles(
+    const std::string& name,
+    AggregateOp op,
+    const std::vector<std::pair<unsigned, uint64_t>>& tiles,
+    LatestCells<T>* latest_cells,
+    AggregateState<T>* state) {
+  auto timer_se = stats_->start_timer("reconcile_tiles");
+
+  // Create the result tiles.
+  std::vector<UnorderedWithDupsResultTile<uint8_t>> result_tiles;
+  std::vector<ResultTile*> result_tile_ptrs;
+  result_tiles.reserve(tiles.size());
+  result_tile_ptrs.reserve(tiles.size());
+  for (const auto& tile : tiles) {
+    result_tiles.emplace_back(
+        tile.first, tile.second, *fragment_metadata_[tile.first]);
+  }
+  for (auto& rt : result_tiles) {
+    result_tile_ptrs.emplace_back(&rt);
+  }
+
+  // The coordinates identify the cells to deduplicate.
+  const bool dups = array_schema_.allows_dups();
+  RETURN_NOT_OK(
+      read_and_unfilter_tiles(name, op, !dups, true, result_tile_ptrs));
+
+  // Collect the cells written in the array open timestamps, in parallel.
+  const bool nullable = op != AggregateOp::AGGREGATE_COUNT &&
+                        array_schema_.is_nullable(name);
+  const bool use_values = op == AggregateOp::AGGREGATE_SUM ||
+                          op == AggregateOp::AGGREGATE_MIN ||
+                          op == AggregateOp::AGGREGATE_MAX;
+  const auto timestamp_start = array_->timestamp_start();
+  const auto timestamp_end = array_->timestamp_end_opened_at();
+  const auto dim_num = array_schema_.dim_num();
+  std::vector<AggregateState<T>> states(result_tiles.size());
+  std::vector<std::vector<std::pair<std::string, LatestCell<T>>>> tile_cells(
+      result_tiles.size());
+  auto status = parallel_for(
+      storage_manager_->compute_tp(),
+      0,
+      result_tiles.size(),
+      [&](uint64_t i) {
+        auto& rt = result_tiles[i];
+        const auto f = rt.frag_idx();
+        const auto cell_num = fragment_metadata_[f]->cell_num(rt.tile_idx());
+
+        // Without duplicates, the latest cell of a coordinate hides the
+        // others even if it is not a result, so the cells in the subarray
+        // are kept apart from the cells satisfying the query condition.
+        std::vector<uint8_t> in_subarray;
+        if (dups) {
+          RETURN_NOT_OK(compute_tile_bitmap(&rt));
+        } else {
+          RETURN_NOT_OK(compute_tile_bitmap(&rt, false));
+          in_subarray = rt.bitmap();
+          if (!condition_.empty()) {
+            if (!rt.has_bmp()) {
+              rt.alloc_bitmap();
+            } else {
+              std::fill(rt.bitmap().begin(), rt.bitmap().end(), 1);
+            }
+            RETURN_NOT_OK(condition_.apply_sparse<uint8_t>(
+                *(fragment_metadata_[f]->array_schema().get()),
+                rt,
+                rt.bitmap()));
+          }
+        }
+        const auto& bitmap = rt.bitmap();
+
+        const T* values = nullptr;
+        const uint8_t* validity = nullptr;
+        if (nullable || use_values) {
+          auto tile_tuple = rt.tile_tuple(name);
+          if (use_values) {
+            values = std::get<0>(*tile_tuple).template data_as<T>();
+          }
+          if (nullable) {
+            validity = std::get<2>(*tile_tuple).template data_as<uint8_t>();
+          }
+        }
+
+        const uint64_t* timestamps = nullptr;
+        if (include_timestamps(f)) {
+          timestamps = std::get<0>(*rt.tile_tuple(constants::timestamps))
+                           .template data_as<uint64_t>();
+        }
+
+        auto& tile_state = states[i];
+        for (uint64_t c = 0; c < cell_num; c++) {
+          if (timestamps != nullptr && (timestamps[c] < timestamp_start ||
+                                        timestamps[c] > timestamp_end)) {
+            continue;
+          }
+
+          const bool result = bitmap.empty() || bitmap[c] != 0;
+          if (dups) {
+            if (!result) {
+              continue;
+            }
+
+            tile_state.count_++;
+            if (validity != nullptr && validity[c] == 0) {
+              tile_state.null_count_++;
+            } else if (op == AggregateOp::AGGREGATE_SUM) {
+              tile_state.add_to_sum(
+                  static_cast<typename AggregateState<T>::sum_type>(
+                      values[c]));
+            } else if (use_values) {
+              tile_state.add_min_max(values[c], values[c]);
+            }
+            continue;
+          }
+
+          if (!in_subarray.empty() && in_subarray[c] == 0) {
+            continue;
+          }
+
+          std::string key;
+          for (unsigned d = 0; d < dim_num; d++) {
+            if (array_schema_.dimension_ptr(d)->var_size()) {
+              const auto coord = rt.coord_string(c, d);
+              const uint64_t size = coord.size();
+              key.append(reinterpret_cast<const char*>(&size), sizeof(size));
+              key.append(coord.data(), coord.size());
+            } else {
+              key.append(
+                  static_cast<const char*>(rt.coord(c, d)),
+                  array_schema_.dimension_ptr(d)->coord_size());
+            }
+          }
+
+          LatestCell<T> cell;
+          if (timestamps != nullptr) {
+            cell.timestamp_ = timestamps[c];
+          }
+          cell.frag_idx_ = f;
+          cell.result_ = result;
+          cell.null_ = validity != nullptr && validity[c] == 0;
+          if (use_values && !cell.null_) {
+            cell.value_ = values[c];
+          }
+          tile_cells[i].emplace_back(std::move(key), cell);
+        }
+
+        return Status::Ok();
+      });
+  RETURN_NOT_OK_ELSE(status, logger_->status(status));
+
+  for (const auto& tile_state : states) {
+    state->merge(tile_state);
+  }
+
+  for (auto& cells : tile_cells) {
+    for (auto& cell : cells) {
+      auto it = latest_cells->find(cell.first);
+      if (it == latest_cells->end()) {
+        latest_cells->emplace(std::move(cell.first), cell.second);
+      } else if (cell.second.newer_than(it->second)) {
+        it->second = cell.second;
+      }
+    }
+  }
+
+  return Status::Ok();
+}
+
+template <class T>
+void AggregateReader::reduce_latest_cells(
+    AggregateOp op,
+    const LatestCells<T>& latest_cells,
+    AggregateState<T>* state) const {
+  for (const auto& entry : latest_cells) {
+    const auto& cell = entry.second;
+    if (!cell.result_) {
+      continue;
+    }
+
+    state->count_++;
+    if (cell.null_) {
+      state->null_count_++;
+    } else if (op == AggregateOp::AGGREGATE_SUM) {
+      state->add_to_sum(
+          static_cast<typename AggregateState<T>::sum_type>(cell.value_));
+    } else if (
+        op == AggregateOp::AGGREGATE_MIN || op == AggregateOp::AGGREGATE_MAX) {
+      state->add_min_max(cell.value_, cell.value_);
+    }
+  }
+}
+
+Status AggregateReader::read_and_unfilter_tiles(
+    const std::string& name,
+    AggregateOp op,
+    const bool with_coords,
+    const bool with_timestamps,
+    const std::vector<ResultTile*>& result_tiles) {
+  // Read and unfilter the coordinates, timestamps, query condition fields and
+  // aggregated attribute in a single batch.
+  std::vector<std::string> names;
+  if (with_coords || subarray_.is_set()) {
+    names.emplace_back(constants::coords);
+    for (unsigned d = 0; d < array_schema_.dim_num(); d++) {
+      names.emplace_back(array_schema_.dimension_ptr(d)->name());
+    }
+  }
+  if (with_timestamps) {
+    names.emplace_back(constants::timestamps);
+  }
+  if (!condition_.empty()) {
+    for (const auto& field_name : condition_.field_names()) {
+      if (std::find(names.begin(), names.end(), field_name) == names.end()) {
+        names.emplace_back(field_name);
+      }
+    }
+  }
+  if (op != AggregateOp::AGGREGATE_COUNT &&
+      std::find(names.begin(), names.end(), name) == names.end()) {
+    names.emplace_back(name);
+  }
+  RETURN_NOT_OK(read_tiles(names, result_tiles));
+  for (const auto& field_name : names) {
+    RETURN_NOT_OK(unfilter_tiles(field_name, result_tiles));
+  }
+
+  return Status::Ok();
+}
+
+Status AggregateReader::compute_tile_bitmap(
+    UnorderedWithDupsResultTile<uint8_t>* rt, const bool apply_condition) {
+  const auto& fragment = fragment_metadata_[rt->frag_idx()];
+  const auto cell_num = fragment->cell_num(rt->tile_idx());
+
+  // Keep the cells that fall in the subarray.
+  if (subarray_.is_set()) {
+    rt->alloc_bitmap();
+
+    const auto& domain = array_schema_.domain();
+    const auto& mbr = fragment->mbr(rt->tile_idx());
+    for (unsigned d = 0; d < array_schema_.dim_num(); d++) {
+      if (subarray_.is_default(d)) {
+        continue;
+      }
+
+      const auto& ranges_for_dim = subarray_.ranges_for_dim(d);
+      std::vector<uint64_t> relevant_ranges;
+      domain.dimension_ptr(d)->relevant_ranges(
+          ranges_for_dim, mbr[d], relevant_ranges);
+      RETURN_NOT_OK(rt->compute_results_count_sparse(
+          d,
+          ranges_for_dim,
+          relevant_ranges,
+          rt->bitmap(),
+          array_schema_.cell_order(),
+          0,
+          cell_num));
+    }
+  }
+
+  // Keep the cells that satisfy the query condition.
+  if (apply_condition && !condition_.empty()) {
+    if (!rt->has_bmp()) {
+      rt->alloc_bitmap();
+    }
+
+    RETURN_NOT_OK(condition_.apply_sparse<uint8_t>(
+        *(fragment->array_schema().get()), *rt, rt->bitmap()));
+  }
+
+  return Status::Ok();
+}
+
+}  // namespace sm
+}  // namespace tiledb
@@ -0,0 +1,365 @@
+/**
+ * @file   aggregate_reader.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class AggregateReader.
+ */
+
+#ifndef TILEDB_AGGREGATE_READER_H
+#define TILEDB_AGGREGATE_READER_H
+
+#include <atomic>
+#include <string>
+#include <unordered_map>
+
+#include "tiledb/common/common.h"
+#include "tiledb/common/logger_public.h"
+#include "tiledb/common/status.h"
+#include "tiledb/sm/enums/aggregate_op.h"
+#include "tiledb/sm/query/query_buffer.h"
+#include "tiledb/sm/query/query_condition.h"
+#include "tiledb/sm/query/readers/reader_base.h"
+#include "tiledb/sm/query/readers/result_tile.h"
+#include "tiledb/sm/tile/tile_metadata_generator.h"
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+class Array;
+class StorageManager;
+
+/**
+ * Computes an aggregate (count, sum, min, max or null count) over the cells
+ * of a sparse array that fall in the query subarray and satisfy the query
+ * condition.
+ *
+ * Tiles that are fully covered by the subarray, and that the query condition
+ * fully matches, are reduced from the tile metadata stored in the fragment
+ * metadata. Only the remaining tiles are read, unfiltered and reduced cell by
+ * cell, in parallel on the compute thread pool.
+ *
+ * The cells of fragments that overlap other fragments of an array without
+ * duplicates, or that were consolidated with timestamps, are not reduced
+ * from the tile metadata: their tiles are read, the cells outside of the
+ * array open timestamps are filtered out and, without duplicates, only the
+ * latest cell of each coordinate is reduced.
+ */
+class AggregateReader : public ReaderBase {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /** Constructor. */
+  AggregateReader(
+      stats::Stats* stats,
+      shared_ptr<Logger> logger,
+      StorageManager* storage_manager,
+      Array* array,
+      Config& config,
+      std::unordered_map<std::string, QueryBuffer>& buffers,
+      Subarray& subarray,
+      Layout layout,
+      QueryCondition& condition);
+
+  /** Destructor. */
+  ~AggregateReader() = default;
+
+  DISABLE_COPY_AND_COPY_ASSIGN(AggregateReader);
+  DISABLE_MOVE_AND_MOVE_ASSIGN(AggregateReader);
+
+  /* ********************************* */
+  /*                 API               */
+  /* ********************************* */
+
+  /**
+   * Computes an aggregate on an attribute.
+   *
+   * `AGGREGATE_COUNT` and `AGGREGATE_NULL_COUNT` produce a `uint64_t`.
+   * `AGGREGATE_SUM` produces an `int64_t`, `uint64_t` or `double`, following
+   * the sum type of the tile metadata, and saturates on overflow.
+   * `AGGREGATE_MIN` and `AGGREGATE_MAX` produce a value of the attribute
+   * type, or nothing if there is no non-null value.
+   *
+   * @param name The attribute name. Ignored for `AGGREGATE_COUNT`.
+   * @param op The aggregate operator.
+   * @param value The buffer receiving the aggregate value.
+   * @param value_size On input, the size of `value` in bytes. On output, the
+   *     size of the aggregate value, which is 0 if there is no value.
+   * @return Status
+   */
+  Status compute(
+      const std::string& name,
+      AggregateOp op,
+      void* value,
+      uint64_t* value_size);
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** UID of the logger instance */
+  inline static std::atomic<uint64_t> logger_id_ = 0;
+
+  /* ********************************* */
+  /*         PRIVATE DATATYPES         */
+  /* ********************************* */
+
+  /** The partial state of an aggregate, merged across tiles. */
+  template <class T>
+  struct AggregateState {
+    /** The sum type of `T`. */
+    typedef typename metadata_generator_type_data<T>::sum_type sum_type;
+
+    /** Number of cells. */
+    uint64_t count_ = 0;
+
+    /** Number of null cells. */
+    uint64_t null_count_ = 0;
+
+    /** Sum of the non-null values. */
+    sum_type sum_ = 0;
+
+    /** Minimum of the non-null values. */
+    T min_ = metadata_generator_type_data<T>::min;
+
+    /** Maximum of the non-null values. */
+    T max_ = metadata_generator_type_data<T>::max;
+
+    /** True if `min_` and `max_` were set from at least one value. */
+    bool has_min_max_ = false;
+
+    /** Merges another state into this one. */
+    void merge(const AggregateState<T>& other);
+
+    /** Adds a value to the sum, saturating on overflow. */
+    void add_to_sum(sum_type value);
+
+    /** Adds a minimum and maximum value to the state. */
+    void add_min_max(T min, T max);
+  };
+
+  /** The latest cell found for a coordinate, when deduplicating cells. */
+  template <class T>
+  struct LatestCell {
+    /** The timestamp of the cell, if its fragment has cell timestamps. */
+    optional<uint64_t> timestamp_;
+
+    /** The fragment index of the cell. */
+    unsigned frag_idx_ = 0;
+
+    /** True if the cell is in the subarray and satisfies the condition. */
+    bool result_ = false;
+
+    /** True if the aggregated attribute is null for the cell. */
+    bool null_ = false;
+
+    /** The aggregated attribute value of the cell. */
+    T value_ = T();
+
+    /**
+     * Returns true if this cell was written after `other`, from the cell
+     * timestamps if both have one, otherwise from the fragment order.
+     */
+    bool newer_than(const LatestCell<T>& other) const {
+      if (timestamp_.has_value() && other.timestamp_.has_value() &&
+          *timestamp_ != *other.timestamp_) {
+        return *timestamp_ > *other.timestamp_;
+      }
+
+      return frag_idx_ >= other.frag_idx_;
+    }
+  };
+
+  /** The latest cell of each coordinate, keyed by the coordinate bytes. */
+  template <class T>
+  using LatestCells = std::unordered_map<std::string, LatestCell<T>>;
+
+  /* ********************************* */
+  /*         PRIVATE METHODS           */
+  /* ********************************* */
+
+  /**
+   * Checks that the aggregated attribute is present in all the fragments.
+   *
+   * @param name The attribute name.
+   * @param op The aggregate operator.
+   * @return Status
+   */
+  Status check_fragments(const std::string& name, AggregateOp op) const;
+
+  /**
+   * Returns, for every fragment, true if its cells must be deduplicated or
+   * filtered by timestamp, i.e. if it overlaps another relevant fragment of
+   * an array without duplicates, or if its cells have timestamps that must
+   * be read.
+   */
+  std::vector<bool> fragments_to_reconcile() const;
+
+  /**
+   * Loads the tile offsets, var sizes and tile metadata required to compute
+   * the aggregate.
+   *
+   * @param name The attribute name.
+   * @param op The aggregate operator.
+   * @param load_timestamps True if the cell timestamps are read.
+   * @return Status
+   */
+  Status load_tile_data(
+      const std::string& name, AggregateOp op, bool load_timestamps);
+
+  /**
+   * Returns true if the MBR of a tile is fully covered by the subarray.
+   *
+   * @param f The fragment index.
+   * @param t The tile index.
+   */
+  bool tile_covered(unsigned f, uint64_t t) const;
+
+  /**
+   * Computes an aggregate on an attribute of type `T`.
+   *
+   * @param name The attribute name.
+   * @param op The aggregate operator.
+   * @param value The buffer receiving the aggregate value.
+   * @param value_size On input, the size of `value` in bytes. On output, the
+   *     size of the aggregate value.
+   * @return Status
+   */
+  template <class T>
+  Status compute(
+      const std::string& name,
+      AggregateOp op,
+      void* value,
+      uint64_t* value_size);
+
+  /**
+   * Reduces a tile from the tile metadata.
+   *
+   * @param name The attribute name.
+   * @param op The aggregate operator.
+   * @param f The fragment index.
+   * @param t The tile index.
+   * @param state The state to reduce into.
+   * @return Status
+   */
+  template <class T>
+  Status reduce_tile_metadata(
+      const std::string& name,
+      AggregateOp op,
+      unsigned f,
+      uint64_t t,
+      AggregateState<T>* state) const;
+
+  /**
+   * Reads the input tiles, computes which of their cells are results and
+   * reduces them, in parallel on the compute thread pool.
+   *
+   * @param name The attribute name.
+   * @param op The aggregate operator.
+   * @param tiles The (fragment index, tile index) of the tiles to reduce.
+   * @param state The state to reduce into.
+   * @return Status
+   */
+  template <class T>
+  Status reduce_tiles(
+      const std::string& name,
+      AggregateOp op,
+      const std::vector<std::pair<unsigned, uint64_t>>& tiles,
+      AggregateState<T>* state);
+
+  /**
+   * Reads the input tiles of fragments to reconcile, and reduces the cells
+   * written in the array open timestamps. Without duplicates, the cells are
+   * recorded in `latest_cells` instead, for `reduce_latest_cells` to reduce
+   * the latest cell of each coordinate once all tiles are read.
+   *
+   * @param name The attribute name.
+   * @param op The aggregate operator.
+   * @param tiles The (fragment index, tile index) of the tiles to reduce.
+   * @param latest_cells The latest cell of each coordinate.
+   * @param state The state to reduce into.
+   * @return Status
+   */
+  template <class T>
+  Status reconcile_tiles(
+      const std::string& name,
+      AggregateOp op,
+      const std::vector<std::pair<unsigned, uint64_t>>& tiles,
+      LatestCells<T>* latest_cells,
+      AggregateState<T>* state);
+
+  /**
+   * Reduces the latest cell of each coordinate.
+   *
+   * @param op The aggregate operator.
+   * @param latest_cells The latest cell of each coordinate.
+   * @param state The state to reduce into.
+   */
+  template <class T>
+  void reduce_latest_cells(
+      AggregateOp op,
+      const LatestCells<T>& latest_cells,
+      AggregateState<T>* state) const;
+
+  /**
+   * Reads and unfilters the given fields of the result tiles.
+   *
+   * @param name The attribute name.
+   * @param op The aggregate operator.
+   * @param with_coords True if the coordinates are always read.
+   * @param with_timestamps True if the cell timestamps are read.
+   * @param result_tiles The result tiles.
+   * @return Status
+   */
+  Status read_and_unfilter_tiles(
+      const std::string& name,
+      AggregateOp op,
+      bool with_coords,
+      bool with_timestamps,
+      const std::vector<ResultTile*>& result_tiles);
+
+  /**
+   * Computes the result bitmap of a tile, from the subarray and the query
+   * condition. An empty bitmap means that all cells are results.
+   *
+   * @param rt The result tile.
+   * @param apply_condition True if the query condition is applied.
+   * @return Status
+   */
+  Status compute_tile_bitmap(
+      UnorderedWithDupsResultTile<uint8_t>* rt, bool apply_condition = true);
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_AGGREGATE_READER_H
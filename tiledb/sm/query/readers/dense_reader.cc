@@ -378,6 +378,8 @@ Status DenseReader::dense_read() {
   // in query condition to be read.
   RETURN_CANCEL_OR_ERROR(
       load_tile_offsets(read_state_.partitioner_.subarray(), names));
+  RETURN_CANCEL_OR_ERROR(load_query_condition_tile_metadata(
+      read_state_.partitioner_.subarray()));
 
   auto&& [st, qc_result] = apply_query_condition<DimType, OffType>(
       subarray,
@@ -557,11 +559,41 @@ DenseReader::apply_query_condition(
       qc_names.emplace_back(name);
     }
 
-    // Read and unfilter query condition attributes.
-    RETURN_CANCEL_OR_ERROR_TUPLE(read_attribute_tiles(qc_names, result_tiles));
+    // Evaluate the query condition on the tile metadata. The tiles where
+    // all or no cells match are not evaluated cell by cell.
+    std::unordered_map<const ResultTile*, QueryCondition::TileMatch>
+        tile_matches;
+    std::vector<ResultTile*> qc_result_tiles;
+    for (auto rt : result_tiles) {
+      auto match = tile_match(rt->frag_idx(), rt->tile_idx());
+      tile_matches.emplace(rt, match);
+      if (match == QueryCondition::TileMatch::SOME) {
+        qc_result_tiles.emplace_back(rt);
+      }
+    }
+
+    // Read and unfilter query condition attributes. The attributes that are
+    // only used by the query condition are not read for the tiles that are
+    // not evaluated cell by cell.
+    std::vector<std::string> qc_only_names;
+    std::vector<std::string> qc_copied_names;
     for (auto& name : qc_names) {
+      if (buffers_.count(name) == 0) {
+        qc_only_names.emplace_back(name);
+      } else {
+        qc_copied_names.emplace_back(name);
+      }
+    }
+    RETURN_CANCEL_OR_ERROR_TUPLE(
+        read_attribute_tiles(qc_copied_names, result_tiles));
+    RETURN_CANCEL_OR_ERROR_TUPLE(
+        read_attribute_tiles(qc_only_names, qc_result_tiles));
+    for (auto& name : qc_copied_names) {
       RETURN_CANCEL_OR_ERROR_TUPLE(unfilter_tiles(name, result_tiles));
     }
+    for (auto& name : qc_only_names) {
+      RETURN_CANCEL_OR_ERROR_TUPLE(unfilter_tiles(name, qc_result_tiles));
+    }
 
     if (stride == UINT64_MAX) {
       stride = 1;
@@ -625,16 +657,27 @@ DenseReader::apply_query_condition(
                   }
                 }
 
-                RETURN_NOT_OK(condition_.apply_dense(
-                    *(fragment_metadata_[frag_domains[i].fid()]
-                          ->array_schema()
-                          .get()),
-                    it->second.result_tile(frag_domains[i].fid()),
-                    start,
-                    end - start + 1,
-                    iter.pos_in_tile(),
-                    stride,
-                    dest_ptr));
+                auto rt = it->second.result_tile(frag_domains[i].fid());
+                auto match = tile_matches.find(rt);
+                if (match != tile_matches.end() &&
+                    match->second == QueryCondition::TileMatch::NONE) {
+                  for (uint64_t c = start; c <= end; c++) {
+                    dest_ptr[c] = 0;
+                  }
+                } else if (
+                    match == tile_matches.end() ||
+                    match->second == QueryCondition::TileMatch::SOME) {
+                  RETURN_NOT_OK(condition_.apply_dense(
+                      *(fragment_metadata_[frag_domains[i].fid()]
+                            ->array_schema()
+                            .get()),
+                      rt,
+                      start,
+                      end - start + 1,
+                      iter.pos_in_tile(),
+                      stride,
+                      dest_ptr));
+                }
               }
             }
 
@@ -77,9 +77,23 @@ ReaderBase::ReaderBase(
     , condition_(condition)
     , disable_cache_(false)
     , user_requested_timestamps_(false)
-    , use_timestamps_(false) {
+    , use_timestamps_(false)
+    , qc_tile_pruned_num_stat_(stats_->register_stat("qc_tile_pruned_num"))
+    , qc_tile_full_match_num_stat_(
+          stats_->register_stat("qc_tile_full_match_num")) {
   if (array != nullptr)
     fragment_metadata_ = array->fragment_metadata();
+
+  // Keep the latency histograms of the main reader phases.
+  for (const auto& stat :
+       {"dowork",
+        "load_tile_offsets",
+        "load_tile_var_sizes",
+        "read_tiles",
+        "unfilter_attr_tiles",
+        "unfilter_coord_tiles"}) {
+    stats_->register_histogram(stat);
+  }
 }
 
 /* ********************************* */
@@ -341,6 +355,72 @@ Status ReaderBase::load_tile_offsets(
   return Status::Ok();
 }
 
+Status ReaderBase::load_query_condition_tile_metadata(Subarray& subarray) {
+  if (condition_.empty()) {
+    return Status::Ok();
+  }
+
+  auto timer_se = stats_->start_timer("load_query_condition_tile_metadata");
+  const auto encryption_key = array_->encryption_key();
+
+  // Fetch relevant fragments so we load tile metadata only from intersecting
+  // fragments
+  const auto relevant_fragments = subarray.relevant_fragments();
+
+  bool all_frag = !subarray.is_set();
+
+  const auto status = parallel_for(
+      storage_manager_->compute_tp(),
+      0,
+      all_frag ? fragment_metadata_.size() : relevant_fragments->size(),
+      [&](const uint64_t i) {
+        auto frag_idx = all_frag ? i : relevant_fragments->at(i);
+        auto& fragment = fragment_metadata_[frag_idx];
+
+        // Only attributes have tile min, max and null count values.
+        std::vector<std::string> min_max_names;
+        std::vector<std::string> null_count_names;
+        const auto& schema = fragment->array_schema();
+        for (const auto& name : condition_.field_names()) {
+          // Not a member of array schema, this field was added in array
+          // schema evolution, ignore for this fragment's tile metadata.
+          const auto attribute = schema->attribute(name);
+          if (attribute == nullptr) {
+            continue;
+          }
+
+          min_max_names.emplace_back(name);
+          if (attribute->nullable()) {
+            null_count_names.emplace_back(name);
+          }
+        }
+
+        RETURN_NOT_OK(fragment->load_tile_min_values(
+            *encryption_key, std::vector<std::string>(min_max_names)));
+        RETURN_NOT_OK(fragment->load_tile_max_values(
+            *encryption_key, std::move(min_max_names)));
+        RETURN_NOT_OK(fragment->load_tile_null_count_values(
+            *encryption_key, std::move(null_count_names)));
+        return Status::Ok();
+      });
+
+  RETURN_NOT_OK(status);
+
+  return Status::Ok();
+}
+
+QueryCondition::TileMatch ReaderBase::tile_match(
+    unsigned frag_idx, uint64_t tile_idx) {
+  auto match = condition_.tile_match(*fragment_metadata_[frag_idx], tile_idx);
+  if (match == QueryCondition::TileMatch::NONE) {
+    stats_->add_counter(qc_tile_pruned_num_stat_, 1);
+  } else if (match == QueryCondition::TileMatch::ALL) {
+    stats_->add_counter(qc_tile_full_match_num_stat_, 1);
+  }
+
+  return match;
+}
+
 Status ReaderBase::load_tile_var_sizes(
     Subarray& subarray, const std::vector<std::string>& names) {
   auto timer_se = stats_->start_timer("load_tile_var_sizes");
@@ -493,6 +573,19 @@ Status ReaderBase::read_tiles(
       all_regions;
 
   uint64_t num_tiles_read = 0;
+  uint64_t num_tile_cache_hits = 0;
+  uint64_t num_tile_cache_misses = 0;
+  uint64_t num_unfiltered_tile_cache_hits = 0;
+  uint64_t num_unfiltered_tile_cache_misses = 0;
+  const bool use_unfiltered_cache =
+      storage_manager_->unfiltered_tile_cache_enabled();
+  uint64_t num_mmap_tiles = 0;
+  uint64_t num_mmap_zero_copy_tiles = 0;
+  const bool use_mmap =
+      storage_manager_->vfs()->mmap_enabled() &&
+      array_->get_encryption_key().encryption_type() ==
+          EncryptionType::NO_ENCRYPTION;
+  TileBufferPool* const tile_buffer_pool = storage_manager_->tile_buffer_pool();
 
   // Run all tiles and attributes.
   for (auto name : names) {
@@ -565,6 +658,33 @@ Status ReaderBase::read_tiles(
           RETURN_NOT_OK(init_tile(format_version, name, t, t_var));
       }
 
+      // Try the unfiltered tile cache first. Zipped coordinates are never
+      // cached as they need post-processing after unfiltering.
+      if (use_unfiltered_cache && name != constants::coords) {
+        bool unfiltered_cache_hit = false;
+        RETURN_NOT_OK(read_unfiltered_tile_from_cache(
+            name, tile, var_size, nullable, &unfiltered_cache_hit));
+        if (unfiltered_cache_hit) {
+          num_unfiltered_tile_cache_hits++;
+          continue;
+        }
+        num_unfiltered_tile_cache_misses++;
+      }
+
+      // Read local tiles from the memory-mapped fragment files. Zipped
+      // coordinates are excluded as they are modified after unfiltering.
+      if (use_mmap && name != constants::coords) {
+        bool mapped = false, zero_copy = false;
+        RETURN_NOT_OK(read_tile_from_mmap(
+            name, tile, var_size, nullable, &mapped, &zero_copy));
+        if (mapped) {
+          num_mmap_tiles++;
+          if (zero_copy)
+            num_mmap_zero_copy_tiles++;
+          continue;
+        }
+      }
+
       // Get information about the tile in its fragment
       auto&& [status, tile_attr_uri] = fragment->uri(name);
       RETURN_NOT_OK(status);
@@ -581,11 +701,14 @@ Status ReaderBase::read_tiles(
       bool cache_hit = false;
       if (!disable_cache_) {
         RETURN_NOT_OK(storage_manager_->read_from_cache(
-            *tile_attr_uri,
-            tile_attr_offset,
+            tile_cache_key(name, tile, TileCacheFile::FIXED),
             t->filtered_buffer(),
             *tile_persisted_size,
             &cache_hit));
+        if (cache_hit)
+          num_tile_cache_hits++;
+        else
+          num_tile_cache_misses++;
       }
 
       if (!cache_hit) {
@@ -593,11 +716,13 @@ Status ReaderBase::read_tiles(
         all_regions[*tile_attr_uri].emplace_back(
             tile_attr_offset, t, *tile_persisted_size);
 
-        t->filtered_buffer().expand(*tile_persisted_size);
+        RETURN_NOT_OK(t->filtered_buffer().expand(
+            *tile_persisted_size, tile_buffer_pool));
       }
 
       // Pre-allocate the unfiltered buffer.
-      RETURN_NOT_OK(t->alloc_data(tile_size));
+      if (t->data() == nullptr)
+        RETURN_NOT_OK(t->alloc_data(tile_size, tile_buffer_pool));
 
       if (var_size) {
         auto&& [status, tile_attr_var_uri] = fragment->var_uri(name);
@@ -614,11 +739,14 @@ Status ReaderBase::read_tiles(
 
         if (!disable_cache_) {
           RETURN_NOT_OK(storage_manager_->read_from_cache(
-              *tile_attr_var_uri,
-              tile_attr_var_offset,
+              tile_cache_key(name, tile, TileCacheFile::VAR),
               t_var->filtered_buffer(),
               *tile_var_persisted_size,
               &cache_hit));
+          if (cache_hit)
+            num_tile_cache_hits++;
+          else
+            num_tile_cache_misses++;
         }
 
         if (!cache_hit) {
@@ -626,11 +754,13 @@ Status ReaderBase::read_tiles(
           all_regions[*tile_attr_var_uri].emplace_back(
               tile_attr_var_offset, t_var, *tile_var_persisted_size);
 
-          t_var->filtered_buffer().expand(*tile_var_persisted_size);
+          RETURN_NOT_OK(t_var->filtered_buffer().expand(
+              *tile_var_persisted_size, tile_buffer_pool));
         }
 
         // Pre-allocate the unfiltered buffer.
-        RETURN_NOT_OK(t_var->alloc_data(*tile_var_size));
+        if (t_var->data() == nullptr)
+          RETURN_NOT_OK(t_var->alloc_data(*tile_var_size, tile_buffer_pool));
       }
 
       if (nullable) {
@@ -648,11 +778,14 @@ Status ReaderBase::read_tiles(
 
         if (!disable_cache_) {
           RETURN_NOT_OK(storage_manager_->read_from_cache(
-              *tile_validity_attr_uri,
-              tile_attr_validity_offset,
+              tile_cache_key(name, tile, TileCacheFile::VALIDITY),
               t_validity->filtered_buffer(),
               *tile_validity_persisted_size,
               &cache_hit));
+          if (cache_hit)
+            num_tile_cache_hits++;
+          else
+            num_tile_cache_misses++;
         }
 
         if (!cache_hit) {
@@ -662,16 +795,33 @@ Status ReaderBase::read_tiles(
               t_validity,
               *tile_validity_persisted_size);
 
-          t_validity->filtered_buffer().expand(*tile_validity_persisted_size);
+          RETURN_NOT_OK(t_validity->filtered_buffer().expand(
+              *tile_validity_persisted_size, tile_buffer_pool));
         }
 
         // Pre-allocate the unfiltered buffer.
-        RETURN_NOT_OK(t_validity->alloc_data(tile_validity_size));
+        if (t_validity->data() == nullptr)
+          RETURN_NOT_OK(
+              t_validity->alloc_data(tile_validity_size, tile_buffer_pool));
       }
     }
   }
 
   stats_->add_counter("num_tiles_read", num_tiles_read);
+  if (!disable_cache_) {
+    stats_->add_counter("tile_cache_hit_num", num_tile_cache_hits);
+    stats_->add_counter("tile_cache_miss_num", num_tile_cache_misses);
+  }
+  if (use_unfiltered_cache) {
+    stats_->add_counter(
+        "unfiltered_tile_cache_hit_num", num_unfiltered_tile_cache_hits);
+    stats_->add_counter(
+        "unfiltered_tile_cache_miss_num", num_unfiltered_tile_cache_misses);
+  }
+  if (use_mmap) {
+    stats_->add_counter("mmap_tile_num", num_mmap_tiles);
+    stats_->add_counter("mmap_zero_copy_tile_num", num_mmap_zero_copy_tiles);
+  }
 
   // Do not use the read-ahead cache because tiles will be
   // cached in the tile cache.
@@ -681,14 +831,8 @@ Status ReaderBase::read_tiles(
   std::vector<ThreadPool::Task> tasks;
 
   // Enqueue all regions to be read.
-  for (const auto& item : all_regions) {
-    RETURN_NOT_OK(storage_manager_->vfs()->read_all(
-        item.first,
-        item.second,
-        storage_manager_->io_tp(),
-        &tasks,
-        use_read_ahead));
-  }
+  RETURN_NOT_OK(storage_manager_->vfs()->read_all(
+      all_regions, storage_manager_->io_tp(), &tasks, use_read_ahead));
 
   // Wait for the reads to finish and check statuses.
   auto statuses = storage_manager_->io_tp()->wait_all_status(tasks);
@@ -946,6 +1090,9 @@ Status ReaderBase::post_process_unfiltered_tile(
     auto t_var = &std::get<1>(*tile_tuple);
     auto t_validity = &std::get<2>(*tile_tuple);
 
+    RETURN_NOT_OK(
+        write_unfiltered_tile_to_cache(name, tile, var_size, nullable));
+
     t->filtered_buffer().clear();
 
     zip_tile_coordinates(name, t);
@@ -964,6 +1111,327 @@ Status ReaderBase::post_process_unfiltered_tile(
   return Status::Ok();
 }
 
+Status ReaderBase::read_unfiltered_tile_from_cache(
+    const std::string& name,
+    ResultTile* const tile,
+    const bool var_size,
+    const bool nullable,
+    bool* const hit) const {
+  *hit = false;
+
+  auto& fragment = fragment_metadata_[tile->frag_idx()];
+  const auto tile_idx = tile->tile_idx();
+  auto tile_tuple = tile->tile_tuple(name);
+  assert(tile_tuple != nullptr);
+  Tile* const t = &std::get<0>(*tile_tuple);
+  Tile* const t_var = &std::get<1>(*tile_tuple);
+  Tile* const t_validity = &std::get<2>(*tile_tuple);
+  TileBufferPool* const tile_buffer_pool = storage_manager_->tile_buffer_pool();
+
+  // Pre-allocate the unfiltered buffers. On a miss, they are kept for the
+  // unfiltering of the tile read from storage.
+  RETURN_NOT_OK(t->alloc_data(
+      fragment->tile_size(name, tile_idx), tile_buffer_pool));
+  if (var_size) {
+    auto&& [st, tile_var_size] = fragment->tile_var_size(name, tile_idx);
+    RETURN_NOT_OK(st);
+    RETURN_NOT_OK(t_var->alloc_data(*tile_var_size, tile_buffer_pool));
+  }
+  if (nullable) {
+    RETURN_NOT_OK(t_validity->alloc_data(
+        fragment->cell_num(tile_idx) * constants::cell_validity_size,
+        tile_buffer_pool));
+  }
+
+  // All the tiles for `name` must be in the cache.
+  RETURN_NOT_OK(storage_manager_->read_from_unfiltered_cache(
+      tile_cache_key(name, tile, TileCacheFile::FIXED),
+      t->data(),
+      t->size(),
+      hit));
+  if (!*hit)
+    return Status::Ok();
+
+  if (var_size) {
+    RETURN_NOT_OK(storage_manager_->read_from_unfiltered_cache(
+        tile_cache_key(name, tile, TileCacheFile::VAR),
+        t_var->data(),
+        t_var->size(),
+        hit));
+    if (!*hit)
+      return Status::Ok();
+  }
+
+  if (nullable) {
+    RETURN_NOT_OK(storage_manager_->read_from_unfiltered_cache(
+        tile_cache_key(name, tile, TileCacheFile::VALIDITY),
+        t_validity->data(),
+        t_validity->size(),
+        hit));
+  }
+
+  return Status::Ok();
+}
+
+Status ReaderBase::read_tile_from_mmap(
+    const std::string& name,
+    ResultTile* const tile,
+    const bool var_size,
+    const bool nullable,
+    bool* const mapped,
+    bool* const zero_copy) const {
+  *mapped = false;
+  *zero_copy = false;
+
+  auto& fragment = fragment_metadata_[tile->frag_idx()];
+  const auto tile_idx = tile->tile_idx();
+  auto tile_tuple = tile->tile_tuple(name);
+  assert(tile_tuple != nullptr);
+
+  // The location, size and filters of each of the tiles for `name`.
+  struct MappedTile {
+    Tile* tile_;
+    URI uri_;
+    uint64_t offset_;
+    uint64_t persisted_size_;
+    uint64_t size_;
+    const FilterPipeline& filters_;
+    shared_ptr<MmapFile> file_;
+  };
+  std::vector<MappedTile> mapped_tiles;
+  {
+    auto&& [st, uri] = fragment->uri(name);
+    RETURN_NOT_OK(st);
+    uint64_t offset;
+    RETURN_NOT_OK(fragment->file_offset(name, tile_idx, &offset));
+    auto&& [st_2, persisted_size] =
+        fragment->persisted_tile_size(name, tile_idx);
+    RETURN_NOT_OK(st_2);
+    mapped_tiles.push_back(
+        {&std::get<0>(*tile_tuple),
+         *uri,
+         offset,
+         *persisted_size,
+         fragment->tile_size(name, tile_idx),
+         var_size ? array_schema_.cell_var_offsets_filters() :
+                    array_schema_.filters(name),
+         nullptr});
+  }
+
+  if (var_size) {
+    auto&& [st, uri] = fragment->var_uri(name);
+    RETURN_NOT_OK(st);
+    uint64_t offset;
+    RETURN_NOT_OK(fragment->file_var_offset(name, tile_idx, &offset));
+    auto&& [st_2, persisted_size] =
+        fragment->persisted_tile_var_size(name, tile_idx);
+    RETURN_NOT_OK(st_2);
+    auto&& [st_3, size] = fragment->tile_var_size(name, tile_idx);
+    RETURN_NOT_OK(st_3);
+    mapped_tiles.push_back(
+        {&std::get<1>(*tile_tuple),
+         *uri,
+         offset,
+         *persisted_size,
+         *size,
+         array_schema_.filters(name),
+         nullptr});
+  }
+
+  if (nullable) {
+    auto&& [st, uri] = fragment->validity_uri(name);
+    RETURN_NOT_OK(st);
+    uint64_t offset;
+    RETURN_NOT_OK(fragment->file_validity_offset(name, tile_idx, &offset));
+    auto&& [st_2, persisted_size] =
+        fragment->persisted_tile_validity_size(name, tile_idx);
+    RETURN_NOT_OK(st_2);
+    mapped_tiles.push_back(
+        {&std::get<2>(*tile_tuple),
+         *uri,
+         offset,
+         *persisted_size,
+         fragment->cell_num(tile_idx) * constants::cell_validity_size,
+         array_schema_.cell_validity_filters(),
+         nullptr});
+  }
+
+  // Only map tiles whose chunk bytes are not transformed by their filters.
+  for (const auto& mapped_tile : mapped_tiles) {
+    if (!mapped_tile.uri_.is_file())
+      return Status::Ok();
+    for (unsigned i = 0; i < mapped_tile.filters_.size(); i++) {
+      const auto type = mapped_tile.filters_.get_filter(i)->type();
+      if (type != FilterType::FILTER_NONE &&
+          type != FilterType::FILTER_CHECKSUM_MD5 &&
+          type != FilterType::FILTER_CHECKSUM_SHA256)
+        return Status::Ok();
+    }
+  }
+
+  for (auto& mapped_tile : mapped_tiles) {
+    RETURN_NOT_OK(array_->mmap_file(mapped_tile.uri_, &mapped_tile.file_));
+    if (mapped_tile.offset_ + mapped_tile.persisted_size_ >
+        mapped_tile.file_->size()) {
+      return logger_->status(Status_ReaderError(
+          "Cannot read tile from '" + mapped_tile.uri_.to_string() +
+          "'; Tile exceeds the file size"));
+    }
+    mapped_tile.tile_->filtered_buffer().set_view(
+        mapped_tile.file_->data() + mapped_tile.offset_,
+        mapped_tile.persisted_size_,
+        mapped_tile.file_);
+  }
+  *mapped = true;
+
+  // The unfiltered data can be referenced in place if each tile is a single
+  // chunk whose checksums, if any, do not need to be validated. The data must
+  // also be aligned for its type.
+  bool skip_checksum_validation = false;
+  bool found = false;
+  RETURN_NOT_OK(storage_manager_->config().get<bool>(
+      "sm.skip_checksum_validation", &skip_checksum_validation, &found));
+  assert(found);
+
+  const uint64_t header_size = sizeof(uint64_t) + 3 * sizeof(uint32_t);
+  std::vector<char*> unfiltered_data(mapped_tiles.size(), nullptr);
+  for (size_t i = 0; i < mapped_tiles.size(); i++) {
+    const auto& mapped_tile = mapped_tiles[i];
+    const auto& buffer = mapped_tile.tile_->filtered_buffer();
+    if ((!mapped_tile.filters_.empty() && !skip_checksum_validation) ||
+        buffer.size() < header_size ||
+        buffer.value_at_as<uint64_t>(0) != 1)
+      break;
+
+    const auto unfiltered_size = buffer.value_at_as<uint32_t>(8);
+    const auto filtered_size = buffer.value_at_as<uint32_t>(12);
+    const auto metadata_size = buffer.value_at_as<uint32_t>(16);
+    char* const data = mapped_tile.tile_->filtered_buffer().data() +
+                       header_size + metadata_size;
+    if (unfiltered_size != mapped_tile.size_ ||
+        filtered_size != unfiltered_size ||
+        header_size + metadata_size + filtered_size != buffer.size() ||
+        reinterpret_cast<uintptr_t>(data) %
+                datatype_size(mapped_tile.tile_->type()) !=
+            0)
+      break;
+
+    unfiltered_data[i] = data;
+  }
+
+  if (std::find(unfiltered_data.begin(), unfiltered_data.end(), nullptr) ==
+      unfiltered_data.end()) {
+    for (size_t i = 0; i < mapped_tiles.size(); i++) {
+      auto& mapped_tile = mapped_tiles[i];
+      mapped_tile.tile_->set_data_view(
+          unfiltered_data[i], mapped_tile.size_, mapped_tile.file_);
+      mapped_tile.tile_->filtered_buffer().clear();
+    }
+    *zero_copy = true;
+    return Status::Ok();
+  }
+
+  // Pre-allocate the unfiltered buffers.
+  TileBufferPool* const tile_buffer_pool = storage_manager_->tile_buffer_pool();
+  for (auto& mapped_tile : mapped_tiles) {
+    if (mapped_tile.tile_->data() == nullptr)
+      RETURN_NOT_OK(mapped_tile.tile_->alloc_data(
+          mapped_tile.size_, tile_buffer_pool));
+  }
+
+  return Status::Ok();
+}
+
+TileCacheKey ReaderBase::tile_cache_key(
+    const std::string& name,
+    const ResultTile* const tile,
+    const TileCacheFile file) const {
+  const auto& fragment = fragment_metadata_[tile->frag_idx()];
+  return TileCacheKey(
+      fragment->tile_cache_id(),
+      fragment->field_idx(name),
+      file,
+      tile->tile_idx());
+}
+
+Status ReaderBase::write_unfiltered_tile_to_cache(
+    const std::string& name,
+    ResultTile* const tile,
+    const bool var_size,
+    const bool nullable) const {
+  if (!storage_manager_->unfiltered_tile_cache_enabled() ||
+      name == constants::coords) {
+    return Status::Ok();
+  }
+
+  auto& fragment = fragment_metadata_[tile->frag_idx()];
+  const auto& array_schema = fragment->array_schema();
+  const auto tile_idx = tile->tile_idx();
+  auto tile_tuple = tile->tile_tuple(name);
+  assert(tile_tuple != nullptr);
+  const Tile& t = std::get<0>(*tile_tuple);
+  const Tile& t_var = std::get<1>(*tile_tuple);
+  const Tile& t_validity = std::get<2>(*tile_tuple);
+
+  // Decrypted tiles are never cached, so that they can only be read with the
+  // encryption key.
+  if (array_->get_encryption_key().encryption_type() !=
+      EncryptionType::NO_ENCRYPTION) {
+    return Status::Ok();
+  }
+
+  // Tiles without any filter are as cheap to unfilter as to copy from the
+  // cache.
+  if (array_schema->filters(name).empty() &&
+      (!var_size || array_schema->cell_var_offsets_filters().empty()) &&
+      (!nullable || array_schema->cell_validity_filters().empty())) {
+    return Status::Ok();
+  }
+
+  // Apply the admission policy on the total size of the tiles for `name`.
+  uint64_t unfiltered_size = t.size();
+  auto&& [st, persisted_size] = fragment->persisted_tile_size(name, tile_idx);
+  RETURN_NOT_OK(st);
+  uint64_t total_persisted_size = *persisted_size;
+  if (var_size) {
+    auto&& [st, persisted_var_size] =
+        fragment->persisted_tile_var_size(name, tile_idx);
+    RETURN_NOT_OK(st);
+    unfiltered_size += t_var.size();
+    total_persisted_size += *persisted_var_size;
+  }
+  if (nullable) {
+    auto&& [st, persisted_validity_size] =
+        fragment->persisted_tile_validity_size(name, tile_idx);
+    RETURN_NOT_OK(st);
+    unfiltered_size += t_validity.size();
+    total_persisted_size += *persisted_validity_size;
+  }
+  if (!storage_manager_->unfiltered_tile_cache_admits(
+          unfiltered_size, total_persisted_size)) {
+    return Status::Ok();
+  }
+
+  RETURN_NOT_OK(storage_manager_->write_to_unfiltered_cache(
+      tile_cache_key(name, tile, TileCacheFile::FIXED), t.data(), t.size()));
+
+  if (var_size) {
+    RETURN_NOT_OK(storage_manager_->write_to_unfiltered_cache(
+        tile_cache_key(name, tile, TileCacheFile::VAR),
+        t_var.data(),
+        t_var.size()));
+  }
+
+  if (nullable) {
+    RETURN_NOT_OK(storage_manager_->write_to_unfiltered_cache(
+        tile_cache_key(name, tile, TileCacheFile::VALIDITY),
+        t_validity.data(),
+        t_validity.size()));
+  }
+
+  return Status::Ok();
+}
+
 Status ReaderBase::unfilter_tiles_chunk_range(
     const std::string& name,
     const std::vector<ResultTile*>& result_tiles) const {
@@ -1354,52 +1822,31 @@ Status ReaderBase::unfilter_tiles(
 
           if (disable_cache_ == false) {
             logger_->info("using cache");
-            // Get information about the tile in its fragment.
-            auto&& [status, tile_attr_uri] = fragment->uri(name);
-            RETURN_NOT_OK(status);
-
-            auto tile_idx = tile->tile_idx();
-            uint64_t tile_attr_offset;
-            RETURN_NOT_OK(
-                fragment->file_offset(name, tile_idx, &tile_attr_offset));
 
             // Cache 't'.
-            if (t.filtered() && !disable_cache_) {
+            if (t.filtered() && !t.filtered_buffer().is_view() &&
+                !disable_cache_) {
               // Store the filtered buffer in the tile cache.
               RETURN_NOT_OK(storage_manager_->write_to_cache(
-                  *tile_attr_uri, tile_attr_offset, t.filtered_buffer()));
+                  tile_cache_key(name, tile, TileCacheFile::FIXED),
+                  t.filtered_buffer()));
             }
 
             // Cache 't_var'.
-            if (var_size && t_var.filtered() && !disable_cache_) {
-              auto&& [status, tile_attr_var_uri] = fragment->var_uri(name);
-              RETURN_NOT_OK(status);
-
-              uint64_t tile_attr_var_offset;
-              RETURN_NOT_OK(fragment->file_var_offset(
-                  name, tile_idx, &tile_attr_var_offset));
-
+            if (var_size && t_var.filtered() &&
+                !t_var.filtered_buffer().is_view() && !disable_cache_) {
               // Store the filtered buffer in the tile cache.
               RETURN_NOT_OK(storage_manager_->write_to_cache(
-                  *tile_attr_var_uri,
-                  tile_attr_var_offset,
+                  tile_cache_key(name, tile, TileCacheFile::VAR),
                   t_var.filtered_buffer()));
             }
 
             // Cache 't_validity'.
-            if (nullable && t_validity.filtered() && !disable_cache_) {
-              auto&& [status, tile_attr_validity_uri] =
-                  fragment->validity_uri(name);
-              RETURN_NOT_OK(status);
-
-              uint64_t tile_attr_validity_offset;
-              RETURN_NOT_OK(fragment->file_validity_offset(
-                  name, tile_idx, &tile_attr_validity_offset));
-
+            if (nullable && t_validity.filtered() &&
+                !t_validity.filtered_buffer().is_view() && !disable_cache_) {
               // Store the filtered buffer in the tile cache.
               RETURN_NOT_OK(storage_manager_->write_to_cache(
-                  *tile_attr_validity_uri,
-                  tile_attr_validity_offset,
+                  tile_cache_key(name, tile, TileCacheFile::VALIDITY),
                   t_validity.filtered_buffer()));
             }
           }
@@ -1418,6 +1865,9 @@ Status ReaderBase::unfilter_tiles(
               RETURN_NOT_OK(
                   unfilter_tile_nullable(name, &t, &t_var, &t_validity));
           }
+
+          RETURN_NOT_OK(
+              write_unfiltered_tile_to_cache(name, tile, var_size, nullable));
         }
 
         return Status::Ok();
@@ -39,6 +39,7 @@
 #include "tiledb/common/status.h"
 #include "tiledb/sm/array_schema/dimension.h"
 #include "tiledb/sm/array_schema/tile_domain.h"
+#include "tiledb/sm/cache/tile_cache.h"
 #include "tiledb/sm/fragment/fragment_metadata.h"
 #include "tiledb/sm/misc/types.h"
 #include "tiledb/sm/query/query_condition.h"
@@ -182,6 +183,12 @@ class ReaderBase : public StrategyBase {
    */
   bool use_timestamps_;
 
+  /** The stat counting the tiles pruned by the query condition. */
+  stats::StatId qc_tile_pruned_num_stat_;
+
+  /** The stat counting the tiles fully matching the query condition. */
+  stats::StatId qc_tile_full_match_num_stat_;
+
   /* ********************************* */
   /*         PROTECTED METHODS         */
   /* ********************************* */
@@ -254,6 +261,27 @@ class ReaderBase : public StrategyBase {
   Status load_tile_offsets(
       Subarray& subarray, const std::vector<std::string>& names);
 
+  /**
+   * Loads the tile min, max and null count values of the query condition
+   * attributes into their associated element in `fragment_metadata_`, to
+   * prune tiles with `tile_match`.
+   *
+   * @param subarray The subarray to load the values for.
+   * @return Status
+   */
+  Status load_query_condition_tile_metadata(Subarray& subarray);
+
+  /**
+   * Evaluates the query condition against the tile metadata of a fragment
+   * tile, and counts the tiles that do not need to be evaluated cell by cell
+   * in the stats.
+   *
+   * @param frag_idx The fragment index.
+   * @param tile_idx The tile index in the fragment.
+   * @return The tile match.
+   */
+  QueryCondition::TileMatch tile_match(unsigned frag_idx, uint64_t tile_idx);
+
   /**
    * Checks if at least one fragment overlaps partially with the
    * time at which the read is taking place.
@@ -825,6 +853,88 @@ class ReaderBase : public StrategyBase {
       ResultTile* const tile,
       const bool var_size,
       const bool nullable) const;
+
+  /**
+   * Allocates the unfiltered buffers of a tile and tries to fill them from
+   * the unfiltered tile cache. On a hit, the tile needs neither I/O nor
+   * unfiltering.
+   *
+   * @param name Attribute/dimension the tile belong to.
+   * @param tile The result tile, whose tiles for `name` are initialized.
+   * @param var_size True if the attribute/dimension is var-sized, false
+   * otherwise
+   * @param nullable True if the attribute/dimension is nullable, false
+   * otherwise
+   * @param hit Set to `true` if all the tiles for `name` were found in the
+   * cache, `false` otherwise.
+   * @return Status
+   */
+  Status read_unfiltered_tile_from_cache(
+      const std::string& name,
+      ResultTile* const tile,
+      const bool var_size,
+      const bool nullable,
+      bool* hit) const;
+
+  /**
+   * Reads the tiles for `name` of a result tile from the memory-mapped
+   * fragment files, if they are all local and their filters leave the
+   * chunk bytes unchanged (no filters or checksum filters only).
+   *
+   * The filtered buffers reference the mapped pages, avoiding the allocation
+   * and copy of a read. If every tile is a single chunk and needs no checksum
+   * validation, the unfiltered data also references the mapped pages and the
+   * tiles need no unfiltering.
+   *
+   * @param name Attribute/dimension the tile belong to.
+   * @param tile The result tile, whose tiles for `name` are initialized.
+   * @param var_size True if the attribute/dimension is var-sized, false
+   * otherwise
+   * @param nullable True if the attribute/dimension is nullable, false
+   * otherwise
+   * @param mapped Set to `true` if the tiles were read from the mapped files.
+   * @param zero_copy Set to `true` if the tiles need no unfiltering.
+   * @return Status
+   */
+  Status read_tile_from_mmap(
+      const std::string& name,
+      ResultTile* const tile,
+      const bool var_size,
+      const bool nullable,
+      bool* mapped,
+      bool* zero_copy) const;
+
+  /**
+   * Returns the key of a tile for `name` of a result tile in the tile
+   * caches.
+   *
+   * @param name Attribute/dimension the tile belong to.
+   * @param tile The result tile.
+   * @param file The file of `name` the tile is stored in.
+   * @return The key of the tile.
+   */
+  TileCacheKey tile_cache_key(
+      const std::string& name,
+      const ResultTile* tile,
+      TileCacheFile file) const;
+
+  /**
+   * Stores a tile that was just unfiltered in the unfiltered tile cache, if
+   * the cache admits it.
+   *
+   * @param name Attribute/dimension the tile belong to.
+   * @param tile The result tile that was just unfiltered.
+   * @param var_size True if the attribute/dimension is var-sized, false
+   * otherwise
+   * @param nullable True if the attribute/dimension is nullable, false
+   * otherwise
+   * @return Status
+   */
+  Status write_unfiltered_tile_to_cache(
+      const std::string& name,
+      ResultTile* const tile,
+      const bool var_size,
+      const bool nullable) const;
 };
 
 }  // namespace sm
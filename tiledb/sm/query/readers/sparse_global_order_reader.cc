@@ -33,6 +33,7 @@
 #include "tiledb/sm/query/readers/sparse_global_order_reader.h"
 #include "tiledb/common/logger.h"
 #include "tiledb/common/memory_tracker.h"
+#include "tiledb/common/scoped_executor.h"
 #include "tiledb/sm/array/array.h"
 #include "tiledb/sm/array_schema/array_schema.h"
 #include "tiledb/sm/array_schema/dimension.h"
@@ -86,7 +87,8 @@ SparseGlobalOrderReader<BitmapType>::SparseGlobalOrderReader(
     , memory_used_for_coords_(array->fragment_metadata().size())
     , memory_used_for_qc_tiles_(array->fragment_metadata().size())
     , consolidation_with_timestamps_(consolidation_with_timestamps)
-    , last_cells_(array->fragment_metadata().size()) {
+    , last_cells_(array->fragment_metadata().size())
+    , merge_partition_min_cells_(0) {
 }
 
 /* ****************************** */
@@ -113,6 +115,13 @@ Status SparseGlobalOrderReader<BitmapType>::init() {
   // Initialize memory budget variables.
   RETURN_NOT_OK(initialize_memory_budget());
 
+  bool found = false;
+  RETURN_NOT_OK(config_.get<uint64_t>(
+      "sm.query.sparse_global_order.merge_partition_min_cells",
+      &merge_partition_min_cells_,
+      &found));
+  assert(found);
+
   return Status::Ok();
 }
 
@@ -143,12 +152,16 @@ Status SparseGlobalOrderReader<BitmapType>::initialize_memory_budget() {
       &found));
   assert(found);
 
+  // Reserve the budget against the memory budget of the context.
+  RETURN_NOT_OK(admit_memory_budget());
+
   return Status::Ok();
 }
 
 template <class BitmapType>
 Status SparseGlobalOrderReader<BitmapType>::dowork() {
   auto timer_se = stats_->start_timer("dowork");
+  ScopedExecutor report_memory([this]() { report_memory_usage(); });
 
   // For easy reference.
   auto fragment_num = fragment_metadata_.size();
@@ -325,6 +338,16 @@ SparseGlobalOrderReader<BitmapType>::add_result_tile(
     return {Status::Ok(), false};
   }
 
+  // Skip the tiles where no cell matches the query condition. Without
+  // duplicates, the tile cells still need to be deduplicated against older
+  // fragments, so the tile is kept.
+  if (!condition_.empty() && array_schema_.allows_dups() &&
+      condition_.tile_match(*fragment_metadata_[f], t) ==
+          QueryCondition::TileMatch::NONE) {
+    stats_->add_counter(qc_tile_pruned_num_stat_, 1);
+    return {Status::Ok(), false};
+  }
+
   // Calculate memory consumption for this tile.
   auto&& [st, tiles_sizes] = get_coord_tiles_size(dim_num, f, t);
   RETURN_NOT_OK_TUPLE(st, nullopt);
@@ -347,6 +370,7 @@ SparseGlobalOrderReader<BitmapType>::add_result_tile(
     std::unique_lock<std::mutex> lck(mem_budget_mtx_);
     memory_used_for_coords_total_ += tiles_size + sizeof(ResultTile);
     memory_used_qc_tiles_total_ += tiles_size_qc;
+    update_memory_peaks();
   }
 
   // Adjust per fragment memory used.
@@ -787,22 +811,45 @@ Status SparseGlobalOrderReader<BitmapType>::compute_hilbert_values(
         auto cell_num =
             fragment_metadata_[tile->frag_idx()]->cell_num(tile->tile_idx());
         auto rc = GlobalOrderResultCoords(tile, 0);
-        std::vector<uint64_t> coords(dim_num);
 
-        tile->allocate_hilbert_vector();
-        for (rc.pos_ = 0; rc.pos_ < cell_num; rc.pos_++) {
-          // Process only values in bitmap.
-          if (!tile->has_bmp() || tile->bitmap()[rc.pos_]) {
-            // Compute Hilbert number for all dimensions first.
-            for (uint32_t d = 0; d < dim_num; ++d) {
-              auto dim{array_schema_.dimension_ptr(d)};
-              coords[d] = hilbert_order::map_to_uint64(
+        // Process only values in bitmap.
+        std::vector<uint64_t> cells;
+        if (tile->has_bmp()) {
+          for (uint64_t c = 0; c < cell_num; c++) {
+            if (tile->bitmap()[c])
+              cells.emplace_back(c);
+          }
+        }
+        const uint64_t num = tile->has_bmp() ? cells.size() : cell_num;
+
+        // Map the coordinates of all dimensions first, contiguously when
+        // they are fixed-size and every cell is processed.
+        std::vector<uint64_t> coords(dim_num * num);
+        std::vector<const uint64_t*> dim_coords(dim_num);
+        for (uint32_t d = 0; d < dim_num; ++d) {
+          auto dim{array_schema_.dimension_ptr(d)};
+          auto out = &coords[d * num];
+          if (tile->has_bmp() || dim->var_size() ||
+              tile->stores_zipped_coords()) {
+            for (uint64_t i = 0; i < num; i++) {
+              rc.pos_ = tile->has_bmp() ? cells[i] : i;
+              out[i] = hilbert_order::map_to_uint64(
                   *dim, rc, d, bits, max_bucket_val);
             }
-
-            // Now we are ready to get the final number.
-            tile->set_hilbert_value(rc.pos_, h.coords_to_hilbert(&coords[0]));
+          } else if (num > 0) {
+            hilbert_order::map_to_uint64(
+                *dim, tile->coord(0, d), num, bits, max_bucket_val, out);
           }
+          dim_coords[d] = out;
+        }
+
+        // Now we are ready to get the final numbers.
+        std::vector<uint64_t> hilbert_values(num);
+        h.coords_to_hilbert(&dim_coords[0], num, hilbert_values.data());
+        tile->allocate_hilbert_vector();
+        for (uint64_t i = 0; i < num; i++) {
+          tile->set_hilbert_value(
+              tile->has_bmp() ? cells[i] : i, hilbert_values[i]);
         }
 
         return Status::Ok();
@@ -831,11 +878,20 @@ SparseGlobalOrderReader<BitmapType>::merge_result_cell_slabs(
   auto timer_se = stats_->start_timer("merge_result_cell_slabs");
   std::vector<ResultCellSlab> result_cell_slabs;
 
-  // TODO Parallelize.
-
   // For easy reference.
   auto dups = array_schema_.allows_dups() || consolidation_with_timestamps_;
 
+  // Merge what can be merged in parallel first, the loop below picks up from
+  // the updated fragment indexes.
+  if (can_merge_in_parallel()) {
+    auto&& [st, slabs] = parallel_merge_result_cell_slabs(num_cells, cmp);
+    RETURN_NOT_OK_TUPLE(st, nullopt);
+    result_cell_slabs = std::move(*slabs);
+    for (const auto& slab : result_cell_slabs) {
+      num_cells -= slab.length_;
+    }
+  }
+
   // A tile min heap, contains one GlobalOrderResultCoords per fragment.
   std::vector<GlobalOrderResultCoords<BitmapType>> container;
   container.reserve(result_tiles_.size());
@@ -851,8 +907,17 @@ SparseGlobalOrderReader<BitmapType>::merge_result_cell_slabs(
   auto status = parallel_for(
       storage_manager_->compute_tp(), 0, result_tiles_.size(), [&](uint64_t f) {
         if (result_tiles_[f].size() > 0) {
-          // Initialize the iterator for this fragment.
+          // Initialize the iterator for this fragment, skipping the tiles
+          // already merged in parallel.
           rt_it[f] = result_tiles_[f].begin();
+          while (rt_it[f] != result_tiles_[f].end() &&
+                 rt_it[f]->tile_idx() < read_state_.frag_idx_[f].tile_idx_) {
+            rt_it[f]++;
+          }
+
+          if (rt_it[f] == result_tiles_[f].end()) {
+            return Status::Ok();
+          }
 
           // Add the tile to the queue.
           uint64_t cell_idx =
@@ -1000,6 +1065,304 @@ SparseGlobalOrderReader<BitmapType>::merge_result_cell_slabs(
   return {Status::Ok(), std::move(result_cell_slabs)};
 };
 
+template <class BitmapType>
+bool SparseGlobalOrderReader<BitmapType>::can_merge_in_parallel() const {
+  // Cells with the same coordinates are all returned for arrays with
+  // duplicates, so key ranges can be merged independently. Cells are searched
+  // by key, which cannot be done in Hilbert order as the Hilbert values are
+  // only computed for the cells in the bitmap.
+  if (!std::is_same<BitmapType, uint8_t>::value ||
+      !array_schema_.allows_dups() || consolidation_with_timestamps_ ||
+      array_schema_.cell_order() == Layout::HILBERT ||
+      storage_manager_->compute_tp()->concurrency_level() < 2) {
+    return false;
+  }
+
+  for (const auto& frag_md : fragment_metadata_) {
+    if (frag_md->has_timestamps()) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+template <class BitmapType>
+template <class CompType>
+tuple<Status, optional<std::vector<ResultCellSlab>>>
+SparseGlobalOrderReader<BitmapType>::parallel_merge_result_cell_slabs(
+    uint64_t num_cells, CompType cmp) {
+  auto timer_se = stats_->start_timer("parallel_merge_result_cell_slabs");
+  std::vector<ResultCellSlab> result_cell_slabs;
+
+  // For easy reference.
+  auto compute_tp = storage_manager_->compute_tp();
+  const auto fragment_num = result_tiles_.size();
+
+  // Collect the tiles left to merge for each fragment, starting at the
+  // fragment index.
+  std::vector<MergeTiles> merge_tiles(fragment_num);
+  std::vector<uint64_t> begin(fragment_num, 0);
+  uint64_t fragments_with_tiles = 0;
+  for (unsigned f = 0; f < fragment_num; f++) {
+    auto& mt = merge_tiles[f];
+    uint64_t offset = 0;
+    for (auto it = result_tiles_[f].begin(); it != result_tiles_[f].end();
+         it++) {
+      if (it->tile_idx() >= read_state_.frag_idx_[f].tile_idx_) {
+        mt.tiles_.emplace_back(it);
+        mt.tile_offsets_.emplace_back(offset);
+        offset += it->cell_num();
+      }
+    }
+    mt.tile_offsets_.emplace_back(offset);
+
+    if (!mt.tiles_.empty()) {
+      fragments_with_tiles++;
+      if (mt.tiles_[0]->tile_idx() == read_state_.frag_idx_[f].tile_idx_) {
+        begin[f] = read_state_.frag_idx_[f].cell_idx_;
+      }
+    }
+  }
+
+  if (fragments_with_tiles < 2) {
+    return {Status::Ok(), std::move(result_cell_slabs)};
+  }
+
+  // Cells can only be merged up to the last loaded cell of the fragments that
+  // have more tiles to load, as cells in the next tiles could come first.
+  optional<GlobalOrderResultCoords<BitmapType>> bound;
+  for (unsigned f = 0; f < fragment_num; f++) {
+    if (!all_tiles_loaded_[f] && !merge_tiles[f].tiles_.empty()) {
+      auto last = merge_tiles[f].coords(merge_tiles[f].cell_num() - 1);
+      if (!bound.has_value() || !cmp(last, *bound)) {
+        bound = last;
+      }
+    }
+  }
+
+  // Returns the first cell of a fragment in [lo, hi) that comes after the
+  // key, `cmp` being a greater-than comparison. Cells equal to the key are
+  // kept before the returned position.
+  auto upper_bound = [&](unsigned f,
+                         const GlobalOrderResultCoords<BitmapType>& key,
+                         uint64_t lo,
+                         uint64_t hi) {
+    while (lo < hi) {
+      auto mid = lo + (hi - lo) / 2;
+      if (cmp(merge_tiles[f].coords(mid), key)) {
+        hi = mid;
+      } else {
+        lo = mid + 1;
+      }
+    }
+
+    return lo;
+  };
+
+  std::vector<uint64_t> end(fragment_num, 0);
+  uint64_t cell_num = 0;
+  for (unsigned f = 0; f < fragment_num; f++) {
+    end[f] = merge_tiles[f].cell_num();
+    if (bound.has_value()) {
+      end[f] = upper_bound(f, *bound, begin[f], end[f]);
+    }
+    end[f] = std::max(end[f], begin[f]);
+    cell_num += end[f] - begin[f];
+  }
+
+  const uint64_t range_num = std::min<uint64_t>(
+      compute_tp->concurrency_level(),
+      cell_num / std::max<uint64_t>(merge_partition_min_cells_, 1));
+  if (range_num < 2) {
+    return {Status::Ok(), std::move(result_cell_slabs)};
+  }
+
+  // Sample the cells of each fragment proportionally to its cell count, the
+  // evenly spaced samples are the splitters between key ranges.
+  const uint64_t samples_per_range = 16;
+  std::vector<GlobalOrderResultCoords<BitmapType>> samples;
+  for (unsigned f = 0; f < fragment_num; f++) {
+    auto n = end[f] - begin[f];
+    if (n == 0) {
+      continue;
+    }
+
+    auto sample_num = std::clamp<uint64_t>(
+        n * range_num * samples_per_range / cell_num, 1, n);
+    for (uint64_t i = 0; i < sample_num; i++) {
+      auto cell = begin[f] + i * n / sample_num;
+      samples.emplace_back(merge_tiles[f].coords(cell));
+    }
+  }
+
+  std::sort(
+      samples.begin(),
+      samples.end(),
+      [&](const GlobalOrderResultCoords<BitmapType>& a,
+          const GlobalOrderResultCoords<BitmapType>& b) {
+        return !cmp(a, b);
+      });
+
+  // Find the first cell of each key range for all fragments.
+  std::vector<std::vector<uint64_t>> bounds(range_num + 1);
+  bounds[0] = begin;
+  for (uint64_t r = 1; r < range_num; r++) {
+    bounds[r].resize(fragment_num);
+  }
+  bounds[range_num] = end;
+
+  auto status =
+      parallel_for(compute_tp, 0, fragment_num, [&](uint64_t f) {
+        for (uint64_t r = 1; r < range_num; r++) {
+          const auto& splitter = samples[r * samples.size() / range_num];
+          bounds[r][f] = upper_bound(f, splitter, bounds[r - 1][f], end[f]);
+        }
+
+        return Status::Ok();
+      });
+  RETURN_NOT_OK_ELSE_TUPLE(status, logger_->status(status), nullopt);
+
+  // Only merge the key ranges that fit in the user buffers. This counts the
+  // cells filtered out by the bitmaps, so the serial merge might still add
+  // more cells after.
+  uint64_t merged_range_num = 0;
+  uint64_t merged_cell_num = 0;
+  for (; merged_range_num < range_num; merged_range_num++) {
+    uint64_t range_cell_num = 0;
+    for (unsigned f = 0; f < fragment_num; f++) {
+      range_cell_num += bounds[merged_range_num + 1][f] -
+                        bounds[merged_range_num][f];
+    }
+
+    if (merged_cell_num + range_cell_num > num_cells) {
+      break;
+    }
+
+    merged_cell_num += range_cell_num;
+  }
+
+  if (merged_range_num == 0) {
+    return {Status::Ok(), std::move(result_cell_slabs)};
+  }
+
+  // Merge the key ranges in parallel.
+  std::vector<std::vector<ResultCellSlab>> range_slabs(merged_range_num);
+  status = parallel_for(compute_tp, 0, merged_range_num, [&](uint64_t r) {
+    merge_range(cmp, merge_tiles, bounds[r], bounds[r + 1], range_slabs[r]);
+    return Status::Ok();
+  });
+  RETURN_NOT_OK_ELSE_TUPLE(status, logger_->status(status), nullopt);
+  stats_->add_counter("merge_range_num", merged_range_num);
+
+  // Concatenate the slabs and flag their tiles as used.
+  uint64_t slab_num = 0;
+  for (const auto& slabs : range_slabs) {
+    slab_num += slabs.size();
+  }
+
+  result_cell_slabs.reserve(slab_num);
+  for (auto& slabs : range_slabs) {
+    for (auto& slab : slabs) {
+      static_cast<GlobalOrderResultTile<BitmapType>*>(slab.tile_)->set_used();
+      result_cell_slabs.emplace_back(std::move(slab));
+    }
+  }
+
+  // Move the fragment indexes past the merged cells and remove the tiles that
+  // were passed without being used.
+  const auto& merged_end = bounds[merged_range_num];
+  for (unsigned f = 0; f < fragment_num; f++) {
+    const auto& mt = merge_tiles[f];
+    if (merged_end[f] == begin[f]) {
+      continue;
+    }
+
+    auto t = merged_end[f] == mt.cell_num() ? mt.tiles_.size() - 1 :
+                                              mt.tile_of(merged_end[f]);
+    read_state_.frag_idx_[f] = FragIdx(
+        mt.tiles_[t]->tile_idx(), merged_end[f] - mt.tile_offsets_[t]);
+
+    for (uint64_t i = 0; i < t; i++) {
+      if (!mt.tiles_[i]->used()) {
+        RETURN_NOT_OK_TUPLE(remove_result_tile(f, mt.tiles_[i]), nullopt);
+      }
+    }
+  }
+
+  logger_->debug(
+      "Done merging result cell slabs in parallel, num ranges {0}, num slabs "
+      "{1}",
+      merged_range_num,
+      result_cell_slabs.size());
+
+  return {Status::Ok(), std::move(result_cell_slabs)};
+}
+
+template <class BitmapType>
+template <class CompType>
+void SparseGlobalOrderReader<BitmapType>::merge_range(
+    const CompType& cmp,
+    const std::vector<MergeTiles>& merge_tiles,
+    const std::vector<uint64_t>& begin,
+    const std::vector<uint64_t>& end,
+    std::vector<ResultCellSlab>& result_cell_slabs) {
+  const auto fragment_num = merge_tiles.size();
+  std::vector<GlobalOrderResultCoords<BitmapType>> container;
+  container.reserve(fragment_num);
+  TileMinHeap<CompType> tile_queue(cmp, std::move(container));
+
+  // Current tile, per fragment.
+  std::vector<uint64_t> tile(fragment_num, 0);
+
+  // Adds the next cell of a fragment to the queue, if it is in the range.
+  auto add_next_cell = [&](unsigned f, GlobalOrderResultCoords<BitmapType> rc) {
+    const auto& mt = merge_tiles[f];
+    while (!rc.advance_to_next_cell()) {
+      tile[f]++;
+      if (tile[f] == mt.tiles_.size() || mt.tile_offsets_[tile[f]] >= end[f]) {
+        return;
+      }
+
+      rc = GlobalOrderResultCoords<BitmapType>(&*mt.tiles_[tile[f]], 0);
+    }
+
+    if (mt.tile_offsets_[tile[f]] + rc.pos_ < end[f]) {
+      tile_queue.emplace(std::move(rc));
+    }
+  };
+
+  for (unsigned f = 0; f < fragment_num; f++) {
+    if (begin[f] < end[f]) {
+      tile[f] = merge_tiles[f].tile_of(begin[f]);
+      add_next_cell(f, merge_tiles[f].coords(begin[f]));
+    }
+  }
+
+  while (!tile_queue.empty()) {
+    auto to_process = tile_queue.top();
+    tile_queue.pop();
+    const auto f = to_process.tile_->frag_idx();
+
+    // Cells with the same coordinates as the next cell are merged one at a
+    // time. Otherwise, merge all cells before the next one without going past
+    // the end of the range.
+    uint64_t length = 1;
+    if (tile_queue.empty()) {
+      length = to_process.max_slab_length();
+    } else if (!to_process.same_coords(tile_queue.top())) {
+      length = to_process.max_slab_length(tile_queue.top(), cmp);
+    }
+
+    const auto range_end = end[f] - merge_tiles[f].tile_offsets_[tile[f]];
+    length = std::min(length, range_end - to_process.pos_);
+
+    result_cell_slabs.emplace_back(to_process.tile_, to_process.pos_, length);
+    to_process.pos_ += length - 1;
+    add_next_cell(f, to_process);
+  }
+}
+
 template <class BitmapType>
 tuple<uint64_t, uint64_t, uint64_t, bool>
 SparseGlobalOrderReader<BitmapType>::compute_parallelization_parameters(
@@ -33,6 +33,7 @@
 #ifndef TILEDB_SPARSE_GLOBAL_ORDER_READER
 #define TILEDB_SPARSE_GLOBAL_ORDER_READER
 
+#include <algorithm>
 #include <atomic>
 
 #include "tiledb/common/common.h"
@@ -167,6 +168,12 @@ class SparseGlobalOrderReader : public SparseIndexReaderBase,
   /** Stores last cell for fragments consolidated with timestamps. */
   std::vector<FragIdx> last_cells_;
 
+  /**
+   * Minimum number of cells to merge per thread for the merge to run in
+   * parallel.
+   */
+  uint64_t merge_partition_min_cells_;
+
   /* ********************************* */
   /*       PRIVATE DECLARATIONS        */
   /* ********************************* */
@@ -182,6 +189,37 @@ class SparseGlobalOrderReader : public SparseIndexReaderBase,
   using TileListIt =
       typename std::list<GlobalOrderResultTile<BitmapType>>::iterator;
 
+  /**
+   * The loaded tiles of a fragment left to merge, used by the parallel merge.
+   * Cells are addressed by their index across all the tiles.
+   */
+  struct MergeTiles {
+    /** The tiles. */
+    std::vector<TileListIt> tiles_;
+
+    /** Index of the first cell of each tile, then the total cell count. */
+    std::vector<uint64_t> tile_offsets_;
+
+    /** Returns the total number of cells. */
+    inline uint64_t cell_num() const {
+      return tile_offsets_.back();
+    }
+
+    /** Returns the index in `tiles_` of the tile containing a cell. */
+    inline uint64_t tile_of(uint64_t cell) const {
+      return std::upper_bound(
+                 tile_offsets_.begin(), tile_offsets_.end(), cell) -
+             tile_offsets_.begin() - 1;
+    }
+
+    /** Returns the result coords of a cell. */
+    inline GlobalOrderResultCoords<BitmapType> coords(uint64_t cell) const {
+      auto t = tile_of(cell);
+      return GlobalOrderResultCoords<BitmapType>(
+          &*tiles_[t], cell - tile_offsets_[t]);
+    }
+  };
+
   /* ********************************* */
   /*           PRIVATE METHODS         */
   /* ********************************* */
@@ -319,6 +357,47 @@ class SparseGlobalOrderReader : public SparseIndexReaderBase,
   tuple<Status, optional<std::vector<ResultCellSlab>>> merge_result_cell_slabs(
       uint64_t num_cells, CompType cmp);
 
+  /**
+   * Returns `true` if the result cell slabs can be merged in parallel. This
+   * is only the case for arrays with duplicates in the global cell order
+   * with no fragment consolidated with timestamps, as no cell needs to be
+   * deduplicated across fragments.
+   */
+  bool can_merge_in_parallel() const;
+
+  /**
+   * Merges the result cell slabs in parallel, up to the last loaded cell of
+   * the fragments that have more tiles to load. The global order is split
+   * into key ranges using splitters sampled from the loaded cells, each range
+   * is merged on its own thread and the slabs are concatenated. The fragment
+   * indexes are updated so that the serial merge can pick up from there.
+   *
+   * @param num_cells Number of cells that can be copied in the user buffer.
+   * @param cmp Comparator class.
+   *
+   * @return Status, result_cell_slabs.
+   */
+  template <class CompType>
+  tuple<Status, optional<std::vector<ResultCellSlab>>>
+  parallel_merge_result_cell_slabs(uint64_t num_cells, CompType cmp);
+
+  /**
+   * Merges the cells of a key range, used by the parallel merge.
+   *
+   * @param cmp Comparator class.
+   * @param merge_tiles The tiles left to merge, per fragment.
+   * @param begin First cell of the range, per fragment.
+   * @param end Cell after the last of the range, per fragment.
+   * @param result_cell_slabs The merged result cell slabs.
+   */
+  template <class CompType>
+  void merge_range(
+      const CompType& cmp,
+      const std::vector<MergeTiles>& merge_tiles,
+      const std::vector<uint64_t>& begin,
+      const std::vector<uint64_t>& end,
+      std::vector<ResultCellSlab>& result_cell_slabs);
+
   /**
    * Compute parallelization parameters for a tile copy operation.
    *
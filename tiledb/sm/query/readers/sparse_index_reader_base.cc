@@ -80,15 +80,27 @@ SparseIndexReaderBase::SparseIndexReaderBase(
     , memory_used_for_coords_total_(0)
     , memory_used_qc_tiles_total_(0)
     , memory_used_result_tile_ranges_(0)
+    , memory_used_for_coords_peak_(0)
+    , memory_used_qc_tiles_peak_(0)
+    , memory_peaks_reported_(0, 0)
+    , context_memory_tracker_(nullptr)
+    , memory_reserved_(0)
     , memory_budget_ratio_coords_(0.5)
     , memory_budget_ratio_query_condition_(0.25)
     , memory_budget_ratio_tile_ranges_(0.1)
     , memory_budget_ratio_array_data_(0.1)
-    , buffers_full_(false) {
+    , buffers_full_(false)
+    , compute_results_count_sparse_stat_(
+          stats_->register_histogram("compute_results_count_sparse")) {
   read_state_.done_adding_result_tiles_ = false;
   disable_cache_ = true;
 }
 
+SparseIndexReaderBase::~SparseIndexReaderBase() {
+  if (memory_reserved_ != 0)
+    context_memory_tracker_->release_memory(memory_reserved_);
+}
+
 /* ****************************** */
 /*        PROTECTED METHODS       */
 /* ****************************** */
@@ -157,6 +169,77 @@ uint64_t SparseIndexReaderBase::cells_copied(
   }
 }
 
+Status SparseIndexReaderBase::admit_memory_budget() {
+  auto timer_se = stats_->start_timer("memory_admission");
+
+  bool found = false;
+  uint64_t timeout_ms = 0;
+  RETURN_NOT_OK(config_.get<uint64_t>(
+      "sm.mem.admission_timeout_ms", &timeout_ms, &found));
+  assert(found);
+
+  // Return a previous reservation, if any.
+  context_memory_tracker_ = storage_manager_->memory_tracker();
+  if (memory_reserved_ != 0) {
+    context_memory_tracker_->release_memory(memory_reserved_);
+    memory_reserved_ = 0;
+  }
+
+  const uint64_t requested = static_cast<uint64_t>(
+      memory_budget_ * (1.0 - memory_budget_ratio_array_data_));
+  if (requested == 0)
+    return Status::Ok();
+
+  memory_reserved_ = context_memory_tracker_->take_memory(
+      requested, requested / 10, std::chrono::milliseconds(timeout_ms));
+  stats_->add_counter("memory_admission_requested", requested);
+  stats_->add_counter("memory_admission_granted", memory_reserved_);
+  if (memory_reserved_ == 0)
+    return logger_->status(Status_ReaderError(
+        "Cannot initialize reader; Not enough memory available in the "
+        "context memory budget, requested: " +
+        std::to_string(requested) + ", available: " +
+        std::to_string(context_memory_tracker_->get_memory_available()) +
+        ", budget: " +
+        std::to_string(context_memory_tracker_->get_memory_budget())));
+
+  // Shrink the budget to the memory granted, keeping the ratios.
+  if (memory_reserved_ < requested) {
+    stats_->add_counter("memory_admission_shrunk_num", 1);
+    memory_budget_ = static_cast<uint64_t>(
+        memory_budget_ * (static_cast<double>(memory_reserved_) / requested));
+  }
+
+  return Status::Ok();
+}
+
+void SparseIndexReaderBase::update_memory_peaks() {
+  memory_used_for_coords_peak_ =
+      std::max(memory_used_for_coords_peak_, memory_used_for_coords_total_);
+  memory_used_qc_tiles_peak_ =
+      std::max(memory_used_qc_tiles_peak_, memory_used_qc_tiles_total_);
+}
+
+void SparseIndexReaderBase::report_memory_usage() {
+  if (context_memory_tracker_ != nullptr) {
+    stats_->add_counter(
+        "memory_context_peak",
+        context_memory_tracker_->take_memory_peak_growth());
+  }
+  stats_->add_counter(
+      "memory_array_peak", array_memory_tracker_->take_memory_peak_growth());
+
+  std::unique_lock<std::mutex> lck(mem_budget_mtx_);
+  stats_->add_counter(
+      "memory_coords_peak",
+      memory_used_for_coords_peak_ - memory_peaks_reported_.first);
+  stats_->add_counter(
+      "memory_qc_tiles_peak",
+      memory_used_qc_tiles_peak_ - memory_peaks_reported_.second);
+  memory_peaks_reported_ = {
+      memory_used_for_coords_peak_, memory_used_qc_tiles_peak_};
+}
+
 template <class BitmapType>
 tuple<Status, optional<std::pair<uint64_t, uint64_t>>>
 SparseIndexReaderBase::get_coord_tiles_size(
@@ -247,6 +330,9 @@ Status SparseIndexReaderBase::load_initial_data(bool include_coords) {
                                          sizeof(std::pair<uint64_t, uint64_t>);
     }
 
+    stats_->add_counter(
+        "memory_tile_ranges_peak", memory_used_result_tile_ranges_);
+
     if (memory_used_result_tile_ranges_ >
         memory_budget_ratio_tile_ranges_ * memory_budget_)
       return logger_->status(
@@ -315,6 +401,9 @@ Status SparseIndexReaderBase::load_initial_data(bool include_coords) {
   RETURN_CANCEL_OR_ERROR(
       load_tile_offsets(subarray_, attr_tile_offsets_to_load));
 
+  // Load the tile metadata used to prune tiles with the query condition.
+  RETURN_CANCEL_OR_ERROR(load_query_condition_tile_metadata(subarray_));
+
   logger_->debug("Initial data loaded");
   initial_data_loaded_ = true;
   return Status::Ok();
@@ -328,38 +417,30 @@ Status SparseIndexReaderBase::read_and_unfilter_coords(
   if (!include_coords && condition_.empty() && !use_timestamps_)
     return Status::Ok();
 
-  if (subarray_.is_set() || include_coords) {
-    // Read and unfilter zipped coordinate tiles. Note that
-    // this will ignore fragments with a version >= 5.
-    std::vector<std::string> zipped_coords_names = {constants::coords};
-    RETURN_CANCEL_OR_ERROR(
-        read_coordinate_tiles(zipped_coords_names, result_tiles));
-    RETURN_CANCEL_OR_ERROR(unfilter_tiles(constants::coords, result_tiles));
-
-    // Read and unfilter unzipped coordinate tiles. Note that
-    // this will ignore fragments with a version < 5.
-    RETURN_CANCEL_OR_ERROR(read_coordinate_tiles(dim_names_, result_tiles));
-    for (const auto& dim_name : dim_names_) {
-      RETURN_CANCEL_OR_ERROR(unfilter_tiles(dim_name, result_tiles));
-    }
+  // Read the tiles of all the fields needed in a single batch, so that the
+  // reads of all the fields and fragments are issued together.
+  std::vector<std::string> names;
+  const bool read_coords = subarray_.is_set() || include_coords;
+  if (read_coords) {
+    // Zipped coordinate tiles are ignored for fragments with a
+    // version >= 5, unzipped ones for fragments with a version < 5.
+    names.emplace_back(constants::coords);
+    names.insert(names.end(), dim_names_.begin(), dim_names_.end());
   }
-
-  if (use_timestamps_) {
-    std::vector<std::string> timestamps_names = {constants::timestamps};
-    RETURN_CANCEL_OR_ERROR(
-        read_attribute_tiles(timestamps_names, result_tiles));
-    RETURN_CANCEL_OR_ERROR(unfilter_tiles(constants::timestamps, result_tiles));
-  }
-
+  if (use_timestamps_)
+    names.emplace_back(constants::timestamps);
   if (!condition_.empty()) {
-    // Read and unfilter tiles for query condition.
-    RETURN_CANCEL_OR_ERROR(
-        read_attribute_tiles(qc_loaded_names_, result_tiles));
-
     for (const auto& name : qc_loaded_names_) {
-      RETURN_CANCEL_OR_ERROR(unfilter_tiles(name, result_tiles));
+      if (std::find(names.begin(), names.end(), name) == names.end())
+        names.emplace_back(name);
     }
   }
+  RETURN_CANCEL_OR_ERROR(read_tiles(names, result_tiles));
+
+  // Unfilter the tiles.
+  for (const auto& name : names) {
+    RETURN_CANCEL_OR_ERROR(unfilter_tiles(name, result_tiles));
+  }
 
   logger_->debug("Done reading and unfiltering coords tiles");
   return Status::Ok();
@@ -478,7 +559,7 @@ Status SparseIndexReaderBase::compute_tile_bitmaps(
           // Compute the bitmap for the cells.
           {
             auto timer_compute_results_count_sparse =
-                stats_->start_timer("compute_results_count_sparse");
+                stats_->start_timer(compute_results_count_sparse_stat_);
             RETURN_NOT_OK(rt->compute_results_count_sparse(
                 dim_idx,
                 ranges_for_dim,
@@ -553,11 +634,20 @@ Status SparseIndexReaderBase::apply_query_condition(
             rt->count_cells();
           }
 
-          // Compute the result of the query condition for this tile.
+          // Compute the result of the query condition for this tile. The
+          // tiles where all or no cells match are not evaluated cell by cell.
           if (!condition_.empty()) {
             rt->ensure_bitmap_for_query_condition();
-            RETURN_NOT_OK(condition_.apply_sparse<BitmapType>(
-                *(frag_meta->array_schema().get()), *rt, rt->bitmap_with_qc()));
+            auto match = tile_match(rt->frag_idx(), rt->tile_idx());
+            if (match == QueryCondition::TileMatch::NONE) {
+              auto& bitmap = rt->bitmap_with_qc();
+              std::fill(bitmap.begin(), bitmap.end(), 0);
+            } else if (match == QueryCondition::TileMatch::SOME) {
+              RETURN_NOT_OK(condition_.apply_sparse<BitmapType>(
+                  *(frag_meta->array_schema().get()),
+                  *rt,
+                  rt->bitmap_with_qc()));
+            }
             if (array_schema_.allows_dups()) {
               rt->count_cells();
             }
@@ -200,8 +200,8 @@ class SparseIndexReaderBase : public ReaderBase {
       Layout layout,
       QueryCondition& condition);
 
-  /** Destructor. */
-  ~SparseIndexReaderBase() = default;
+  /** Destructor. Returns the memory reserved to the context. */
+  ~SparseIndexReaderBase();
 
   /* ********************************* */
   /*          PUBLIC METHODS           */
@@ -279,6 +279,22 @@ class SparseIndexReaderBase : public ReaderBase {
   /** Memory used for result tile ranges. */
   uint64_t memory_used_result_tile_ranges_;
 
+  /** Highest memory used for coordinates tiles. */
+  uint64_t memory_used_for_coords_peak_;
+
+  /** Highest memory used for query condition tiles. */
+  uint64_t memory_used_qc_tiles_peak_;
+
+  /** Peaks of the memory used for coordinates and query condition tiles
+   * already reported in the stats. */
+  std::pair<uint64_t, uint64_t> memory_peaks_reported_;
+
+  /** Memory tracker of the context the memory budget is reserved from. */
+  MemoryTracker* context_memory_tracker_;
+
+  /** Memory reserved from the context memory tracker. */
+  uint64_t memory_reserved_;
+
   /** How much of the memory budget is reserved for coords. */
   double memory_budget_ratio_coords_;
 
@@ -300,6 +316,9 @@ class SparseIndexReaderBase : public ReaderBase {
   /* Are the users buffers full. */
   bool buffers_full_;
 
+  /** The timer stat of the per-tile result count computation. */
+  stats::StatId compute_results_count_sparse_stat_;
+
   /** List of tiles to ignore. */
   std::unordered_set<IgnoredTile, ignored_tile_hash> ignored_tiles_;
 
@@ -316,6 +335,29 @@ class SparseIndexReaderBase : public ReaderBase {
    */
   uint64_t cells_copied(const std::vector<std::string>& names);
 
+  /**
+   * Reserves the memory budget against the memory budget of the context,
+   * waiting up to `sm.mem.admission_timeout_ms` for other readers to release
+   * it. Past the timeout, shrinks `memory_budget_` to the memory available,
+   * as long as it is at least a tenth of the budget. The array data part of
+   * the budget is not reserved, as the array memory tracker takes it from
+   * the context when it is loaded.
+   *
+   * @return Status.
+   */
+  Status admit_memory_budget();
+
+  /** Updates the peaks of the memory used for coordinates and query
+   * condition tiles, after the memory used was adjusted. */
+  void update_memory_peaks();
+
+  /**
+   * Adds the growth of the memory peaks since the last call to the stats,
+   * per level: context, array, and coordinates/query condition tiles of
+   * this reader.
+   */
+  void report_memory_usage();
+
   /**
    * Get the coordinate tiles size for a dimension.
    *
@@ -32,6 +32,7 @@
 #include "tiledb/sm/query/readers/sparse_unordered_with_dups_reader.h"
 #include "tiledb/common/logger.h"
 #include "tiledb/common/memory_tracker.h"
+#include "tiledb/common/scoped_executor.h"
 #include "tiledb/sm/array/array.h"
 #include "tiledb/sm/array_schema/array_schema.h"
 #include "tiledb/sm/array_schema/dimension.h"
@@ -144,12 +145,16 @@ Status SparseUnorderedWithDupsReader<BitmapType>::initialize_memory_budget() {
       &found));
   assert(found);
 
+  // Reserve the budget against the memory budget of the context.
+  RETURN_NOT_OK(admit_memory_budget());
+
   return Status::Ok();
 }
 
 template <class BitmapType>
 Status SparseUnorderedWithDupsReader<BitmapType>::dowork() {
   auto timer_se = stats_->start_timer("dowork");
+  ScopedExecutor report_memory([this]() { report_memory_usage(); });
 
   // Make sure user didn't request delete timestamps.
   if (buffers_.count(constants::delete_timestamps) != 0) {
@@ -315,6 +320,16 @@ SparseUnorderedWithDupsReader<BitmapType>::add_result_tile(
     const uint64_t t,
     const uint64_t last_t,
     const FragmentMetadata& frag_md) {
+  // Skip the tiles where no cell matches the query condition.
+  if (!condition_.empty() &&
+      condition_.tile_match(*fragment_metadata_[f], t) ==
+          QueryCondition::TileMatch::NONE) {
+    stats_->add_counter(qc_tile_pruned_num_stat_, 1);
+    if (t == last_t)
+      all_tiles_loaded_[f] = true;
+    return {Status::Ok(), false};
+  }
+
   // Calculate memory consumption for this tile.
   auto&& [st, tiles_sizes] = get_coord_tiles_size(dim_num, f, t);
   RETURN_NOT_OK_TUPLE(st, nullopt);
@@ -330,6 +345,7 @@ SparseUnorderedWithDupsReader<BitmapType>::add_result_tile(
   // Adjust memory usage.
   memory_used_for_coords_total_ += tiles_size;
   memory_used_qc_tiles_total_ += tiles_size_qc;
+  update_memory_peaks();
 
   // Add the result tile.
   result_tiles_.emplace_back(f, t, frag_md);
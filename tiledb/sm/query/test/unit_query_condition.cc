@@ -2358,6 +2358,170 @@ TEST_CASE(
   test_apply_dense<char*>(Datatype::STRING_ASCII, false, true);
 }
 
+/**
+ * Initializes a fixed-size tile of `result_tile` with `values` and, if
+ * `validity` is not empty, its validity tile with `validity`.
+ */
+template <typename T>
+void init_fixed_size_tile(
+    const std::string& field_name,
+    const Datatype type,
+    ResultTile* const result_tile,
+    const std::vector<T>& values,
+    const std::vector<uint8_t>& validity) {
+  ResultTile::TileTuple* const tile_tuple = result_tile->tile_tuple(field_name);
+  Tile* const tile = &std::get<0>(*tile_tuple);
+  REQUIRE(tile->init_unfiltered(
+                  constants::format_version,
+                  type,
+                  values.size() * sizeof(T),
+                  sizeof(T),
+                  0)
+              .ok());
+  REQUIRE(tile->write(values.data(), 0, values.size() * sizeof(T)).ok());
+
+  if (!validity.empty()) {
+    Tile* const tile_validity = &std::get<2>(*tile_tuple);
+    REQUIRE(tile_validity
+                ->init_unfiltered(
+                    constants::format_version,
+                    constants::cell_validity_type,
+                    validity.size() * constants::cell_validity_size,
+                    constants::cell_validity_size,
+                    0)
+                .ok());
+    REQUIRE(tile_validity
+                ->write(
+                    validity.data(),
+                    0,
+                    validity.size() * constants::cell_validity_size)
+                .ok());
+  }
+}
+
+/**
+ * Compares the vectorized evaluation of each comparison operator on
+ * contiguous fixed-size cells with the scalar evaluation of the same cells
+ * read with a stride of 2.
+ *
+ * @param type The TILEDB data type of the attribute.
+ * @param nullable Run the test with nullable attribute.
+ */
+template <typename T>
+void test_apply_dense_vectorized(const Datatype type, const bool nullable) {
+  const std::string field_name = "foo";
+  // Two full vectors of the narrowest type plus a shorter tail.
+  const uint64_t cells = 67;
+  const T cmp_value = 5;
+
+  // Initialize the array schema.
+  ArraySchema array_schema;
+  Attribute attr(field_name, type);
+  REQUIRE(attr.set_nullable(nullable).ok());
+  REQUIRE(attr.set_cell_val_num(1).ok());
+  REQUIRE(array_schema.add_attribute(tdb::make_shared<Attribute>(HERE(), &attr))
+              .ok());
+  Domain domain;
+  Dimension dim("dim1", Datatype::UINT32);
+  uint32_t bounds[2] = {1, 2 * cells};
+  Range range(bounds, 2 * sizeof(uint32_t));
+  REQUIRE(dim.set_domain(range).ok());
+  REQUIRE(
+      domain
+          .add_dimension(tdb::make_shared<tiledb::sm::Dimension>(HERE(), &dim))
+          .ok());
+  REQUIRE(
+      array_schema.set_domain(make_shared<tiledb::sm::Domain>(HERE(), &domain))
+          .ok());
+
+  // The contiguous tile holds the cells, the strided tile holds the same
+  // cells interleaved with cells that must be skipped.
+  std::vector<T> values(cells), strided_values(2 * cells);
+  std::vector<uint8_t> validity, strided_validity;
+  for (uint64_t i = 0; i < cells; ++i) {
+    values[i] = static_cast<T>(i % 11);
+    strided_values[2 * i] = values[i];
+    strided_values[2 * i + 1] = cmp_value;
+  }
+  if (nullable) {
+    validity.resize(cells);
+    strided_validity.resize(2 * cells);
+    for (uint64_t i = 0; i < cells; ++i) {
+      validity[i] = i % 3 != 0;
+      strided_validity[2 * i] = validity[i];
+      strided_validity[2 * i + 1] = 1;
+    }
+  }
+
+  ResultTile result_tile(0, 0, array_schema);
+  result_tile.init_attr_tile(field_name);
+  init_fixed_size_tile<T>(field_name, type, &result_tile, values, validity);
+  ResultTile strided_result_tile(0, 0, array_schema);
+  strided_result_tile.init_attr_tile(field_name);
+  init_fixed_size_tile<T>(
+      field_name, type, &strided_result_tile, strided_values, strided_validity);
+
+  for (const auto op :
+       {QueryConditionOp::LT,
+        QueryConditionOp::LE,
+        QueryConditionOp::GT,
+        QueryConditionOp::GE,
+        QueryConditionOp::EQ,
+        QueryConditionOp::NE}) {
+    QueryCondition query_condition;
+    REQUIRE(
+        query_condition.init(std::string(field_name), &cmp_value, sizeof(T), op)
+            .ok());
+    REQUIRE(query_condition.check(array_schema).ok());
+
+    std::vector<uint8_t> result_bitmap(cells, 1);
+    REQUIRE(query_condition
+                .apply_dense(
+                    array_schema,
+                    &result_tile,
+                    0,
+                    cells,
+                    0,
+                    1,
+                    result_bitmap.data())
+                .ok());
+    std::vector<uint8_t> strided_result_bitmap(cells, 1);
+    REQUIRE(query_condition
+                .apply_dense(
+                    array_schema,
+                    &strided_result_tile,
+                    0,
+                    cells,
+                    0,
+                    2,
+                    strided_result_bitmap.data())
+                .ok());
+
+    CHECK(result_bitmap == strided_result_bitmap);
+    for (uint64_t i = 0; i < cells; ++i) {
+      if (nullable && validity[i] == 0)
+        CHECK(result_bitmap[i] == 0);
+    }
+  }
+}
+
+TEST_CASE(
+    "QueryCondition: Test apply dense vectorized",
+    "[QueryCondition][apply][dense][vectorized]") {
+  const bool nullable = GENERATE(true, false);
+  test_apply_dense_vectorized<int8_t>(Datatype::INT8, nullable);
+  test_apply_dense_vectorized<uint8_t>(Datatype::UINT8, nullable);
+  test_apply_dense_vectorized<int16_t>(Datatype::INT16, nullable);
+  test_apply_dense_vectorized<uint16_t>(Datatype::UINT16, nullable);
+  test_apply_dense_vectorized<int32_t>(Datatype::INT32, nullable);
+  test_apply_dense_vectorized<uint32_t>(Datatype::UINT32, nullable);
+  test_apply_dense_vectorized<int64_t>(Datatype::INT64, nullable);
+  test_apply_dense_vectorized<uint64_t>(Datatype::UINT64, nullable);
+  test_apply_dense_vectorized<float>(Datatype::FLOAT32, nullable);
+  test_apply_dense_vectorized<double>(Datatype::FLOAT64, nullable);
+  test_apply_dense_vectorized<char>(Datatype::CHAR, nullable);
+}
+
 TEST_CASE(
     "QueryCondition: Test empty/null strings dense",
     "[QueryCondition][empty_string][null_string][dense]") {
@@ -54,6 +54,9 @@
 #include "tiledb/sm/tile/tile_metadata_generator.h"
 #include "tiledb/sm/tile/writer_tile.h"
 
+#include <array>
+#include <cstring>
+
 using namespace tiledb;
 using namespace tiledb::common;
 using namespace tiledb::sm::stats;
@@ -61,6 +64,210 @@ using namespace tiledb::sm::stats;
 namespace tiledb {
 namespace sm {
 
+namespace {
+/** A component of the radix sort key of a cell. */
+struct RadixKeyComponent {
+  /** The dimension, `nullptr` for the Hilbert value. */
+  const Dimension* dim_;
+
+  /** The coordinates of the dimension, or the Hilbert values. */
+  const void* values_;
+
+  /** Whether the component is the tile index rather than the coordinate. */
+  bool tile_;
+
+  /** The minimum value of the component over the cells. */
+  uint64_t min_;
+
+  /** The number of bits of the component in the key. */
+  uint64_t bits_;
+};
+
+/** A cell to radix sort, with its key of `W` 64-bit words. */
+template <unsigned W>
+struct RadixSortCell {
+  /** The key words, from the least significant one. */
+  std::array<uint64_t, W> key_;
+
+  /** The position of the cell in the user buffers. */
+  uint64_t pos_;
+};
+
+/**
+ * Maps a coordinate to an unsigned integer with the same order. Negative
+ * zero is mapped to positive zero, as the two compare equal.
+ */
+template <class T>
+inline uint64_t order_preserving_uint64(const T v) {
+  if constexpr (std::is_floating_point<T>::value) {
+    const double d = v == 0 ? 0.0 : static_cast<double>(v);
+    uint64_t bits;
+    std::memcpy(&bits, &d, sizeof(bits));
+    return (bits >> 63) ? ~bits : bits | (uint64_t(1) << 63);
+  } else if constexpr (std::is_signed<T>::value) {
+    return static_cast<uint64_t>(static_cast<int64_t>(v)) ^
+           (uint64_t(1) << 63);
+  } else {
+    return static_cast<uint64_t>(v);
+  }
+}
+
+/**
+ * Calls `f(c, value)` for the cells `c` in [begin, end), with `value` the
+ * order-preserving tile index or coordinate of the component.
+ */
+template <class T, class F>
+void for_each_key_value(
+    const RadixKeyComponent& comp,
+    const uint64_t begin,
+    const uint64_t end,
+    const F& f) {
+  auto coords = static_cast<const T*>(comp.values_);
+  if (comp.tile_) {
+    auto domain = (const T*)comp.dim_->domain().data();
+    auto tile_extent = *(const T*)comp.dim_->tile_extent().data();
+    for (uint64_t c = begin; c < end; ++c)
+      f(c, Dimension::tile_idx(coords[c], domain[0], tile_extent));
+  } else {
+    for (uint64_t c = begin; c < end; ++c)
+      f(c, order_preserving_uint64(coords[c]));
+  }
+}
+
+/**
+ * Dispatches `for_each_key_value` on the datatype of the component.
+ *
+ * @return `false` if the datatype cannot be radix sorted.
+ */
+template <class F>
+bool for_each_key_value(
+    const RadixKeyComponent& comp,
+    const uint64_t begin,
+    const uint64_t end,
+    const F& f) {
+  if (comp.dim_ == nullptr) {
+    for_each_key_value<uint64_t>(comp, begin, end, f);
+    return true;
+  }
+
+  switch (comp.dim_->type()) {
+    case Datatype::INT8:
+      for_each_key_value<int8_t>(comp, begin, end, f);
+      return true;
+    case Datatype::UINT8:
+      for_each_key_value<uint8_t>(comp, begin, end, f);
+      return true;
+    case Datatype::INT16:
+      for_each_key_value<int16_t>(comp, begin, end, f);
+      return true;
+    case Datatype::UINT16:
+      for_each_key_value<uint16_t>(comp, begin, end, f);
+      return true;
+    case Datatype::INT32:
+      for_each_key_value<int32_t>(comp, begin, end, f);
+      return true;
+    case Datatype::UINT32:
+      for_each_key_value<uint32_t>(comp, begin, end, f);
+      return true;
+    case Datatype::UINT64:
+      for_each_key_value<uint64_t>(comp, begin, end, f);
+      return true;
+    case Datatype::INT64:
+    case Datatype::DATETIME_YEAR:
+    case Datatype::DATETIME_MONTH:
+    case Datatype::DATETIME_WEEK:
+    case Datatype::DATETIME_DAY:
+    case Datatype::DATETIME_HR:
+    case Datatype::DATETIME_MIN:
+    case Datatype::DATETIME_SEC:
+    case Datatype::DATETIME_MS:
+    case Datatype::DATETIME_US:
+    case Datatype::DATETIME_NS:
+    case Datatype::DATETIME_PS:
+    case Datatype::DATETIME_FS:
+    case Datatype::DATETIME_AS:
+    case Datatype::TIME_HR:
+    case Datatype::TIME_MIN:
+    case Datatype::TIME_SEC:
+    case Datatype::TIME_MS:
+    case Datatype::TIME_US:
+    case Datatype::TIME_NS:
+    case Datatype::TIME_PS:
+    case Datatype::TIME_FS:
+    case Datatype::TIME_AS:
+      for_each_key_value<int64_t>(comp, begin, end, f);
+      return true;
+    case Datatype::FLOAT32:
+      for_each_key_value<float>(comp, begin, end, f);
+      return true;
+    case Datatype::FLOAT64:
+      for_each_key_value<double>(comp, begin, end, f);
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Packs the key components of every cell into `W` words, radix sorts the
+ * cells on them and stores the sorted positions in `cell_pos`.
+ */
+template <unsigned W>
+Status radix_sort_cells(
+    ThreadPool* const tp,
+    const std::vector<RadixKeyComponent>& components,
+    const uint64_t key_bits,
+    const uint64_t cell_num,
+    std::vector<uint64_t>& cell_pos) {
+  // Pack the keys, shifting in the components from the most significant one.
+  std::vector<RadixSortCell<W>> cells(cell_num);
+  const uint64_t chunk_num =
+      std::min<uint64_t>(tp->concurrency_level(), cell_num);
+  const uint64_t chunk_len = (cell_num + chunk_num - 1) / chunk_num;
+  RETURN_NOT_OK(parallel_for(tp, 0, chunk_num, [&](uint64_t i) {
+    const uint64_t begin = i * chunk_len;
+    const uint64_t end = std::min(cell_num, begin + chunk_len);
+    for (uint64_t c = begin; c < end; ++c) {
+      cells[c].key_.fill(0);
+      cells[c].pos_ = c;
+    }
+
+    for (const auto& comp : components) {
+      const uint64_t bits = comp.bits_;
+      if (bits == 0)
+        continue;
+
+      for_each_key_value(comp, begin, end, [&](uint64_t c, uint64_t v) {
+        auto& key = cells[c].key_;
+        for (unsigned w = W - 1; w > 0; --w) {
+          key[w] = bits == 64 ? key[w - 1] :
+                                (key[w] << bits) | (key[w - 1] >> (64 - bits));
+        }
+        v -= comp.min_;
+        key[0] = bits == 64 ? v : (key[0] << bits) | v;
+      });
+    }
+
+    return Status::Ok();
+  }));
+
+  RETURN_NOT_OK(parallel_radix_sort(
+      tp, cells, key_bits, [](const RadixSortCell<W>& cell, uint64_t shift) {
+        const uint64_t w = shift / 64;
+        const uint64_t s = shift % 64;
+        uint64_t digit = cell.key_[w] >> s;
+        if (s != 0 && w + 1 < W)
+          digit |= cell.key_[w + 1] << (64 - s);
+        return digit;
+      }));
+
+  for (uint64_t i = 0; i < cell_num; ++i)
+    cell_pos[i] = cells[i].pos_;
+
+  return Status::Ok();
+}
+}  // namespace
+
 /* ****************************** */
 /*   CONSTRUCTORS & DESTRUCTORS   */
 /* ****************************** */
@@ -581,6 +788,19 @@ Status UnorderedWriter::sort_coords(std::vector<uint64_t>& cell_pos) const {
   auto cell_order = array_schema_.cell_order();
   const Domain& domain = array_schema_.domain();
   DomainBuffersView domain_buffs{array_schema_, buffers_};
+  std::vector<uint64_t> hilbert_values;
+  if (cell_order == Layout::HILBERT) {
+    hilbert_values.resize(coords_info_.coords_num_);
+    RETURN_NOT_OK(calculate_hilbert_values(domain_buffs, hilbert_values));
+  }
+
+  // Sort on packed keys if possible, which avoids the comparator calls
+  auto&& [st, radix_sorted] =
+      radix_sort_coords(domain_buffs, hilbert_values, cell_pos);
+  RETURN_NOT_OK(st);
+  if (*radix_sorted)
+    return Status::Ok();
+
   if (cell_order != Layout::HILBERT) {  // Row- or col-major
     parallel_sort(
         storage_manager_->compute_tp(),
@@ -588,8 +808,6 @@ Status UnorderedWriter::sort_coords(std::vector<uint64_t>& cell_pos) const {
         cell_pos.end(),
         GlobalCmpQB(domain, domain_buffs));
   } else {  // Hilbert order
-    std::vector<uint64_t> hilbert_values(coords_info_.coords_num_);
-    RETURN_NOT_OK(calculate_hilbert_values(domain_buffs, hilbert_values));
     parallel_sort(
         storage_manager_->compute_tp(),
         cell_pos.begin(),
@@ -600,6 +818,82 @@ Status UnorderedWriter::sort_coords(std::vector<uint64_t>& cell_pos) const {
   return Status::Ok();
 }
 
+tuple<Status, optional<bool>> UnorderedWriter::radix_sort_coords(
+    const DomainBuffersView& domain_buffs,
+    const std::vector<uint64_t>& hilbert_values,
+    std::vector<uint64_t>& cell_pos) const {
+  const uint64_t cell_num = coords_info_.coords_num_;
+  const auto dim_num = array_schema_.dim_num();
+  if (cell_num == 0 || !array_schema_.domain().all_dims_fixed())
+    return {Status::Ok(), false};
+
+  // Collect the key components in global order, from the most significant
+  // one. Dimensions without a tile extent do not contribute a tile index.
+  std::vector<RadixKeyComponent> components;
+  auto add_dims = [&](Layout order, bool tile) {
+    for (unsigned i = 0; i < dim_num; ++i) {
+      unsigned d = (order == Layout::ROW_MAJOR) ? i : dim_num - 1 - i;
+      auto dim{array_schema_.dimension_ptr(d)};
+      if (tile && !dim->tile_extent())
+        continue;
+      components.push_back({dim, domain_buffs[d]->buffer_, tile, 0, 0});
+    }
+  };
+  if (array_schema_.cell_order() == Layout::HILBERT) {
+    components.push_back({nullptr, hilbert_values.data(), false, 0, 0});
+  } else {
+    add_dims(array_schema_.tile_order(), true);
+  }
+  add_dims(array_schema_.cell_order(), false);
+
+  // Narrow every component to the bits that vary across the cells
+  auto compute_tp = storage_manager_->compute_tp();
+  const uint64_t chunk_num =
+      std::min<uint64_t>(compute_tp->concurrency_level(), cell_num);
+  const uint64_t chunk_len = (cell_num + chunk_num - 1) / chunk_num;
+  uint64_t key_bits = 0;
+  for (auto& comp : components) {
+    std::vector<uint64_t> mins(chunk_num, UINT64_MAX);
+    std::vector<uint64_t> maxs(chunk_num, 0);
+    std::vector<uint8_t> supported(chunk_num, 0);
+    auto status = parallel_for(compute_tp, 0, chunk_num, [&](uint64_t i) {
+      const uint64_t begin = i * chunk_len;
+      const uint64_t end = std::min(cell_num, begin + chunk_len);
+      supported[i] =
+          for_each_key_value(comp, begin, end, [&](uint64_t, uint64_t v) {
+            mins[i] = std::min(mins[i], v);
+            maxs[i] = std::max(maxs[i], v);
+          });
+      return Status::Ok();
+    });
+    RETURN_NOT_OK_ELSE_TUPLE(status, logger_->status(status), nullopt);
+    if (!supported[0])
+      return {Status::Ok(), false};
+
+    comp.min_ = *std::min_element(mins.begin(), mins.end());
+    const uint64_t range =
+        *std::max_element(maxs.begin(), maxs.end()) - comp.min_;
+    for (uint64_t r = range; r != 0; r >>= 1)
+      ++comp.bits_;
+    key_bits += comp.bits_;
+  }
+
+  // Keys over 128 bits are left to the comparator sort
+  Status status;
+  if (key_bits <= 64) {
+    status = radix_sort_cells<1>(
+        compute_tp, components, key_bits, cell_num, cell_pos);
+  } else if (key_bits <= 128) {
+    status = radix_sort_cells<2>(
+        compute_tp, components, key_bits, cell_num, cell_pos);
+  } else {
+    return {Status::Ok(), false};
+  }
+  RETURN_NOT_OK_ELSE_TUPLE(status, logger_->status(status), nullopt);
+
+  return {Status::Ok(), true};
+}
+
 Status UnorderedWriter::unordered_write() {
   // Applicable only to unordered write on sparse arrays
   assert(layout_ == Layout::UNORDERED);
@@ -208,6 +208,26 @@ class UnorderedWriter : public WriterBase {
    */
   Status sort_coords(std::vector<uint64_t>& cell_pos) const;
 
+  /**
+   * Sorts the coordinates of the user buffers on packed per-cell keys with
+   * a parallel radix sort. The key of a cell concatenates the tile indices
+   * and the coordinates of the cell in global order (or its Hilbert value
+   * and coordinates), each mapped to an order-preserving unsigned integer
+   * narrowed to the bits that vary across the written cells.
+   *
+   * @param domain_buffs The coordinate buffers.
+   * @param hilbert_values The Hilbert values of the cells, for the Hilbert
+   *     cell order only.
+   * @param cell_pos The sorted cell positions to be created.
+   * @return Status, and `false` if the keys do not fit in 128 bits or
+   *     involve var-sized dimensions, in which case `cell_pos` is not
+   *     modified and the comparator sort must be used.
+   */
+  tuple<Status, optional<bool>> radix_sort_coords(
+      const DomainBuffersView& domain_buffs,
+      const std::vector<uint64_t>& hilbert_values,
+      std::vector<uint64_t>& cell_pos) const;
+
   /**
    * Writes in unordered layout. Applicable to both dense and sparse arrays.
    * Explicit coordinates must be provided for this write.
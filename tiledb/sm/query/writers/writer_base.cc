@@ -276,20 +276,40 @@ Status WriterBase::calculate_hilbert_values(
   auto bits = h.bits();
   auto max_bucket_val = ((uint64_t)1 << bits) - 1;
 
-  // Calculate Hilbert values in parallel
-  assert(hilbert_values.size() >= coords_info_.coords_num_);
+  // Calculate Hilbert values in parallel, on batches of cells
+  const uint64_t cell_num = coords_info_.coords_num_;
+  assert(hilbert_values.size() >= cell_num);
+  const uint64_t batch_size = hilbert_order::batch_size;
   auto status = parallel_for(
       storage_manager_->compute_tp(),
       0,
-      coords_info_.coords_num_,
-      [&](uint64_t c) {
-        std::vector<uint64_t> coords(dim_num);
+      (cell_num + batch_size - 1) / batch_size,
+      [&](uint64_t b) {
+        const uint64_t begin = b * batch_size;
+        const uint64_t num = std::min(batch_size, cell_num - begin);
+        std::vector<uint64_t> coords(dim_num * num);
+        std::vector<const uint64_t*> dim_coords(dim_num);
         for (uint32_t d = 0; d < dim_num; ++d) {
           auto dim{array_schema_.dimension_ptr(d)};
-          coords[d] = hilbert_order::map_to_uint64(
-              *dim, domain_buffers[d], c, bits, max_bucket_val);
+          auto out = &coords[d * num];
+          if (dim->var_size()) {
+            for (uint64_t c = 0; c < num; ++c) {
+              out[c] = hilbert_order::map_to_uint64(
+                  *dim, domain_buffers[d], begin + c, bits, max_bucket_val);
+            }
+          } else {
+            auto buff = static_cast<const uint8_t*>(domain_buffers[d]->buffer_);
+            hilbert_order::map_to_uint64(
+                *dim,
+                buff + begin * dim->coord_size(),
+                num,
+                bits,
+                max_bucket_val,
+                out);
+          }
+          dim_coords[d] = out;
         }
-        hilbert_values[c] = h.coords_to_hilbert(&coords[0]);
+        h.coords_to_hilbert(&dim_coords[0], num, &hilbert_values[begin]);
 
         return Status::Ok();
       });
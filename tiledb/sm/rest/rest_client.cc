@@ -890,6 +890,68 @@ Status RestClient::get_query_est_result_sizes(const URI& uri, Query* query) {
       query, serialization_type_, true, returned_data);
 }
 
+Status RestClient::get_query_aggregate_from_rest(
+    const URI& uri,
+    Query* query,
+    const std::string& name,
+    AggregateOp op,
+    void* value,
+    uint64_t* value_size) {
+  if (query == nullptr) {
+    return LOG_STATUS(Status_RestError(
+        "Error getting query aggregate from REST; Query is null."));
+  }
+
+  // Get array
+  const Array* array = query->array();
+  if (array == nullptr) {
+    return LOG_STATUS(Status_RestError(
+        "Error getting query aggregate from REST; null array."));
+  }
+
+  // Serialize the query with the aggregate to send
+  Buffer buff;
+  RETURN_NOT_OK(serialization::query_aggregate_request_serialize(
+      query, name, op, serialization_type_, &buff));
+  // Wrap in a list
+  BufferList serialized;
+  RETURN_NOT_OK(serialized.add_buffer(std::move(buff)));
+
+  // Init curl and form the URL
+  Curl curlc(logger_);
+  std::string array_ns, array_uri;
+  RETURN_NOT_OK(uri.get_rest_components(&array_ns, &array_uri));
+  const std::string cache_key = array_ns + ":" + array_uri;
+  RETURN_NOT_OK(
+      curlc.init(config_, extra_headers_, &redirect_meta_, &redirect_mtx_));
+  std::string url = redirect_uri(cache_key) + "/v1/arrays/" + array_ns + "/" +
+                    curlc.url_escape(array_uri) + "/query/aggregate?type=" +
+                    query_type_str(query->type());
+
+  // Remote array reads always supply the timestamp.
+  url += "&start_timestamp=" + std::to_string(array->timestamp_start());
+  url += "&end_timestamp=" + std::to_string(array->timestamp_end());
+
+  // Get the data
+  Buffer returned_data;
+  RETURN_NOT_OK(curlc.post_data(
+      stats_,
+      url,
+      serialization_type_,
+      &serialized,
+      &returned_data,
+      cache_key));
+  if (returned_data.data() == nullptr || returned_data.size() == 0) {
+    return LOG_STATUS(Status_RestError(
+        "Error getting query aggregate from REST; server returned no data."));
+  }
+
+  // Ensure data has a null delimiter for cap'n proto if using JSON
+  RETURN_NOT_OK(ensure_json_null_delimited_string(&returned_data));
+  return serialization::query_aggregate_value_deserialize(
+      returned_data, serialization_type_, value, value_size);
+}
+
 std::string RestClient::redirect_uri(const std::string& cache_key) {
   std::unique_lock<std::mutex> rd_lck(redirect_mtx_);
   std::unordered_map<std::string, std::string>::const_iterator cache_it =
@@ -1185,6 +1247,12 @@ Status RestClient::get_query_est_result_sizes(const URI&, Query*) {
       Status_RestError("Cannot use rest client; serialization not enabled."));
 }
 
+Status RestClient::get_query_aggregate_from_rest(
+    const URI&, Query*, const std::string&, AggregateOp, void*, uint64_t*) {
+  return LOG_STATUS(
+      Status_RestError("Cannot use rest client; serialization not enabled."));
+}
+
 Status RestClient::post_array_schema_evolution_to_rest(
     const URI&, ArraySchemaEvolution*) {
   return LOG_STATUS(
@@ -52,6 +52,7 @@ class ArraySchema;
 class Config;
 class Query;
 
+enum class AggregateOp : uint8_t;
 enum class SerializationType : uint8_t;
 
 class RestClient {
@@ -200,6 +201,26 @@ class RestClient {
    */
   Status get_query_est_result_sizes(const URI& uri, Query* query);
 
+  /**
+   * Get an aggregate over the cells of a query from the rest server.
+   *
+   * @param uri of array being queried
+   * @param query to compute the aggregate over
+   * @param name Attribute name, ignored for `AGGREGATE_COUNT`
+   * @param op Aggregate operator
+   * @param value Buffer receiving the aggregate value
+   * @param value_size As input, the size of `value`. As output, the size of
+   *     the aggregate value
+   * @return Status Ok() on success Error() on failures
+   */
+  Status get_query_aggregate_from_rest(
+      const URI& uri,
+      Query* query,
+      const std::string& name,
+      AggregateOp op,
+      void* value,
+      uint64_t* value_size);
+
   /**
    * Post array schema evolution to rest server
    *
@@ -40,6 +40,7 @@
 
 #include <cassert>
 #include <cmath>
+#include <cstring>
 #include <iostream>
 #include <list>
 
@@ -114,16 +115,37 @@ Status RTree::build_tree() {
   // Make the root as the first level
   std::reverse(std::begin(levels_), std::end(levels_));
 
+  build_flat_levels();
+
   return Status::Ok();
 }
 
 uint64_t RTree::free_memory() {
-  auto ret = deserialized_buffer_size_;
+  auto ret = deserialized_buffer_size_ + flat_levels_size();
   levels_.clear();
+  free_flat_levels();
   deserialized_buffer_size_ = 0;
   return ret;
 }
 
+uint64_t RTree::flat_levels_size() const {
+  uint64_t size = 0;
+  for (const auto& flat_level : flat_levels_) {
+    for (const auto& starts : flat_level.starts_)
+      size += starts.size();
+    for (const auto& ends : flat_level.ends_)
+      size += ends.size();
+  }
+
+  return size;
+}
+
+void RTree::free_flat_levels() {
+  // Swap with empty vectors to release the memory.
+  std::vector<FlatLevel>().swap(flat_levels_);
+  std::vector<FlatTestFunc>().swap(flat_test_funcs_);
+}
+
 unsigned RTree::dim_num() const {
   return (domain_ == nullptr) ? 0 : domain_->dim_num();
 }
@@ -140,6 +162,21 @@ TileOverlap RTree::get_tile_overlap(
   if (domain_ == nullptr || levels_.empty())
     return overlap;
 
+  if (has_flat_levels()) {
+    std::vector<std::pair<unsigned, const Range*>> dim_ranges;
+    std::vector<Entry> traversal;
+    std::vector<uint8_t> overlap_flags, covered_flags;
+    get_tile_overlap_flat(
+        range,
+        is_default,
+        dim_ranges,
+        traversal,
+        overlap_flags,
+        covered_flags,
+        &overlap);
+    return overlap;
+  }
+
   // This will keep track of the traversal
   std::list<Entry> traversal;
   traversal.push_front({0, 0});
@@ -185,12 +222,61 @@ TileOverlap RTree::get_tile_overlap(
   return overlap;
 }
 
+void RTree::get_tile_overlap(
+    const std::vector<NDRange>& ranges,
+    std::vector<bool>& is_default,
+    std::vector<TileOverlap>* tile_overlaps) const {
+  tile_overlaps->clear();
+  tile_overlaps->resize(ranges.size());
+
+  // Empty tree
+  if (domain_ == nullptr || levels_.empty())
+    return;
+
+  if (!has_flat_levels()) {
+    for (size_t r = 0; r < ranges.size(); ++r)
+      (*tile_overlaps)[r] = get_tile_overlap(ranges[r], is_default);
+    return;
+  }
+
+  std::vector<std::pair<unsigned, const Range*>> dim_ranges;
+  std::vector<Entry> traversal;
+  std::vector<uint8_t> overlap_flags, covered_flags;
+  for (size_t r = 0; r < ranges.size(); ++r) {
+    get_tile_overlap_flat(
+        ranges[r],
+        is_default,
+        dim_ranges,
+        traversal,
+        overlap_flags,
+        covered_flags,
+        &(*tile_overlaps)[r]);
+  }
+}
+
 void RTree::compute_tile_bitmap(
     const Range& range, unsigned d, std::vector<uint8_t>* tile_bitmap) const {
   // Empty tree
   if (domain_ == nullptr || levels_.empty())
     return;
 
+  if (has_flat_levels()) {
+    std::vector<std::pair<unsigned, const Range*>> dim_range = {{d, &range}};
+    std::vector<Entry> traversal;
+    std::vector<uint8_t> overlap_flags, covered_flags;
+    traverse_flat(
+        dim_range,
+        traversal,
+        overlap_flags,
+        covered_flags,
+        [&](uint64_t start, uint64_t end) {
+          std::fill(
+              tile_bitmap->begin() + start, tile_bitmap->begin() + end + 1, 1);
+        },
+        [&](uint64_t leaf_idx) { tile_bitmap->at(leaf_idx) = 1; });
+    return;
+  }
+
   // This will keep track of the traversal
   std::list<Entry> traversal;
   traversal.push_front({0, 0});
@@ -296,6 +382,7 @@ Status RTree::set_leaf(uint64_t leaf_id, const NDRange& mbr) {
     return LOG_STATUS(Status_RTreeError("Cannot set leaf; Invalid lead index"));
 
   levels_[0][leaf_id] = mbr;
+  flat_levels_.clear();
 
   return Status::Ok();
 }
@@ -304,6 +391,7 @@ Status RTree::set_leaves(const std::vector<NDRange>& mbrs) {
   levels_.clear();
   levels_.resize(1);
   levels_[0] = mbrs;
+  flat_levels_.clear();
   return Status::Ok();
 }
 
@@ -318,6 +406,7 @@ Status RTree::set_leaf_num(uint64_t num) {
                           "cannot be smaller than the current leaf number"));
 
   levels_[0].resize(num);
+  flat_levels_.clear();
   return Status::Ok();
 }
 
@@ -347,11 +436,233 @@ RTree::Level RTree::build_level(const Level& level) {
   return new_level;
 }
 
+void RTree::build_flat_levels() {
+  flat_levels_.clear();
+  flat_test_funcs_.clear();
+  if (domain_ == nullptr || levels_.empty())
+    return;
+
+  // Set the test function of each dimension
+  auto dim_num = domain_->dim_num();
+  std::vector<FlatTestFunc> funcs(dim_num);
+  for (unsigned d = 0; d < dim_num; ++d) {
+    switch (domain_->dimension_ptr(d)->type()) {
+      case Datatype::INT8:
+        funcs[d] = flat_test<int8_t>;
+        break;
+      case Datatype::UINT8:
+        funcs[d] = flat_test<uint8_t>;
+        break;
+      case Datatype::INT16:
+        funcs[d] = flat_test<int16_t>;
+        break;
+      case Datatype::UINT16:
+        funcs[d] = flat_test<uint16_t>;
+        break;
+      case Datatype::INT32:
+        funcs[d] = flat_test<int32_t>;
+        break;
+      case Datatype::UINT32:
+        funcs[d] = flat_test<uint32_t>;
+        break;
+      case Datatype::INT64:
+        funcs[d] = flat_test<int64_t>;
+        break;
+      case Datatype::UINT64:
+        funcs[d] = flat_test<uint64_t>;
+        break;
+      case Datatype::FLOAT32:
+        funcs[d] = flat_test<float>;
+        break;
+      case Datatype::FLOAT64:
+        funcs[d] = flat_test<double>;
+        break;
+      case Datatype::DATETIME_YEAR:
+      case Datatype::DATETIME_MONTH:
+      case Datatype::DATETIME_WEEK:
+      case Datatype::DATETIME_DAY:
+      case Datatype::DATETIME_HR:
+      case Datatype::DATETIME_MIN:
+      case Datatype::DATETIME_SEC:
+      case Datatype::DATETIME_MS:
+      case Datatype::DATETIME_US:
+      case Datatype::DATETIME_NS:
+      case Datatype::DATETIME_PS:
+      case Datatype::DATETIME_FS:
+      case Datatype::DATETIME_AS:
+      case Datatype::TIME_HR:
+      case Datatype::TIME_MIN:
+      case Datatype::TIME_SEC:
+      case Datatype::TIME_MS:
+      case Datatype::TIME_US:
+      case Datatype::TIME_NS:
+      case Datatype::TIME_PS:
+      case Datatype::TIME_FS:
+      case Datatype::TIME_AS:
+        funcs[d] = flat_test<int64_t>;
+        break;
+      default:
+        // Var-sized dimensions are not flattened
+        return;
+    }
+  }
+
+  // Copy the MBR bounds of every level
+  std::vector<FlatLevel> flat_levels(levels_.size());
+  for (size_t l = 0; l < levels_.size(); ++l) {
+    const auto& level = levels_[l];
+    auto& flat_level = flat_levels[l];
+    flat_level.starts_.resize(dim_num);
+    flat_level.ends_.resize(dim_num);
+    for (unsigned d = 0; d < dim_num; ++d) {
+      auto coord_size = domain_->dimension_ptr(d)->coord_size();
+      auto& starts = flat_level.starts_[d];
+      auto& ends = flat_level.ends_[d];
+      starts.resize(level.size() * coord_size);
+      ends.resize(level.size() * coord_size);
+      for (uint64_t m = 0; m < level.size(); ++m) {
+        // Unset MBRs (e.g., leaves not set yet) cannot be flattened
+        const auto& r = level[m][d];
+        if (r.size() != 2 * coord_size)
+          return;
+        std::memcpy(&starts[m * coord_size], r.data(), coord_size);
+        std::memcpy(
+            &ends[m * coord_size],
+            static_cast<const uint8_t*>(r.data()) + coord_size,
+            coord_size);
+      }
+    }
+  }
+
+  flat_levels_ = std::move(flat_levels);
+  flat_test_funcs_ = std::move(funcs);
+}
+
+bool RTree::has_flat_levels() const {
+  return !flat_levels_.empty() && flat_levels_.size() == levels_.size() &&
+         domain_ != nullptr && flat_test_funcs_.size() == domain_->dim_num();
+}
+
+template <class T>
+void RTree::flat_test(
+    const ByteVec& starts,
+    const ByteVec& ends,
+    uint64_t mbr_idx,
+    uint64_t num,
+    const Range& range,
+    uint8_t* overlap,
+    uint8_t* covered) {
+  auto s = reinterpret_cast<const T*>(starts.data()) + mbr_idx;
+  auto e = reinterpret_cast<const T*>(ends.data()) + mbr_idx;
+  auto r = static_cast<const T*>(range.data());
+  const T low = r[0];
+  const T high = r[1];
+
+  // The loop is kept branch-free so that it is vectorized. The tests
+  // match `Dimension::overlap` and `Dimension::covered`.
+  for (uint64_t i = 0; i < num; ++i) {
+    overlap[i] &= static_cast<uint8_t>(!(s[i] > high) & !(e[i] < low));
+    covered[i] &= static_cast<uint8_t>((s[i] >= low) & (e[i] <= high));
+  }
+}
+
+template <class FullF, class PartialF>
+void RTree::traverse_flat(
+    const std::vector<std::pair<unsigned, const Range*>>& range,
+    std::vector<Entry>& traversal,
+    std::vector<uint8_t>& overlap,
+    std::vector<uint8_t>& covered,
+    FullF&& full_f,
+    PartialF&& partial_f) const {
+  auto leaf_num = levels_.back().size();
+  auto height = this->height();
+  overlap.resize(std::max(fanout_, 1u));
+  covered.resize(overlap.size());
+
+  // Tests the `num` MBRs of `level` starting at `mbr_idx` and pushes the
+  // ones overlapping the range to the traversal, in reverse order so that
+  // they are popped in leaf order.
+  auto push_mbrs = [&](uint64_t level, uint64_t mbr_idx, uint64_t num) {
+    std::fill(overlap.begin(), overlap.begin() + num, 1);
+    std::fill(covered.begin(), covered.begin() + num, 1);
+    const auto& flat_level = flat_levels_[level];
+    for (const auto& [d, r] : range) {
+      flat_test_funcs_[d](
+          flat_level.starts_[d],
+          flat_level.ends_[d],
+          mbr_idx,
+          num,
+          *r,
+          overlap.data(),
+          covered.data());
+    }
+    for (uint64_t i = num; i-- > 0;) {
+      if (overlap[i])
+        traversal.push_back({level, mbr_idx + i, covered[i] != 0});
+    }
+  };
+
+  traversal.clear();
+  push_mbrs(0, 0, 1);
+  while (!traversal.empty()) {
+    auto entry = traversal.back();
+    traversal.pop_back();
+
+    if (entry.covered_) {  // Full overlap
+      auto subtree_leaf_num = this->subtree_leaf_num(entry.level_);
+      assert(subtree_leaf_num > 0);
+      uint64_t start = entry.mbr_idx_ * subtree_leaf_num;
+      uint64_t end = start + std::min(subtree_leaf_num, leaf_num - start) - 1;
+      full_f(start, end);
+    } else if (entry.level_ == height - 1) {  // Partial overlap on a leaf
+      partial_f(entry.mbr_idx_);
+    } else {  // Test all "children"
+      auto next_mbr_num = (uint64_t)levels_[entry.level_ + 1].size();
+      auto start = entry.mbr_idx_ * fanout_;
+      auto num = std::min((uint64_t)fanout_, next_mbr_num - start);
+      push_mbrs(entry.level_ + 1, start, num);
+    }
+  }
+}
+
+void RTree::get_tile_overlap_flat(
+    const NDRange& range,
+    const std::vector<bool>& is_default,
+    std::vector<std::pair<unsigned, const Range*>>& dim_ranges,
+    std::vector<Entry>& traversal,
+    std::vector<uint8_t>& overlap,
+    std::vector<uint8_t>& covered,
+    TileOverlap* tile_overlap) const {
+  // Default ranges cover every MBR, so they are not tested
+  dim_ranges.clear();
+  for (unsigned d = 0; d < domain_->dim_num(); ++d) {
+    if (!is_default[d])
+      dim_ranges.emplace_back(d, &range[d]);
+  }
+
+  traverse_flat(
+      dim_ranges,
+      traversal,
+      overlap,
+      covered,
+      [&](uint64_t start, uint64_t end) {
+        tile_overlap->tile_ranges_.emplace_back(start, end);
+      },
+      [&](uint64_t leaf_idx) {
+        // The ratio is below 1.0 for MBRs not covered by the range
+        auto ratio =
+            domain_->overlap_ratio(range, is_default, levels_.back()[leaf_idx]);
+        tile_overlap->tiles_.emplace_back(leaf_idx, ratio);
+      });
+}
+
 RTree RTree::clone() const {
   RTree clone;
   clone.domain_ = domain_;
   clone.fanout_ = fanout_;
   clone.levels_ = levels_;
+  clone.flat_levels_ = flat_levels_;
+  clone.flat_test_funcs_ = flat_test_funcs_;
 
   return clone;
 }
@@ -386,6 +697,7 @@ Status RTree::deserialize_v1_v4(ConstBuffer* cbuff, const Domain* domain) {
 
   domain_ = domain;
   deserialized_buffer_size_ = cbuff->size();
+  build_flat_levels();
 
   return Status::Ok();
 }
@@ -430,6 +742,7 @@ Status RTree::deserialize_v5(ConstBuffer* cbuff, const Domain* domain) {
 
   domain_ = domain;
   deserialized_buffer_size_ = cbuff->size();
+  build_flat_levels();
 
   return Status::Ok();
 }
@@ -438,6 +751,8 @@ void RTree::swap(RTree& rtree) {
   std::swap(domain_, rtree.domain_);
   std::swap(fanout_, rtree.fanout_);
   std::swap(levels_, rtree.levels_);
+  std::swap(flat_levels_, rtree.flat_levels_);
+  std::swap(flat_test_funcs_, rtree.flat_test_funcs_);
 }
 
 }  // namespace sm
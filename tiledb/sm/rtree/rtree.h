@@ -55,6 +55,11 @@ enum class Layout : uint8_t;
  * A simple RTree implementation. It supports storing only n-dimensional
  * MBRs (not points). Also it only offers bottom-up bulk-loading
  * (without incremental updates), and range and point queries.
+ *
+ * When all dimensions are fixed-sized, the tree also keeps a flat,
+ * structure-of-arrays copy of the MBR bounds of every level, on which the
+ * children of a node are tested against a query range in branch-free loops
+ * that the compiler can vectorize.
  */
 class RTree {
  public:
@@ -90,9 +95,21 @@ class RTree {
   /** Builds the RTree bottom-up on the current leaf level. */
   Status build_tree();
 
-  /** Frees the memory associated with the rtree. */
+  /**
+   * Frees the memory associated with the rtree. Returns the deserialized
+   * buffer size plus the byte size of the flat levels.
+   */
   uint64_t free_memory();
 
+  /** Returns the byte size of the flat copy of the levels. */
+  uint64_t flat_levels_size() const;
+
+  /**
+   * Frees the flat copy of the levels. Queries then traverse the levels
+   * directly.
+   */
+  void free_flat_levels();
+
   /** The number of dimensions of the R-tree. */
   unsigned dim_num() const;
 
@@ -111,6 +128,20 @@ class RTree {
   TileOverlap get_tile_overlap(
       const NDRange& range, std::vector<bool>& is_default) const;
 
+  /**
+   * Computes the tile overlap of each of the input ranges with the MBRs
+   * stored in the RTree. The traversal state is shared across the ranges,
+   * which makes this cheaper than querying the ranges one by one.
+   *
+   * @param ranges The ranges to compute the tile overlap for.
+   * @param is_default Flags per dimension indicating default ranges.
+   * @param tile_overlaps The tile overlap of each input range.
+   */
+  void get_tile_overlap(
+      const std::vector<NDRange>& ranges,
+      std::vector<bool>& is_default,
+      std::vector<TileOverlap>* tile_overlaps) const;
+
   /**
    * Compute tile bitmap for the curent range.
    */
@@ -215,8 +246,41 @@ class RTree {
     uint64_t level_;
     /** The index of the first MBR of the corresponding node. */
     uint64_t mbr_idx_;
+    /**
+     * Whether the MBR is known to be fully covered by the query range. Set
+     * only by the traversal of the flat levels.
+     */
+    bool covered_ = false;
+  };
+
+  /**
+   * The MBR bounds of a tree level in structure-of-arrays layout. For
+   * dimension `d`, `starts_[d]` and `ends_[d]` store the lower and upper
+   * bounds of all the MBRs of the level, contiguously and in the datatype
+   * of the dimension.
+   */
+  struct FlatLevel {
+    /** The lower MBR bounds, one vector per dimension. */
+    std::vector<ByteVec> starts_;
+    /** The upper MBR bounds, one vector per dimension. */
+    std::vector<ByteVec> ends_;
   };
 
+  /**
+   * Tests `num` MBRs of a flat level, starting at `mbr_idx`, against a
+   * 1D range on a single dimension. It clears the `overlap` flag of every
+   * MBR that does not overlap the range and the `covered` flag of every
+   * MBR that is not covered by it.
+   */
+  typedef void (*FlatTestFunc)(
+      const ByteVec& starts,
+      const ByteVec& ends,
+      uint64_t mbr_idx,
+      uint64_t num,
+      const Range& range,
+      uint8_t* overlap,
+      uint8_t* covered);
+
   /* ********************************* */
   /*         PRIVATE ATTRIBUTES        */
   /* ********************************* */
@@ -238,6 +302,15 @@ class RTree {
    */
   std::vector<Level> levels_;
 
+  /**
+   * The flat copy of `levels_`. It is empty if a dimension is var-sized or
+   * if the tree has not been built.
+   */
+  std::vector<FlatLevel> flat_levels_;
+
+  /** The function testing the flat MBR bounds, one per dimension. */
+  std::vector<FlatTestFunc> flat_test_funcs_;
+
   /**
    * Stores the size of the buffer used to deserialize the data, used for
    * memory tracking pusposes on reads.
@@ -251,6 +324,69 @@ class RTree {
   /** Builds a single tree level on top of the input level. */
   Level build_level(const Level& level);
 
+  /**
+   * Builds `flat_levels_` from `levels_`. The flat levels are left empty
+   * if any dimension is var-sized.
+   */
+  void build_flat_levels();
+
+  /** Returns true if the flat levels can be used for queries. */
+  bool has_flat_levels() const;
+
+  /**
+   * Computes the tile overlap of the input range on the flat levels.
+   *
+   * @param range The range to compute the tile overlap for.
+   * @param is_default Flags per dimension indicating default ranges.
+   * @param dim_ranges Scratch space for the per dimension ranges.
+   * @param traversal Scratch space for the traversal.
+   * @param overlap Scratch space for the overlap flags.
+   * @param covered Scratch space for the covered flags.
+   * @param tile_overlap The tile overlap to compute.
+   */
+  void get_tile_overlap_flat(
+      const NDRange& range,
+      const std::vector<bool>& is_default,
+      std::vector<std::pair<unsigned, const Range*>>& dim_ranges,
+      std::vector<Entry>& traversal,
+      std::vector<uint8_t>& overlap,
+      std::vector<uint8_t>& covered,
+      TileOverlap* tile_overlap) const;
+
+  /** Tests flat MBR bounds against a range. See `FlatTestFunc`. */
+  template <class T>
+  static void flat_test(
+      const ByteVec& starts,
+      const ByteVec& ends,
+      uint64_t mbr_idx,
+      uint64_t num,
+      const Range& range,
+      uint8_t* overlap,
+      uint8_t* covered);
+
+  /**
+   * Traverses the flat levels with a range given as (dimension, 1D range)
+   * pairs; dimensions not in `range` are considered fully covered. It calls
+   * `full_f(start, end)` for every inclusive range of leaves fully covered
+   * by the range and `partial_f(leaf_idx)` for every leaf it partially
+   * overlaps, in leaf order.
+   *
+   * @param range The range to traverse the tree with.
+   * @param traversal Scratch space for the traversal.
+   * @param overlap Scratch space for the overlap flags.
+   * @param covered Scratch space for the covered flags.
+   * @param full_f Called for every range of fully covered leaves.
+   * @param partial_f Called for every partially overlapping leaf.
+   */
+  template <class FullF, class PartialF>
+  void traverse_flat(
+      const std::vector<std::pair<unsigned, const Range*>>& range,
+      std::vector<Entry>& traversal,
+      std::vector<uint8_t>& overlap,
+      std::vector<uint8_t>& covered,
+      FullF&& full_f,
+      PartialF&& partial_f) const;
+
   /** Returns a deep copy of this RTree. */
   RTree clone() const;
 
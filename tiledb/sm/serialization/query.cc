@@ -52,6 +52,7 @@
 #include "tiledb/sm/array/array.h"
 #include "tiledb/sm/buffer/buffer_list.h"
 #include "tiledb/sm/config/config.h"
+#include "tiledb/sm/enums/aggregate_op.h"
 #include "tiledb/sm/enums/layout.h"
 #include "tiledb/sm/enums/query_condition_combination_op.h"
 #include "tiledb/sm/enums/query_status.h"
@@ -2439,6 +2440,239 @@ Status query_est_result_size_deserialize(
   return Status::Ok();
 }
 
+Status query_aggregate_request_serialize(
+    Query* query,
+    const std::string& name,
+    AggregateOp op,
+    SerializationType serialize_type,
+    Buffer* serialized_buffer) {
+  try {
+    ::capnp::MallocMessageBuilder message;
+    capnp::QueryAggregate::Builder aggregate_builder =
+        message.initRoot<capnp::QueryAggregate>();
+    auto query_builder = aggregate_builder.initQuery();
+    RETURN_NOT_OK(query_to_capnp(*query, &query_builder, true));
+    aggregate_builder.setAttributeName(name);
+    aggregate_builder.setOp(aggregate_op_str(op));
+
+    switch (serialize_type) {
+      case SerializationType::JSON: {
+        ::capnp::JsonCodec json;
+        kj::String capnp_json = json.encode(aggregate_builder);
+        const auto json_len = capnp_json.size();
+        const char nul = '\0';
+        // size does not include needed null terminator, so add +1
+        RETURN_NOT_OK(serialized_buffer->realloc(json_len + 1));
+        RETURN_NOT_OK(serialized_buffer->write(capnp_json.cStr(), json_len));
+        RETURN_NOT_OK(serialized_buffer->write(&nul, 1));
+        break;
+      }
+      case SerializationType::CAPNP: {
+        kj::Array<::capnp::word> protomessage = messageToFlatArray(message);
+        kj::ArrayPtr<const char> message_chars = protomessage.asChars();
+        const auto nbytes = message_chars.size();
+        RETURN_NOT_OK(serialized_buffer->realloc(nbytes));
+        RETURN_NOT_OK(serialized_buffer->write(message_chars.begin(), nbytes));
+        break;
+      }
+      default:
+        return LOG_STATUS(Status_SerializationError(
+            "Cannot serialize; unknown serialization type"));
+    }
+  } catch (kj::Exception& e) {
+    return LOG_STATUS(Status_SerializationError(
+        "Cannot serialize; kj::Exception: " +
+        std::string(e.getDescription().cStr())));
+  } catch (std::exception& e) {
+    return LOG_STATUS(Status_SerializationError(
+        "Cannot serialize; exception: " + std::string(e.what())));
+  }
+
+  return Status::Ok();
+}
+
+Status query_aggregate_request_from_capnp(
+    const capnp::QueryAggregate::Reader& aggregate_reader,
+    Query* query,
+    std::string* name,
+    AggregateOp* op,
+    ThreadPool* compute_tp) {
+  if (!aggregate_reader.hasQuery()) {
+    return LOG_STATUS(Status_SerializationError(
+        "Cannot deserialize aggregate request; no query in message."));
+  }
+
+  RETURN_NOT_OK(query_from_capnp(
+      aggregate_reader.getQuery(),
+      SerializationContext::SERVER,
+      nullptr,
+      nullptr,
+      query,
+      compute_tp));
+  *name = aggregate_reader.getAttributeName().cStr();
+  RETURN_NOT_OK(aggregate_op_enum(aggregate_reader.getOp().cStr(), op));
+
+  return Status::Ok();
+}
+
+Status query_aggregate_request_deserialize(
+    const Buffer& serialized_buffer,
+    SerializationType serialize_type,
+    Query* query,
+    std::string* name,
+    AggregateOp* op,
+    ThreadPool* compute_tp) {
+  try {
+    switch (serialize_type) {
+      case SerializationType::JSON: {
+        ::capnp::JsonCodec json;
+        ::capnp::MallocMessageBuilder message_builder;
+        capnp::QueryAggregate::Builder aggregate_builder =
+            message_builder.initRoot<capnp::QueryAggregate>();
+        json.decode(
+            kj::StringPtr(static_cast<const char*>(serialized_buffer.data())),
+            aggregate_builder);
+        return query_aggregate_request_from_capnp(
+            aggregate_builder.asReader(), query, name, op, compute_tp);
+      }
+      case SerializationType::CAPNP: {
+        const auto mBytes =
+            reinterpret_cast<const kj::byte*>(serialized_buffer.data());
+        ::capnp::FlatArrayMessageReader reader(kj::arrayPtr(
+            reinterpret_cast<const ::capnp::word*>(mBytes),
+            serialized_buffer.size() / sizeof(::capnp::word)));
+        return query_aggregate_request_from_capnp(
+            reader.getRoot<capnp::QueryAggregate>(),
+            query,
+            name,
+            op,
+            compute_tp);
+      }
+      default:
+        return LOG_STATUS(Status_SerializationError(
+            "Error deserializing aggregate request; Unknown serialization "
+            "type passed"));
+    }
+  } catch (kj::Exception& e) {
+    return LOG_STATUS(Status_SerializationError(
+        "Error deserializing aggregate request; kj::Exception: " +
+        std::string(e.getDescription().cStr())));
+  } catch (std::exception& e) {
+    return LOG_STATUS(Status_SerializationError(
+        "Error deserializing aggregate request; exception " +
+        std::string(e.what())));
+  }
+}
+
+Status query_aggregate_value_serialize(
+    const void* value,
+    uint64_t value_size,
+    SerializationType serialize_type,
+    Buffer* serialized_buffer) {
+  try {
+    ::capnp::MallocMessageBuilder message;
+    capnp::QueryAggregate::Builder aggregate_builder =
+        message.initRoot<capnp::QueryAggregate>();
+    aggregate_builder.setValue(
+        kj::arrayPtr(static_cast<const uint8_t*>(value), value_size));
+
+    switch (serialize_type) {
+      case SerializationType::JSON: {
+        ::capnp::JsonCodec json;
+        kj::String capnp_json = json.encode(aggregate_builder);
+        const auto json_len = capnp_json.size();
+        const char nul = '\0';
+        // size does not include needed null terminator, so add +1
+        RETURN_NOT_OK(serialized_buffer->realloc(json_len + 1));
+        RETURN_NOT_OK(serialized_buffer->write(capnp_json.cStr(), json_len));
+        RETURN_NOT_OK(serialized_buffer->write(&nul, 1));
+        break;
+      }
+      case SerializationType::CAPNP: {
+        kj::Array<::capnp::word> protomessage = messageToFlatArray(message);
+        kj::ArrayPtr<const char> message_chars = protomessage.asChars();
+        const auto nbytes = message_chars.size();
+        RETURN_NOT_OK(serialized_buffer->realloc(nbytes));
+        RETURN_NOT_OK(serialized_buffer->write(message_chars.begin(), nbytes));
+        break;
+      }
+      default:
+        return LOG_STATUS(Status_SerializationError(
+            "Cannot serialize; unknown serialization type"));
+    }
+  } catch (kj::Exception& e) {
+    return LOG_STATUS(Status_SerializationError(
+        "Cannot serialize; kj::Exception: " +
+        std::string(e.getDescription().cStr())));
+  } catch (std::exception& e) {
+    return LOG_STATUS(Status_SerializationError(
+        "Cannot serialize; exception: " + std::string(e.what())));
+  }
+
+  return Status::Ok();
+}
+
+Status query_aggregate_value_from_capnp(
+    const capnp::QueryAggregate::Reader& aggregate_reader,
+    void* value,
+    uint64_t* value_size) {
+  auto value_reader = aggregate_reader.getValue();
+  if (*value_size < value_reader.size()) {
+    return LOG_STATUS(Status_SerializationError(
+        "Cannot deserialize aggregate value; Value buffer of " +
+        std::to_string(*value_size) + " bytes is too small for a " +
+        std::to_string(value_reader.size()) + " bytes value"));
+  }
+
+  std::memcpy(value, value_reader.begin(), value_reader.size());
+  *value_size = value_reader.size();
+
+  return Status::Ok();
+}
+
+Status query_aggregate_value_deserialize(
+    const Buffer& serialized_buffer,
+    SerializationType serialize_type,
+    void* value,
+    uint64_t* value_size) {
+  try {
+    switch (serialize_type) {
+      case SerializationType::JSON: {
+        ::capnp::JsonCodec json;
+        ::capnp::MallocMessageBuilder message_builder;
+        capnp::QueryAggregate::Builder aggregate_builder =
+            message_builder.initRoot<capnp::QueryAggregate>();
+        json.decode(
+            kj::StringPtr(static_cast<const char*>(serialized_buffer.data())),
+            aggregate_builder);
+        return query_aggregate_value_from_capnp(
+            aggregate_builder.asReader(), value, value_size);
+      }
+      case SerializationType::CAPNP: {
+        const auto mBytes =
+            reinterpret_cast<const kj::byte*>(serialized_buffer.data());
+        ::capnp::FlatArrayMessageReader reader(kj::arrayPtr(
+            reinterpret_cast<const ::capnp::word*>(mBytes),
+            serialized_buffer.size() / sizeof(::capnp::word)));
+        return query_aggregate_value_from_capnp(
+            reader.getRoot<capnp::QueryAggregate>(), value, value_size);
+      }
+      default:
+        return LOG_STATUS(Status_SerializationError(
+            "Error deserializing aggregate value; Unknown serialization type "
+            "passed"));
+    }
+  } catch (kj::Exception& e) {
+    return LOG_STATUS(Status_SerializationError(
+        "Error deserializing aggregate value; kj::Exception: " +
+        std::string(e.getDescription().cStr())));
+  } catch (std::exception& e) {
+    return LOG_STATUS(Status_SerializationError(
+        "Error deserializing aggregate value; exception " +
+        std::string(e.what())));
+  }
+}
+
 #else
 
 Status query_serialize(Query*, SerializationType, bool, BufferList*) {
@@ -2464,6 +2698,35 @@ Status query_est_result_size_deserialize(
       "Cannot deserialize; serialization not enabled."));
 }
 
+Status query_aggregate_request_serialize(
+    Query*, const std::string&, AggregateOp, SerializationType, Buffer*) {
+  return LOG_STATUS(Status_SerializationError(
+      "Cannot serialize; serialization not enabled."));
+}
+
+Status query_aggregate_request_deserialize(
+    const Buffer&,
+    SerializationType,
+    Query*,
+    std::string*,
+    AggregateOp*,
+    ThreadPool*) {
+  return LOG_STATUS(Status_SerializationError(
+      "Cannot deserialize; serialization not enabled."));
+}
+
+Status query_aggregate_value_serialize(
+    const void*, uint64_t, SerializationType, Buffer*) {
+  return LOG_STATUS(Status_SerializationError(
+      "Cannot serialize; serialization not enabled."));
+}
+
+Status query_aggregate_value_deserialize(
+    const Buffer&, SerializationType, void*, uint64_t*) {
+  return LOG_STATUS(Status_SerializationError(
+      "Cannot deserialize; serialization not enabled."));
+}
+
 #endif  // TILEDB_SERIALIZATION
 
 }  // namespace serialization
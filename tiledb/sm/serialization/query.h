@@ -53,6 +53,7 @@ class Buffer;
 class BufferList;
 class Query;
 
+enum class AggregateOp : uint8_t;
 enum class SerializationType : uint8_t;
 
 namespace serialization {
@@ -192,6 +193,74 @@ Status query_est_result_size_deserialize(
     bool clientside,
     const Buffer& serialized_buffer);
 
+/**
+ * Serialize an aggregate request, the query with the aggregated attribute
+ * and operator, from the client.
+ *
+ * @param query Query to compute the aggregate over
+ * @param name Attribute name, ignored for `AGGREGATE_COUNT`
+ * @param op Aggregate operator
+ * @param serialize_type Format to serialize into
+ * @param serialized_buffer Buffer to store serialized request
+ * @return Status
+ */
+Status query_aggregate_request_serialize(
+    Query* query,
+    const std::string& name,
+    AggregateOp op,
+    SerializationType serialize_type,
+    Buffer* serialized_buffer);
+
+/**
+ * Deserialize an aggregate request on the server.
+ *
+ * @param serialized_buffer Buffer containing serialized request
+ * @param serialize_type Serialization type of serialized request
+ * @param query Query to deserialize into
+ * @param name Set to the attribute name
+ * @param op Set to the aggregate operator
+ * @param compute_tp Thread pool for compute-bound tasks
+ * @return Status
+ */
+Status query_aggregate_request_deserialize(
+    const Buffer& serialized_buffer,
+    SerializationType serialize_type,
+    Query* query,
+    std::string* name,
+    AggregateOp* op,
+    ThreadPool* compute_tp);
+
+/**
+ * Serialize an aggregate value computed on the server.
+ *
+ * @param value Aggregate value
+ * @param value_size Size of the aggregate value, `0` for no value
+ * @param serialize_type Format to serialize into
+ * @param serialized_buffer Buffer to store serialized value
+ * @return Status
+ */
+Status query_aggregate_value_serialize(
+    const void* value,
+    uint64_t value_size,
+    SerializationType serialize_type,
+    Buffer* serialized_buffer);
+
+/**
+ * Deserialize an aggregate value on the client.
+ *
+ * @param serialized_buffer Buffer containing serialized value
+ * @param serialize_type Serialization type of serialized value
+ * @param value Buffer receiving the aggregate value
+ * @param value_size As input, the size of `value`. As output, the size of
+ *     the aggregate value
+ * @return Status
+ */
+Status query_aggregate_value_deserialize(
+    const Buffer& serialized_buffer,
+    SerializationType serialize_type,
+    void* value,
+    uint64_t* value_size);
+
 #ifdef TILEDB_SERIALIZATION
 Status condition_from_capnp(
     const capnp::Condition::Reader& condition_reader,
@@ -73,6 +73,7 @@ CAPNP_DECLARE_SCHEMA(c4e54a63294eddb7);
 CAPNP_DECLARE_SCHEMA(83b01e46759bde40);
 CAPNP_DECLARE_SCHEMA(fb7f36ad4d8ffe84);
 CAPNP_DECLARE_SCHEMA(d5fd459ad75e86a9);
+CAPNP_DECLARE_SCHEMA(a541f2d823ed8352);
 
 }  // namespace schemas
 }  // namespace capnp
@@ -1137,6 +1138,23 @@ struct GroupCreate::GroupCreateDetails {
   };
 };
 
+struct QueryAggregate {
+  QueryAggregate() = delete;
+
+  class Reader;
+  class Builder;
+  class Pipeline;
+
+  struct _capnpPrivate {
+    CAPNP_DECLARE_STRUCT_HEADER(a541f2d823ed8352, 0, 4)
+#if !CAPNP_LITE
+    static constexpr ::capnp::_::RawBrandedSchema const* brand() {
+      return &schema->defaultBrand;
+    }
+#endif  // !CAPNP_LITE
+  };
+};
+
 // =======================================================================================
 
 class DomainArray::Reader {
@@ -9223,6 +9241,137 @@ class GroupCreate::GroupCreateDetails::Pipeline {
 };
 #endif  // !CAPNP_LITE
 
+class QueryAggregate::Reader {
+ public:
+  typedef QueryAggregate Reads;
+
+  Reader() = default;
+  inline explicit Reader(::capnp::_::StructReader base)
+      : _reader(base) {
+  }
+
+  inline ::capnp::MessageSize totalSize() const {
+    return _reader.totalSize().asPublic();
+  }
+
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const {
+    return ::capnp::_::structString(_reader, *_capnpPrivate::brand());
+  }
+#endif  // !CAPNP_LITE
+
+  inline bool hasQuery() const;
+  inline ::tiledb::sm::serialization::capnp::Query::Reader getQuery() const;
+
+  inline bool hasAttributeName() const;
+  inline ::capnp::Text::Reader getAttributeName() const;
+
+  inline bool hasOp() const;
+  inline ::capnp::Text::Reader getOp() const;
+
+  inline bool hasValue() const;
+  inline ::capnp::Data::Reader getValue() const;
+
+ private:
+  ::capnp::_::StructReader _reader;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::List;
+  friend class ::capnp::MessageBuilder;
+  friend class ::capnp::Orphanage;
+};
+
+class QueryAggregate::Builder {
+ public:
+  typedef QueryAggregate Builds;
+
+  Builder() = delete;  // Deleted to discourage incorrect usage.
+                       // You can explicitly initialize to nullptr instead.
+  inline Builder(decltype(nullptr)) {
+  }
+  inline explicit Builder(::capnp::_::StructBuilder base)
+      : _builder(base) {
+  }
+  inline operator Reader() const {
+    return Reader(_builder.asReader());
+  }
+  inline Reader asReader() const {
+    return *this;
+  }
+
+  inline ::capnp::MessageSize totalSize() const {
+    return asReader().totalSize();
+  }
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const {
+    return asReader().toString();
+  }
+#endif  // !CAPNP_LITE
+
+  inline bool hasQuery();
+  inline ::tiledb::sm::serialization::capnp::Query::Builder getQuery();
+  inline void setQuery(::tiledb::sm::serialization::capnp::Query::Reader value);
+  inline ::tiledb::sm::serialization::capnp::Query::Builder initQuery();
+  inline void adoptQuery(
+      ::capnp::Orphan<::tiledb::sm::serialization::capnp::Query>&& value);
+  inline ::capnp::Orphan<::tiledb::sm::serialization::capnp::Query>
+  disownQuery();
+
+  inline bool hasAttributeName();
+  inline ::capnp::Text::Builder getAttributeName();
+  inline void setAttributeName(::capnp::Text::Reader value);
+  inline ::capnp::Text::Builder initAttributeName(unsigned int size);
+  inline void adoptAttributeName(::capnp::Orphan<::capnp::Text>&& value);
+  inline ::capnp::Orphan<::capnp::Text> disownAttributeName();
+
+  inline bool hasOp();
+  inline ::capnp::Text::Builder getOp();
+  inline void setOp(::capnp::Text::Reader value);
+  inline ::capnp::Text::Builder initOp(unsigned int size);
+  inline void adoptOp(::capnp::Orphan<::capnp::Text>&& value);
+  inline ::capnp::Orphan<::capnp::Text> disownOp();
+
+  inline bool hasValue();
+  inline ::capnp::Data::Builder getValue();
+  inline void setValue(::capnp::Data::Reader value);
+  inline ::capnp::Data::Builder initValue(unsigned int size);
+  inline void adoptValue(::capnp::Orphan<::capnp::Data>&& value);
+  inline ::capnp::Orphan<::capnp::Data> disownValue();
+
+ private:
+  ::capnp::_::StructBuilder _builder;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  friend class ::capnp::Orphanage;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+};
+
+#if !CAPNP_LITE
+class QueryAggregate::Pipeline {
+ public:
+  typedef QueryAggregate Pipelines;
+
+  inline Pipeline(decltype(nullptr))
+      : _typeless(nullptr) {
+  }
+  inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
+      : _typeless(kj::mv(typeless)) {
+  }
+
+  inline ::tiledb::sm::serialization::capnp::Query::Pipeline getQuery();
+
+ private:
+  ::capnp::AnyPointer::Pipeline _typeless;
+  friend class ::capnp::PipelineHook;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+};
+#endif  // !CAPNP_LITE
+
 // =======================================================================================
 
 inline bool DomainArray::Reader::hasInt8() const {
@@ -18563,6 +18712,174 @@ GroupCreate::GroupCreateDetails::Builder::disownUri() {
       _builder.getPointerField(::capnp::bounded<0>() * ::capnp::POINTERS));
 }
 
+inline bool QueryAggregate::Reader::hasQuery() const {
+  return !_reader.getPointerField(::capnp::bounded<0>() * ::capnp::POINTERS)
+              .isNull();
+}
+inline bool QueryAggregate::Builder::hasQuery() {
+  return !_builder.getPointerField(::capnp::bounded<0>() * ::capnp::POINTERS)
+              .isNull();
+}
+inline ::tiledb::sm::serialization::capnp::Query::Reader
+QueryAggregate::Reader::getQuery() const {
+  return ::capnp::_::
+      PointerHelpers<::tiledb::sm::serialization::capnp::Query>::get(
+          _reader.getPointerField(::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+inline ::tiledb::sm::serialization::capnp::Query::Builder
+QueryAggregate::Builder::getQuery() {
+  return ::capnp::_::
+      PointerHelpers<::tiledb::sm::serialization::capnp::Query>::get(
+          _builder.getPointerField(::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+#if !CAPNP_LITE
+inline ::tiledb::sm::serialization::capnp::Query::Pipeline
+QueryAggregate::Pipeline::getQuery() {
+  return ::tiledb::sm::serialization::capnp::Query::Pipeline(
+      _typeless.getPointerField(0));
+}
+#endif  // !CAPNP_LITE
+inline void QueryAggregate::Builder::setQuery(
+    ::tiledb::sm::serialization::capnp::Query::Reader value) {
+  ::capnp::_::PointerHelpers<::tiledb::sm::serialization::capnp::Query>::set(
+      _builder.getPointerField(::capnp::bounded<0>() * ::capnp::POINTERS),
+      value);
+}
+inline ::tiledb::sm::serialization::capnp::Query::Builder
+QueryAggregate::Builder::initQuery() {
+  return ::capnp::_::
+      PointerHelpers<::tiledb::sm::serialization::capnp::Query>::init(
+          _builder.getPointerField(::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+inline void QueryAggregate::Builder::adoptQuery(
+    ::capnp::Orphan<::tiledb::sm::serialization::capnp::Query>&& value) {
+  ::capnp::_::PointerHelpers<::tiledb::sm::serialization::capnp::Query>::adopt(
+      _builder.getPointerField(::capnp::bounded<0>() * ::capnp::POINTERS),
+      kj::mv(value));
+}
+inline ::capnp::Orphan<::tiledb::sm::serialization::capnp::Query>
+QueryAggregate::Builder::disownQuery() {
+  return ::capnp::_::
+      PointerHelpers<::tiledb::sm::serialization::capnp::Query>::disown(
+          _builder.getPointerField(::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+
+inline bool QueryAggregate::Reader::hasAttributeName() const {
+  return !_reader.getPointerField(::capnp::bounded<1>() * ::capnp::POINTERS)
+              .isNull();
+}
+inline bool QueryAggregate::Builder::hasAttributeName() {
+  return !_builder.getPointerField(::capnp::bounded<1>() * ::capnp::POINTERS)
+              .isNull();
+}
+inline ::capnp::Text::Reader QueryAggregate::Reader::getAttributeName() const {
+  return ::capnp::_::PointerHelpers<::capnp::Text>::get(
+      _reader.getPointerField(::capnp::bounded<1>() * ::capnp::POINTERS));
+}
+inline ::capnp::Text::Builder QueryAggregate::Builder::getAttributeName() {
+  return ::capnp::_::PointerHelpers<::capnp::Text>::get(
+      _builder.getPointerField(::capnp::bounded<1>() * ::capnp::POINTERS));
+}
+inline void QueryAggregate::Builder::setAttributeName(
+    ::capnp::Text::Reader value) {
+  ::capnp::_::PointerHelpers<::capnp::Text>::set(
+      _builder.getPointerField(::capnp::bounded<1>() * ::capnp::POINTERS),
+      value);
+}
+inline ::capnp::Text::Builder QueryAggregate::Builder::initAttributeName(
+    unsigned int size) {
+  return ::capnp::_::PointerHelpers<::capnp::Text>::init(
+      _builder.getPointerField(::capnp::bounded<1>() * ::capnp::POINTERS),
+      size);
+}
+inline void QueryAggregate::Builder::adoptAttributeName(
+    ::capnp::Orphan<::capnp::Text>&& value) {
+  ::capnp::_::PointerHelpers<::capnp::Text>::adopt(
+      _builder.getPointerField(::capnp::bounded<1>() * ::capnp::POINTERS),
+      kj::mv(value));
+}
+inline ::capnp::Orphan<::capnp::Text>
+QueryAggregate::Builder::disownAttributeName() {
+  return ::capnp::_::PointerHelpers<::capnp::Text>::disown(
+      _builder.getPointerField(::capnp::bounded<1>() * ::capnp::POINTERS));
+}
+
+inline bool QueryAggregate::Reader::hasOp() const {
+  return !_reader.getPointerField(::capnp::bounded<2>() * ::capnp::POINTERS)
+              .isNull();
+}
+inline bool QueryAggregate::Builder::hasOp() {
+  return !_builder.getPointerField(::capnp::bounded<2>() * ::capnp::POINTERS)
+              .isNull();
+}
+inline ::capnp::Text::Reader QueryAggregate::Reader::getOp() const {
+  return ::capnp::_::PointerHelpers<::capnp::Text>::get(
+      _reader.getPointerField(::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+inline ::capnp::Text::Builder QueryAggregate::Builder::getOp() {
+  return ::capnp::_::PointerHelpers<::capnp::Text>::get(
+      _builder.getPointerField(::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+inline void QueryAggregate::Builder::setOp(::capnp::Text::Reader value) {
+  ::capnp::_::PointerHelpers<::capnp::Text>::set(
+      _builder.getPointerField(::capnp::bounded<2>() * ::capnp::POINTERS),
+      value);
+}
+inline ::capnp::Text::Builder QueryAggregate::Builder::initOp(
+    unsigned int size) {
+  return ::capnp::_::PointerHelpers<::capnp::Text>::init(
+      _builder.getPointerField(::capnp::bounded<2>() * ::capnp::POINTERS),
+      size);
+}
+inline void QueryAggregate::Builder::adoptOp(
+    ::capnp::Orphan<::capnp::Text>&& value) {
+  ::capnp::_::PointerHelpers<::capnp::Text>::adopt(
+      _builder.getPointerField(::capnp::bounded<2>() * ::capnp::POINTERS),
+      kj::mv(value));
+}
+inline ::capnp::Orphan<::capnp::Text> QueryAggregate::Builder::disownOp() {
+  return ::capnp::_::PointerHelpers<::capnp::Text>::disown(
+      _builder.getPointerField(::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+
+inline bool QueryAggregate::Reader::hasValue() const {
+  return !_reader.getPointerField(::capnp::bounded<3>() * ::capnp::POINTERS)
+              .isNull();
+}
+inline bool QueryAggregate::Builder::hasValue() {
+  return !_builder.getPointerField(::capnp::bounded<3>() * ::capnp::POINTERS)
+              .isNull();
+}
+inline ::capnp::Data::Reader QueryAggregate::Reader::getValue() const {
+  return ::capnp::_::PointerHelpers<::capnp::Data>::get(
+      _reader.getPointerField(::capnp::bounded<3>() * ::capnp::POINTERS));
+}
+inline ::capnp::Data::Builder QueryAggregate::Builder::getValue() {
+  return ::capnp::_::PointerHelpers<::capnp::Data>::get(
+      _builder.getPointerField(::capnp::bounded<3>() * ::capnp::POINTERS));
+}
+inline void QueryAggregate::Builder::setValue(::capnp::Data::Reader value) {
+  ::capnp::_::PointerHelpers<::capnp::Data>::set(
+      _builder.getPointerField(::capnp::bounded<3>() * ::capnp::POINTERS),
+      value);
+}
+inline ::capnp::Data::Builder QueryAggregate::Builder::initValue(
+    unsigned int size) {
+  return ::capnp::_::PointerHelpers<::capnp::Data>::init(
+      _builder.getPointerField(::capnp::bounded<3>() * ::capnp::POINTERS),
+      size);
+}
+inline void QueryAggregate::Builder::adoptValue(
+    ::capnp::Orphan<::capnp::Data>&& value) {
+  ::capnp::_::PointerHelpers<::capnp::Data>::adopt(
+      _builder.getPointerField(::capnp::bounded<3>() * ::capnp::POINTERS),
+      kj::mv(value));
+}
+inline ::capnp::Orphan<::capnp::Data> QueryAggregate::Builder::disownValue() {
+  return ::capnp::_::PointerHelpers<::capnp::Data>::disown(
+      _builder.getPointerField(::capnp::bounded<3>() * ::capnp::POINTERS));
+}
+
 }  // namespace capnp
 }  // namespace serialization
 }  // namespace sm
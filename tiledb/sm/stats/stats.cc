@@ -36,21 +36,157 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <sstream>
 #include <vector>
 
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define TILEDB_STATS_TSC
+#elif defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#define TILEDB_STATS_TSC
+#endif
+
 namespace tiledb {
 namespace sm {
 namespace stats {
 
+namespace {
+
+/** The unique id of the next constructed Stats instance. */
+std::atomic<uint64_t> next_stats_uid{0};
+
+/**
+ * Returns the current time in ticks: the CPU timestamp counter where
+ * available, otherwise nanoseconds of the steady clock.
+ */
+inline uint64_t now_ticks() {
+#ifdef TILEDB_STATS_TSC
+  return __rdtsc();
+#else
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+#endif
+}
+
+#ifdef TILEDB_STATS_TSC
+/** The ticks and the steady clock time at load time. */
+const std::pair<uint64_t, std::chrono::steady_clock::time_point>
+    tick_reference(now_ticks(), std::chrono::steady_clock::now());
+#endif
+
+/**
+ * Returns the duration of a tick in seconds. The timestamp counter is
+ * calibrated against the steady clock over the time since load.
+ */
+double seconds_per_tick() {
+#ifdef TILEDB_STATS_TSC
+  const uint64_t ticks = now_ticks() - tick_reference.first;
+  const std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - tick_reference.second;
+  if (ticks == 0 || elapsed.count() <= 0)
+    return 0;
+  return elapsed.count() / ticks;
+#else
+  return 1e-9;
+#endif
+}
+
+/**
+ * Returns the histogram bucket of a duration. Durations of less than
+ * `2^histogram_sub_bucket_bits_` ticks have their own bucket, larger ones
+ * fall in one of `2^histogram_sub_bucket_bits_` buckets of equal width per
+ * power of two.
+ */
+inline unsigned histogram_bucket(uint64_t ticks) {
+  constexpr unsigned bits = Stats::histogram_sub_bucket_bits_;
+  constexpr uint64_t sub_bucket_num = uint64_t(1) << bits;
+  if (ticks < sub_bucket_num)
+    return static_cast<unsigned>(ticks);
+  unsigned exp = 63;
+  while ((ticks >> exp) == 0)
+    --exp;
+  return (exp - bits + 1) * sub_bucket_num +
+         static_cast<unsigned>((ticks >> (exp - bits)) & (sub_bucket_num - 1));
+}
+
+/** Returns the duration in the middle of a histogram bucket, in ticks. */
+inline double histogram_bucket_value(unsigned bucket) {
+  constexpr unsigned bits = Stats::histogram_sub_bucket_bits_;
+  constexpr unsigned sub_bucket_num = 1u << bits;
+  if (bucket < sub_bucket_num)
+    return bucket;
+  const unsigned exp = bucket / sub_bucket_num + bits - 1;
+  const double width = static_cast<double>(uint64_t(1) << (exp - bits));
+  return (sub_bucket_num + bucket % sub_bucket_num) * width + width / 2;
+}
+
+/**
+ * Returns the duration in ticks below which the input fraction of the
+ * durations of a histogram fall, and 0 for an empty histogram.
+ */
+double histogram_percentile(
+    const std::vector<uint64_t>& buckets, double fraction) {
+  uint64_t total = 0;
+  for (auto count : buckets)
+    total += count;
+  if (total == 0)
+    return 0;
+
+  const uint64_t rank = std::max<uint64_t>(
+      1, static_cast<uint64_t>(std::ceil(fraction * total)));
+  uint64_t seen = 0;
+  for (unsigned b = 0; b < buckets.size(); ++b) {
+    seen += buckets[b];
+    if (seen >= rank)
+      return histogram_bucket_value(b);
+  }
+  return histogram_bucket_value(static_cast<unsigned>(buckets.size() - 1));
+}
+
+}  // namespace
+
 /* ****************************** */
 /*   CONSTRUCTORS & DESTRUCTORS   */
 /* ****************************** */
 
+ScopedTimer::~ScopedTimer() {
+  if (stats_ != nullptr)
+    stats_->end_timer(id_, start_ticks_);
+}
+
+Stats::StatHistogram::StatHistogram() {
+  for (auto& bucket : buckets_)
+    bucket.store(0, std::memory_order_relaxed);
+}
+
+Stats::StatSlot::~StatSlot() {
+  delete histogram_.load(std::memory_order_relaxed);
+}
+
+Stats::Trace::Trace(uint64_t max_span_num, uint64_t start_ticks)
+    : max_span_num_(max_span_num)
+    , start_ticks_(start_ticks)
+    , spans_(new TraceSpan[max_span_num])
+    , span_num_(0) {
+}
+
 Stats::Stats(const std::string& prefix)
     : enabled_(true)
+    , uid_(next_stats_uid.fetch_add(1, std::memory_order_relaxed))
+    , trace_(nullptr)
     , prefix_(prefix + ".")
     , parent_(nullptr) {
+  for (auto& chunk : stat_chunks_)
+    chunk.store(nullptr, std::memory_order_relaxed);
+}
+
+Stats::~Stats() {
+  for (auto& chunk : stat_chunks_)
+    delete[] chunk.load(std::memory_order_relaxed);
+  delete trace_.load(std::memory_order_relaxed);
 }
 
 /* ****************************** */
@@ -61,17 +197,67 @@ bool Stats::enabled() const {
   return enabled_;
 }
 
+uint64_t Stats::uid() const {
+  return uid_;
+}
+
 void Stats::set_enabled(bool enabled) {
   enabled_ = enabled;
 }
 
+StatId Stats::register_stat(const std::string& stat) {
+  std::unique_lock<std::mutex> lck(mtx_);
+  auto it = stat_ids_.find(stat);
+  if (it != stat_ids_.end())
+    return it->second;
+
+  const StatId id = static_cast<StatId>(stat_names_.size());
+  unsigned chunk_idx;
+  uint64_t slot_idx;
+  stat_slot_position(id, &chunk_idx, &slot_idx);
+  if (slot_idx == 0) {
+    stat_chunks_[chunk_idx].store(
+        new StatSlot[uint64_t(slots_per_chunk_) << chunk_idx],
+        std::memory_order_release);
+  }
+  stat_names_.emplace_back(prefix_ + stat);
+  stat_ids_.emplace(stat, id);
+  StatSlot* const slot = stat_slot(id);
+  if (slot != nullptr)
+    slot->name_.store(&stat_names_.back(), std::memory_order_release);
+  return id;
+}
+
+StatId Stats::register_histogram(const std::string& stat) {
+  const StatId id = register_stat(stat);
+  StatSlot* const slot = stat_slot(id);
+  if (slot == nullptr)
+    return id;
+
+  std::unique_lock<std::mutex> lck(mtx_);
+  if (slot->histogram_.load(std::memory_order_relaxed) == nullptr)
+    slot->histogram_.store(new StatHistogram, std::memory_order_release);
+  return id;
+}
+
 void Stats::reset() {
   // We will acquire the locks top-down in the tree and hold
   // until the recursion terminates.
   std::unique_lock<std::mutex> lck(mtx_);
 
+  drain_registered_stats();
   timers_.clear();
   counters_.clear();
+  for (StatId id = 0; id < stat_names_.size(); ++id) {
+    StatSlot* const slot = stat_slot(id);
+    StatHistogram* const histogram =
+        slot == nullptr ? nullptr :
+                          slot->histogram_.load(std::memory_order_acquire);
+    if (histogram != nullptr) {
+      for (auto& bucket : histogram->buckets_)
+        bucket.store(0, std::memory_order_relaxed);
+    }
+  }
 
   for (auto& child : children_) {
     child.reset();
@@ -82,10 +268,12 @@ std::string Stats::dump(
     const uint64_t indent_size, const uint64_t num_indents) const {
   std::unordered_map<std::string, double> flattened_timers;
   std::unordered_map<std::string, uint64_t> flattened_counters;
+  std::unordered_map<std::string, std::vector<uint64_t>> flattened_histograms;
 
   // Recursively populate the flattened stats with the stats from
   // this instance and all of its children.
-  populate_flattened_stats(&flattened_timers, &flattened_counters);
+  populate_flattened_stats(
+      &flattened_timers, &flattened_counters, &flattened_histograms);
 
   // Return an empty string if there are no stats.
   if (flattened_timers.empty() && flattened_counters.empty()) {
@@ -137,6 +325,19 @@ std::string Stats::dump(
       auto avg = timer.second / it->second;
       ss << l_indent << indent << indent << "\"" << stat + ".avg"
          << "\": " << avg;
+
+      // Report the percentiles of the timers that keep a histogram.
+      auto hit = flattened_histograms.find(stat);
+      if (hit != flattened_histograms.end()) {
+        const double spt = seconds_per_tick();
+        const std::pair<const char*, double> percentiles[] = {
+            {".p50", 0.5}, {".p99", 0.99}, {".p999", 0.999}};
+        for (const auto& p : percentiles) {
+          ss << ",\n"
+             << l_indent << indent << indent << "\"" << stat + p.first
+             << "\": " << histogram_percentile(hit->second, p.second) * spt;
+        }
+      }
       printed_first_timer = true;
     }
   }
@@ -176,69 +377,78 @@ void Stats::add_counter(const std::string& stat, uint64_t count) {
   if (!enabled_)
     return;
 
-  std::string new_stat = prefix_ + stat;
-  std::unique_lock<std::mutex> lck(mtx_);
-  auto it = counters_.find(new_stat);
-  if (it == counters_.end()) {  // Counter not found
-    counters_[new_stat] = count;
-  } else {  // Counter found
-    it->second += count;
-  }
+  add_counter(register_stat(stat), count);
 }
 
-ScopedExecutor Stats::start_timer(const std::string& stat) {
+void Stats::add_counter(StatId id, uint64_t count) {
   if (!enabled_)
-    return ScopedExecutor();
+    return;
 
-  std::string new_stat = prefix_ + stat;
-  std::unique_lock<std::mutex> lck(mtx_);
-  const std::thread::id tid = std::this_thread::get_id();
-  start_times_[new_stat][tid] = std::chrono::high_resolution_clock::now();
+  StatSlot* const slot = stat_slot(id);
+  if (slot == nullptr)
+    return;
+
+  slot->shards_[thread_shard()].counter_.fetch_add(
+      count, std::memory_order_relaxed);
+  if (!slot->counter_set_.load(std::memory_order_relaxed))
+    slot->counter_set_.store(true, std::memory_order_relaxed);
+}
+
+ScopedTimer Stats::start_timer(const std::string& stat) {
+  if (!enabled_)
+    return ScopedTimer();
 
-  std::function<void()> end_timer_fn = std::bind(&Stats::end_timer, this, stat);
-  return ScopedExecutor(std::move(end_timer_fn));
+  return start_timer(register_stat(stat));
 }
 
-void Stats::end_timer(const std::string& stat) {
+ScopedTimer Stats::start_timer(StatId id) {
+  if (!enabled_)
+    return ScopedTimer();
+
+  return ScopedTimer(this, id, now_ticks());
+}
+
+void Stats::end_timer(StatId id, uint64_t start_ticks) {
   if (!enabled_)
     return;
 
-  std::string new_stat = prefix_ + stat;
-  std::unique_lock<std::mutex> lck(mtx_);
+  StatSlot* const slot = stat_slot(id);
+  if (slot == nullptr)
+    return;
 
-  // Calculate duration
-  const std::thread::id tid = std::this_thread::get_id();
-  auto it = start_times_.find(new_stat);
-  assert(it != start_times_.end());
-  auto tit = it->second.find(tid);
-  assert(tit != it->second.end());
-  auto start_time = tit->second;
-  auto end_time = std::chrono::high_resolution_clock::now();
-  const std::chrono::duration<double> duration = end_time - start_time;
-
-  // Add duration to timer total
-  auto it2 = timers_.find(new_stat + ".sum");
-  if (it2 == timers_.end()) {  // Timer not found
-    timers_[new_stat + ".sum"] = duration.count();
-  } else {  // Timer found
-    it2->second += duration.count();
+  // Add the duration to the timer total and max, and increment the
+  // timer counter
+  const uint64_t end_ticks = now_ticks();
+  const uint64_t ticks = end_ticks > start_ticks ? end_ticks - start_ticks : 0;
+  StatShard* const shard = &slot->shards_[thread_shard()];
+  shard->timer_sum_.fetch_add(ticks, std::memory_order_relaxed);
+  uint64_t max = shard->timer_max_.load(std::memory_order_relaxed);
+  while (ticks > max && !shard->timer_max_.compare_exchange_weak(
+                            max, ticks, std::memory_order_relaxed)) {
   }
+  shard->timer_count_.fetch_add(1, std::memory_order_relaxed);
 
-  // Add duration to timer max
-  auto it3 = timers_.find(new_stat + ".max");
-  if (it3 == timers_.end()) {  // Timer not found
-    timers_[new_stat + ".max"] = duration.count();
-  } else {  // Timer found
-    if (duration.count() > it3->second)
-      it3->second = duration.count();
+  StatHistogram* const histogram =
+      slot->histogram_.load(std::memory_order_acquire);
+  if (histogram != nullptr) {
+    histogram->buckets_[histogram_bucket(ticks)].fetch_add(
+        1, std::memory_order_relaxed);
   }
 
-  // Increment the timer counter
-  auto it4 = counters_.find(new_stat + ".timer_count");
-  if (it4 == counters_.end()) {  // Timer not found
-    counters_[new_stat + ".timer_count"] = 1;
-  } else {  // Timer found
-    it4->second += 1;
+  // Record the span if the subtree is traced. Spans past the trace
+  // capacity are dropped.
+  Trace* const trace = this->trace();
+  if (trace != nullptr) {
+    const uint64_t idx =
+        trace->span_num_.fetch_add(1, std::memory_order_relaxed);
+    if (idx < trace->max_span_num_) {
+      TraceSpan& span = trace->spans_[idx];
+      span.name_ = slot->name_.load(std::memory_order_acquire);
+      span.start_ticks_ = start_ticks;
+      span.end_ticks_ = end_ticks;
+      span.thread_ = std::hash<std::thread::id>()(std::this_thread::get_id());
+      span.recorded_.store(true, std::memory_order_release);
+    }
   }
 }
 
@@ -248,13 +458,25 @@ void Stats::add_counter(const std::string& stat, uint64_t count) {
   (void)stat;
   (void)count;
 }
-ScopedExecutor Stats::start_timer(const std::string& stat) {
-  (void)stat;
-  return ScopedExecutor();
+
+void Stats::add_counter(StatId id, uint64_t count) {
+  (void)id;
+  (void)count;
 }
 
-void Stats::end_timer(const std::string& stat) {
+ScopedTimer Stats::start_timer(const std::string& stat) {
   (void)stat;
+  return ScopedTimer();
+}
+
+ScopedTimer Stats::start_timer(StatId id) {
+  (void)id;
+  return ScopedTimer();
+}
+
+void Stats::end_timer(StatId id, uint64_t start_ticks) {
+  (void)id;
+  (void)start_ticks;
 }
 
 #endif
@@ -263,6 +485,57 @@ Stats* Stats::parent() {
   return parent_;
 }
 
+void Stats::enable_trace(uint64_t max_span_num) {
+  std::unique_lock<std::mutex> lck(mtx_);
+  if (trace_.load(std::memory_order_relaxed) != nullptr)
+    return;
+  trace_.store(
+      new Trace(max_span_num, now_ticks()), std::memory_order_release);
+}
+
+std::string Stats::dump_trace() const {
+  const Trace* const trace = trace_.load(std::memory_order_acquire);
+  if (trace == nullptr)
+    return "";
+
+  // Number the threads in the order of their first span.
+  const double us_per_tick = seconds_per_tick() * 1e6;
+  const uint64_t span_num = std::min(
+      trace->span_num_.load(std::memory_order_relaxed), trace->max_span_num_);
+  std::unordered_map<uint64_t, uint64_t> thread_ids;
+  std::stringstream ss;
+  ss << std::fixed << std::setprecision(3);
+  ss << "{\"traceEvents\": [";
+  bool printed_first_span = false;
+  for (uint64_t i = 0; i < span_num; ++i) {
+    const TraceSpan& span = trace->spans_[i];
+    if (!span.recorded_.load(std::memory_order_acquire))
+      continue;
+
+    const uint64_t tid =
+        thread_ids.emplace(span.thread_, thread_ids.size() + 1).first->second;
+    const uint64_t start = span.start_ticks_ > trace->start_ticks_ ?
+                               span.start_ticks_ - trace->start_ticks_ :
+                               0;
+    const uint64_t dur = span.end_ticks_ > span.start_ticks_ ?
+                             span.end_ticks_ - span.start_ticks_ :
+                             0;
+    if (printed_first_span)
+      ss << ",";
+    ss << "\n  {\"name\": \"" << *span.name_
+       << "\", \"ph\": \"X\", \"pid\": 1, \"tid\": " << tid
+       << ", \"ts\": " << start * us_per_tick
+       << ", \"dur\": " << dur * us_per_tick << "}";
+    printed_first_span = true;
+  }
+  const uint64_t dropped_span_num =
+      trace->span_num_.load(std::memory_order_relaxed) - span_num;
+  ss << "\n], \"displayTimeUnit\": \"ms\", \"otherData\": "
+     << "{\"dropped_span_num\": " << dropped_span_num << "}}";
+
+  return ss.str();
+}
+
 Stats* Stats::create_child(const std::string& prefix) {
   std::unique_lock<std::mutex> lck(mtx_);
   children_.emplace_back(prefix_ + prefix);
@@ -273,32 +546,152 @@ Stats* Stats::create_child(const std::string& prefix) {
 
 void Stats::populate_flattened_stats(
     std::unordered_map<std::string, double>* const flattened_timers,
-    std::unordered_map<std::string, uint64_t>* const flattened_counters) const {
+    std::unordered_map<std::string, uint64_t>* const flattened_counters,
+    std::unordered_map<std::string, std::vector<uint64_t>>* const
+        flattened_histograms) const {
   // We will acquire the locks top-down in the tree and hold
   // until the recursion terminates.
   std::unique_lock<std::mutex> lck(mtx_);
 
   // Append the stats from this instance.
-  for (const auto& timer : timers_)
+  auto timers = timers_;
+  auto counters = counters_;
+  aggregate_registered_stats(&timers, &counters, flattened_histograms);
+  for (const auto& timer : timers)
     (*flattened_timers)[timer.first] += timer.second;
-  for (const auto& counter : counters_)
+  for (const auto& counter : counters)
     (*flattened_counters)[counter.first] += counter.second;
 
   // Populate the stats from all of the children.
   for (const auto& child : children_) {
-    child.populate_flattened_stats(flattened_timers, flattened_counters);
+    child.populate_flattened_stats(
+        flattened_timers, flattened_counters, flattened_histograms);
   }
 }
 
 std::unordered_map<std::string, double>* Stats::timers() {
+  std::unique_lock<std::mutex> lck(mtx_);
+  drain_registered_stats();
   return &timers_;
 }
 
 /** Return pointer to conters map, used for serialization only. */
 std::unordered_map<std::string, uint64_t>* Stats::counters() {
+  std::unique_lock<std::mutex> lck(mtx_);
+  drain_registered_stats();
   return &counters_;
 }
 
+unsigned Stats::thread_shard() {
+  // Threads are assigned to shards round-robin on their first update.
+  static std::atomic<unsigned> next_shard{0};
+  thread_local const unsigned shard_idx =
+      next_shard.fetch_add(1, std::memory_order_relaxed) % shard_num_;
+  return shard_idx;
+}
+
+Stats::Trace* Stats::trace() const {
+  for (const Stats* stats = this; stats != nullptr; stats = stats->parent_) {
+    Trace* const trace = stats->trace_.load(std::memory_order_acquire);
+    if (trace != nullptr)
+      return trace;
+  }
+  return nullptr;
+}
+
+void Stats::stat_slot_position(
+    StatId id, unsigned* chunk_idx, uint64_t* slot_idx) {
+  // Chunk `i` holds `slots_per_chunk_ << i` stats, so it starts at id
+  // `slots_per_chunk_ * (2^i - 1)`.
+  const uint64_t n = uint64_t(id) / slots_per_chunk_ + 1;
+  unsigned idx = 0;
+  while ((n >> (idx + 1)) != 0)
+    ++idx;
+  *chunk_idx = idx;
+  *slot_idx = uint64_t(id) - uint64_t(slots_per_chunk_) * ((1ull << idx) - 1);
+}
+
+Stats::StatSlot* Stats::stat_slot(StatId id) const {
+  unsigned chunk_idx;
+  uint64_t slot_idx;
+  stat_slot_position(id, &chunk_idx, &slot_idx);
+  StatSlot* const chunk =
+      stat_chunks_[chunk_idx].load(std::memory_order_acquire);
+  if (chunk == nullptr)
+    return nullptr;
+  return &chunk[slot_idx];
+}
+
+void Stats::drain_registered_stats() {
+  const double spt = seconds_per_tick();
+  const StatId stat_num = static_cast<StatId>(stat_names_.size());
+  for (StatId id = 0; id < stat_num; ++id) {
+    StatSlot& slot = *stat_slot(id);
+    const std::string& name = stat_names_[id];
+
+    const bool counter_set =
+        slot.counter_set_.exchange(false, std::memory_order_relaxed);
+    uint64_t counter = 0, timer_count = 0, timer_sum = 0, timer_max = 0;
+    for (auto& shard : slot.shards_) {
+      counter += shard.counter_.exchange(0, std::memory_order_relaxed);
+      timer_count +=
+          shard.timer_count_.exchange(0, std::memory_order_relaxed);
+      timer_sum += shard.timer_sum_.exchange(0, std::memory_order_relaxed);
+      timer_max = std::max(
+          timer_max, shard.timer_max_.exchange(0, std::memory_order_relaxed));
+    }
+
+    if (counter_set)
+      counters_[name] += counter;
+    if (timer_count > 0) {
+      timers_[name + ".sum"] += timer_sum * spt;
+      double& max = timers_[name + ".max"];
+      max = std::max(max, timer_max * spt);
+      counters_[name + ".timer_count"] += timer_count;
+    }
+  }
+}
+
+void Stats::aggregate_registered_stats(
+    std::unordered_map<std::string, double>* const timers,
+    std::unordered_map<std::string, uint64_t>* const counters,
+    std::unordered_map<std::string, std::vector<uint64_t>>* const histograms)
+    const {
+  const double spt = seconds_per_tick();
+  const StatId stat_num = static_cast<StatId>(stat_names_.size());
+  for (StatId id = 0; id < stat_num; ++id) {
+    const StatSlot& slot = *stat_slot(id);
+    const std::string& name = stat_names_[id];
+
+    uint64_t counter = 0, timer_count = 0, timer_sum = 0, timer_max = 0;
+    for (const auto& shard : slot.shards_) {
+      counter += shard.counter_.load(std::memory_order_relaxed);
+      timer_count += shard.timer_count_.load(std::memory_order_relaxed);
+      timer_sum += shard.timer_sum_.load(std::memory_order_relaxed);
+      timer_max = std::max(
+          timer_max, shard.timer_max_.load(std::memory_order_relaxed));
+    }
+
+    if (slot.counter_set_.load(std::memory_order_relaxed))
+      (*counters)[name] += counter;
+    if (timer_count > 0) {
+      (*timers)[name + ".sum"] += timer_sum * spt;
+      double& max = (*timers)[name + ".max"];
+      max = std::max(max, timer_max * spt);
+      (*counters)[name + ".timer_count"] += timer_count;
+    }
+
+    const StatHistogram* const histogram =
+        slot.histogram_.load(std::memory_order_acquire);
+    if (histogram != nullptr) {
+      auto& buckets = (*histograms)[name];
+      buckets.resize(histogram_bucket_num_, 0);
+      for (unsigned b = 0; b < histogram_bucket_num_; ++b)
+        buckets[b] += histogram->buckets_[b].load(std::memory_order_relaxed);
+    }
+  }
+}
+
 }  // namespace stats
 }  // namespace sm
 }  // namespace tiledb
@@ -33,16 +33,22 @@
 #ifndef TILEDB_STATS_H
 #define TILEDB_STATS_H
 
+#include "tiledb/common/macros.h"
 #include "tiledb/common/scoped_executor.h"
 
 #include <inttypes.h>
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <deque>
 #include <iomanip>
 #include <iostream>
 #include <list>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <sstream>
+#include <string>
 #include <thread>
 #include <unordered_map>
 #include <vector>
@@ -51,11 +57,103 @@ namespace tiledb {
 namespace sm {
 namespace stats {
 
+class Stats;
+
+/**
+ * The identifier of a stat registered on a `Stats` instance with
+ * `Stats::register_stat`. It is only valid for that instance.
+ */
+typedef uint32_t StatId;
+
+/**
+ * Measures the duration of a timer stat, from its construction by
+ * `Stats::start_timer` to its destruction.
+ */
+class ScopedTimer final {
+ public:
+  /* ****************************** */
+  /*   CONSTRUCTORS & DESTRUCTORS   */
+  /* ****************************** */
+
+  /** Default constructor. Constructs an inactive timer. */
+  ScopedTimer()
+      : stats_(nullptr)
+      , id_(0)
+      , start_ticks_(0) {
+  }
+
+  /**
+   * Value constructor.
+   *
+   * @param stats The instance the duration is recorded to.
+   * @param id The timer stat.
+   * @param start_ticks The ticks at the start of the timer.
+   */
+  ScopedTimer(Stats* stats, StatId id, uint64_t start_ticks)
+      : stats_(stats)
+      , id_(id)
+      , start_ticks_(start_ticks) {
+  }
+
+  /** Move constructor. */
+  ScopedTimer(ScopedTimer&& rhs)
+      : stats_(rhs.stats_)
+      , id_(rhs.id_)
+      , start_ticks_(rhs.start_ticks_) {
+    rhs.stats_ = nullptr;
+  }
+
+  /** Destructor. Records the duration of the timer. */
+  ~ScopedTimer();
+
+  DISABLE_COPY_AND_COPY_ASSIGN(ScopedTimer);
+  DISABLE_MOVE_ASSIGN(ScopedTimer);
+
+ private:
+  /* ****************************** */
+  /*       PRIVATE ATTRIBUTES       */
+  /* ****************************** */
+
+  /** The instance the duration is recorded to, null if inactive. */
+  Stats* stats_;
+
+  /** The timer stat. */
+  StatId id_;
+
+  /** The ticks at the start of the timer. */
+  uint64_t start_ticks_;
+};
+
 /**
  * Class that defines stats counters and methods to manipulate them.
+ *
+ * Stats are identified by integer ids, registered once per name with
+ * `register_stat`. Updating a stat by id takes no lock: each stat keeps
+ * a few cache-line sized shards of atomic values, each thread updates
+ * the shard it is assigned to, and the shards are aggregated when the
+ * stats are dumped. Timers measure durations in CPU timestamp counter
+ * ticks where available, converted to seconds on aggregation. The
+ * overloads taking stat names register the stat on every call, which
+ * takes a lock; hot paths should register their stats up front.
+ *
+ * Timers registered with `register_histogram` also keep a log-linear
+ * histogram of their durations, from which the dump reports the 50th,
+ * 99th and 99.9th percentiles. An instance may also record the spans of
+ * the timers of its subtree in a bounded trace, see `enable_trace`.
  */
 class Stats {
  public:
+  /* ****************************** */
+  /*            CONSTANTS           */
+  /* ****************************** */
+
+  /**
+   * The log2 of the number of buckets of equal width per power of two of a
+   * timer histogram. With 16 buckets, a duration is known within 1/16 of
+   * its value.
+   */
+  static constexpr unsigned histogram_sub_bucket_bits_ = 4;
+
   /* ****************************** */
   /*   CONSTRUCTORS & DESTRUCTORS   */
   /* ****************************** */
@@ -69,24 +167,52 @@ class Stats {
   Stats(const std::string& prefix);
 
   /** Destructor. */
-  ~Stats() = default;
+  ~Stats();
+
+  DISABLE_COPY_AND_COPY_ASSIGN(Stats);
+  DISABLE_MOVE_AND_MOVE_ASSIGN(Stats);
 
   /* ****************************** */
   /*              API               */
   /* ****************************** */
 
+  /**
+   * Returns the id of the input stat, registering it on the first call.
+   * The same id may be used for a timer and a counter stat.
+   */
+  StatId register_stat(const std::string& stat);
+
+  /**
+   * Registers the input timer stat as `register_stat` does, and keeps a
+   * histogram of its durations, including the durations of the timers
+   * started by name.
+   */
+  StatId register_histogram(const std::string& stat);
+
   /**
    * Starts a timer for the input timer stat. The timer
-   * ends when the returned `ScopedExecutor` object is destroyed.
+   * ends when the returned `ScopedTimer` object is destroyed.
    */
-  common::ScopedExecutor start_timer(const std::string& stat);
+  ScopedTimer start_timer(const std::string& stat);
+
+  /** Starts a timer for the input registered timer stat. */
+  ScopedTimer start_timer(StatId id);
 
   /** Adds `count` to the input counter stat. */
   void add_counter(const std::string& stat, uint64_t count);
 
+  /** Adds `count` to the input registered counter stat. */
+  void add_counter(StatId id, uint64_t count);
+
   /** Returns true if statistics are currently enabled. */
   bool enabled() const;
 
+  /**
+   * Returns an id of this instance that is unique in the process, i.e.
+   * that is never reused after the instance is destroyed.
+   */
+  uint64_t uid() const;
+
   /** Enable or disable statistics gathering. */
   void set_enabled(bool enabled);
 
@@ -108,13 +234,140 @@ class Stats {
   /** Creates a child instance, managed by this instance. */
   Stats* create_child(const std::string& prefix);
 
-  /** Return pointer to timers map, used for serialization only. */
+  /**
+   * Records the spans of the timers of this instance and its descendants,
+   * up to `max_span_num` spans, after which spans are dropped. The memory
+   * of the trace is allocated up front. Subsequent calls have no effect.
+   */
+  void enable_trace(uint64_t max_span_num);
+
+  /**
+   * Dumps the spans recorded since `enable_trace` as a Chrome trace JSON
+   * object of complete events, with timestamps in microseconds since the
+   * trace was enabled. Returns an empty string if tracing is not enabled.
+   */
+  std::string dump_trace() const;
+
+  /**
+   * Return pointer to timers map, used for serialization only. The values
+   * of the registered stats are moved to the map first.
+   */
   std::unordered_map<std::string, double>* timers();
 
-  /** Return pointer to conters map, used for serialization only. */
+  /**
+   * Return pointer to conters map, used for serialization only. The values
+   * of the registered stats are moved to the map first.
+   */
   std::unordered_map<std::string, uint64_t>* counters();
 
  private:
+  friend class ScopedTimer;
+
+  /* ****************************** */
+  /*         PRIVATE TYPES          */
+  /* ****************************** */
+
+  /** The number of shards of a registered stat. */
+  static constexpr unsigned shard_num_ = 8;
+
+  /**
+   * The number of registered stats in the first chunk. Each following
+   * chunk is twice as large as the previous one.
+   */
+  static constexpr unsigned slots_per_chunk_ = 16;
+
+  /**
+   * The number of chunks of registered stats, enough to hold a slot for
+   * every `StatId`.
+   */
+  static constexpr unsigned max_chunk_num_ = 29;
+
+  /**
+   * The number of buckets of a timer histogram: exact buckets for the
+   * durations of less than `2^histogram_sub_bucket_bits_` ticks, then
+   * `2^histogram_sub_bucket_bits_` buckets for each larger power of two.
+   */
+  static constexpr unsigned histogram_bucket_num_ =
+      (65 - histogram_sub_bucket_bits_) << histogram_sub_bucket_bits_;
+
+  /** The values of a registered stat updated by a subset of the threads. */
+  struct alignas(64) StatShard {
+    /** The counter value. */
+    std::atomic<uint64_t> counter_{0};
+
+    /** The number of completed timers. */
+    std::atomic<uint64_t> timer_count_{0};
+
+    /** The sum of the timer durations, in ticks. */
+    std::atomic<uint64_t> timer_sum_{0};
+
+    /** The maximum timer duration, in ticks. */
+    std::atomic<uint64_t> timer_max_{0};
+  };
+
+  /** The histogram of the durations of a timer stat, in ticks. */
+  struct StatHistogram {
+    /** Constructor. */
+    StatHistogram();
+
+    /** The number of durations in each bucket. */
+    std::array<std::atomic<uint64_t>, histogram_bucket_num_> buckets_;
+  };
+
+  /** A registered stat. */
+  struct StatSlot {
+    /** Destructor. */
+    ~StatSlot();
+
+    /** The shards of the stat. */
+    std::array<StatShard, shard_num_> shards_;
+
+    /** True if the stat was updated as a counter. */
+    std::atomic<bool> counter_set_{false};
+
+    /** The histogram of the timer durations, null if not kept. */
+    std::atomic<StatHistogram*> histogram_{nullptr};
+
+    /** The stat name in `stat_names_`, read by traced timers. */
+    std::atomic<const std::string*> name_{nullptr};
+  };
+
+  /** A completed timer recorded in a trace. */
+  struct TraceSpan {
+    /** The stat name, including the prefix. */
+    const std::string* name_;
+
+    /** The ticks at the start of the timer. */
+    uint64_t start_ticks_;
+
+    /** The ticks at the end of the timer. */
+    uint64_t end_ticks_;
+
+    /** The hash of the id of the thread that ran the timer. */
+    uint64_t thread_;
+
+    /** True once the other fields are written. */
+    std::atomic<bool> recorded_{false};
+  };
+
+  /** A bounded buffer of trace spans, filled without locks. */
+  struct Trace {
+    /** Constructor. */
+    Trace(uint64_t max_span_num, uint64_t start_ticks);
+
+    /** The maximum number of spans. */
+    const uint64_t max_span_num_;
+
+    /** The ticks when the trace was enabled. */
+    const uint64_t start_ticks_;
+
+    /** The spans, the first `span_num_` of which are claimed. */
+    std::unique_ptr<TraceSpan[]> spans_;
+
+    /** The number of spans claimed, including the dropped ones. */
+    std::atomic<uint64_t> span_num_;
+  };
+
   /* ****************************** */
   /*       PRIVATE ATTRIBUTES       */
   /* ****************************** */
@@ -125,19 +378,33 @@ class Stats {
   /** True if stats are being gathered. */
   bool enabled_;
 
+  /** The unique id of this instance. */
+  const uint64_t uid_;
+
   /** A map of timer stats measuring time in seconds. */
   std::unordered_map<std::string, double> timers_;
 
   /** A map of counter stats. */
   std::unordered_map<std::string, uint64_t> counters_;
 
-  typedef std::unordered_map<
-      std::thread::id,
-      std::chrono::high_resolution_clock::time_point>
-      ThreadTimer;
+  /** The ids of the registered stats, keyed by stat name. */
+  std::unordered_map<std::string, StatId> stat_ids_;
+
+  /**
+   * The names of the registered stats, including the prefix. Trace spans
+   * point to these names, which are never moved.
+   */
+  std::deque<std::string> stat_names_;
+
+  /**
+   * The registered stats, allocated in chunks of doubling size that are
+   * never moved, so that they can be updated while other stats are
+   * registered.
+   */
+  std::array<std::atomic<StatSlot*>, max_chunk_num_> stat_chunks_;
 
-  /** The start time for all pending timers. */
-  std::unordered_map<std::string, ThreadTimer> start_times_;
+  /** The trace of the timers of this subtree, null if not enabled. */
+  std::atomic<Trace*> trace_;
 
   /** Prefix used for the various timers and counters. */
   const std::string prefix_;
@@ -155,8 +422,47 @@ class Stats {
   /*       PRIVATE FUNCTIONS        */
   /* ****************************** */
 
-  /** Ends a timer for the input timer stat. */
-  void end_timer(const std::string& stat);
+  /** Returns the index of the shards updated by the calling thread. */
+  static unsigned thread_shard();
+
+  /**
+   * Computes the chunk holding the input registered stat and the index
+   * of the stat in that chunk.
+   */
+  static void stat_slot_position(
+      StatId id, unsigned* chunk_idx, uint64_t* slot_idx);
+
+  /** Returns the input registered stat, or null if the id is not valid. */
+  StatSlot* stat_slot(StatId id) const;
+
+  /** Ends a timer for the input registered timer stat. */
+  void end_timer(StatId id, uint64_t start_ticks);
+
+  /**
+   * Returns the trace of this instance or of its closest traced ancestor,
+   * or null if none is traced.
+   */
+  Trace* trace() const;
+
+  /**
+   * Moves the values of the registered stats to `timers_` and
+   * `counters_`. The `mtx_` must be locked.
+   */
+  void drain_registered_stats();
+
+  /**
+   * Adds the values of the registered stats to the input stats, without
+   * modifying them. The `mtx_` must be locked.
+   *
+   * @param timers Timers to add to.
+   * @param counters Counters to add to.
+   * @param histograms Timer histograms to add to.
+   */
+  void aggregate_registered_stats(
+      std::unordered_map<std::string, double>* timers,
+      std::unordered_map<std::string, uint64_t>* counters,
+      std::unordered_map<std::string, std::vector<uint64_t>>* histograms)
+      const;
 
   /**
    * Populates the input stats with the instance stats. This is a
@@ -166,11 +472,13 @@ class Stats {
    *
    * @param flattened_timers Timers to append to.
    * @param flattened_counters Counters to append to.
+   * @param flattened_histograms Timer histograms to append to.
    */
   void populate_flattened_stats(
       std::unordered_map<std::string, double>* const flattened_timers,
-      std::unordered_map<std::string, uint64_t>* const flattened_counters)
-      const;
+      std::unordered_map<std::string, uint64_t>* const flattened_counters,
+      std::unordered_map<std::string, std::vector<uint64_t>>* const
+          flattened_histograms) const;
 };
 
 }  // namespace stats
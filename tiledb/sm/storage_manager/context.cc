@@ -50,8 +50,14 @@ Context::Context(const Config& config)
     : last_error_(nullopt)
     , logger_(make_shared<Logger>(
           HERE(), "Context: " + std::to_string(++logger_id_)))
-    , compute_tp_(get_compute_thread_count(config))
-    , io_tp_(get_io_thread_count(config))
+    , compute_tp_(
+          get_compute_thread_count(config),
+          ThreadPool::Scheduling::WorkStealing,
+          get_thread_affinity(config, "sm.compute_cpu_set"))
+    , io_tp_(
+          get_io_thread_count(config),
+          ThreadPool::Scheduling::WorkStealing,
+          get_thread_affinity(config, "sm.io_cpu_set"))
     , stats_(make_shared<stats::Stats>(HERE(), "Context"))
     , storage_manager_{} {
   if (!init(config).ok()) {
@@ -233,6 +239,37 @@ size_t Context::get_io_thread_count(const Config& config) {
       std::max(config_thread_count, io_concurrency_level));
 }
 
+std::vector<CpuAffinity> Context::get_thread_affinity(
+    const Config& config, const std::string& cpu_set_param) {
+  bool found = false;
+  bool numa_aware = false;
+  if (!config.get<bool>("sm.numa_aware", &numa_aware, &found).ok()) {
+    throw std::logic_error("Cannot get NUMA awareness");
+  }
+  assert(found);
+
+  const char* cpu_set = nullptr;
+  if (!config.get(cpu_set_param, &cpu_set).ok()) {
+    throw std::logic_error("Cannot get CPU set");
+  }
+  assert(cpu_set != nullptr);
+
+  // Without an explicit CPU set, the threads are only pinned when they
+  // should stay on a single NUMA node.
+  std::vector<uint32_t> cpus;
+  if (*cpu_set == '\0') {
+    if (!numa_aware) {
+      return {};
+    }
+    cpus = available_cpus();
+  } else if (!parse_cpu_list(cpu_set, &cpus).ok() || cpus.empty()) {
+    throw std::logic_error(
+        "Cannot parse CPU set '" + std::string(cpu_set) + "'");
+  }
+
+  return worker_affinities(cpus, numa_aware);
+}
+
 Status Context::init_loggers(const Config& config) {
   // temporarily set level to error so that possible errors reading
   // configuration are visible to the user
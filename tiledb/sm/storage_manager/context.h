@@ -158,6 +158,17 @@ class Context {
    */
   size_t get_io_thread_count(const Config& config);
 
+  /**
+   * Get the CPUs to pin the workers of a thread pool to, based on config
+   * parameters.
+   *
+   * @param config The Config to look up the affinity information from.
+   * @param cpu_set_param The parameter holding the CPU set of the pool.
+   * @return The worker affinities, empty if the workers are not pinned.
+   */
+  std::vector<CpuAffinity> get_thread_affinity(
+      const Config& config, const std::string& cpu_set_param);
+
   /**
    * Initializes global and local logger.
    *
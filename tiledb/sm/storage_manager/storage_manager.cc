@@ -46,7 +46,8 @@
 #include "tiledb/sm/array/array_directory.h"
 #include "tiledb/sm/array_schema/array_schema.h"
 #include "tiledb/sm/array_schema/array_schema_evolution.h"
-#include "tiledb/sm/cache/buffer_lru_cache.h"
+#include "tiledb/sm/cache/fragment_metadata_cache.h"
+#include "tiledb/sm/cache/tile_cache.h"
 #include "tiledb/sm/consolidator/consolidator.h"
 #include "tiledb/sm/consolidator/fragment_consolidator.h"
 #include "tiledb/sm/enums/array_type.h"
@@ -70,6 +71,7 @@
 #include "tiledb/sm/storage_manager/storage_manager.h"
 #include "tiledb/sm/tile/generic_tile_io.h"
 #include "tiledb/sm/tile/tile.h"
+#include "tiledb/sm/tile/tile_buffer_pool.h"
 #include "tiledb/storage_format/uri/parse_uri.h"
 
 #include <algorithm>
@@ -96,6 +98,7 @@ StorageManager::StorageManager(
     , queries_in_progress_(0)
     , compute_tp_(compute_tp)
     , io_tp_(io_tp)
+    , unfiltered_tile_cache_min_ratio_(1.0f)
     , vfs_(nullptr) {
 }
 
@@ -197,33 +200,52 @@ std::tuple<
 StorageManager::load_array_schemas_and_fragment_metadata(
     const ArrayDirectory& array_dir,
     MemoryTracker* memory_tracker,
-    const EncryptionKey& enc_key) {
+    const EncryptionKey& enc_key,
+    const std::unordered_map<std::string, shared_ptr<ArraySchema>>&
+        loaded_schemas,
+    const std::vector<shared_ptr<FragmentMetadata>>&
+        loaded_fragment_metadata) {
   auto timer_se =
       stats_->start_timer("sm_load_array_schemas_and_fragment_metadata");
 
-  // Load array schemas
-  auto&& [st_schemas, array_schema_latest, array_schemas_all] =
-      load_array_schemas(array_dir, enc_key);
-  RETURN_NOT_OK_TUPLE(st_schemas, std::nullopt, std::nullopt, std::nullopt);
-
-  auto filtered_fragment_uris = array_dir.filtered_fragment_uris(
-      array_schema_latest.value().get()->dense());
+  // The array schemas and the consolidated fragment metadatas do not
+  // depend on each other, so they are loaded in parallel.
   const auto& meta_uris = array_dir.fragment_meta_uris();
-  const auto& fragments_to_load = filtered_fragment_uris.fragment_uris();
-
-  // Get the consolidated fragment metadatas
+  optional<shared_ptr<ArraySchema>> array_schema_latest;
+  optional<std::unordered_map<std::string, shared_ptr<ArraySchema>>>
+      array_schemas_all;
   std::vector<Buffer> f_buffs(meta_uris.size());
   std::vector<std::vector<std::pair<std::string, uint64_t>>> offsets_vectors(
       meta_uris.size());
-  auto status = parallel_for(compute_tp_, 0, meta_uris.size(), [&](size_t i) {
-    auto&& [st, buffer_opt, offsets] =
-        load_consolidated_fragment_meta(meta_uris[i], enc_key);
+  std::vector<ThreadPool::Task> tasks;
+
+  // Load array schemas
+  tasks.emplace_back(compute_tp_->execute([&]() {
+    auto&& [st, latest, all] =
+        load_array_schemas(array_dir, enc_key, loaded_schemas);
     RETURN_NOT_OK(st);
-    f_buffs[i] = std::move(*buffer_opt);
-    offsets_vectors[i] = std::move(offsets.value());
-    return st;
-  });
-  RETURN_NOT_OK_TUPLE(status, nullopt, nullopt, nullopt);
+    array_schema_latest = std::move(latest);
+    array_schemas_all = std::move(all);
+    return Status::Ok();
+  }));
+
+  // Get the consolidated fragment metadatas
+  tasks.emplace_back(compute_tp_->execute([&]() {
+    auto timer_se = stats_->start_timer("sm_load_consolidated_frag_metas");
+    return parallel_for(io_tp_, 0, meta_uris.size(), [&](size_t i) {
+      auto&& [st, buffer_opt, offsets] =
+          load_consolidated_fragment_meta(meta_uris[i], enc_key);
+      RETURN_NOT_OK(st);
+      f_buffs[i] = std::move(*buffer_opt);
+      offsets_vectors[i] = std::move(offsets.value());
+      return st;
+    });
+  }));
+  RETURN_NOT_OK_TUPLE(compute_tp_->wait_all(tasks), nullopt, nullopt, nullopt);
+
+  auto filtered_fragment_uris = array_dir.filtered_fragment_uris(
+      array_schema_latest.value().get()->dense());
+  const auto& fragments_to_load = filtered_fragment_uris.fragment_uris();
 
   // Get the unique fragment metadatas into a map.
   std::unordered_map<std::string, std::pair<Buffer*, uint64_t>> offsets;
@@ -243,7 +265,8 @@ StorageManager::load_array_schemas_and_fragment_metadata(
       array_schemas_all.value(),
       enc_key,
       fragments_to_load,
-      offsets);
+      offsets,
+      loaded_fragment_metadata);
   RETURN_NOT_OK_TUPLE(st_fragment_meta, nullopt, nullopt, nullopt);
 
   return {
@@ -273,7 +296,9 @@ StorageManager::array_open_for_reads(Array* array) {
       load_array_schemas_and_fragment_metadata(
           array->array_directory(),
           array->memory_tracker(),
-          *array->encryption_key());
+          *array->encryption_key(),
+          {},
+          {});
   RETURN_NOT_OK_TUPLE(st, nullopt, nullopt, nullopt);
 
   auto version = array_schema_latest.value()->version();
@@ -297,7 +322,8 @@ StorageManager::array_open_for_reads_without_fragments(Array* array) {
 
   // Load array schemas
   auto&& [st_schemas, array_schema_latest, array_schemas_all] =
-      load_array_schemas(array->array_directory(), *array->encryption_key());
+      load_array_schemas(
+          array->array_directory(), *array->encryption_key(), {});
   RETURN_NOT_OK_TUPLE(st_schemas, nullopt, nullopt);
 
   auto version = array_schema_latest.value()->version();
@@ -324,7 +350,8 @@ StorageManager::array_open_for_writes(Array* array) {
 
   // Load array schemas
   auto&& [st_schemas, array_schema_latest, array_schemas_all] =
-      load_array_schemas(array->array_directory(), *array->encryption_key());
+      load_array_schemas(
+          array->array_directory(), *array->encryption_key(), {});
   RETURN_NOT_OK_TUPLE(st_schemas, nullopt, nullopt);
 
   // If building experimentally, this library should not be able to
@@ -384,7 +411,8 @@ StorageManager::array_load_fragments(
       array->array_schemas_all(),
       *array->encryption_key(),
       fragments_to_load,
-      offsets);
+      offsets,
+      {});
   RETURN_NOT_OK_TUPLE(st_fragment_meta, nullopt);
 
   return {Status::Ok(), fragment_metadata};
@@ -395,7 +423,10 @@ tuple<
     optional<shared_ptr<ArraySchema>>,
     optional<std::unordered_map<std::string, shared_ptr<ArraySchema>>>,
     optional<std::vector<shared_ptr<FragmentMetadata>>>>
-StorageManager::array_reopen(Array* array) {
+StorageManager::array_reopen(
+    Array* array,
+    const std::vector<shared_ptr<FragmentMetadata>>&
+        loaded_fragment_metadata) {
   auto timer_se = stats_->start_timer("read_array_open");
 
   // Check if array is open
@@ -409,7 +440,22 @@ StorageManager::array_reopen(Array* array) {
             nullopt};
   }
 
-  return array_open_for_reads(array);
+  // Only the schemas and fragments that were not loaded when the array was
+  // last opened are loaded from storage.
+  auto&& [st, array_schema_latest, array_schemas_all, fragment_metadata] =
+      load_array_schemas_and_fragment_metadata(
+          array->array_directory(),
+          array->memory_tracker(),
+          *array->encryption_key(),
+          array->array_schemas_all(),
+          loaded_fragment_metadata);
+  RETURN_NOT_OK_TUPLE(st, nullopt, nullopt, nullopt);
+
+  auto version = array_schema_latest.value()->version();
+  ensure_supported_schema_version_for_read(version);
+
+  return {
+      Status::Ok(), array_schema_latest, array_schemas_all, fragment_metadata};
 }
 
 Status StorageManager::array_consolidate(
@@ -1339,9 +1385,74 @@ Status StorageManager::init(const Config& config) {
   RETURN_NOT_OK(
       config_.get<uint64_t>("sm.tile_cache_size", &tile_cache_size, &found));
   assert(found);
+  uint64_t tile_cache_shard_num = 0;
+  RETURN_NOT_OK(config_.get<uint64_t>(
+      "sm.tile_cache_shard_num", &tile_cache_shard_num, &found));
+  assert(found);
+  const std::string tile_cache_policy_str =
+      config_.get("sm.tile_cache_policy", &found);
+  assert(found);
+  TileCachePolicy tile_cache_policy = TileCachePolicy::LRU;
+  if (tile_cache_policy_str == "slru") {
+    tile_cache_policy = TileCachePolicy::SLRU;
+  } else if (tile_cache_policy_str != "lru") {
+    return logger_->status(Status_StorageManagerError(
+        "Cannot initialize storage manager; Invalid tile cache policy '" +
+        tile_cache_policy_str + "'"));
+  }
+
+  uint64_t tile_buffer_pool_size = 0;
+  RETURN_NOT_OK(config_.get<uint64_t>(
+      "sm.mem.tile_buffer_pool_size", &tile_buffer_pool_size, &found));
+  assert(found);
+  if (tile_buffer_pool_size > 0) {
+    tile_buffer_pool_ = tdb_unique_ptr<TileBufferPool>(
+        tdb_new(TileBufferPool, stats_, tile_buffer_pool_size));
+  }
+
+  tile_cache_ = tdb_unique_ptr<TileCache>(tdb_new(
+      TileCache,
+      stats_,
+      tile_cache_size,
+      tile_cache_shard_num,
+      tile_cache_policy));
+
+  uint64_t unfiltered_tile_cache_size = 0;
+  RETURN_NOT_OK(config_.get<uint64_t>(
+      "sm.tile_cache_unfiltered_size", &unfiltered_tile_cache_size, &found));
+  assert(found);
+  RETURN_NOT_OK(config_.get<float>(
+      "sm.tile_cache_unfiltered_min_ratio",
+      &unfiltered_tile_cache_min_ratio_,
+      &found));
+  assert(found);
+  if (unfiltered_tile_cache_size > 0) {
+    unfiltered_tile_cache_ = tdb_unique_ptr<TileCache>(tdb_new(
+        TileCache,
+        stats_->create_child("Unfiltered"),
+        unfiltered_tile_cache_size,
+        tile_cache_shard_num,
+        tile_cache_policy));
+  }
+
+  uint64_t fragment_metadata_cache_size = 0;
+  RETURN_NOT_OK(config_.get<uint64_t>(
+      "sm.fragment_metadata_cache_size",
+      &fragment_metadata_cache_size,
+      &found));
+  assert(found);
+  if (fragment_metadata_cache_size > 0) {
+    fragment_metadata_cache_ = tdb_unique_ptr<FragmentMetadataCache>(tdb_new(
+        FragmentMetadataCache, stats_, fragment_metadata_cache_size));
+  }
 
-  tile_cache_ =
-      tdb_unique_ptr<BufferLRUCache>(tdb_new(BufferLRUCache, tile_cache_size));
+  uint64_t context_budget = 0;
+  RETURN_NOT_OK(config_.get<uint64_t>(
+      "sm.mem.context_budget", &context_budget, &found));
+  assert(found);
+  memory_tracker_.set_budget(
+      context_budget == 0 ? std::numeric_limits<uint64_t>::max() :
+                            context_budget);
 
   // GlobalState must be initialized before `vfs->init` because S3::init calls
   // GetGlobalState
@@ -1483,10 +1594,13 @@ tuple<
     optional<shared_ptr<ArraySchema>>,
     optional<std::unordered_map<std::string, shared_ptr<ArraySchema>>>>
 StorageManager::load_array_schemas(
-    const ArrayDirectory& array_dir, const EncryptionKey& encryption_key) {
+    const ArrayDirectory& array_dir,
+    const EncryptionKey& encryption_key,
+    const std::unordered_map<std::string, shared_ptr<ArraySchema>>&
+        loaded_schemas) {
   // Load all array schemas
   auto&& [st, array_schemas] =
-      load_all_array_schemas(array_dir, encryption_key);
+      load_all_array_schemas(array_dir, encryption_key, loaded_schemas);
   RETURN_NOT_OK_TUPLE(st, nullopt, nullopt);
 
   // Locate the latest array schema
@@ -1502,7 +1616,10 @@ tuple<
     Status,
     optional<std::unordered_map<std::string, shared_ptr<ArraySchema>>>>
 StorageManager::load_all_array_schemas(
-    const ArrayDirectory& array_dir, const EncryptionKey& encryption_key) {
+    const ArrayDirectory& array_dir,
+    const EncryptionKey& encryption_key,
+    const std::unordered_map<std::string, shared_ptr<ArraySchema>>&
+        loaded_schemas) {
   auto timer_se = stats_->start_timer("sm_load_all_array_schemas");
 
   const URI& array_uri = array_dir.uri();
@@ -1525,6 +1642,14 @@ StorageManager::load_all_array_schemas(
   auto status =
       parallel_for(compute_tp_, 0, schema_num, [&](size_t schema_ith) {
         auto& schema_uri = schema_uris[schema_ith];
+
+        // Array schemas are immutable, so the ones already loaded are reused
+        auto it = loaded_schemas.find(schema_uri.last_path_part());
+        if (it != loaded_schemas.end()) {
+          schema_vector[schema_ith] = it->second;
+          return Status::Ok();
+        }
+
         auto&& [st, array_schema] =
             load_array_schema_from_uri(schema_uri, encryption_key);
         RETURN_NOT_OK(st);
@@ -1819,19 +1944,49 @@ Status StorageManager::query_submit_async(Query* query) {
 }
 
 Status StorageManager::read_from_cache(
-    const URI& uri,
-    uint64_t offset,
+    const TileCacheKey& key,
     FilteredBuffer& buffer,
     uint64_t nbytes,
     bool* in_cache) const {
-  std::stringstream key;
-  key << uri.to_string() << "+" << offset;
-  buffer.expand(nbytes);
-  RETURN_NOT_OK(tile_cache_->read(key.str(), buffer, 0, nbytes, in_cache));
+  RETURN_NOT_OK(buffer.expand(nbytes, tile_buffer_pool_.get()));
+  RETURN_NOT_OK(tile_cache_->read(key, buffer, nbytes, in_cache));
 
   return Status::Ok();
 }
 
+FragmentMetadataCache* StorageManager::fragment_metadata_cache() const {
+  return fragment_metadata_cache_.get();
+}
+
+MemoryTracker* StorageManager::memory_tracker() {
+  return &memory_tracker_;
+}
+
+TileBufferPool* StorageManager::tile_buffer_pool() const {
+  return tile_buffer_pool_.get();
+}
+
+bool StorageManager::unfiltered_tile_cache_enabled() const {
+  return unfiltered_tile_cache_ != nullptr;
+}
+
+bool StorageManager::unfiltered_tile_cache_admits(
+    uint64_t unfiltered_size, uint64_t persisted_size) const {
+  return unfiltered_tile_cache_ != nullptr &&
+         static_cast<float>(unfiltered_size) >=
+             unfiltered_tile_cache_min_ratio_ *
+                 static_cast<float>(persisted_size);
+}
+
+Status StorageManager::read_from_unfiltered_cache(
+    const TileCacheKey& key,
+    void* buffer,
+    uint64_t nbytes,
+    bool* in_cache) const {
+  assert(unfiltered_tile_cache_ != nullptr);
+  return unfiltered_tile_cache_->read(key, buffer, nbytes, in_cache);
+}
+
 Status StorageManager::read(
     const URI& uri, uint64_t offset, Buffer* buffer, uint64_t nbytes) const {
   RETURN_NOT_OK(buffer->realloc(nbytes));
@@ -2000,28 +2155,25 @@ Status StorageManager::init_rest_client() {
 }
 
 Status StorageManager::write_to_cache(
-    const URI& uri, uint64_t offset, const FilteredBuffer& buffer) const {
-  // Do not write metadata or array schema to cache
-  std::string filename = uri.last_path_part();
-  std::string uri_str = uri.to_string();
-  if (filename == constants::fragment_metadata_filename ||
-      (uri_str.find(constants::array_schema_dir_name) != std::string::npos) ||
-      filename == constants::array_schema_filename) {
-    return Status::Ok();
-  }
-
-  // Generate key (uri + offset)
-  std::stringstream key;
-  key << uri.to_string() << "+" << offset;
-
+    const TileCacheKey& key, const FilteredBuffer& buffer) const {
   // Insert to cache
-  FilteredBuffer cached_buffer(buffer);
-  RETURN_NOT_OK(
-      tile_cache_->insert(key.str(), std::move(cached_buffer), false));
+  FilteredBuffer cached_buffer(0);
+  RETURN_NOT_OK(cached_buffer.expand(buffer.size(), tile_buffer_pool_.get()));
+  memcpy(cached_buffer.data(), buffer.data(), buffer.size());
+  RETURN_NOT_OK(tile_cache_->insert(key, std::move(cached_buffer), false));
 
   return Status::Ok();
 }
 
+Status StorageManager::write_to_unfiltered_cache(
+    const TileCacheKey& key, const void* buffer, uint64_t nbytes) const {
+  assert(unfiltered_tile_cache_ != nullptr);
+  FilteredBuffer cached_buffer(0);
+  RETURN_NOT_OK(cached_buffer.expand(nbytes, tile_buffer_pool_.get()));
+  memcpy(cached_buffer.data(), buffer, nbytes);
+  return unfiltered_tile_cache_->insert(key, std::move(cached_buffer), false);
+}
+
 Status StorageManager::write(const URI& uri, Buffer* buffer) const {
   return vfs_->write(uri, buffer->data(), buffer->size());
 }
@@ -2227,16 +2379,47 @@ StorageManager::load_fragment_metadata(
     const EncryptionKey& encryption_key,
     const std::vector<TimestampedURI>& fragments_to_load,
     const std::unordered_map<std::string, std::pair<Buffer*, uint64_t>>&
-        offsets) {
+        offsets,
+    const std::vector<shared_ptr<FragmentMetadata>>&
+        loaded_fragment_metadata) {
   auto timer_se = stats_->start_timer("load_fragment_metadata");
 
-  // Load the metadata for each fragment
+  // Index the fragment metadata already loaded by fragment URI
+  std::unordered_map<std::string, const shared_ptr<FragmentMetadata>*> loaded;
+  for (const auto& metadata : loaded_fragment_metadata) {
+    loaded.emplace(
+        metadata->fragment_uri().remove_trailing_slash().to_string(),
+        &metadata);
+  }
+
+  // Load the metadata for each fragment. Loading a footer that is not in a
+  // consolidated fragment metadata buffer is dominated by the latency of its
+  // reads, so all footers are loaded as a single batch on the I/O pool.
   auto fragment_num = fragments_to_load.size();
   std::vector<shared_ptr<FragmentMetadata>> fragment_metadata;
   fragment_metadata.resize(fragment_num);
-  auto status = parallel_for(compute_tp_, 0, fragment_num, [&](size_t f) {
+  std::atomic<uint64_t> consolidated_footer_num = 0;
+  std::atomic<uint64_t> reused_num = 0;
+  auto status = parallel_for(io_tp_, 0, fragment_num, [&](size_t f) {
     const auto& sf = fragments_to_load[f];
 
+    // Fragments are immutable, so a fragment that is already loaded is
+    // reused along with its loaded R-tree, tile offsets, etc., as long as
+    // it still refers to one of the array schemas of the array.
+    auto loaded_it = loaded.find(sf.uri_.remove_trailing_slash().to_string());
+    if (loaded_it != loaded.end()) {
+      const auto& metadata = *loaded_it->second;
+      auto schema_it = array_schemas_all.find(metadata->array_schema_name());
+      if (metadata->timestamp_range() == sf.timestamp_range_ &&
+          (metadata->array_schema() == array_schema_latest ||
+           (schema_it != array_schemas_all.end() &&
+            metadata->array_schema() == schema_it->second))) {
+        fragment_metadata[f] = metadata;
+        ++reused_num;
+        return Status::Ok();
+      }
+    }
+
     URI coords_uri =
         sf.uri_.join_path(constants::coords + constants::file_suffix);
 
@@ -2283,6 +2466,7 @@ StorageManager::load_fragment_metadata(
     if (it != offsets.end()) {
       f_buff = it->second.first;
       offset = it->second.second;
+      ++consolidated_footer_num;
     }
 
     // Load fragment metadata
@@ -2294,6 +2478,11 @@ StorageManager::load_fragment_metadata(
   });
   RETURN_NOT_OK_TUPLE(status, nullopt);
 
+  stats_->add_counter("fragment_footer_num", fragment_num - reused_num);
+  stats_->add_counter("fragment_reused_num", reused_num);
+  stats_->add_counter(
+      "fragment_consolidated_footer_num", consolidated_footer_num);
+
   return {Status::Ok(), fragment_metadata};
 }
 
@@ -48,6 +48,7 @@
 #include "tiledb/common/common.h"
 #include "tiledb/common/heap_memory.h"
 #include "tiledb/common/logger_public.h"
+#include "tiledb/common/memory_tracker.h"
 #include "tiledb/common/status.h"
 #include "tiledb/common/thread_pool.h"
 #include "tiledb/sm/config/config.h"
@@ -69,10 +70,13 @@ class ArrayDirectory;
 class ArraySchema;
 class ArraySchemaEvolution;
 class Buffer;
-class BufferLRUCache;
+class TileBufferPool;
+class TileCache;
+struct TileCacheKey;
 class Consolidator;
 class EncryptionKey;
 class FragmentMetadata;
+class FragmentMetadataCache;
 class FragmentInfo;
 class Group;
 class Metadata;
@@ -238,6 +242,10 @@ class StorageManager {
    * @param memory_tracker The memory tracker of the array
    *     for which the fragment metadata is loaded.
    * @param enc_key The encryption key to use.
+   * @param loaded_schemas Array schemas already loaded, keyed by name. They
+   *     are reused instead of being loaded again.
+   * @param loaded_fragment_metadata Fragment metadata already loaded for the
+   *     same array. They are reused instead of being loaded again.
    * @return tuple of Status, latest ArraySchema, map of all array schemas and
    * vector of FragmentMetadata
    *        Status Ok on success, else error
@@ -255,7 +263,11 @@ class StorageManager {
   load_array_schemas_and_fragment_metadata(
       const ArrayDirectory& array_dir,
       MemoryTracker* memory_tracker,
-      const EncryptionKey& enc_key);
+      const EncryptionKey& enc_key,
+      const std::unordered_map<std::string, shared_ptr<ArraySchema>>&
+          loaded_schemas,
+      const std::vector<shared_ptr<FragmentMetadata>>&
+          loaded_fragment_metadata);
 
   /**
    * Opens an array for reads at a timestamp. All the metadata of the
@@ -349,9 +361,14 @@ class StorageManager {
       Array* array, const std::vector<TimestampedURI>& fragment_info);
 
   /**
-   * Reopen an array for reads.
+   * Reopen an array for reads. Only the array schemas and the fragments that
+   * were not loaded before are loaded from storage; the fragment metadata
+   * (with any R-trees and tile offsets loaded since) of the fragments that
+   * are still part of the array is kept.
    *
-   * @param array The array to reopen.
+   * @param array The array to reopen, with its new array directory set.
+   * @param loaded_fragment_metadata The fragment metadata of the array
+   *     before reopening.
    * @return tuple of Status, latest ArraySchema, map of all array schemas and
    * vector of FragmentMetadata
    *        Status Ok on success, else error
@@ -366,7 +383,10 @@ class StorageManager {
       optional<shared_ptr<ArraySchema>>,
       optional<std::unordered_map<std::string, shared_ptr<ArraySchema>>>,
       optional<std::vector<shared_ptr<FragmentMetadata>>>>
-  array_reopen(Array* array);
+  array_reopen(
+      Array* array,
+      const std::vector<shared_ptr<FragmentMetadata>>&
+          loaded_fragment_metadata);
 
   /**
    * Consolidates the fragments of an array into a single one.
@@ -739,6 +759,8 @@ class StorageManager {
    * @param array_dir The ArrayDirectory object used to retrieve the
    *     various URIs in the array directory.
    * @param encryption_key The encryption key to use.
+   * @param loaded_schemas Array schemas already loaded, keyed by name. They
+   *     are reused instead of being loaded again.
    * @return tuple of Status, latest array schema and all array schemas.
    *   Status Ok on success, else error
    *   ArraySchema The latest array schema.
@@ -749,7 +771,10 @@ class StorageManager {
       optional<shared_ptr<ArraySchema>>,
       optional<std::unordered_map<std::string, shared_ptr<ArraySchema>>>>
   load_array_schemas(
-      const ArrayDirectory& array_dir, const EncryptionKey& encryption_key);
+      const ArrayDirectory& array_dir,
+      const EncryptionKey& encryption_key,
+      const std::unordered_map<std::string, shared_ptr<ArraySchema>>&
+          loaded_schemas);
 
   /**
    * Loads all schemas of an array from persistent storage into memory.
@@ -757,6 +782,8 @@ class StorageManager {
    * @param array_dir The ArrayDirectory object used to retrieve the
    *     various URIs in the array directory.
    * @param encryption_key The encryption key to use.
+   * @param loaded_schemas Array schemas already loaded, keyed by name. They
+   *     are reused instead of being loaded again.
    * @return tuple of Status and optional unordered map. If Status is an error
    * the unordered_map will be nullopt
    *        Status Ok on success, else error
@@ -766,7 +793,10 @@ class StorageManager {
       Status,
       optional<std::unordered_map<std::string, shared_ptr<ArraySchema>>>>
   load_all_array_schemas(
-      const ArrayDirectory& array_dir, const EncryptionKey& encryption_key);
+      const ArrayDirectory& array_dir,
+      const EncryptionKey& encryption_key,
+      const std::unordered_map<std::string, shared_ptr<ArraySchema>>&
+          loaded_schemas);
 
   /**
    * Loads the array metadata from persistent storage based on
@@ -890,28 +920,67 @@ class StorageManager {
   Status query_submit_async(Query* query);
 
   /**
-   * Reads from the cache into the input buffer. `uri` and `offset` collectively
-   * form the key of the cached object to be read. Essentially, this is used
-   * to read potentially cached tiles. `uri` is the URI of the attribute the
-   * tile belongs to, and `offset` is the offset in the attribute file where
-   * the tile is located. Observe that the `uri`, `offset` pair is unique.
+   * Reads a tile from the cache into the input buffer.
    *
-   * @param uri The URI of the cached object.
-   * @param offset The offset of the cached object.
+   * @param key The key of the cached tile.
    * @param buffer The buffer to write into. The function reallocates memory
    *     for the buffer, sets its size to *nbytes* and resets its offset.
    * @param nbytes Number of bytes to be read.
-   * @param in_cache This is set to `true` if the object is in the cache,
+   * @param in_cache This is set to `true` if the tile is in the cache,
    *     and `false` otherwise.
    * @return Status.
    */
   Status read_from_cache(
-      const URI& uri,
-      uint64_t offset,
+      const TileCacheKey& key,
       FilteredBuffer& buffer,
       uint64_t nbytes,
       bool* in_cache) const;
 
+  /**
+   * Returns the cache of fragment metadata shared by all the arrays opened
+   * with this storage manager, or `nullptr` if it is disabled.
+   */
+  FragmentMetadataCache* fragment_metadata_cache() const;
+
+  /**
+   * Returns the memory tracker of the context, budgeted by
+   * `sm.mem.context_budget`. The trackers of the arrays and the memory
+   * reserved by the readers draw from it.
+   */
+  MemoryTracker* memory_tracker();
+
+  /**
+   * Returns the pool recycling the tile buffers of the queries of this
+   * storage manager, or `nullptr` if it is disabled.
+   */
+  TileBufferPool* tile_buffer_pool() const;
+
+  /** Returns `true` if the unfiltered tile cache is enabled. */
+  bool unfiltered_tile_cache_enabled() const;
+
+  /**
+   * Returns `true` if a tile of `unfiltered_size` bytes, persisted in
+   * `persisted_size` bytes, should be admitted in the unfiltered tile cache.
+   */
+  bool unfiltered_tile_cache_admits(
+      uint64_t unfiltered_size, uint64_t persisted_size) const;
+
+  /**
+   * Reads the unfiltered data of a tile from the unfiltered tile cache.
+   *
+   * @param key The key of the cached tile.
+   * @param buffer The buffer to write into, of at least `nbytes` bytes.
+   * @param nbytes Number of bytes to be read.
+   * @param in_cache This is set to `true` if the tile is in the cache,
+   *     and `false` otherwise.
+   * @return Status.
+   */
+  Status read_from_unfiltered_cache(
+      const TileCacheKey& key,
+      void* buffer,
+      uint64_t nbytes,
+      bool* in_cache) const;
+
   /**
    * Reads from a file into the input buffer.
    *
@@ -995,19 +1064,25 @@ class StorageManager {
   VFS* vfs() const;
 
   /**
-   * Writes the contents of a buffer into the cache. `uri` and `offset`
-   * collectively form the key of the object to be cached. Essentially, this is
-   * used to cach tiles. `uri` is the URI of the attribute the
-   * tile belongs to, and `offset` is the offset in the attribute file where
-   * the tile is located. Observe that the `uri`, `offset` pair is unique.
+   * Writes the contents of a buffer into the cache.
    *
-   * @param uri The URI of the cached object.
-   * @param offset The offset of the cached object.
+   * @param key The key of the tile to cache.
    * @param buffer The buffer whose contents will be cached.
    * @return Status.
    */
   Status write_to_cache(
-      const URI& uri, uint64_t offset, const FilteredBuffer& buffer) const;
+      const TileCacheKey& key, const FilteredBuffer& buffer) const;
+
+  /**
+   * Writes the unfiltered data of a tile into the unfiltered tile cache.
+   *
+   * @param key The key of the tile to cache.
+   * @param buffer The unfiltered tile data.
+   * @param nbytes The size of the unfiltered tile data.
+   * @return Status.
+   */
+  Status write_to_unfiltered_cache(
+      const TileCacheKey& key, const void* buffer, uint64_t nbytes) const;
 
   /**
    * Writes the contents of a buffer into a URI file.
@@ -1150,8 +1225,29 @@ class StorageManager {
   /** Tags for the context object. */
   std::unordered_map<std::string, std::string> tags_;
 
+  /**
+   * The pool recycling the tile buffers of the queries, or `nullptr` if it
+   * is disabled. Declared before the caches, which hold pooled buffers.
+   */
+  tdb_unique_ptr<TileBufferPool> tile_buffer_pool_;
+
   /** A tile cache. */
-  tdb_unique_ptr<BufferLRUCache> tile_cache_;
+  tdb_unique_ptr<TileCache> tile_cache_;
+
+  /** A cache of unfiltered tiles, or `nullptr` if it is disabled. */
+  tdb_unique_ptr<TileCache> unfiltered_tile_cache_;
+
+  /**
+   * The minimum ratio of unfiltered to persisted size of a tile admitted in
+   * `unfiltered_tile_cache_`.
+   */
+  float unfiltered_tile_cache_min_ratio_;
+
+  /** A cache of fragment metadata, or `nullptr` if it is disabled. */
+  tdb_unique_ptr<FragmentMetadataCache> fragment_metadata_cache_;
+
+  /** The memory tracker of the context. */
+  MemoryTracker memory_tracker_;
 
   /**
    * Virtual filesystem handler. It directs queries to the appropriate
@@ -1196,6 +1292,9 @@ class StorageManager {
    *     where the basic fragment metadata can be found. If the offset
    *     cannot be found, then the metadata of that fragment will be loaded from
    *     storage instead.
+   * @param loaded_fragment_metadata Fragment metadata already loaded for the
+   *     same array. The metadata of the fragments to load found in it are
+   *     reused instead of being loaded again.
    * @return tuple of Status and vector of FragmentMetadata
    *        Status Ok on success, else error
    *        Vector of FragmentMetadata is the fragment metadata to be retrieved.
@@ -1209,7 +1308,9 @@ class StorageManager {
       const EncryptionKey& encryption_key,
       const std::vector<TimestampedURI>& fragments_to_load,
       const std::unordered_map<std::string, std::pair<Buffer*, uint64_t>>&
-          offsets);
+          offsets,
+      const std::vector<shared_ptr<FragmentMetadata>>&
+          loaded_fragment_metadata);
 
   /**
    * Loads the latest consolidated fragment metadata from storage.
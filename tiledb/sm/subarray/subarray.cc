@@ -33,6 +33,7 @@
 #include <algorithm>
 #include <cmath>
 #include <iomanip>
+#include <numeric>
 #include <sstream>
 #include <unordered_set>
 
@@ -2903,6 +2904,9 @@ Status Subarray::compute_relevant_fragment_tile_overlap(
 
   const auto& meta = array_->fragment_metadata();
 
+  if (!fn_ctx->sweep_prepared_)
+    prepare_tile_overlap_sweep(fn_ctx);
+
   auto status =
       parallel_for(compute_tp, 0, relevant_fragments_.size(), [&](uint64_t i) {
         const auto f = relevant_fragments_[i];
@@ -2925,21 +2929,40 @@ Status Subarray::compute_relevant_fragment_tile_overlap(
   const auto num_threads = compute_tp->concurrency_level();
   const auto range_num = fn_ctx->range_len_;
 
+  // With more ranges than tiles, sweeping the tiles once beats querying
+  // the R-tree once per range.
+  if (!dense && !fn_ctx->sorted_range_idx_.empty() &&
+      range_num > meta->tile_num()) {
+    stats_->add_counter("precompute_tile_overlap.fragment_sweep_num", 1);
+    return compute_relevant_fragment_tile_overlap_sweep(
+        meta, frag_idx, compute_tp, tile_overlap, fn_ctx);
+  }
+
   const auto ranges_per_thread =
       (uint64_t)std::ceil((double)range_num / num_threads);
   const auto status = parallel_for(compute_tp, 0, num_threads, [&](uint64_t t) {
     const auto r_start = fn_ctx->range_idx_offset_ + (t * ranges_per_thread);
     const auto r_end = fn_ctx->range_idx_offset_ +
                        std::min((t + 1) * ranges_per_thread - 1, range_num - 1);
-    for (uint64_t r = r_start; r <= r_end; ++r) {
-      if (dense) {  // Dense fragment
+    if (r_start > r_end)
+      return Status::Ok();
+
+    if (dense) {  // Dense fragment
+      for (uint64_t r = r_start; r <= r_end; ++r) {
         *tile_overlap->at(frag_idx, r) =
             compute_tile_overlap(r + tile_overlap->range_idx_start(), frag_idx);
-      } else {  // Sparse fragment
-        const auto& range = this->ndrange(r + tile_overlap->range_idx_start());
-        RETURN_NOT_OK(meta->get_tile_overlap(
-            range, is_default_, tile_overlap->at(frag_idx, r)));
       }
+    } else {  // Sparse fragment
+      // Query the R-tree with all the ranges of this thread at once
+      std::vector<NDRange> ranges;
+      ranges.reserve(r_end - r_start + 1);
+      for (uint64_t r = r_start; r <= r_end; ++r) {
+        ranges.emplace_back(this->ndrange(r + tile_overlap->range_idx_start()));
+      }
+      std::vector<TileOverlap> overlaps;
+      RETURN_NOT_OK(meta->get_tile_overlap(ranges, is_default_, &overlaps));
+      for (uint64_t r = r_start; r <= r_end; ++r)
+        *tile_overlap->at(frag_idx, r) = std::move(overlaps[r - r_start]);
     }
 
     return Status::Ok();
@@ -2949,6 +2972,293 @@ Status Subarray::compute_relevant_fragment_tile_overlap(
   return Status::Ok();
 }
 
+void Subarray::prepare_tile_overlap_sweep(
+    ComputeRelevantTileOverlapCtx* const fn_ctx) const {
+  fn_ctx->sweep_prepared_ = true;
+
+  const auto& domain = array_->array_schema_latest().domain();
+  const auto dim_num = this->dim_num();
+  std::vector<std::vector<uint64_t>> sorted_range_idx(dim_num);
+  std::vector<SweepRangesFunc> sweep_funcs(dim_num, nullptr);
+  for (unsigned d = 0; d < dim_num; ++d) {
+    if (is_default_[d])
+      continue;
+
+    const auto& ranges = range_subset_[d].ranges();
+    auto& sorted_idx = sorted_range_idx[d];
+    bool disjoint = false;
+    switch (domain.dimension_ptr(d)->type()) {
+      case Datatype::INT8:
+        disjoint = sort_ranges_for_sweep<int8_t>(ranges, &sorted_idx);
+        sweep_funcs[d] = sweep_ranges<int8_t>;
+        break;
+      case Datatype::UINT8:
+        disjoint = sort_ranges_for_sweep<uint8_t>(ranges, &sorted_idx);
+        sweep_funcs[d] = sweep_ranges<uint8_t>;
+        break;
+      case Datatype::INT16:
+        disjoint = sort_ranges_for_sweep<int16_t>(ranges, &sorted_idx);
+        sweep_funcs[d] = sweep_ranges<int16_t>;
+        break;
+      case Datatype::UINT16:
+        disjoint = sort_ranges_for_sweep<uint16_t>(ranges, &sorted_idx);
+        sweep_funcs[d] = sweep_ranges<uint16_t>;
+        break;
+      case Datatype::INT32:
+        disjoint = sort_ranges_for_sweep<int32_t>(ranges, &sorted_idx);
+        sweep_funcs[d] = sweep_ranges<int32_t>;
+        break;
+      case Datatype::UINT32:
+        disjoint = sort_ranges_for_sweep<uint32_t>(ranges, &sorted_idx);
+        sweep_funcs[d] = sweep_ranges<uint32_t>;
+        break;
+      case Datatype::INT64:
+        disjoint = sort_ranges_for_sweep<int64_t>(ranges, &sorted_idx);
+        sweep_funcs[d] = sweep_ranges<int64_t>;
+        break;
+      case Datatype::UINT64:
+        disjoint = sort_ranges_for_sweep<uint64_t>(ranges, &sorted_idx);
+        sweep_funcs[d] = sweep_ranges<uint64_t>;
+        break;
+      case Datatype::FLOAT32:
+        disjoint = sort_ranges_for_sweep<float>(ranges, &sorted_idx);
+        sweep_funcs[d] = sweep_ranges<float>;
+        break;
+      case Datatype::FLOAT64:
+        disjoint = sort_ranges_for_sweep<double>(ranges, &sorted_idx);
+        sweep_funcs[d] = sweep_ranges<double>;
+        break;
+      case Datatype::DATETIME_YEAR:
+      case Datatype::DATETIME_MONTH:
+      case Datatype::DATETIME_WEEK:
+      case Datatype::DATETIME_DAY:
+      case Datatype::DATETIME_HR:
+      case Datatype::DATETIME_MIN:
+      case Datatype::DATETIME_SEC:
+      case Datatype::DATETIME_MS:
+      case Datatype::DATETIME_US:
+      case Datatype::DATETIME_NS:
+      case Datatype::DATETIME_PS:
+      case Datatype::DATETIME_FS:
+      case Datatype::DATETIME_AS:
+      case Datatype::TIME_HR:
+      case Datatype::TIME_MIN:
+      case Datatype::TIME_SEC:
+      case Datatype::TIME_MS:
+      case Datatype::TIME_US:
+      case Datatype::TIME_NS:
+      case Datatype::TIME_PS:
+      case Datatype::TIME_FS:
+      case Datatype::TIME_AS:
+        disjoint = sort_ranges_for_sweep<int64_t>(ranges, &sorted_idx);
+        sweep_funcs[d] = sweep_ranges<int64_t>;
+        break;
+      default:
+        // Var-sized dimensions are not swept
+        return;
+    }
+
+    // Overlapping ranges are not swept
+    if (!disjoint)
+      return;
+  }
+
+  fn_ctx->sorted_range_idx_ = std::move(sorted_range_idx);
+  fn_ctx->sweep_funcs_ = std::move(sweep_funcs);
+}
+
+template <class T>
+bool Subarray::sort_ranges_for_sweep(
+    const std::vector<Range>& ranges, std::vector<uint64_t>* sorted_idx) {
+  sorted_idx->resize(ranges.size());
+  std::iota(sorted_idx->begin(), sorted_idx->end(), 0);
+  std::sort(
+      sorted_idx->begin(), sorted_idx->end(), [&](uint64_t a, uint64_t b) {
+        return ((const T*)ranges[a].data())[0] <
+               ((const T*)ranges[b].data())[0];
+      });
+
+  for (uint64_t i = 1; i < sorted_idx->size(); ++i) {
+    auto prev = (const T*)ranges[(*sorted_idx)[i - 1]].data();
+    auto cur = (const T*)ranges[(*sorted_idx)[i]].data();
+    if (cur[0] <= prev[1])
+      return false;
+  }
+
+  return true;
+}
+
+template <class T>
+void Subarray::sweep_ranges(
+    const std::vector<Range>& ranges,
+    const std::vector<uint64_t>& sorted_idx,
+    const Range& mbr,
+    std::vector<uint64_t>* range_idx) {
+  auto mbr_data = (const T*)mbr.data();
+
+  // The ranges are disjoint, so their ends are sorted as well. Find the
+  // first range ending at or after the MBR start.
+  auto it = std::lower_bound(
+      sorted_idx.begin(),
+      sorted_idx.end(),
+      mbr_data[0],
+      [&](uint64_t r, const T value) {
+        return ((const T*)ranges[r].data())[1] < value;
+      });
+
+  // Collect ranges until one starts after the MBR end
+  for (; it != sorted_idx.end(); ++it) {
+    if (((const T*)ranges[*it].data())[0] > mbr_data[1])
+      break;
+    range_idx->emplace_back(*it);
+  }
+}
+
+Status Subarray::compute_relevant_fragment_tile_overlap_sweep(
+    shared_ptr<FragmentMetadata> meta,
+    unsigned frag_idx,
+    ThreadPool* const compute_tp,
+    SubarrayTileOverlap* const tile_overlap,
+    ComputeRelevantTileOverlapCtx* const fn_ctx) {
+  const auto& domain = array_->array_schema_latest().domain();
+  const auto dim_num = this->dim_num();
+  const auto tile_num = meta->tile_num();
+
+  // The range indices to compute the overlap for, relative to the ranges
+  // of `tile_overlap`.
+  const auto r_start = fn_ctx->range_idx_offset_;
+  const auto r_end = r_start + fn_ctx->range_len_ - 1;
+  const auto range_idx_start = tile_overlap->range_idx_start();
+
+  // Restrict the sorted ranges of each dimension to the coordinates of the
+  // ND ranges in [r_start, r_end], so that the cross product below does not
+  // enumerate the ranges of the other chunks. The chunk is an interval of
+  // ND range indices, in which the coordinate on dimension `d` goes from
+  // `first % n` to `last % n`, wrapping around if it spans several rows.
+  const auto chunk_start = range_idx_start + r_start;
+  const auto chunk_end = range_idx_start + r_end;
+  std::vector<std::vector<uint64_t>> chunk_sorted_idx(dim_num);
+  std::vector<const std::vector<uint64_t>*> sorted_idx(dim_num);
+  for (unsigned d = 0; d < dim_num; ++d) {
+    sorted_idx[d] = &fn_ctx->sorted_range_idx_[d];
+    if (is_default_[d])
+      continue;
+
+    const auto dim_range_num = range_subset_[d].num_ranges();
+    const auto first = chunk_start / range_offsets_[d];
+    const auto last = chunk_end / range_offsets_[d];
+    if (last - first + 1 >= dim_range_num)
+      continue;
+
+    const auto lo = first % dim_range_num;
+    const auto hi = last % dim_range_num;
+    for (auto r : fn_ctx->sorted_range_idx_[d]) {
+      if (lo <= hi ? (r >= lo && r <= hi) : (r >= lo || r <= hi))
+        chunk_sorted_idx[d].emplace_back(r);
+    }
+    sorted_idx[d] = &chunk_sorted_idx[d];
+  }
+
+  // A tile overlapping a range.
+  struct RangeTileOverlap {
+    uint64_t range_idx_;
+    uint64_t tile_idx_;
+    double ratio_;
+  };
+
+  // Each thread sweeps a block of tiles, collecting their overlaps in tile
+  // order.
+  const auto num_threads = compute_tp->concurrency_level();
+  const auto tiles_per_thread =
+      (uint64_t)std::ceil((double)tile_num / num_threads);
+  std::vector<std::vector<RangeTileOverlap>> overlaps(num_threads);
+  auto status = parallel_for(compute_tp, 0, num_threads, [&](uint64_t t) {
+    const auto t_start = t * tiles_per_thread;
+    const auto t_end = std::min((t + 1) * tiles_per_thread, tile_num);
+    std::vector<std::vector<uint64_t>> dim_ranges(dim_num);
+    std::vector<std::vector<double>> dim_ratios(dim_num);
+    std::vector<uint64_t> pos(dim_num);
+    for (uint64_t tile = t_start; tile < t_end; ++tile) {
+      // Find the ranges overlapping the tile MBR on each dimension
+      const auto& mbr = meta->mbr(tile);
+      bool overlap = true;
+      for (unsigned d = 0; d < dim_num && overlap; ++d) {
+        dim_ranges[d].clear();
+        dim_ratios[d].clear();
+        if (is_default_[d]) {
+          dim_ranges[d].emplace_back(0);
+          dim_ratios[d].emplace_back(1.0);
+          continue;
+        }
+
+        fn_ctx->sweep_funcs_[d](
+            range_subset_[d].ranges(), *sorted_idx[d], mbr[d], &dim_ranges[d]);
+        auto dim{domain.dimension_ptr(d)};
+        for (auto r : dim_ranges[d])
+          dim_ratios[d].emplace_back(
+              dim->overlap_ratio(range_subset_[d][r], mbr[d]));
+        overlap = !dim_ranges[d].empty();
+      }
+      if (!overlap)
+        continue;
+
+      // Go over the ND ranges in the cross product of the ranges found,
+      // keeping those in the chunk. The ratio is computed as in
+      // `Domain::overlap_ratio`.
+      std::fill(pos.begin(), pos.end(), 0);
+      while (true) {
+        uint64_t range_idx = 0;
+        double ratio = 1.0;
+        for (unsigned d = 0; d < dim_num; ++d) {
+          range_idx += range_offsets_[d] * dim_ranges[d][pos[d]];
+          if (!is_default_[d]) {
+            ratio *= dim_ratios[d][pos[d]];
+            if (ratio == 0)
+              ratio = std::nextafter(0, std::numeric_limits<double>::max());
+          }
+        }
+        if (range_idx >= chunk_start && range_idx <= chunk_end) {
+          overlaps[t].push_back({range_idx - range_idx_start, tile, ratio});
+        }
+
+        unsigned d = 0;
+        for (; d < dim_num; ++d) {
+          if (++pos[d] < dim_ranges[d].size())
+            break;
+          pos[d] = 0;
+        }
+        if (d == dim_num)
+          break;
+      }
+    }
+
+    return Status::Ok();
+  });
+  RETURN_NOT_OK(status);
+
+  // Gather the overlaps per range. The threads swept the tiles in order,
+  // so the tiles of each range are appended in order, and consecutive
+  // fully covered tiles are merged into a single tile range.
+  for (uint64_t r = r_start; r <= r_end; ++r)
+    *tile_overlap->at(frag_idx, r) = TileOverlap();
+  for (const auto& thread_overlaps : overlaps) {
+    for (const auto& o : thread_overlaps) {
+      auto overlap = tile_overlap->at(frag_idx, o.range_idx_);
+      if (o.ratio_ != 1.0) {
+        overlap->tiles_.emplace_back(o.tile_idx_, o.ratio_);
+      } else if (
+          !overlap->tile_ranges_.empty() &&
+          overlap->tile_ranges_.back().second + 1 == o.tile_idx_) {
+        overlap->tile_ranges_.back().second = o.tile_idx_;
+      } else {
+        overlap->tile_ranges_.emplace_back(o.tile_idx_, o.tile_idx_);
+      }
+    }
+  }
+
+  return Status::Ok();
+}
+
 Status Subarray::load_relevant_fragment_tile_var_sizes(
     const std::vector<std::string>& names, ThreadPool* const compute_tp) const {
   const auto& array_schema = array_->array_schema_latest();
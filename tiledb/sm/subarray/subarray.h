@@ -1005,6 +1005,16 @@ class Subarray {
     std::vector<std::vector<uint8_t>> frag_bytemaps_;
   };
 
+  /**
+   * Appends to `range_idx` the indices of the ranges in `ranges` that
+   * overlap `mbr`, given the indices of the ranges sorted on their start.
+   */
+  typedef void (*SweepRangesFunc)(
+      const std::vector<Range>& ranges,
+      const std::vector<uint64_t>& sorted_idx,
+      const Range& mbr,
+      std::vector<uint64_t>* range_idx);
+
   /**
    * An opaque context to be used between successive calls
    * to `compute_relevant_fragment_tile_overlap`.
@@ -1012,7 +1022,8 @@ class Subarray {
   struct ComputeRelevantTileOverlapCtx {
     ComputeRelevantTileOverlapCtx()
         : range_idx_offset_(0)
-        , range_len_(0) {
+        , range_len_(0)
+        , sweep_prepared_(false) {
     }
 
     /**
@@ -1024,6 +1035,21 @@ class Subarray {
 
     /** The number of ranges. */
     uint64_t range_len_;
+
+    /** True once the sweep state below has been computed. */
+    bool sweep_prepared_;
+
+    /**
+     * For each dimension, the indices of its ranges sorted on their start.
+     * Empty if the ranges cannot be swept against the tile MBRs.
+     */
+    std::vector<std::vector<uint64_t>> sorted_range_idx_;
+
+    /**
+     * For each dimension, the function finding its ranges that overlap an
+     * MBR, or `nullptr` for dimensions with a default range.
+     */
+    std::vector<SweepRangesFunc> sweep_funcs_;
   };
 
   /* ********************************* */
@@ -1256,6 +1282,61 @@ class Subarray {
       SubarrayTileOverlap* tile_overlap,
       ComputeRelevantTileOverlapCtx* fn_ctx);
 
+  /**
+   * Prepares the sweep state of `fn_ctx`, used to compute the tile overlap
+   * of many ranges with a sparse fragment in a single pass over its tile
+   * MBRs. The ranges can be swept if all dimensions with non-default ranges
+   * are fixed-sized and the ranges of each dimension are disjoint.
+   *
+   * @param fn_ctx The context whose sweep state is prepared.
+   */
+  void prepare_tile_overlap_sweep(ComputeRelevantTileOverlapCtx* fn_ctx) const;
+
+  /**
+   * Sorts the indices of the input ranges on the range start.
+   *
+   * @tparam T The dimension datatype.
+   * @param ranges The ranges of a dimension.
+   * @param sorted_idx Set to the sorted range indices.
+   * @return `false` if any two ranges overlap, `true` otherwise.
+   */
+  template <class T>
+  static bool sort_ranges_for_sweep(
+      const std::vector<Range>& ranges, std::vector<uint64_t>* sorted_idx);
+
+  /**
+   * Finds the ranges that overlap `mbr` with binary searches on the
+   * sorted, disjoint ranges. See `SweepRangesFunc`.
+   *
+   * @tparam T The dimension datatype.
+   */
+  template <class T>
+  static void sweep_ranges(
+      const std::vector<Range>& ranges,
+      const std::vector<uint64_t>& sorted_idx,
+      const Range& mbr,
+      std::vector<uint64_t>* range_idx);
+
+  /**
+   * Computes the tile overlap of the current ranges of `fn_ctx` with a
+   * sparse fragment by sweeping the tile MBRs against the sorted ranges of
+   * each dimension, rather than querying the R-tree once per range. This
+   * is faster when there are more ranges than tiles.
+   *
+   * @param meta The fragment metadata to focus on.
+   * @param frag_idx The fragment id.
+   * @param compute_tp The thread pool for compute-bound tasks.
+   * @param tile_overlap Mutated to store the computed tile overlap.
+   * @param fn_ctx The context with the prepared sweep state.
+   * @return Status
+   */
+  Status compute_relevant_fragment_tile_overlap_sweep(
+      shared_ptr<FragmentMetadata> meta,
+      unsigned frag_idx,
+      ThreadPool* compute_tp,
+      SubarrayTileOverlap* tile_overlap,
+      ComputeRelevantTileOverlapCtx* fn_ctx);
+
   /**
    * Load the var-sized tile sizes for the input names and from the
    * relevant fragments.
@@ -33,9 +33,12 @@
 #ifndef TILEDB_FILTERED_BUFFER_H
 #define TILEDB_FILTERED_BUFFER_H
 
+#include <cstring>
 #include <vector>
 
+#include "tiledb/common/common.h"
 #include "tiledb/common/status.h"
+#include "tiledb/sm/tile/tile_buffer_pool.h"
 
 using namespace tiledb::common;
 
@@ -51,7 +54,11 @@ class FilteredBuffer {
   /*     CONSTRUCTORS & DESTRUCTORS    */
   /* ********************************* */
 
-  FilteredBuffer(uint64_t size) {
+  FilteredBuffer(uint64_t size)
+      : view_data_(nullptr)
+      , view_size_(0)
+      , pool_(nullptr)
+      , pool_capacity_(0) {
     if (size != 0) {
       filtered_buffer_.resize(size);
     }
@@ -61,18 +68,31 @@ class FilteredBuffer {
    * Copy constructor.
    *
    * Only used in the tile cache. Should be removed when the tile cache is
-   * removed.
+   * removed. A view is copied to owned storage.
    */
-  FilteredBuffer(const FilteredBuffer& other) {
-    filtered_buffer_ = other.filtered_buffer_;
+  FilteredBuffer(const FilteredBuffer& other)
+      : view_data_(nullptr)
+      , view_size_(0)
+      , pool_(nullptr)
+      , pool_capacity_(0) {
+    filtered_buffer_.assign(other.data(), other.data() + other.size());
   }
 
   /** Move constructor. */
-  FilteredBuffer(FilteredBuffer&& other) {
+  FilteredBuffer(FilteredBuffer&& other)
+      : view_data_(nullptr)
+      , view_size_(0)
+      , pool_(nullptr)
+      , pool_capacity_(0) {
     // Swap with the argument
     swap(other);
   }
 
+  /** Destructor. Returns a pooled buffer to its pool. */
+  ~FilteredBuffer() {
+    release_pooled();
+  }
+
   /** Move-assign operator. */
   FilteredBuffer& operator=(FilteredBuffer&& other) {
     // Swap with the argument
@@ -89,42 +109,107 @@ class FilteredBuffer {
 
   /** Returns the size. */
   inline size_t size() const {
-    return filtered_buffer_.size();
+    return view_data_ != nullptr ? view_size_ : filtered_buffer_.size();
   }
 
   /** Returns the data. */
   inline char* data() {
-    return filtered_buffer_.data();
+    return view_data_ != nullptr ? view_data_ : filtered_buffer_.data();
   }
 
   /** Returns the data. */
   inline const char* data() const {
-    return filtered_buffer_.data();
+    return view_data_ != nullptr ? view_data_ : filtered_buffer_.data();
   }
 
   /** Returns the data casted as a type. */
   template <class T>
   inline T* data_as() {
-    return static_cast<T*>(static_cast<void*>(filtered_buffer_.data()));
+    return static_cast<T*>(static_cast<void*>(data()));
   }
 
   /** Converts the data at an offset to a specific type. */
   template <class T>
   inline T value_at_as(uint64_t offset) const {
-    assert(offset + sizeof(T) <= filtered_buffer_.size());
-    return *static_cast<const T*>(
-        static_cast<const void*>(&filtered_buffer_.data()[offset]));
+    assert(offset + sizeof(T) <= size());
+    return *static_cast<const T*>(static_cast<const void*>(&data()[offset]));
   }
 
   /** Expands the size of the underlying container. */
   inline void expand(size_t size) {
+    assert(view_data_ == nullptr);
     assert(size >= filtered_buffer_.size());
     filtered_buffer_.resize(size);
   }
 
+  /**
+   * Expands the size of the buffer, storing the data in a buffer from
+   * `pool` if the buffer is empty.
+   *
+   * @param size The new size.
+   * @param pool The pool to acquire the buffer from, or `nullptr` to
+   *     expand the underlying container.
+   * @return Status.
+   */
+  inline Status expand(size_t size, TileBufferPool* pool) {
+    assert(view_data_ == nullptr || pool_ != nullptr);
+
+    // A pooled buffer keeps growing from its own pool.
+    if (pool_ != nullptr)
+      pool = pool_;
+
+    if (pool == nullptr ||
+        (pool_ == nullptr && (size == 0 || !filtered_buffer_.empty()))) {
+      expand(size);
+      return Status::Ok();
+    }
+
+    assert(size >= this->size());
+    if (pool_ == nullptr || size > pool_capacity_) {
+      auto [data, capacity] = pool->acquire(size);
+      if (data == nullptr)
+        return Status_TileError(
+            "Cannot expand filtered buffer; Memory allocation failed");
+      if (pool_ != nullptr)
+        memcpy(data, view_data_, view_size_);
+      release_pooled();
+      pool_ = pool;
+      pool_capacity_ = capacity;
+      view_data_ = data;
+    }
+    view_size_ = size;
+
+    return Status::Ok();
+  }
+
   /** Clears the data. */
   inline void clear() {
+    release_pooled();
+    filtered_buffer_.clear();
+    view_data_ = nullptr;
+    view_size_ = 0;
+    view_owner_.reset();
+  }
+
+  /**
+   * Makes the buffer a view of memory it does not own, such as the pages of
+   * a memory-mapped file, instead of storing the data itself.
+   *
+   * @param data The viewed data.
+   * @param size The size of the viewed data.
+   * @param owner Keeps the viewed data alive as long as it is viewed.
+   */
+  inline void set_view(char* data, size_t size, shared_ptr<void> owner) {
+    release_pooled();
     filtered_buffer_.clear();
+    view_data_ = data;
+    view_size_ = size;
+    view_owner_ = std::move(owner);
+  }
+
+  /** Returns `true` if the buffer is a view of memory it does not own. */
+  inline bool is_view() const {
+    return view_data_ != nullptr && pool_ == nullptr;
   }
 
   /**
@@ -133,6 +218,11 @@ class FilteredBuffer {
    */
   void swap(FilteredBuffer& other) {
     std::swap(filtered_buffer_, other.filtered_buffer_);
+    std::swap(view_data_, other.view_data_);
+    std::swap(view_size_, other.view_size_);
+    std::swap(view_owner_, other.view_owner_);
+    std::swap(pool_, other.pool_);
+    std::swap(pool_capacity_, other.pool_capacity_);
   }
 
  private:
@@ -142,6 +232,39 @@ class FilteredBuffer {
 
   /** Storing container for the filtered buffer. */
   std::vector<char> filtered_buffer_;
+
+  /** The viewed data, `nullptr` if the buffer stores its own data. */
+  char* view_data_;
+
+  /** The size of the viewed data. */
+  size_t view_size_;
+
+  /** Keeps the viewed data alive. */
+  shared_ptr<void> view_owner_;
+
+  /**
+   * The pool the data was acquired from, `nullptr` if it is not pooled. A
+   * pooled buffer is stored in `view_data_` and `view_size_`.
+   */
+  TileBufferPool* pool_;
+
+  /** The capacity of the pooled buffer. */
+  uint64_t pool_capacity_;
+
+  /* ********************************* */
+  /*          PRIVATE METHODS          */
+  /* ********************************* */
+
+  /** Returns a pooled buffer to its pool. */
+  inline void release_pooled() {
+    if (pool_ != nullptr) {
+      pool_->release(view_data_, pool_capacity_);
+      pool_ = nullptr;
+      pool_capacity_ = 0;
+      view_data_ = nullptr;
+      view_size_ = 0;
+    }
+  }
 };
 
 }  // namespace sm
@@ -84,6 +84,8 @@ void Tile::set_max_tile_chunk_size(uint64_t max_tile_chunk_size) {
 
 Tile::Tile()
     : data_(nullptr, tiledb_free)
+    , pool_(nullptr)
+    , pool_capacity_(0)
     , size_(0)
     , cell_size_(0)
     , zipped_coords_dim_num_(0)
@@ -99,6 +101,8 @@ Tile::Tile(
     void* const buffer,
     uint64_t size)
     : data_(static_cast<char*>(buffer), nop_free)
+    , pool_(nullptr)
+    , pool_capacity_(0)
     , size_(size)
     , cell_size_(cell_size)
     , zipped_coords_dim_num_(zipped_coords_dim_num)
@@ -113,6 +117,10 @@ Tile::Tile(Tile&& tile)
   swap(tile);
 }
 
+Tile::~Tile() {
+  release_pooled_data();
+}
+
 Tile& Tile::operator=(Tile&& tile) {
   // Swap with the argument
   swap(tile);
@@ -140,13 +148,12 @@ Status Tile::init_unfiltered(
   type_ = type;
   format_version_ = format_version;
 
+  clear_data();
   if (tile_size > 0) {
     data_.reset(static_cast<char*>(tdb_malloc(tile_size)));
     if (data_ == nullptr)
       return LOG_STATUS(
           Status_TileError("Cannot initialize tile; Buffer allocation failed"));
-  } else {
-    data_ = nullptr;
   }
 
   if (fill_with_zeros && tile_size > 0) {
@@ -172,12 +179,40 @@ Status Tile::init_filtered(
 }
 
 void Tile::clear_data() {
+  release_pooled_data();
+
+  // Views do not own their data; reset the deleter for the next allocation.
+  if (data_owner_ != nullptr) {
+    data_ = std::unique_ptr<char, void (*)(void*)>(nullptr, tiledb_free);
+    data_owner_.reset();
+  }
   data_ = nullptr;
   size_ = 0;
 }
 
-Status Tile::alloc_data(uint64_t size) {
+void Tile::set_data_view(
+    char* const data, const uint64_t size, shared_ptr<void> owner) {
+  release_pooled_data();
+  data_ = std::unique_ptr<char, void (*)(void*)>(data, nop_free);
+  data_owner_ = std::move(owner);
+  size_ = size;
+}
+
+Status Tile::alloc_data(uint64_t size, TileBufferPool* const pool) {
   assert(data_ == nullptr);
+  if (pool != nullptr && size > 0) {
+    auto [data, capacity] = pool->acquire(size);
+    if (data == nullptr) {
+      return LOG_STATUS(
+          Status_TileError("Cannot allocate buffer; Memory allocation failed"));
+    }
+    data_ = std::unique_ptr<char, void (*)(void*)>(data, nop_free);
+    pool_ = pool;
+    pool_capacity_ = capacity;
+    size_ = size;
+    return Status::Ok();
+  }
+
   data_.reset(static_cast<char*>(tdb_malloc(size)));
   if (data_ == nullptr) {
     return LOG_STATUS(
@@ -223,12 +258,22 @@ Status Tile::write_var(const void* data, uint64_t offset, uint64_t nbytes) {
     while (new_alloc_size < offset + nbytes)
       new_alloc_size *= 2;
 
-    auto new_data =
-        static_cast<char*>(tdb_realloc(data_.release(), new_alloc_size));
+    // A view or pooled data cannot be reallocated, copy it to an allocated
+    // buffer.
+    char* new_data = nullptr;
+    if (data_owner_ != nullptr || pool_ != nullptr) {
+      new_data = static_cast<char*>(tdb_malloc(new_alloc_size));
+      if (new_data != nullptr)
+        std::memcpy(new_data, data_.get(), size_);
+    } else {
+      new_data =
+          static_cast<char*>(tdb_realloc(data_.release(), new_alloc_size));
+    }
     if (new_data == nullptr) {
       return LOG_STATUS(Status_TileError(
           "Cannot reallocate buffer; Memory allocation failed"));
     }
+    clear_data();
     data_.reset(new_data);
     size_ = new_alloc_size;
   }
@@ -271,11 +316,27 @@ void Tile::swap(Tile& tile) {
   std::swap(filtered_buffer_, tile.filtered_buffer_);
   std::swap(size_, tile.size_);
   std::swap(data_, tile.data_);
+  std::swap(data_owner_, tile.data_owner_);
+  std::swap(pool_, tile.pool_);
+  std::swap(pool_capacity_, tile.pool_capacity_);
   std::swap(cell_size_, tile.cell_size_);
   std::swap(zipped_coords_dim_num_, tile.zipped_coords_dim_num_);
   std::swap(format_version_, tile.format_version_);
   std::swap(type_, tile.type_);
 }
 
+/* ****************************** */
+/*         PRIVATE METHODS        */
+/* ****************************** */
+
+void Tile::release_pooled_data() {
+  if (pool_ != nullptr) {
+    pool_->release(data_.release(), pool_capacity_);
+    data_ = std::unique_ptr<char, void (*)(void*)>(nullptr, tiledb_free);
+    pool_ = nullptr;
+    pool_capacity_ = 0;
+  }
+}
+
 }  // namespace sm
 }  // namespace tiledb
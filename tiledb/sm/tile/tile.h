@@ -103,6 +103,9 @@ class Tile {
   /** Move constructor. */
   Tile(Tile&& tile);
 
+  /** Destructor. Returns a pooled buffer to its pool. */
+  ~Tile();
+
   /** Move-assign operator. */
   Tile& operator=(Tile&& tile);
 
@@ -175,13 +178,25 @@ class Tile {
   /** Clears the internal buffer. */
   void clear_data();
 
+  /**
+   * Makes the tile data a view of memory it does not own, such as the pages
+   * of a memory-mapped file, instead of an allocated buffer.
+   *
+   * @param data The viewed data.
+   * @param size The size of the viewed data.
+   * @param owner Keeps the viewed data alive as long as it is viewed.
+   */
+  void set_data_view(char* data, uint64_t size, shared_ptr<void> owner);
+
   /**
    * Allocate the internal buffer.
    *
    * @param size New size.
+   * @param pool The pool to acquire the buffer from, `nullptr` to allocate
+   *     it. A pooled buffer returns to the pool when the data is cleared.
    * @return Status.
    */
-  Status alloc_data(uint64_t size);
+  Status alloc_data(uint64_t size, TileBufferPool* pool = nullptr);
 
   /** Returns the cell size. */
   inline uint64_t cell_size() const {
@@ -288,6 +303,15 @@ class Tile {
    */
   std::unique_ptr<char, void (*)(void*)> data_;
 
+  /** Keeps the data alive if it is a view set with `set_data_view`. */
+  shared_ptr<void> data_owner_;
+
+  /** The pool the data was acquired from, `nullptr` if it is not pooled. */
+  TileBufferPool* pool_;
+
+  /** The capacity of the pooled data. */
+  uint64_t pool_capacity_;
+
   /** Size of the data. */
   uint64_t size_;
 
@@ -319,6 +343,13 @@ class Tile {
    * to override the value in tests.
    */
   static uint64_t max_tile_chunk_size_;
+
+  /* ********************************* */
+  /*          PRIVATE METHODS          */
+  /* ********************************* */
+
+  /** Returns pooled data to its pool. */
+  void release_pooled_data();
 };
 
 }  // namespace sm
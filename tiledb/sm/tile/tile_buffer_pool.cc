@@ -0,0 +1,149 @@
+/**
+ * @file   tile_buffer_pool.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2017-2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file implements class TileBufferPool.
+ */
+
+#include "tiledb/sm/tile/tile_buffer_pool.h"
+#include "tiledb/common/heap_memory.h"
+
+#include <cassert>
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+/* ****************************** */
+/*    CONSTRUCTORS & DESTRUCTORS  */
+/* ****************************** */
+
+TileBufferPool::TileBufferPool(
+    stats::Stats* const parent_stats, const uint64_t max_size)
+    : stats_(parent_stats->create_child("TileBufferPool"))
+    , max_size_(max_size)
+    , size_(0)
+    , hit_num_stat_(stats_->register_stat("hit_num"))
+    , miss_num_stat_(stats_->register_stat("miss_num"))
+    , recycled_num_stat_(stats_->register_stat("recycled_num"))
+    , dropped_num_stat_(stats_->register_stat("dropped_num")) {
+}
+
+TileBufferPool::~TileBufferPool() {
+  for (auto& size_class : classes_) {
+    for (auto data : size_class.free_)
+      tdb_free(data);
+  }
+}
+
+/* ****************************** */
+/*               API              */
+/* ****************************** */
+
+std::pair<char*, uint64_t> TileBufferPool::acquire(const uint64_t size) {
+  if (!pooled(size))
+    return {static_cast<char*>(tdb_malloc(size)), size};
+
+  const unsigned idx = class_idx(size);
+  const uint64_t capacity = class_capacity(idx);
+  {
+    auto& size_class = classes_[idx];
+    std::lock_guard<std::mutex> lg(size_class.mtx_);
+    if (!size_class.free_.empty()) {
+      char* const data = size_class.free_.back();
+      size_class.free_.pop_back();
+      size_ -= capacity;
+      stats_->add_counter(hit_num_stat_, 1);
+      return {data, capacity};
+    }
+  }
+
+  stats_->add_counter(miss_num_stat_, 1);
+  return {static_cast<char*>(tdb_malloc(capacity)), capacity};
+}
+
+void TileBufferPool::release(char* const data, const uint64_t capacity) {
+  if (data == nullptr)
+    return;
+
+  // Buffers allocated outside of the size classes are freed directly.
+  if (!pooled(capacity) || class_capacity(class_idx(capacity)) != capacity) {
+    tdb_free(data);
+    return;
+  }
+
+  // Free the buffer if the pool is full.
+  if (size_.fetch_add(capacity) + capacity > max_size_) {
+    size_ -= capacity;
+    stats_->add_counter(dropped_num_stat_, 1);
+    tdb_free(data);
+    return;
+  }
+
+  auto& size_class = classes_[class_idx(capacity)];
+  std::lock_guard<std::mutex> lg(size_class.mtx_);
+  size_class.free_.push_back(data);
+  stats_->add_counter(recycled_num_stat_, 1);
+}
+
+uint64_t TileBufferPool::size() const {
+  return size_;
+}
+
+/* ****************************** */
+/*         PRIVATE METHODS        */
+/* ****************************** */
+
+unsigned TileBufferPool::class_idx(const uint64_t size) {
+  assert(pooled(size));
+
+  // With `2^log2 <= size - 1 < 2^(log2 + 1)`, the classes of this power of
+  // two are `2^log2 + (sub + 1) * 2^log2 / class_per_log2`.
+  const uint64_t s = size - 1;
+  unsigned log2 = 0;
+  while ((s >> (log2 + 1)) != 0)
+    ++log2;
+  const unsigned sub = (s >> (log2 - 2)) & (class_per_log2 - 1);
+
+  return (log2 - min_pooled_log2) * class_per_log2 + sub;
+}
+
+uint64_t TileBufferPool::class_capacity(const unsigned idx) {
+  const unsigned log2 = min_pooled_log2 + idx / class_per_log2;
+  const unsigned sub = idx % class_per_log2;
+  return (uint64_t(1) << log2) + (sub + 1) * (uint64_t(1) << (log2 - 2));
+}
+
+bool TileBufferPool::pooled(const uint64_t size) {
+  return size > (uint64_t(1) << min_pooled_log2) &&
+         size <= (uint64_t(1) << max_pooled_log2);
+}
+
+}  // namespace sm
+}  // namespace tiledb
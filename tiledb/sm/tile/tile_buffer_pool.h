@@ -0,0 +1,190 @@
+/**
+ * @file   tile_buffer_pool.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2017-2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class TileBufferPool.
+ */
+
+#ifndef TILEDB_TILE_BUFFER_POOL_H
+#define TILEDB_TILE_BUFFER_POOL_H
+
+#include "tiledb/common/macros.h"
+#include "tiledb/sm/stats/stats.h"
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+/**
+ * Recycles the buffers of tiles across the queries of a context, to save
+ * the allocations, frees and page faults of the buffers of every tile
+ * read.
+ *
+ * Buffer sizes are rounded up to size classes, four per power of two, so
+ * that a released buffer can serve any later request of the same class.
+ * Released buffers are kept in per-class free lists until their total
+ * byte size reaches the pool capacity; past it they are freed. Sizes
+ * outside of the pooled range are allocated and freed directly.
+ *
+ * This class is thread-safe.
+ */
+class TileBufferPool {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /**
+   * Constructor.
+   *
+   * @param parent_stats The parent stats of the pool stats.
+   * @param max_size The maximum total byte size of the released buffers
+   *     kept for reuse.
+   */
+  TileBufferPool(stats::Stats* parent_stats, uint64_t max_size);
+
+  /** Destructor. Frees the buffers kept for reuse. */
+  ~TileBufferPool();
+
+  DISABLE_COPY_AND_COPY_ASSIGN(TileBufferPool);
+  DISABLE_MOVE_AND_MOVE_ASSIGN(TileBufferPool);
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /**
+   * Returns a buffer of at least `size` bytes, reusing a released buffer
+   * of the same size class if any.
+   *
+   * @param size The requested byte size.
+   * @return The buffer, `nullptr` if the allocation failed, and its
+   *     capacity, to pass back to `release`.
+   */
+  std::pair<char*, uint64_t> acquire(uint64_t size);
+
+  /**
+   * Releases a buffer returned by `acquire`, keeping it for reuse if the
+   * pool has room for it.
+   *
+   * @param data The buffer, may be `nullptr`.
+   * @param capacity The capacity returned by `acquire` with the buffer.
+   */
+  void release(char* data, uint64_t capacity);
+
+  /** Returns the total byte size of the buffers kept for reuse. */
+  uint64_t size() const;
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE CONSTANTS         */
+  /* ********************************* */
+
+  /** Log2 of the smallest pooled power of two. Smaller buffers are
+   * allocated directly, malloc is cheap enough for them. */
+  static constexpr unsigned min_pooled_log2 = 11;
+
+  /** Log2 of the largest pooled size. */
+  static constexpr unsigned max_pooled_log2 = 30;
+
+  /** The number of size classes per power of two. */
+  static constexpr unsigned class_per_log2 = 4;
+
+  /** The number of size classes. */
+  static constexpr unsigned class_num =
+      (max_pooled_log2 - min_pooled_log2) * class_per_log2;
+
+  /* ********************************* */
+  /*         PRIVATE DATATYPES         */
+  /* ********************************* */
+
+  /** The released buffers of a size class. */
+  struct SizeClass {
+    /** Protects `free_`. */
+    std::mutex mtx_;
+
+    /** The released buffers, reused in LIFO order. */
+    std::vector<char*> free_;
+  };
+
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** The class stats. */
+  stats::Stats* stats_;
+
+  /** The maximum total byte size of the buffers kept for reuse. */
+  const uint64_t max_size_;
+
+  /** The total byte size of the buffers kept for reuse. */
+  std::atomic<uint64_t> size_;
+
+  /** The size classes. */
+  std::array<SizeClass, class_num> classes_;
+
+  /** The stat of the acquisitions served by a released buffer. */
+  stats::StatId hit_num_stat_;
+
+  /** The stat of the acquisitions of pooled sizes that allocated. */
+  stats::StatId miss_num_stat_;
+
+  /** The stat of the releases kept for reuse. */
+  stats::StatId recycled_num_stat_;
+
+  /** The stat of the releases freed because the pool was full. */
+  stats::StatId dropped_num_stat_;
+
+  /* ********************************* */
+  /*          PRIVATE METHODS          */
+  /* ********************************* */
+
+  /**
+   * Returns the index of the smallest size class holding `size` bytes.
+   * `size` must be within the pooled range.
+   */
+  static unsigned class_idx(uint64_t size);
+
+  /** Returns the capacity of the buffers of a size class. */
+  static uint64_t class_capacity(unsigned idx);
+
+  /** Returns `true` if `size` is within the pooled range. */
+  static bool pooled(uint64_t size);
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_TILE_BUFFER_POOL_H